@@ -63,6 +63,7 @@ endmacro()
 set_and_mark_depnames_advncd(assets_prefix "af_assets")
 set_and_mark_depnames_advncd(testdata_prefix "af_test_data")
 set_and_mark_depnames_advncd(gtest_prefix "googletest")
+set_and_mark_depnames_advncd(gbench_prefix "googlebenchmark")
 set_and_mark_depnames_advncd(glad_prefix "af_glad")
 set_and_mark_depnames_advncd(forge_prefix "af_forge")
 set_and_mark_depnames_advncd(spdlog_prefix "spdlog")
@@ -1675,6 +1675,9 @@ extern "C" {
 #if AF_API_VERSION >= 34
     /**
        Evaluate multiple arrays together
+
+       The arrays may have different types and sizes. Backends that cannot
+       evaluate them together evaluate them one at a time.
     */
     AFAPI af_err af_eval_multiple(const int num, af_array *arrays);
 #endif
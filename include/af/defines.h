@@ -547,6 +547,34 @@ typedef enum {
 } af_conv_gradient_type;
 #endif
 
+#if AF_API_VERSION >= 310
+typedef enum {
+    AF_BILATERAL_EXACT         = 1, ///< Brute force evaluation of the filter window
+    AF_BILATERAL_GRID          = 2, ///< Bilateral grid approximation, channels are filtered independently
+    AF_BILATERAL_PERMUTOHEDRAL = 3, ///< Permutohedral lattice approximation, colour images use the joint colour distance
+    AF_BILATERAL_DEFAULT       = 0  ///< Default is AF_BILATERAL_EXACT
+} af_bilateral_method;
+#endif
+
+#if AF_API_VERSION >= 310
+typedef enum {
+    AF_MEANSHIFT_EXACT   = 1, ///< Compares the exact colours of every window pixel
+    AF_MEANSHIFT_BINNED  = 2, ///< Compares quantized colours, bins are a quarter of the chromatic sigma wide
+    AF_MEANSHIFT_DEFAULT = 0  ///< Default is AF_MEANSHIFT_EXACT
+} af_meanshift_method;
+#endif
+
+#if AF_API_VERSION >= 310
+typedef enum {
+    AF_QUANTILE_LINEAR   = 1, ///< Linear interpolation between the two closest ranks
+    AF_QUANTILE_LOWER    = 2, ///< Value of the lower of the two closest ranks
+    AF_QUANTILE_HIGHER   = 3, ///< Value of the higher of the two closest ranks
+    AF_QUANTILE_NEAREST  = 4, ///< Value of the closest rank, ties go to the even rank
+    AF_QUANTILE_MIDPOINT = 5, ///< Mean of the values of the two closest ranks
+    AF_QUANTILE_DEFAULT  = 0  ///< Default is AF_QUANTILE_LINEAR
+} af_quantile_method;
+#endif
+
 #ifdef __cplusplus
 namespace af
 {
@@ -602,6 +630,11 @@ namespace af
     typedef af_inverse_deconv_algo inverseDeconvAlgo;
     typedef af_conv_gradient_type convGradientType;
 #endif
+#if AF_API_VERSION >= 310
+    typedef af_bilateral_method bilateralMethod;
+    typedef af_meanshift_method meanShiftMethod;
+    typedef af_quantile_method quantileMethod;
+#endif
 }
 
 #endif
@@ -157,6 +157,59 @@ AFAPI void saveImageNative(const char* filename, const array& in);
 AFAPI bool isImageIOAvailable();
 #endif
 
+#if AF_API_VERSION >= 310
+/**
+    C++ Interface for loading a batch of images
+
+    The images are decoded in parallel and stacked along the fourth dimension
+    of the result. All images must have the same width and height.
+
+    \param[in] filenames is an array of \p count file names
+    \param[in] count is the number of images to load
+    \param[in] is_color boolean denoting if the images should be loaded as 1
+    channel or 3 channel. Alpha channels are dropped.
+    \return images loaded as an \ref af::array() of size height x width x
+    channels x \p count
+
+    \ingroup imageio_func_load_batch
+*/
+AFAPI array loadImages(const char* const* filenames, const unsigned count,
+                       const bool is_color = false);
+
+/**
+    C++ Interface for loading a batch of images from memory
+
+    \param[in] ptrs is an array of \p count distinct FIMEMORY pointers, see
+    \ref loadImageMem
+    \param[in] count is the number of images to load
+    \param[in] is_color boolean denoting if the images should be loaded as 1
+    channel or 3 channel. Alpha channels are dropped.
+    \return images loaded as an \ref af::array() of size height x width x
+    channels x \p count
+
+    \ingroup imageio_func_load_batch
+*/
+AFAPI array loadImagesMem(const void* const* ptrs, const unsigned count,
+                          const bool is_color = false);
+
+/**
+    C++ Interface for saving a batch of images
+
+    Every image along the fourth dimension of \p in is saved to the file of
+    the same index in \p filenames. The images are scaled the same way as
+    \ref saveImage does and are encoded in parallel.
+
+    \param[in] filenames is an array of \p count file names
+    \param[in] count is the number of images to save. Must match the fourth
+    dimension of \p in
+    \param[in] in is the array of images to be saved
+
+    \ingroup imageio_func_save_batch
+*/
+AFAPI void saveImages(const char* const* filenames, const unsigned count,
+                      const array& in);
+#endif
+
 /**
     C++ Interface for resizing an image to specified dimensions
 
@@ -238,6 +291,26 @@ AFAPI array transform(const array& in, const array& transform, const dim_t odim0
 AFAPI array transformCoordinates(const array& tf, const float d0, const float d1);
 #endif
 
+#if AF_API_VERSION >= 310
+/**
+    C++ Interface for sampling an image at precomputed positions
+
+    \param[in] in is input image
+    \param[in] mapX holds the position along the first dimension of \p in
+                for every output pixel
+    \param[in] mapY holds the position along the second dimension of \p in
+                for every output pixel
+    \param[in] method is the interpolation type (Nearest by default)
+    \return the remapped image
+
+    \note Only supported on the CPU backend
+
+    \ingroup transform_func_remap
+*/
+AFAPI array remap(const array& in, const array& mapX, const array& mapY,
+                  const interpType method=AF_INTERP_NEAREST);
+#endif
+
 /**
     C++ Interface for translating an image
 
@@ -297,6 +370,25 @@ AFAPI array skew(const array& in, const float skew0, const float skew1, const di
 */
 AFAPI array bilateral(const array &in, const float spatial_sigma, const float chromatic_sigma, const bool is_color=false);
 
+#if AF_API_VERSION >= 310
+/**
+    C++ Interface for bilateral filter with a selectable algorithm
+
+    \param[in]  in array is the input image
+    \param[in]  spatial_sigma is the spatial variance parameter that decides the filter window
+    \param[in]  chromatic_sigma is the chromatic variance parameter
+    \param[in]  is_color indicates if the input \p in is color image or grayscale
+    \param[in]  method selects the exact filter or one of the approximations
+    \return     the processed image
+
+    \note \ref AF_BILATERAL_GRID and \ref AF_BILATERAL_PERMUTOHEDRAL are only
+          available on the CPU backend.
+
+    \ingroup image_func_bilateral
+*/
+AFAPI array bilateral(const array &in, const float spatial_sigma, const float chromatic_sigma, const bool is_color, const bilateralMethod method);
+#endif
+
 /**
    C++ Interface for histogram
 
@@ -339,6 +431,25 @@ AFAPI array histogram(const array &in, const unsigned nbins);
 */
 AFAPI array meanShift(const array& in, const float spatial_sigma, const float chromatic_sigma, const unsigned iter, const bool is_color=false);
 
+#if AF_API_VERSION >= 310
+/**
+    C++ Interface for mean shift with a selectable range test
+
+    \param[in]  in array is the input image
+    \param[in]  spatial_sigma is the spatial variance parameter that decides the filter window
+    \param[in]  chromatic_sigma is the chromatic variance parameter
+    \param[in]  iter is the number of iterations filter operation is performed
+    \param[in]  is_color indicates if the input \p in is color image or grayscale
+    \param[in]  method selects the exact range test or the binned approximation
+    \return     the processed image
+
+    \note \ref AF_MEANSHIFT_BINNED is only available on the CPU backend.
+
+    \ingroup image_func_mean_shift
+*/
+AFAPI array meanShift(const array& in, const float spatial_sigma, const float chromatic_sigma, const unsigned iter, const bool is_color, const meanShiftMethod method);
+#endif
+
 /**
     C++ Interface for minimum filter
 
@@ -780,6 +891,32 @@ AFAPI array anisotropicDiffusion(const af::array& in, const float timestep,
 AFAPI array iterativeDeconv(const array& in, const array& ker,
                             const unsigned iterations, const float relaxFactor,
                             const iterativeDeconvAlgo algo);
+#endif
+
+#if AF_API_VERSION >= 310
+/**
+  C++ Interface for Iterative deconvolution algorithm with early stopping
+
+  \param[in] in is the blurred input image
+  \param[in] ker is the kernel(point spread function) known to have caused
+             the blur in the system
+  \param[in] iterations is the maximum number of iterations the algorithm
+             will run
+  \param[in] relaxFactor is the relaxation factor multiplied with distance
+             of estimate from observed image.
+  \param[in] algo takes value of type enum \ref af_iterative_deconv_algo
+             indicating the iterative deconvolution algorithm to be used
+  \param[in] tolerance stops the iterations once the relative change of the
+             estimate in one iteration is at most this value. Zero always
+             runs all \p iterations.
+  \return sharp image estimate generated from the blurred input
+
+  \ingroup image_func_iterative_deconv
+ */
+AFAPI array iterativeDeconv(const array& in, const array& ker,
+                            const unsigned iterations, const float relaxFactor,
+                            const iterativeDeconvAlgo algo,
+                            const float tolerance);
 
 /**
    C++ Interface for Tikhonov deconvolution algorithm
@@ -1026,6 +1163,63 @@ extern "C" {
     AFAPI af_err af_is_image_io_available(bool *out);
 #endif
 
+#if AF_API_VERSION >= 310
+    /**
+        C Interface for loading a batch of images
+
+        The images are decoded in parallel and stacked along the fourth
+        dimension of \p out. All images must have the same width and height.
+
+        \param[out] out will contain the images as a height x width x
+        channels x \p count array
+        \param[in] filenames is an array of \p count file names
+        \param[in] count is the number of images to load
+        \param[in] isColor boolean denoting if the images should be loaded as
+        1 channel or 3 channel. Alpha channels are dropped.
+        \return     \ref AF_SUCCESS if successful
+
+        \ingroup imageio_func_load_batch
+    */
+    AFAPI af_err af_load_images(af_array *out, const char *const *filenames,
+                                const unsigned count, const bool isColor);
+
+    /**
+        C Interface for loading a batch of images from memory
+
+        \param[out] out will contain the images as a height x width x
+        channels x \p count array
+        \param[in] ptrs is an array of \p count distinct FIMEMORY pointers,
+        see \ref af_load_image_memory
+        \param[in] count is the number of images to load
+        \param[in] isColor boolean denoting if the images should be loaded as
+        1 channel or 3 channel. Alpha channels are dropped.
+        \return     \ref AF_SUCCESS if successful
+
+        \ingroup imageio_func_load_batch
+    */
+    AFAPI af_err af_load_images_memory(af_array *out, const void *const *ptrs,
+                                       const unsigned count,
+                                       const bool isColor);
+
+    /**
+        C Interface for saving a batch of images
+
+        Every image along the fourth dimension of \p in is saved to the file
+        of the same index in \p filenames. The images are scaled the same way
+        as \ref af_save_image does and are encoded in parallel.
+
+        \param[in] filenames is an array of \p count file names
+        \param[in] count is the number of images to save. Must match the
+        fourth dimension of \p in
+        \param[in] in is the array of images to be saved
+        \return     \ref AF_SUCCESS if successful
+
+        \ingroup imageio_func_save_batch
+    */
+    AFAPI af_err af_save_images(const char *const *filenames,
+                                const unsigned count, const af_array in);
+#endif
+
     /**
        C Interface for resizing an image to specified dimensions
 
@@ -1106,6 +1300,29 @@ extern "C" {
     AFAPI af_err af_transform_coordinates(af_array *out, const af_array tf, const float d0, const float d1);
 #endif
 
+#if AF_API_VERSION >= 310
+    /**
+       C Interface for sampling an image at precomputed positions
+
+       \param[out] out will contain the image \p in sampled at the
+                   positions in \p map_x and \p map_y
+       \param[in] in is input image
+       \param[in] map_x holds the position along the first dimension of
+                  \p in for every output pixel
+       \param[in] map_y holds the position along the second dimension of
+                  \p in for every output pixel
+       \param[in] method is the interpolation type
+       \return \ref AF_SUCCESS if the remap is successful,
+       otherwise an appropriate error code is returned.
+
+       \note Only supported on the CPU backend
+
+       \ingroup transform_func_remap
+    */
+    AFAPI af_err af_remap(af_array *out, const af_array in, const af_array map_x,
+                          const af_array map_y, const af_interp_type method);
+#endif
+
     /**
        C Interface for rotating an image
 
@@ -1261,6 +1478,27 @@ extern "C" {
     */
     AFAPI af_err af_bilateral(af_array *out, const af_array in, const float spatial_sigma, const float chromatic_sigma, const bool isColor);
 
+#if AF_API_VERSION >= 310
+    /**
+        C Interface for bilateral filter with a selectable algorithm
+
+        \param[out] out array is the processed image
+        \param[in]  in array is the input image
+        \param[in]  spatial_sigma is the spatial variance parameter that decides the filter window
+        \param[in]  chromatic_sigma is the chromatic variance parameter
+        \param[in]  isColor indicates if the input \p in is color image or grayscale
+        \param[in]  method selects the exact filter or one of the approximations
+        \return     \ref AF_SUCCESS if the filter is applied successfully,
+        otherwise an appropriate error code is returned.
+
+        \note \ref AF_BILATERAL_GRID and \ref AF_BILATERAL_PERMUTOHEDRAL are
+              only available on the CPU backend.
+
+        \ingroup image_func_bilateral
+    */
+    AFAPI af_err af_bilateral_v2(af_array *out, const af_array in, const float spatial_sigma, const float chromatic_sigma, const bool isColor, const af_bilateral_method method);
+#endif
+
     /**
         C Interface for mean shift
 
@@ -1277,6 +1515,27 @@ extern "C" {
     */
     AFAPI af_err af_mean_shift(af_array *out, const af_array in, const float spatial_sigma, const float chromatic_sigma, const unsigned iter, const bool is_color);
 
+#if AF_API_VERSION >= 310
+    /**
+        C Interface for mean shift with a selectable range test
+
+        \param[out] out array is the processed image
+        \param[in]  in array is the input image
+        \param[in]  spatial_sigma is the spatial variance parameter that decides the filter window
+        \param[in]  chromatic_sigma is the chromatic variance parameter
+        \param[in]  iter is the number of iterations filter operation is performed
+        \param[in]  is_color indicates if the input \p in is color image or grayscale
+        \param[in]  method selects the exact range test or the binned approximation
+        \return     \ref AF_SUCCESS if the filter is applied successfully,
+        otherwise an appropriate error code is returned.
+
+        \note \ref AF_MEANSHIFT_BINNED is only available on the CPU backend.
+
+        \ingroup image_func_mean_shift
+    */
+    AFAPI af_err af_mean_shift_v2(af_array *out, const af_array in, const float spatial_sigma, const float chromatic_sigma, const unsigned iter, const bool is_color, const af_meanshift_method method);
+#endif
+
     /**
         C Interface for minimum filter
 
@@ -1740,6 +1999,36 @@ extern "C" {
                                      const unsigned iterations,
                                      const float relax_factor,
                                      const af_iterative_deconv_algo algo);
+#endif
+
+#if AF_API_VERSION >= 310
+    /**
+       C Interface for Iterative deconvolution algorithm with early stopping
+
+       \param[out] out is the sharp estimate generated from the blurred input
+       \param[in] in is the blurred input image
+       \param[in] ker is the kernel(point spread function) known to have caused
+                  the blur in the system
+       \param[in] iterations is the maximum number of iterations the
+                  algorithm will run
+       \param[in] relax_factor is the relaxation factor multiplied with
+                  distance of estimate from observed image.
+       \param[in] algo takes value of type enum \ref af_iterative_deconv_algo
+                  indicating the iterative deconvolution algorithm to be used
+       \param[in] tolerance stops the iterations once the relative change of
+                  the estimate in one iteration is at most this value. Zero
+                  always runs all \p iterations.
+       \return \ref AF_SUCCESS if the deconvolution is successful,
+       otherwise an appropriate error code is returned.
+
+       \ingroup image_func_iterative_deconv
+     */
+    AFAPI af_err af_iterative_deconv_v2(af_array* out,
+                                        const af_array in, const af_array ker,
+                                        const unsigned iterations,
+                                        const float relax_factor,
+                                        const af_iterative_deconv_algo algo,
+                                        const float tolerance);
 
     /**
        C Interface for Tikhonov deconvolution algorithm
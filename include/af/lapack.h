@@ -172,6 +172,31 @@ namespace af
     */
     AFAPI int choleskyInPlace(array &in, const bool is_upper = true);
 
+#if AF_API_VERSION >= 310
+    /**
+       C++ Interface to compute the eigenvalues and eigenvectors of a
+       symmetric (Hermitian) matrix.
+
+       Only the triangle selected by `is_upper` is read. Batches of matrices
+       are supported on the CPU backend.
+
+       This function is not supported in GFOR.
+
+       \param[out] values   eigenvalues in ascending order, of the base type
+                            of `in`
+       \param[out] vectors  eigenvectors, column `i` belongs to `values(i)`
+       \param[in]  in       input matrix
+       \param[in]  k        number of largest eigenvalues to compute; `0`
+                            computes all of them
+       \param[in]  is_upper boolean determining if the upper or lower
+                            triangle of `in` is used
+
+       \ingroup lapack_factor_func_eigh
+    */
+    AFAPI void eigh(array &values, array &vectors, const array &in,
+                    const unsigned k = 0, const bool is_upper = true);
+#endif
+
     /**
        C++ Interface to solve a system of equations.
 
@@ -442,6 +467,30 @@ extern "C" {
     */
     AFAPI af_err af_cholesky_inplace(int *info, af_array in, const bool is_upper);
 
+#if AF_API_VERSION >= 310
+    /**
+       C Interface to compute the eigenvalues and eigenvectors of a
+       symmetric (Hermitian) matrix.
+
+       \param[out] values   eigenvalues in ascending order, of the base type
+                            of `in`
+       \param[out] vectors  eigenvectors, column `i` belongs to `values(i)`;
+                            may be NULL to compute the eigenvalues only
+       \param[in]  in       input matrix
+       \param[in]  k        number of largest eigenvalues to compute; `0`
+                            computes all of them
+       \param[in]  is_upper boolean determining if the upper or lower
+                            triangle of `in` is used
+       \return     \ref AF_SUCCESS, if function returns successfully, else
+                   an \ref af_err code is given
+
+       \ingroup lapack_factor_func_eigh
+    */
+    AFAPI af_err af_eigh(af_array *values, af_array *vectors,
+                         const af_array in, const unsigned k,
+                         const bool is_upper);
+#endif
+
     /**
        C Interface to solve a system of equations.
 
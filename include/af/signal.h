@@ -125,6 +125,56 @@ AFAPI array approx2(const array &in,
                     const interpType method = AF_INTERP_LINEAR, const float off_grid = 0.0f);
 #endif
 
+#if AF_API_VERSION >= 310
+/**
+   C++ Interface for preparing one-dimensional signals for repeated
+   interpolation
+
+   Computes the polynomial that approx1() evaluates between each pair of
+   neighboring samples along the first dimension, so that many sets of
+   positions can be interpolated without recomputing them. Interval i covers
+   the samples i and i + 1 and its coefficients, from the constant term up,
+   are rows 4 * i to 4 * i + 3 of the result.
+
+   \param[in] in is the multidimensional input array
+   \param[in] method is \ref AF_INTERP_LINEAR, \ref AF_INTERP_CUBIC or
+              \ref AF_INTERP_CUBIC_SPLINE
+   \returns   the coefficients, with four times as many rows as \p in
+
+   \note Only supported on the CPU backend
+
+   \ingroup signal_func_approx1
+ */
+AFAPI array approx1Prepare(const array &in,
+                           const interpType method = AF_INTERP_CUBIC_SPLINE);
+
+/**
+   C++ Interface for interpolating prepared one-dimensional signals
+
+   Gives the same results as approx1() along the first dimension, with the
+   method passed to approx1Prepare(), up to rounding.
+
+   \param[in] coeffs are the coefficients from approx1Prepare()
+   \param[in] pos are the positions of the interpolation points along the
+              first dimension, either one column shared by all columns or
+              one column per column of the input
+   \param[in] idx_start is the first index value
+   \param[in] idx_step is the uniform spacing value between subsequent
+              indices
+   \param[in] off_grid is the default value for any indices outside the
+              valid range of indices
+   \returns   the interpolated array
+
+   \note Only supported on the CPU backend
+
+   \ingroup signal_func_approx1
+ */
+AFAPI array approx1Prepared(const array &coeffs, const array &pos,
+                            const double idx_start = 0.0,
+                            const double idx_step = 1.0,
+                            const float off_grid = 0.0f);
+#endif
+
 /**
    C++ Interface for fast fourier transform on one dimensional signals
 
@@ -657,6 +707,48 @@ AFAPI array fftConvolve(const array& signal, const array& filter, const convMode
  */
 AFAPI array fftConvolve1(const array& signal, const array& filter, const convMode mode=AF_CONV_DEFAULT);
 
+#if AF_API_VERSION >= 310
+/**
+   C++ Interface for streaming convolution on 1D signals using FFT
+
+   Convolves long signals block by block. \p zf carries the outputs of a
+   block that overlap the next one, so concatenating the outputs of all
+   blocks gives the first samples of the expanded convolution of the whole
+   signal. The final \p zf holds its last len(filter) - 1 samples.
+
+   \param[out] y is the convolved block, with one column per output channel
+   \param[out] zf is the array of the pending outputs, with the same
+               dimensions as \p zi
+   \param[in] signal is the next block of the input signal
+   \param[in] filter is the filter, with at least two coefficients
+   \param[in] zi is the array of pending outputs from the previous block. It
+              has len(filter) - 1 rows and one column per output channel.
+              An empty array starts a new signal.
+
+   \note Only supported on the CPU backend, for f32 and f64 signals
+
+   \ingroup signal_func_convolve1
+ */
+AFAPI void fftConvolve1(array& y, array& zf, const array& signal,
+                        const array& filter, const array& zi);
+
+/**
+   C++ Interface for streaming convolution on 1D signals using FFT, starting
+   a new signal
+
+   \param[out] y is the convolved block
+   \param[out] zf is the array of the pending outputs
+   \param[in] signal is the first block of the input signal
+   \param[in] filter is the filter, with at least two coefficients
+
+   \note Only supported on the CPU backend, for f32 and f64 signals
+
+   \ingroup signal_func_convolve1
+ */
+AFAPI void fftConvolve1(array& y, array& zf, const array& signal,
+                        const array& filter);
+#endif
+
 /**
    C++ Interface for convolution on 2D signals using FFT
 
@@ -706,6 +798,86 @@ AFAPI array fir(const array &b, const array &x);
 */
 AFAPI array iir(const array &b, const array &a, const array &x);
 
+#if AF_API_VERSION >= 310
+/**
+   C++ Interface for infinite impulse response filter with states
+
+   Filters long signals block by block. The final states of one block are
+   the initial states of the next, so the output matches filtering the whole
+   signal at once.
+
+   \param[out] y is the output signal from the filter
+   \param[out] zf is the array of the states after the last sample, with
+               the same dimensions as \p zi
+   \param[in] b is the array containing the feedforward coefficients
+   \param[in] a is the array containing the feedback coefficients. At least
+              one of \p a and \p b must have two or more coefficients.
+   \param[in] x is the input signal to the filter
+   \param[in] zi is the array of initial states. It has max(len(b), len(a))
+              - 1 rows and one column per output channel. An empty array
+              starts from zero states.
+
+   \note Only supported on the CPU backend
+
+   \ingroup signal_func_iir
+*/
+AFAPI void iir(array &y, array &zf, const array &b, const array &a,
+               const array &x, const array &zi);
+
+/**
+   C++ Interface for infinite impulse response filter with states, starting
+   from zero states
+
+   \param[out] y is the output signal from the filter
+   \param[out] zf is the array of the states after the last sample
+   \param[in] b is the array containing the feedforward coefficients
+   \param[in] a is the array containing the feedback coefficients
+   \param[in] x is the input signal to the filter
+
+   \note Only supported on the CPU backend
+
+   \ingroup signal_func_iir
+*/
+AFAPI void iir(array &y, array &zf, const array &b, const array &a,
+               const array &x);
+
+/**
+   C++ Interface for infinite impulse response filter of second order
+   sections
+
+   \param[out] y is the output signal from the filter
+   \param[out] zf is the array of the states after the last sample, with
+               the same dimensions as \p zi
+   \param[in] sos is the 6 x S array of sections. Each column holds b0, b1,
+              b2, a0, a1 and a2 of one section.
+   \param[in] x is the input signal to the filter
+   \param[in] zi is the array of initial states. It has 2 S rows, the two
+              states of every section in order, and one column per channel
+              of \p x. An empty array starts from zero states.
+
+   \note Only supported on the CPU backend
+
+   \ingroup signal_func_iir
+*/
+AFAPI void iirSos(array &y, array &zf, const array &sos, const array &x,
+                  const array &zi);
+
+/**
+   C++ Interface for infinite impulse response filter of second order
+   sections, starting from zero states
+
+   \param[out] y is the output signal from the filter
+   \param[out] zf is the array of the states after the last sample
+   \param[in] sos is the 6 x S array of sections
+   \param[in] x is the input signal to the filter
+
+   \note Only supported on the CPU backend
+
+   \ingroup signal_func_iir
+*/
+AFAPI void iirSos(array &y, array &zf, const array &sos, const array &x);
+#endif
+
 /**
     C++ Interface for median filter
 
@@ -982,6 +1154,53 @@ AFAPI af_err af_approx1_uniform_v2(af_array *out, const af_array in,
                                    const af_interp_type method,
                                    const float off_grid);
 
+#if AF_API_VERSION >= 310
+/**
+   C Interface for preparing one-dimensional signals for repeated
+   interpolation
+
+   \param[out] coeffs the coefficients of the polynomial of every interval
+                      along the first dimension, with four times as many
+                      rows as \p in
+   \param[in]  in     is the multidimensional input array
+   \param[in]  method is \ref AF_INTERP_LINEAR, \ref AF_INTERP_CUBIC or
+                      \ref AF_INTERP_CUBIC_SPLINE
+
+   \return \ref AF_SUCCESS if the coefficients are computed successfully,
+           otherwise an appropriate error code is returned.
+
+   \note Only supported on the CPU backend
+
+   \ingroup signal_func_approx1
+ */
+AFAPI af_err af_approx1_prepare(af_array *coeffs, const af_array in,
+                                const af_interp_type method);
+
+/**
+   C Interface for interpolating prepared one-dimensional signals
+
+   \param[out] out       the interpolated array
+   \param[in]  coeffs    are the coefficients from \ref af_approx1_prepare
+   \param[in]  pos       are the positions of the interpolation points along
+                         the first dimension
+   \param[in]  idx_start is the first index value
+   \param[in]  idx_step  is the uniform spacing value between subsequent
+                         indices
+   \param[in]  off_grid  is the default value for any indices outside the
+                         valid range of indices
+
+   \return \ref AF_SUCCESS if the interpolation operation is successful,
+           otherwise an appropriate error code is returned.
+
+   \note Only supported on the CPU backend
+
+   \ingroup signal_func_approx1
+ */
+AFAPI af_err af_approx1_prepared(af_array *out, const af_array coeffs,
+                                 const af_array pos, const double idx_start,
+                                 const double idx_step, const float off_grid);
+#endif
+
 /**
    C Interface for signals interpolation on two dimensional signals along
    specified dimensions.
@@ -1491,6 +1710,31 @@ AFAPI af_err af_convolve2_sep(af_array *out, const af_array col_filter, const af
  */
 AFAPI af_err af_fft_convolve1(af_array *out, const af_array signal, const af_array filter, const af_conv_mode mode);
 
+#if AF_API_VERSION >= 310
+/**
+   C Interface for streaming convolution on 1D signals using FFT
+
+   \param[out] y is the convolved block
+   \param[out] zf is the array of the outputs that overlap the next block.
+               May be NULL.
+   \param[in] signal is the next block of the input signal
+   \param[in] filter is the filter, with at least two coefficients
+   \param[in] zi is the array of pending outputs from the previous block
+              with len(filter) - 1 rows and one column per output channel,
+              or 0 to start a new signal
+   \return     \ref AF_SUCCESS if the convolution is successful,
+               otherwise an appropriate error code is returned.
+
+   \note Only supported on the CPU backend, for f32 and f64 signals
+
+   \ingroup signal_func_convolve1
+ */
+AFAPI af_err af_fft_convolve1_stream(af_array *y, af_array *zf,
+                                     const af_array signal,
+                                     const af_array filter,
+                                     const af_array zi);
+#endif
+
 /**
    C Interface for convolution on 2D signals using FFT
 
@@ -1544,6 +1788,48 @@ AFAPI af_err af_fir(af_array *y, const af_array b, const af_array x);
 */
 AFAPI af_err af_iir(af_array *y, const af_array b, const af_array a, const af_array x);
 
+#if AF_API_VERSION >= 310
+/**
+   C Interface for infinite impulse response filter with states
+
+   \param[out] y is the output signal from the filter
+   \param[out] zf is the array of the states after the last sample. May be
+               NULL.
+   \param[in] b is the array containing the feedforward coefficients
+   \param[in] a is the array containing the feedback coefficients. At least
+              one of \p a and \p b must have two or more coefficients.
+   \param[in] x is the input signal to the filter
+   \param[in] zi is the array of initial states with max(len(b), len(a)) - 1
+              rows and one column per output channel, or 0 for zero states
+
+   \note Only supported on the CPU backend
+
+   \ingroup signal_func_iir
+*/
+AFAPI af_err af_iir_state(af_array *y, af_array *zf, const af_array b,
+                          const af_array a, const af_array x,
+                          const af_array zi);
+
+/**
+   C Interface for infinite impulse response filter of second order sections
+
+   \param[out] y is the output signal from the filter
+   \param[out] zf is the array of the states after the last sample. May be
+               NULL.
+   \param[in] sos is the 6 x S array of sections. Each column holds b0, b1,
+              b2, a0, a1 and a2 of one section.
+   \param[in] x is the input signal to the filter
+   \param[in] zi is the array of initial states with 2 S rows and one
+              column per channel of \p x, or 0 for zero states
+
+   \note Only supported on the CPU backend
+
+   \ingroup signal_func_iir
+*/
+AFAPI af_err af_iir_sos(af_array *y, af_array *zf, const af_array sos,
+                        const af_array x, const af_array zi);
+#endif
+
     /**
         C Interface for median filter
 
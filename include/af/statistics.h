@@ -327,6 +327,54 @@ AFAPI T corrcoef(const array& X, const array& Y);
 AFAPI void topk(array &values, array &indices, const array& in, const int k,
                 const int dim = -1, const topkFunction order = AF_TOPK_MAX);
 #endif
+
+#if AF_API_VERSION >= 310
+/**
+   C++ Interface for quantiles along a given dimension
+
+   \param[in] in     is the input array
+   \param[in] probs  is a vector of the probabilities, in [0, 1], of the
+                     quantiles to compute
+   \param[in] dim    the dimension along which the quantiles are extracted
+   \param[in] method how a quantile between two ranks is computed
+   \return    the quantiles of the input array along dimension \p dim, one
+              per element of \p probs
+
+   \ingroup stat_func_quantile
+
+   \note \p dim is -1 by default. -1 denotes the first non-singleton dimension.
+*/
+AFAPI array quantile(const array& in, const array& probs, const dim_t dim = -1,
+                     const quantileMethod method = AF_QUANTILE_DEFAULT);
+
+/**
+   C++ Interface for the covariance matrix of the columns of an array
+
+   \param[in] X    is the input array with one observation per row and one
+                   variable per column
+   \param[in] bias The type of bias used for variance calculation. Takes of
+                   value of type \ref af_var_bias.
+   \return    a square matrix with the covariance of every pair of columns
+              of \p X
+
+   \ingroup stat_func_cov
+*/
+AFAPI array covMatrix(const array& X,
+                      const af_var_bias bias = AF_VARIANCE_DEFAULT);
+
+/**
+   C++ Interface for the correlation coefficient matrix of the columns of an
+   array
+
+   \param[in] X is the input array with one observation per row and one
+                variable per column
+   \return    a square matrix with the correlation coefficient of every pair
+              of columns of \p X
+
+   \ingroup stat_func_corrcoef
+*/
+AFAPI array corrcoefMatrix(const array& X);
+#endif
 }
 #endif
 
@@ -682,6 +730,58 @@ AFAPI af_err af_topk(af_array *values, af_array *indices, const af_array in,
                      const int k, const int dim, const af_topk_function order);
 #endif
 
+#if AF_API_VERSION >= 310
+/**
+   C Interface for quantiles along a given dimension
+
+   \param[out] out    will contain the quantiles of the input array along
+                      dimension \p dim, one per element of \p probs
+   \param[in]  in     is the input array
+   \param[in]  probs  is a vector of the probabilities, in [0, 1], of the
+                      quantiles to compute
+   \param[in]  dim    the dimension along which the quantiles are extracted
+   \param[in]  method how a quantile between two ranks is computed
+   \return     \ref AF_SUCCESS if the operation is successful,
+               otherwise an appropriate error code is returned.
+
+   \ingroup stat_func_quantile
+*/
+AFAPI af_err af_quantile(af_array *out, const af_array in, const af_array probs,
+                         const dim_t dim, const af_quantile_method method);
+
+/**
+   C Interface for the covariance matrix of the columns of an array
+
+   \param[out] out  will contain a square matrix with the covariance of every
+                    pair of columns of \p X
+   \param[in]  X    is the input array with one observation per row and one
+                    variable per column
+   \param[in]  bias The type of bias used for variance calculation. Takes of
+                    value of type \ref af_var_bias
+   \return     \ref AF_SUCCESS if the operation is successful,
+               otherwise an appropriate error code is returned.
+
+   \ingroup stat_func_cov
+*/
+AFAPI af_err af_cov_matrix(af_array *out, const af_array X,
+                           const af_var_bias bias);
+
+/**
+   C Interface for the correlation coefficient matrix of the columns of an
+   array
+
+   \param[out] out will contain a square matrix with the correlation
+                   coefficient of every pair of columns of \p X
+   \param[in]  X   is the input array with one observation per row and one
+                   variable per column
+   \return     \ref AF_SUCCESS if the operation is successful,
+               otherwise an appropriate error code is returned.
+
+   \ingroup stat_func_corrcoef
+*/
+AFAPI af_err af_corrcoef_matrix(af_array *out, const af_array X);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
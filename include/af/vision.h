@@ -43,6 +43,45 @@ AFAPI features fast(const array& in, const float thr=20.0f, const unsigned arc_l
                     const bool non_max=true, const float feature_ratio=0.05f,
                     const unsigned edge=3);
 
+#if AF_API_VERSION >= 310
+/**
+    C++ Interface for FAST feature detector with a per cell feature cap
+
+    \param[in] in array containing a grayscale image (color images are not
+               supported)
+    \param[in] thr FAST threshold for which a pixel of the circle around
+               the central pixel is considered to be greater or smaller
+    \param[in] arc_length length of arc (or sequential segment) to be tested,
+               must be within range [9-16]
+    \param[in] non_max performs non-maximal suppression if true
+    \param[in] feature_ratio maximum ratio of features to detect, the maximum
+               number of features is calculated by feature_ratio * in.elements().
+               The maximum number of features is not based on the score, instead,
+               features detected after the limit is reached are discarded
+    \param[in] edge is the length of the edges in the image to be discarded
+               by FAST (minimum is 3, as the radius of the circle)
+    \param[in] grid_rows number of cells the image is split into along its
+               first dimension (must be > 0)
+    \param[in] grid_cols number of cells the image is split into along its
+               second dimension (must be > 0)
+    \param[in] max_per_cell maximum number of features kept in each cell, only
+               the ones with the highest scores are retained. 0 disables the
+               cap. Otherwise the limit set by \p feature_ratio is applied
+               after the cap, by dropping the weakest features of every cell
+               first
+    \return    features object containing arrays for x and y coordinates and
+               score, while array orientation is set to 0 as FAST does not
+               compute orientation, and size is set to 1 as FAST does not
+               compute multiple scales
+
+    \ingroup cv_func_fast
+ */
+AFAPI features fast(const array& in, const float thr, const unsigned arc_length,
+                    const bool non_max, const float feature_ratio,
+                    const unsigned edge, const unsigned grid_rows,
+                    const unsigned grid_cols, const unsigned max_per_cell);
+#endif
+
 #if AF_API_VERSION >= 31
 /**
     C++ Interface for Harris corner detector
@@ -372,6 +411,48 @@ extern "C" {
     AFAPI af_err af_fast(af_features *out, const af_array in, const float thr, const unsigned arc_length,
                          const bool non_max, const float feature_ratio, const unsigned edge);
 
+#if AF_API_VERSION >= 310
+    /**
+        C Interface for FAST feature detector with a per cell feature cap
+
+        \param[out] out struct containing arrays for x and y
+                    coordinates and score, while array orientation is set to 0
+                    as FAST does not compute orientation, and size is set to 1
+                    as FAST does not compute multiple scales
+        \param[in]  in array containing a grayscale image (color images are
+                    not supported)
+        \param[in]  thr FAST threshold for which a pixel of the circle around
+                    the central pixel is considered to be greater or smaller
+        \param[in]  arc_length length of arc (or sequential segment) to be
+                    tested, must be within range [9-16]
+        \param[in]  non_max performs non-maximal suppression if true
+        \param[in]  feature_ratio maximum ratio of features to detect, the
+                    maximum number of features is calculated by
+                    feature_ratio * in.elements(). The maximum number of
+                    features is not based on the score, instead, features
+                    detected after the limit is reached are discarded
+        \param[in]  edge is the length of the edges in the image to be
+                    discarded by FAST (minimum is 3, as the radius of the
+                    circle)
+        \param[in]  grid_rows number of cells the image is split into along
+                    its first dimension (must be > 0)
+        \param[in]  grid_cols number of cells the image is split into along
+                    its second dimension (must be > 0)
+        \param[in]  max_per_cell maximum number of features kept in each cell,
+                    only the ones with the highest scores are retained. 0
+                    disables the cap. Otherwise the limit set by
+                    \p feature_ratio is applied after the cap, by dropping the
+                    weakest features of every cell first
+
+        \ingroup cv_func_fast
+    */
+    AFAPI af_err af_fast_v2(af_features *out, const af_array in, const float thr,
+                            const unsigned arc_length, const bool non_max,
+                            const float feature_ratio, const unsigned edge,
+                            const unsigned grid_rows, const unsigned grid_cols,
+                            const unsigned max_per_cell);
+#endif
+
 #if AF_API_VERSION >= 31
     /**
         C Interface for Harris corner detector
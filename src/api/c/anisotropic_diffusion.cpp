@@ -36,7 +36,13 @@ template<typename T>
 af_array diffusion(const Array<float>& in, const float dt, const float K,
                    const unsigned iterations, const af_flux_function fftype,
                    const af::diffusionEq eq) {
-    auto out  = copyArray(in);
+    auto out = copyArray(in);
+
+#if defined(AF_CPU)
+    // The CPU backend fuses the gradient, its reduction and the update into
+    // a single sweep per iteration
+    detail::anisotropicDiffusionIterate(out, dt, K, iterations, fftype, eq);
+#else
     auto dims = out.dims();
     auto g0   = createEmptyArray<float>(dims);
     auto g1   = createEmptyArray<float>(dims);
@@ -54,6 +60,7 @@ af_array diffusion(const Array<float>& in, const float dt, const float K,
 
         anisotropicDiffusion(out, dt, 1.0f / (cnst * avg), fftype, eq);
     }
+#endif
 
     return getHandle(cast<T, float>(out));
 }
@@ -63,6 +70,7 @@ af_err af_anisotropic_diffusion(af_array* out, const af_array in,
                                 const unsigned iterations,
                                 const af_flux_function fftype,
                                 const af_diffusion_eq eq) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(in);
 
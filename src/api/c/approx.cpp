@@ -18,11 +18,16 @@
 #include <af/defines.h>
 #include <af/signal.h>
 
+#include <utility>
+
 using af::dim4;
 using detail::approx1;
+using detail::approx1Prepare;
+using detail::approx1Prepared;
 using detail::approx2;
 using detail::cdouble;
 using detail::cfloat;
+using std::swap;
 
 namespace {
 template<typename Ty, typename Tp>
@@ -32,6 +37,19 @@ inline void approx1(af_array *yo, const af_array yi, const af_array xo,
     approx1<Ty>(getArray<Ty>(*yo), getArray<Ty>(yi), getArray<Tp>(xo), xdim,
                 xi_beg, xi_step, method, offGrid);
 }
+
+template<typename Ty>
+inline af_array prepare(const af_array in, const af_interp_type method) {
+    return getHandle(approx1Prepare<Ty>(getArray<Ty>(in), method));
+}
+
+template<typename Ty, typename Tp>
+inline af_array prepared(const af_array coeffs, const af_array pos,
+                         const Tp &xi_beg, const Tp &xi_step,
+                         const float offGrid) {
+    return getHandle(approx1Prepared<Ty, Tp>(
+        getArray<Ty>(coeffs), getArray<Tp>(pos), xi_beg, xi_step, offGrid));
+}
 }  // namespace
 
 template<typename Ty, typename Tp>
@@ -117,6 +135,7 @@ af_err af_approx1_uniform(af_array *yo, const af_array yi, const af_array xo,
                           const int xdim, const double xi_beg,
                           const double xi_step, const af_interp_type method,
                           const float offGrid) {
+    AF_API_SCOPE;
     try {
         af_approx1_common(yo, yi, xo, xdim, xi_beg, xi_step, method, offGrid,
                           true);
@@ -130,6 +149,7 @@ af_err af_approx1_uniform_v2(af_array *yo, const af_array yi, const af_array xo,
                              const int xdim, const double xi_beg,
                              const double xi_step, const af_interp_type method,
                              const float offGrid) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, yo != 0);  // need to dereference yo in next call
         af_approx1_common(yo, yi, xo, xdim, xi_beg, xi_step, method, offGrid,
@@ -142,6 +162,7 @@ af_err af_approx1_uniform_v2(af_array *yo, const af_array yi, const af_array xo,
 
 af_err af_approx1(af_array *yo, const af_array yi, const af_array xo,
                   const af_interp_type method, const float offGrid) {
+    AF_API_SCOPE;
     try {
         af_approx1_common(yo, yi, xo, 0, 0.0, 1.0, method, offGrid, true);
     }
@@ -152,6 +173,7 @@ af_err af_approx1(af_array *yo, const af_array yi, const af_array xo,
 
 af_err af_approx1_v2(af_array *yo, const af_array yi, const af_array xo,
                      const af_interp_type method, const float offGrid) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, yo != 0);  // need to dereference yo in next call
         af_approx1_common(yo, yi, xo, 0, 0.0, 1.0, method, offGrid, *yo == 0);
@@ -245,6 +267,7 @@ af_err af_approx2_uniform(af_array *zo, const af_array zi, const af_array xo,
                           const int ydim, const double yi_beg,
                           const double yi_step, const af_interp_type method,
                           const float offGrid) {
+    AF_API_SCOPE;
     try {
         af_approx2_common(zo, zi, xo, xdim, xi_beg, xi_step, yo, ydim, yi_beg,
                           yi_step, method, offGrid, true);
@@ -260,6 +283,7 @@ af_err af_approx2_uniform_v2(af_array *zo, const af_array zi, const af_array xo,
                              const int ydim, const double yi_beg,
                              const double yi_step, const af_interp_type method,
                              const float offGrid) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, zo != 0);  // need to dereference zo in next call
         af_approx2_common(zo, zi, xo, xdim, xi_beg, xi_step, yo, ydim, yi_beg,
@@ -273,6 +297,7 @@ af_err af_approx2_uniform_v2(af_array *zo, const af_array zi, const af_array xo,
 af_err af_approx2(af_array *zo, const af_array zi, const af_array xo,
                   const af_array yo, const af_interp_type method,
                   const float offGrid) {
+    AF_API_SCOPE;
     try {
         af_approx2_common(zo, zi, xo, 0, 0.0, 1.0, yo, 1, 0.0, 1.0, method,
                           offGrid, true);
@@ -285,6 +310,7 @@ af_err af_approx2(af_array *zo, const af_array zi, const af_array xo,
 af_err af_approx2_v2(af_array *zo, const af_array zi, const af_array xo,
                      const af_array yo, const af_interp_type method,
                      const float offGrid) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, zo != 0);  // need to dereference zo in next call
         af_approx2_common(zo, zi, xo, 0, 0.0, 1.0, yo, 1, 0.0, 1.0, method,
@@ -294,3 +320,94 @@ af_err af_approx2_v2(af_array *zo, const af_array zi, const af_array xo,
 
     return AF_SUCCESS;
 }
+
+af_err af_approx1_prepare(af_array *coeffs, const af_array in,
+                          const af_interp_type method) {
+    AF_API_SCOPE;
+    try {
+        ARG_ASSERT(0, coeffs != 0);
+
+        const ArrayInfo &info = getInfo(in);
+        ARG_ASSERT(1, info.isFloating());  // Only floating and complex types
+        ARG_ASSERT(2, method == AF_INTERP_LINEAR ||
+                          method == AF_INTERP_CUBIC ||
+                          method == AF_INTERP_CUBIC_SPLINE);
+
+        if (info.ndims() == 0) {
+            return af_create_handle(coeffs, 0, nullptr, info.getType());
+        }
+
+        af_array output = 0;
+        switch (info.getType()) {
+            case f32: output = prepare<float>(in, method); break;
+            case f64: output = prepare<double>(in, method); break;
+            case c32: output = prepare<cfloat>(in, method); break;
+            case c64: output = prepare<cdouble>(in, method); break;
+            default: TYPE_ERROR(1, info.getType());
+        }
+        swap(*coeffs, output);
+    }
+    CATCHALL;
+
+    return AF_SUCCESS;
+}
+
+af_err af_approx1_prepared(af_array *out, const af_array coeffs,
+                           const af_array pos, const double idx_start,
+                           const double idx_step, const float off_grid) {
+    AF_API_SCOPE;
+    try {
+        ARG_ASSERT(0, out != 0);
+
+        const ArrayInfo &c_info = getInfo(coeffs);
+        const ArrayInfo &p_info = getInfo(pos);
+        const dim4 &c_dims      = c_info.dims();
+        const dim4 &p_dims      = p_info.dims();
+
+        ARG_ASSERT(1, c_info.isFloating());      // Only floating and complex
+        ARG_ASSERT(2, p_info.isRealFloating());  // Only floating types
+        ARG_ASSERT(1, c_info.isSingle() ==
+                          p_info.isSingle());  // Must have same precision
+        ARG_ASSERT(1, c_info.isDouble() ==
+                          p_info.isDouble());  // Must have same precision
+        DIM_ASSERT(1, c_dims[0] % 4 == 0);     // Four coefficients per sample
+        ARG_ASSERT(4, idx_step != 0);
+
+        // POS should either be (x, 1, 1, 1) or (x, coeffs_dims[1],
+        // coeffs_dims[2], coeffs_dims[3])
+        if (p_dims[0] != p_dims.elements()) {
+            for (int i = 1; i < 4; i++) {
+                DIM_ASSERT(2, p_dims[i] == c_dims[i]);
+            }
+        }
+
+        if (c_dims.ndims() == 0 || p_dims.ndims() == 0) {
+            return af_create_handle(out, 0, nullptr, c_info.getType());
+        }
+
+        af_array output = 0;
+        switch (c_info.getType()) {
+            case f32:
+                output = prepared<float, float>(coeffs, pos, idx_start,
+                                                idx_step, off_grid);
+                break;
+            case f64:
+                output = prepared<double, double>(coeffs, pos, idx_start,
+                                                  idx_step, off_grid);
+                break;
+            case c32:
+                output = prepared<cfloat, float>(coeffs, pos, idx_start,
+                                                 idx_step, off_grid);
+                break;
+            case c64:
+                output = prepared<cdouble, double>(coeffs, pos, idx_start,
+                                                   idx_step, off_grid);
+                break;
+            default: TYPE_ERROR(1, c_info.getType());
+        }
+        swap(*out, output);
+    }
+    CATCHALL;
+
+    return AF_SUCCESS;
+}
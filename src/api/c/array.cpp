@@ -36,6 +36,7 @@ using detail::uintl;
 using detail::ushort;
 
 af_err af_get_data_ptr(void *data, const af_array arr) {
+    AF_API_SCOPE;
     try {
         af_dtype type = getInfo(arr).getType();
         // clang-format off
@@ -65,6 +66,7 @@ af_err af_get_data_ptr(void *data, const af_array arr) {
 af_err af_create_array(af_array *result, const void *const data,
                        const unsigned ndims, const dim_t *const dims,
                        const af_dtype type) {
+    AF_API_SCOPE;
     try {
         af_array out;
         AF_CHECK(af_init());
@@ -126,6 +128,7 @@ af_err af_create_array(af_array *result, const void *const data,
 // Strong Exception Guarantee
 af_err af_create_handle(af_array *result, const unsigned ndims,
                         const dim_t *const dims, const af_dtype type) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
 
@@ -143,6 +146,7 @@ af_err af_create_handle(af_array *result, const unsigned ndims,
 
 // Strong Exception Guarantee
 af_err af_copy_array(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in, false);
         const af_dtype type   = info.getType();
@@ -192,6 +196,7 @@ af_err af_copy_array(af_array *out, const af_array in) {
 
 // Strong Exception Guarantee
 af_err af_get_data_ref_count(int *use_count, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in, false);
         const af_dtype type   = info.getType();
@@ -220,6 +225,7 @@ af_err af_get_data_ref_count(int *use_count, const af_array in) {
 }
 
 af_err af_release_array(af_array arr) {
+    AF_API_SCOPE;
     try {
         if (arr == 0) { return AF_SUCCESS; }
         const ArrayInfo &info = getInfo(arr, false);
@@ -258,6 +264,7 @@ af_err af_release_array(af_array arr) {
 }
 
 af_err af_retain_array(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         *out = retain(in);
     }
@@ -277,6 +284,7 @@ void write_array(af_array arr, const T *const data, const size_t bytes,
 
 af_err af_write_array(af_array arr, const void *data, const size_t bytes,
                       af_source src) {
+    AF_API_SCOPE;
     if (bytes == 0) { return AF_SUCCESS; }
     try {
         af_dtype type = getInfo(arr).getType();
@@ -334,6 +342,7 @@ af_err af_write_array(af_array arr, const void *data, const size_t bytes,
 }
 
 af_err af_get_elements(dim_t *elems, const af_array arr) {
+    AF_API_SCOPE;
     try {
         // Do not check for device mismatch
         *elems = getInfo(arr, false).elements();
@@ -343,6 +352,7 @@ af_err af_get_elements(dim_t *elems, const af_array arr) {
 }
 
 af_err af_get_type(af_dtype *type, const af_array arr) {
+    AF_API_SCOPE;
     try {
         // Do not check for device mismatch
         *type = getInfo(arr, false).getType();
@@ -353,6 +363,7 @@ af_err af_get_type(af_dtype *type, const af_array arr) {
 
 af_err af_get_dims(dim_t *d0, dim_t *d1, dim_t *d2, dim_t *d3,
                    const af_array in) {
+    AF_API_SCOPE;
     try {
         // Do not check for device mismatch
         const ArrayInfo &info = getInfo(in, false);
@@ -366,6 +377,7 @@ af_err af_get_dims(dim_t *d0, dim_t *d1, dim_t *d2, dim_t *d3,
 }
 
 af_err af_get_numdims(unsigned *nd, const af_array in) {
+    AF_API_SCOPE;
     try {
         // Do not check for device mismatch
         const ArrayInfo &info = getInfo(in, false);
@@ -410,6 +422,7 @@ inline void getScalar(T *out, const af_array &arr) {
 }
 
 af_err af_get_scalar(void *output_value, const af_array arr) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, (output_value != NULL));
 
@@ -27,32 +27,62 @@ using std::is_same;
 
 template<typename T>
 inline af_array bilateral(const af_array &in, const float &sp_sig,
-                          const float &chr_sig) {
+                          const float &chr_sig, const bool isColor,
+                          const af_bilateral_method method) {
     using OutType =
         typename conditional<is_same<T, double>::value, double, float>::type;
-    return getHandle(bilateral<T, OutType>(getArray<T>(in), sp_sig, chr_sig));
+    return getHandle(bilateral<T, OutType>(getArray<T>(in), sp_sig, chr_sig,
+                                           isColor, method));
 }
 
 af_err af_bilateral(af_array *out, const af_array in, const float ssigma,
                     const float csigma, const bool iscolor) {
-    UNUSED(iscolor);
+    return af_bilateral_v2(out, in, ssigma, csigma, iscolor,
+                           AF_BILATERAL_DEFAULT);
+}
+
+af_err af_bilateral_v2(af_array *out, const af_array in, const float ssigma,
+                       const float csigma, const bool iscolor,
+                       const af_bilateral_method method) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         af_dtype type         = info.getType();
         af::dim4 dims         = info.dims();
 
         DIM_ASSERT(1, (dims.ndims() >= 2));
+        ARG_ASSERT(5, (method >= AF_BILATERAL_DEFAULT &&
+                       method <= AF_BILATERAL_PERMUTOHEDRAL));
+
+        const af_bilateral_method m =
+            (method == AF_BILATERAL_DEFAULT ? AF_BILATERAL_EXACT : method);
 
         af_array output = nullptr;
         switch (type) {
-            case f64: output = bilateral<double>(in, ssigma, csigma); break;
-            case f32: output = bilateral<float>(in, ssigma, csigma); break;
-            case b8: output = bilateral<char>(in, ssigma, csigma); break;
-            case s32: output = bilateral<int>(in, ssigma, csigma); break;
-            case u32: output = bilateral<uint>(in, ssigma, csigma); break;
-            case u8: output = bilateral<uchar>(in, ssigma, csigma); break;
-            case s16: output = bilateral<short>(in, ssigma, csigma); break;
-            case u16: output = bilateral<ushort>(in, ssigma, csigma); break;
+            case f64:
+                output = bilateral<double>(in, ssigma, csigma, iscolor, m);
+                break;
+            case f32:
+                output = bilateral<float>(in, ssigma, csigma, iscolor, m);
+                break;
+            case b8:
+                output = bilateral<char>(in, ssigma, csigma, iscolor, m);
+                break;
+            case s32:
+                output = bilateral<int>(in, ssigma, csigma, iscolor, m);
+                break;
+            case u32:
+                output = bilateral<uint>(in, ssigma, csigma, iscolor, m);
+                break;
+            case u8:
+                output = bilateral<uchar>(in, ssigma, csigma, iscolor, m);
+                break;
+            case s16:
+                output = bilateral<short>(in, ssigma, csigma, iscolor, m);
+                break;
+            case u16:
+                output = bilateral<ushort>(in, ssigma, csigma, iscolor, m);
+                break;
             default: TYPE_ERROR(1, type);
         }
         std::swap(*out, output);
@@ -277,6 +277,7 @@ static af_err af_arith_sparse_dense(af_array *out, const af_array lhs,
 
 af_err af_add(af_array *out, const af_array lhs, const af_array rhs,
               const bool batchMode) {
+    AF_API_SCOPE;
     try {
         // Check if inputs are sparse
         const ArrayInfo &linfo = getInfo(lhs, false);
@@ -299,6 +300,7 @@ af_err af_add(af_array *out, const af_array lhs, const af_array rhs,
 
 af_err af_mul(af_array *out, const af_array lhs, const af_array rhs,
               const bool batchMode) {
+    AF_API_SCOPE;
     try {
         // Check if inputs are sparse
         const ArrayInfo &linfo = getInfo(lhs, false);
@@ -325,6 +327,7 @@ af_err af_mul(af_array *out, const af_array lhs, const af_array rhs,
 
 af_err af_sub(af_array *out, const af_array lhs, const af_array rhs,
               const bool batchMode) {
+    AF_API_SCOPE;
     try {
         // Check if inputs are sparse
         const ArrayInfo &linfo = getInfo(lhs, false);
@@ -348,6 +351,7 @@ af_err af_sub(af_array *out, const af_array lhs, const af_array rhs,
 
 af_err af_div(af_array *out, const af_array lhs, const af_array rhs,
               const bool batchMode) {
+    AF_API_SCOPE;
     try {
         // Check if inputs are sparse
         const ArrayInfo &linfo = getInfo(lhs, false);
@@ -376,26 +380,31 @@ af_err af_div(af_array *out, const af_array lhs, const af_array rhs,
 
 af_err af_maxof(af_array *out, const af_array lhs, const af_array rhs,
                 const bool batchMode) {
+    AF_API_SCOPE;
     return af_arith<af_max_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_minof(af_array *out, const af_array lhs, const af_array rhs,
                 const bool batchMode) {
+    AF_API_SCOPE;
     return af_arith<af_min_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_rem(af_array *out, const af_array lhs, const af_array rhs,
               const bool batchMode) {
+    AF_API_SCOPE;
     return af_arith_real<af_rem_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_mod(af_array *out, const af_array lhs, const af_array rhs,
               const bool batchMode) {
+    AF_API_SCOPE;
     return af_arith_real<af_mod_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_pow(af_array *out, const af_array lhs, const af_array rhs,
               const bool batchMode) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &linfo = getInfo(lhs);
         const ArrayInfo &rinfo = getInfo(rhs);
@@ -441,6 +450,7 @@ af_err af_pow(af_array *out, const af_array lhs, const af_array rhs,
 
 af_err af_root(af_array *out, const af_array lhs, const af_array rhs,
                const bool batchMode) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &linfo = getInfo(lhs);
         const ArrayInfo &rinfo = getInfo(rhs);
@@ -473,6 +483,7 @@ af_err af_root(af_array *out, const af_array lhs, const af_array rhs,
 
 af_err af_atan2(af_array *out, const af_array lhs, const af_array rhs,
                 const bool batchMode) {
+    AF_API_SCOPE;
     try {
         const af_dtype type = implicit(lhs, rhs);
 
@@ -504,6 +515,7 @@ af_err af_atan2(af_array *out, const af_array lhs, const af_array rhs,
 
 af_err af_hypot(af_array *out, const af_array lhs, const af_array rhs,
                 const bool batchMode) {
+    AF_API_SCOPE;
     try {
         const af_dtype type = implicit(lhs, rhs);
 
@@ -583,41 +595,49 @@ static af_err af_logic(af_array *out, const af_array lhs, const af_array rhs,
 
 af_err af_eq(af_array *out, const af_array lhs, const af_array rhs,
              const bool batchMode) {
+    AF_API_SCOPE;
     return af_logic<af_eq_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_neq(af_array *out, const af_array lhs, const af_array rhs,
               const bool batchMode) {
+    AF_API_SCOPE;
     return af_logic<af_neq_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_gt(af_array *out, const af_array lhs, const af_array rhs,
              const bool batchMode) {
+    AF_API_SCOPE;
     return af_logic<af_gt_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_ge(af_array *out, const af_array lhs, const af_array rhs,
              const bool batchMode) {
+    AF_API_SCOPE;
     return af_logic<af_ge_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_lt(af_array *out, const af_array lhs, const af_array rhs,
              const bool batchMode) {
+    AF_API_SCOPE;
     return af_logic<af_lt_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_le(af_array *out, const af_array lhs, const af_array rhs,
              const bool batchMode) {
+    AF_API_SCOPE;
     return af_logic<af_le_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_and(af_array *out, const af_array lhs, const af_array rhs,
               const bool batchMode) {
+    AF_API_SCOPE;
     return af_logic<af_and_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_or(af_array *out, const af_array lhs, const af_array rhs,
              const bool batchMode) {
+    AF_API_SCOPE;
     return af_logic<af_or_t>(out, lhs, rhs, batchMode);
 }
 
@@ -665,25 +685,30 @@ static af_err af_bitwise(af_array *out, const af_array lhs, const af_array rhs,
 
 af_err af_bitand(af_array *out, const af_array lhs, const af_array rhs,
                  const bool batchMode) {
+    AF_API_SCOPE;
     return af_bitwise<af_bitand_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_bitor(af_array *out, const af_array lhs, const af_array rhs,
                 const bool batchMode) {
+    AF_API_SCOPE;
     return af_bitwise<af_bitor_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_bitxor(af_array *out, const af_array lhs, const af_array rhs,
                  const bool batchMode) {
+    AF_API_SCOPE;
     return af_bitwise<af_bitxor_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_bitshiftl(af_array *out, const af_array lhs, const af_array rhs,
                     const bool batchMode) {
+    AF_API_SCOPE;
     return af_bitwise<af_bitshiftl_t>(out, lhs, rhs, batchMode);
 }
 
 af_err af_bitshiftr(af_array *out, const af_array lhs, const af_array rhs,
                     const bool batchMode) {
+    AF_API_SCOPE;
     return af_bitwise<af_bitshiftr_t>(out, lhs, rhs, batchMode);
 }
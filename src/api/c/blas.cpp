@@ -69,6 +69,7 @@ static inline T dotAll(af_array out) {
 
 af_err af_sparse_matmul(af_array *out, const af_array lhs, const af_array rhs,
                         const af_mat_prop optLhs, const af_mat_prop optRhs) {
+    AF_API_SCOPE;
     try {
         const SparseArrayBase lhsBase = getSparseArrayBase(lhs);
         const ArrayInfo &rhsInfo      = getInfo(rhs);
@@ -133,6 +134,7 @@ af_err af_sparse_matmul(af_array *out, const af_array lhs, const af_array rhs,
 af_err af_gemm(af_array *out, const af_mat_prop optLhs,
                const af_mat_prop optRhs, const void *alpha, const af_array lhs,
                const af_array rhs, const void *beta) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &lhsInfo = getInfo(lhs, false);
         const ArrayInfo &rhsInfo = getInfo(rhs, true);
@@ -226,6 +228,7 @@ af_err af_gemm(af_array *out, const af_mat_prop optLhs,
 
 af_err af_matmul(af_array *out, const af_array lhs, const af_array rhs,
                  const af_mat_prop optLhs, const af_mat_prop optRhs) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &lhsInfo = getInfo(lhs, false);
         const ArrayInfo &rhsInfo = getInfo(rhs, true);
@@ -299,6 +302,7 @@ af_err af_matmul(af_array *out, const af_array lhs, const af_array rhs,
 
 af_err af_dot(af_array *out, const af_array lhs, const af_array rhs,
               const af_mat_prop optLhs, const af_mat_prop optRhs) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &lhsInfo = getInfo(lhs);
         const ArrayInfo &rhsInfo = getInfo(rhs);
@@ -343,6 +347,7 @@ af_err af_dot(af_array *out, const af_array lhs, const af_array rhs,
 af_err af_dot_all(double *rval, double *ival, const af_array lhs,
                   const af_array rhs, const af_mat_prop optLhs,
                   const af_mat_prop optRhs) {
+    AF_API_SCOPE;
     using namespace detail;  // NOLINT needed for imag and real functions
                              // name resolution
 
@@ -225,6 +225,7 @@ af_array cannyHelper(const Array<T>& in, const float t1,
 af_err af_canny(af_array* out, const af_array in, const af_canny_threshold ct,
                 const float t1, const float t2, const unsigned sw,
                 const bool isf) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(in);
         af::dim4 dims         = info.dims();
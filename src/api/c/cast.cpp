@@ -67,6 +67,7 @@ static af_array cast(const af_array in, const af_dtype type) {
 }
 
 af_err af_cast(af_array* out, const af_array in, const af_dtype type) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(in, false);
 
@@ -13,10 +13,12 @@
 #include <common/ArrayInfo.hpp>
 #include <common/err_common.hpp>
 #include <handle.hpp>
+#include <lapack_common.hpp>
 #include <af/array.h>
 #include <af/defines.h>
 #include <af/lapack.h>
 
+using arrayfire::common::lapackBatchSupported;
 using arrayfire::getArray;
 using detail::cdouble;
 using detail::cfloat;
@@ -34,10 +36,11 @@ static inline int cholesky_inplace(af_array in, const bool is_upper) {
 
 af_err af_cholesky(af_array *out, int *info, const af_array in,
                    const bool is_upper) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &i_info = getInfo(in);
 
-        if (i_info.ndims() > 2) {
+        if (!lapackBatchSupported && i_info.ndims() > 2) {
             AF_ERROR("cholesky can not be used in batch mode", AF_ERR_BATCH);
         }
 
@@ -66,10 +69,11 @@ af_err af_cholesky(af_array *out, int *info, const af_array in,
 }
 
 af_err af_cholesky_inplace(int *info, af_array in, const bool is_upper) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &i_info = getInfo(in);
 
-        if (i_info.ndims() > 2) {
+        if (!lapackBatchSupported && i_info.ndims() > 2) {
             AF_ERROR("cholesky can not be used in batch mode", AF_ERR_BATCH);
         }
 
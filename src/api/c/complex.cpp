@@ -39,6 +39,7 @@ static inline af_array cplx(const af_array lhs, const af_array rhs,
 
 af_err af_cplx2(af_array *out, const af_array lhs, const af_array rhs,
                 bool batchMode) {
+    AF_API_SCOPE;
     try {
         af_dtype type = implicit(lhs, rhs);
 
@@ -67,6 +68,7 @@ af_err af_cplx2(af_array *out, const af_array lhs, const af_array rhs,
 }
 
 af_err af_cplx(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         af_dtype type         = info.getType();
@@ -96,6 +98,7 @@ af_err af_cplx(af_array *out, const af_array in) {
 }
 
 af_err af_real(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         af_dtype type         = info.getType();
@@ -122,6 +125,7 @@ af_err af_real(af_array *out, const af_array in) {
 }
 
 af_err af_imag(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         af_dtype type         = info.getType();
@@ -150,6 +154,7 @@ af_err af_imag(af_array *out, const af_array in) {
 }
 
 af_err af_conjg(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         af_dtype type         = info.getType();
@@ -176,6 +181,7 @@ af_err af_conjg(af_array *out, const af_array in) {
 }
 
 af_err af_abs(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &in_info = getInfo(in);
         af_dtype in_type         = in_info.getType();
@@ -211,6 +211,7 @@ af_err convolve(af_array *out, const af_array signal, const af_array filter,
 
 af_err af_convolve1(af_array *out, const af_array signal, const af_array filter,
                     const af_conv_mode mode, af_conv_domain domain) {
+    AF_API_SCOPE;
     try {
         if (isFreqDomain(1, signal, filter, domain)) {
             return af_fft_convolve1(out, signal, filter, mode);
@@ -222,6 +223,7 @@ af_err af_convolve1(af_array *out, const af_array signal, const af_array filter,
 
 af_err af_convolve2(af_array *out, const af_array signal, const af_array filter,
                     const af_conv_mode mode, af_conv_domain domain) {
+    AF_API_SCOPE;
     try {
         if (getInfo(signal).dims().ndims() < 2 ||
             getInfo(filter).dims().ndims() < 2) {
@@ -237,6 +239,7 @@ af_err af_convolve2(af_array *out, const af_array signal, const af_array filter,
 
 af_err af_convolve3(af_array *out, const af_array signal, const af_array filter,
                     const af_conv_mode mode, af_conv_domain domain) {
+    AF_API_SCOPE;
     try {
         if (getInfo(signal).dims().ndims() < 3 ||
             getInfo(filter).dims().ndims() < 3) {
@@ -253,6 +256,7 @@ af_err af_convolve3(af_array *out, const af_array signal, const af_array filter,
 af_err af_convolve2_sep(af_array *out, const af_array col_filter,
                         const af_array row_filter, const af_array signal,
                         const af_conv_mode mode) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &sInfo = getInfo(signal);
 
@@ -337,6 +341,7 @@ af_err af_convolve2_nn(af_array *out, const af_array signal,
                        const dim_t *strides, const unsigned padding_dims,
                        const dim_t *paddings, const unsigned dilation_dims,
                        const dim_t *dilations) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &sInfo = getInfo(signal);
         const ArrayInfo &fInfo = getInfo(filter);
@@ -409,6 +414,7 @@ af_err af_convolve2_gradient_nn(
     const dim_t *strides, const unsigned padding_dims, const dim_t *paddings,
     const unsigned dilation_dims, const dim_t *dilations,
     af_conv_gradient_type grad_type) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &iinfo = getInfo(incoming_gradient);
         const af::dim4 &iDims  = iinfo.dims();
@@ -23,10 +23,15 @@
 
 #include <cmath>
 
+#if defined(AF_CPU)
+#include <covariance.hpp>
+#endif
+
 using af::dim4;
 using arrayfire::common::cast;
 using detail::arithOp;
 using detail::Array;
+using detail::createValueArray;
 using detail::getScalar;
 using detail::intl;
 using detail::reduce_all;
@@ -37,33 +42,41 @@ using detail::ushort;
 
 template<typename Ti, typename To>
 static To corrcoef(const af_array& X, const af_array& Y) {
+#if defined(AF_CPU)
+    // Centred sums from a single pass over both inputs
+    return detail::corrcoef<Ti, To>(getArray<Ti>(X), getArray<Ti>(Y));
+#else
     Array<To> xIn = cast<To>(getArray<Ti>(X));
     Array<To> yIn = cast<To>(getArray<Ti>(Y));
 
     const dim4& dims = xIn.dims();
     dim_t n          = xIn.elements();
 
-    To xSum = getScalar<To>(reduce_all<af_add_t, To, To>(xIn));
-    To ySum = getScalar<To>(reduce_all<af_add_t, To, To>(yIn));
+    To xMean = getScalar<To>(reduce_all<af_add_t, To, To>(xIn)) / n;
+    To yMean = getScalar<To>(reduce_all<af_add_t, To, To>(yIn)) / n;
+
+    // Centring first keeps the sums of squares from cancelling each other
+    Array<To> xc = arithOp<To, af_sub_t>(
+        xIn, createValueArray<To>(dims, xMean), dims);
+    Array<To> yc = arithOp<To, af_sub_t>(
+        yIn, createValueArray<To>(dims, yMean), dims);
 
-    Array<To> xSq = arithOp<To, af_mul_t>(xIn, xIn, dims);
-    Array<To> ySq = arithOp<To, af_mul_t>(yIn, yIn, dims);
-    Array<To> xy  = arithOp<To, af_mul_t>(xIn, yIn, dims);
+    Array<To> xSq = arithOp<To, af_mul_t>(xc, xc, dims);
+    Array<To> ySq = arithOp<To, af_mul_t>(yc, yc, dims);
+    Array<To> xy  = arithOp<To, af_mul_t>(xc, yc, dims);
 
     To xSqSum = getScalar<To>(reduce_all<af_add_t, To, To>(xSq));
     To ySqSum = getScalar<To>(reduce_all<af_add_t, To, To>(ySq));
     To xySum  = getScalar<To>(reduce_all<af_add_t, To, To>(xy));
 
-    To result =
-        (n * xySum - xSum * ySum) / (std::sqrt(n * xSqSum - xSum * xSum) *
-                                     std::sqrt(n * ySqSum - ySum * ySum));
-
-    return result;
+    return xySum / (std::sqrt(xSqSum) * std::sqrt(ySqSum));
+#endif
 }
 
 // NOLINTNEXTLINE
 af_err af_corrcoef(double* realVal, double* imagVal, const af_array X,
                    const af_array Y) {
+    AF_API_SCOPE;
     UNUSED(imagVal);  // TODO(umar): implement for complex types
     try {
         const ArrayInfo& xInfo = getInfo(X);
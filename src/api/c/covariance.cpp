@@ -9,7 +9,9 @@
 
 #include <arith.hpp>
 #include <backend.hpp>
+#include <blas.hpp>
 #include <common/cast.hpp>
+#include <diagonal.hpp>
 #include <handle.hpp>
 #include <math.hpp>
 #include <mean.hpp>
@@ -22,26 +24,38 @@
 
 #include "stats.h"
 
+#if defined(AF_CPU)
+#include <covariance.hpp>
+#endif
+
 using af::dim4;
 using arrayfire::common::cast;
 using detail::arithOp;
 using detail::Array;
 using detail::createValueArray;
+using detail::diagExtract;
 using detail::intl;
+using detail::matmul;
 using detail::mean;
 using detail::reduce;
 using detail::scalar;
+using detail::tile;
 using detail::uchar;
 using detail::uint;
 using detail::uintl;
+using detail::unaryOp;
 using detail::ushort;
 
 template<typename T, typename cType>
 static af_array cov(const af_array& X, const af_array& Y,
                     const af_var_bias bias) {
-    using weightType  = typename baseOutType<cType>::type;
     const Array<T> _x = getArray<T>(X);
     const Array<T> _y = getArray<T>(Y);
+#if defined(AF_CPU)
+    // One pass over both inputs instead of materialising the centred arrays
+    return getHandle<cType>(detail::cov<T, cType>(_x, _y, bias));
+#else
+    using weightType  = typename baseOutType<cType>::type;
     Array<cType> xArr = cast<cType>(_x);
     Array<cType> yArr = cast<cType>(_y);
 
@@ -62,10 +76,84 @@ static af_array cov(const af_array& X, const af_array& Y,
     Array<cType> result = arithOp<cType, af_div_t>(redArr, nArr, xDims);
 
     return getHandle<cType>(result);
+#endif
+}
+
+template<typename T, typename cType>
+static af_array covMatrix(const af_array& X, const af_var_bias bias,
+                          const bool correlation) {
+    const Array<T> in = getArray<T>(X);
+#if defined(AF_CPU)
+    return getHandle<cType>(detail::covMatrix<T, cType>(in, bias, correlation));
+#else
+    Array<cType> input = cast<cType>(in);
+    const dim4 dims    = input.dims();
+    const dim_t N      = (bias == AF_VARIANCE_SAMPLE ? dims[0] - 1 : dims[0]);
+
+    Array<cType> means   = mean<cType, cType, cType>(input, 0);
+    Array<cType> centred = arithOp<cType, af_sub_t>(
+        input, tile(means, dim4(dims[0], 1, 1, 1)), dims);
+    Array<cType> prod = matmul(centred, centred, AF_MAT_TRANS, AF_MAT_NONE);
+    const dim4 oDims = prod.dims();
+
+    if (correlation) {
+        Array<cType> sd    = unaryOp<cType, af_sqrt_t>(diagExtract(prod, 0));
+        Array<cType> scale = matmul(sd, sd, AF_MAT_NONE, AF_MAT_TRANS);
+        return getHandle<cType>(arithOp<cType, af_div_t>(prod, scale, oDims));
+    }
+    Array<cType> nArr = createValueArray<cType>(oDims, scalar<cType>(N));
+    return getHandle<cType>(arithOp<cType, af_div_t>(prod, nArr, oDims));
+#endif
+}
+
+static af_err covMatrix(af_array* out, const af_array X,
+                        const af_var_bias bias, const bool correlation) {
+    try {
+        const ArrayInfo& xInfo = getInfo(X);
+        af_dtype xType         = xInfo.getType();
+
+        ARG_ASSERT(1, (xInfo.ndims() <= 2));
+
+        af_array output = 0;
+        switch (xType) {
+            case f64:
+                output = covMatrix<double, double>(X, bias, correlation);
+                break;
+            case f32:
+                output = covMatrix<float, float>(X, bias, correlation);
+                break;
+            case s32:
+                output = covMatrix<int, float>(X, bias, correlation);
+                break;
+            case u32:
+                output = covMatrix<uint, float>(X, bias, correlation);
+                break;
+            case s64:
+                output = covMatrix<intl, double>(X, bias, correlation);
+                break;
+            case u64:
+                output = covMatrix<uintl, double>(X, bias, correlation);
+                break;
+            case s16:
+                output = covMatrix<short, float>(X, bias, correlation);
+                break;
+            case u16:
+                output = covMatrix<ushort, float>(X, bias, correlation);
+                break;
+            case u8:
+                output = covMatrix<uchar, float>(X, bias, correlation);
+                break;
+            default: TYPE_ERROR(1, xType);
+        }
+        std::swap(*out, output);
+    }
+    CATCHALL;
+    return AF_SUCCESS;
 }
 
 af_err af_cov(af_array* out, const af_array X, const af_array Y,
               const bool isbiased) {
+    AF_API_SCOPE;
     const af_var_bias bias =
         (isbiased ? AF_VARIANCE_SAMPLE : AF_VARIANCE_POPULATION);
     return af_cov_v2(out, X, Y, bias);
@@ -73,6 +161,7 @@ af_err af_cov(af_array* out, const af_array X, const af_array Y,
 
 af_err af_cov_v2(af_array* out, const af_array X, const af_array Y,
                  const af_var_bias bias) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& xInfo = getInfo(X);
         const ArrayInfo& yInfo = getInfo(Y);
@@ -105,3 +194,13 @@ af_err af_cov_v2(af_array* out, const af_array X, const af_array Y,
     CATCHALL;
     return AF_SUCCESS;
 }
+
+af_err af_cov_matrix(af_array* out, const af_array X, const af_var_bias bias) {
+    AF_API_SCOPE;
+    return covMatrix(out, X, bias, false);
+}
+
+af_err af_corrcoef_matrix(af_array* out, const af_array X) {
+    AF_API_SCOPE;
+    return covMatrix(out, X, AF_VARIANCE_POPULATION, true);
+}
@@ -26,6 +26,10 @@
 #include <unary.hpp>
 #include <af/image.h>
 
+#if defined(AF_CPU)
+#include <deconvolution.hpp>
+#endif
+
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -40,8 +44,10 @@ using detail::cdouble;
 using detail::cfloat;
 using detail::createSubArray;
 using detail::createValueArray;
+using detail::getScalar;
 using detail::logicOp;
 using detail::padArrayBorders;
+using detail::reduce_all;
 using detail::scalar;
 using detail::select_scalar;
 using detail::shift;
@@ -73,8 +79,8 @@ Array<T> complexNorm(const Array<CT>& input) {
 }
 
 std::vector<af_seq> calcPadInfo(dim4& inLPad, dim4& psfLPad, dim4& inUPad,
-                                dim4& psfUPad, dim4& odims, dim_t nElems,
-                                const dim4& idims, const dim4& fdims) {
+                                dim4& psfUPad, dim4& odims, const dim4& idims,
+                                const dim4& fdims) {
     vector<af_seq> index(4);
 
     for (int d = 0; d < 4; ++d) {
@@ -92,8 +98,6 @@ std::vector<af_seq> calcPadInfo(dim4& inLPad, dim4& psfLPad, dim4& inUPad,
             index[d].begin = inLPad[d];
             index[d].end   = index[d].begin + idims[d] - 1;
             index[d].step  = 1;
-
-            nElems *= odims[d];
         } else {
             inLPad[d]  = 0;
             psfLPad[d] = 0;
@@ -106,11 +110,22 @@ std::vector<af_seq> calcPadInfo(dim4& inLPad, dim4& psfLPad, dim4& inUPad,
     return index;
 }
 
+template<typename T>
+T sumOfSquares(const Array<T>& in) {
+    auto sq = arithOp<T, af_mul_t>(in, in, in.dims());
+    return getScalar<T>(reduce_all<af_add_t, T, T>(sq));
+}
+
+template<typename T, typename CT>
+T sumOfNorms(const Array<CT>& in) {
+    return getScalar<T>(reduce_all<af_add_t, T, T>(complexNorm<T, CT>(in)));
+}
+
 template<typename T, typename CT>
 void richardsonLucy(Array<T>& currentEstimate, const Array<T>& in,
                     const Array<CT>& P, const Array<CT>& Pc,
                     const unsigned iters, const float normFactor,
-                    const dim4 odims) {
+                    const dim4 odims, const float tolerance) {
     for (unsigned i = 0; i < iters; ++i) {
         auto fft1  = fft_r2c<CT, T>(currentEstimate, BASE_DIM);
         auto cmul1 = arithOp<CT, af_mul_t>(fft1, P, P.dims());
@@ -119,9 +134,18 @@ void richardsonLucy(Array<T>& currentEstimate, const Array<T>& in,
         auto fft2  = fft_r2c<CT, T>(div1, BASE_DIM);
         auto cmul2 = arithOp<CT, af_mul_t>(fft2, Pc, Pc.dims());
         auto ifft2 = fft_c2r<CT, T>(cmul2, normFactor, odims, BASE_DIM);
-
-        currentEstimate =
-            arithOp<T, af_mul_t>(currentEstimate, ifft2, ifft2.dims());
+        auto next  = arithOp<T, af_mul_t>(currentEstimate, ifft2, ifft2.dims());
+
+        if (tolerance > 0) {
+            auto diff    = arithOp<T, af_sub_t>(next, currentEstimate,
+                                             next.dims());
+            bool isDone  = sumOfSquares(diff) <=
+                          tolerance * tolerance * sumOfSquares(currentEstimate);
+            currentEstimate = next;
+            if (isDone) { break; }
+        } else {
+            currentEstimate = next;
+        }
     }
 }
 
@@ -129,7 +153,7 @@ template<typename T, typename CT>
 void landweber(Array<T>& currentEstimate, const Array<T>& in,
                const Array<CT>& P, const Array<CT>& Pc, const unsigned iters,
                const float relaxFactor, const float normFactor,
-               const dim4 odims) {
+               const dim4 odims, const float tolerance) {
     const dim4& dims = P.dims();
 
     auto I        = fft_r2c<CT, T>(in, BASE_DIM);
@@ -145,15 +169,27 @@ void landweber(Array<T>& currentEstimate, const Array<T>& in,
     auto iterTemp = I;
 
     for (unsigned i = 0; i < iters; ++i) {
-        auto mul = arithOp<CT, af_mul_t>(iterTemp, lhs, dims);
-        iterTemp = arithOp<CT, af_add_t>(mul, rhs, dims);
+        auto mul  = arithOp<CT, af_mul_t>(iterTemp, lhs, dims);
+        auto next = arithOp<CT, af_add_t>(mul, rhs, dims);
+
+        // The change is measured on the spectrum of the estimate
+        if (tolerance > 0) {
+            auto diff   = arithOp<CT, af_sub_t>(next, iterTemp, dims);
+            bool isDone = sumOfNorms<T, CT>(diff) <=
+                          tolerance * tolerance * sumOfNorms<T, CT>(iterTemp);
+            iterTemp    = next;
+            if (isDone) { break; }
+        } else {
+            iterTemp = next;
+        }
     }
     currentEstimate = fft_c2r<CT, T>(iterTemp, normFactor, odims, BASE_DIM);
 }
 
 template<typename InputType, typename RealType = float>
 af_array iterDeconv(const af_array in, const af_array ker, const uint iters,
-                    const float rfactor, const af_iterative_deconv_algo algo) {
+                    const float rfactor, const af_iterative_deconv_algo algo,
+                    const float tolerance) {
     using T    = RealType;
     using CT   = typename std::conditional<std::is_same<T, double>::value,
                                          cdouble, cfloat>::type;
@@ -161,12 +197,11 @@ af_array iterDeconv(const af_array in, const af_array ker, const uint iters,
     auto psf   = castArray<T>(ker);
     const dim4& idims = input.dims();
     const dim4& fdims = psf.dims();
-    dim_t nElems      = 1;
 
     dim4 inUPad, psfUPad, inLPad, psfLPad, odims(1);
 
-    auto index = calcPadInfo(inLPad, psfLPad, inUPad, psfUPad, odims, nElems,
-                             idims, fdims);
+    auto index =
+        calcPadInfo(inLPad, psfLPad, inUPad, psfUPad, odims, idims, fdims);
     auto paddedIn =
         padArrayBorders<T>(input, inLPad, inUPad, AF_PAD_CLAMP_TO_EDGE);
     auto paddedPsf = padArrayBorders<T>(psf, psfLPad, psfUPad, AF_PAD_ZERO);
@@ -175,28 +210,51 @@ af_array iterDeconv(const af_array in, const af_array ker, const uint iters,
                                           -int(fdims[1] / 2), 0, 0};
     auto shiftedPsf                    = shift(paddedPsf, shiftDims.data());
 
-    auto P  = fft_r2c<CT, T>(shiftedPsf, BASE_DIM);
+    auto P = fft_r2c<CT, T>(shiftedPsf, BASE_DIM);
+
+#if defined(AF_CPU)
+    // The PSF spectrum, the work buffers and the FFT plans are set up once
+    // for all iterations
+    Array<T> currentEstimate =
+        (algo == AF_ITERATIVE_DECONV_RICHARDSONLUCY
+             ? detail::richardsonLucy<T, CT>(paddedIn, P, iters, tolerance)
+             : detail::landweber<T, CT>(paddedIn, P, iters, rfactor,
+                                        tolerance));
+#else
     auto Pc = conj(P);
 
+    // The inverse transforms are unnormalized, so their scale is applied here
+    // as it is by the CPU kernels
     Array<T> currentEstimate = paddedIn;
-    const double normFactor  = 1 / static_cast<double>(nElems);
+    const double normFactor  = 1 / static_cast<double>(odims.elements());
 
     switch (algo) {
         case AF_ITERATIVE_DECONV_RICHARDSONLUCY:
             richardsonLucy(currentEstimate, paddedIn, P, Pc, iters, normFactor,
-                           odims);
+                           odims, tolerance);
             break;
         case AF_ITERATIVE_DECONV_LANDWEBER:
         default:
             landweber(currentEstimate, paddedIn, P, Pc, iters, rfactor,
-                      normFactor, odims);
+                      normFactor, odims, tolerance);
     }
+#endif
     return getHandle(createSubArray<T>(currentEstimate, index));
 }
 
 af_err af_iterative_deconv(af_array* out, const af_array in, const af_array ker,
                            const unsigned iterations, const float relax_factor,
                            const af_iterative_deconv_algo algo) {
+    return af_iterative_deconv_v2(out, in, ker, iterations, relax_factor, algo,
+                                  0.f);
+}
+
+af_err af_iterative_deconv_v2(af_array* out, const af_array in,
+                              const af_array ker, const unsigned iterations,
+                              const float relax_factor,
+                              const af_iterative_deconv_algo algo,
+                              const float tolerance) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& inputInfo  = getInfo(in);
         const dim4& inputDims       = inputInfo.dims();
@@ -211,22 +269,26 @@ af_err af_iterative_deconv(af_array* out, const af_array in, const af_array ker,
         ARG_ASSERT(6, (algo == AF_ITERATIVE_DECONV_DEFAULT ||
                        algo == AF_ITERATIVE_DECONV_LANDWEBER ||
                        algo == AF_ITERATIVE_DECONV_RICHARDSONLUCY));
+        ARG_ASSERT(7, (std::isfinite(tolerance) && tolerance >= 0));
         af_array res   = 0;
         unsigned iters = iterations;
         float rfac     = relax_factor;
+        float tol      = tolerance;
 
         af_dtype inputType = inputInfo.getType();
         switch (inputType) {
             case f32:
-                res = iterDeconv<float>(in, ker, iters, rfac, algo);
+                res = iterDeconv<float>(in, ker, iters, rfac, algo, tol);
                 break;
             case s16:
-                res = iterDeconv<short>(in, ker, iters, rfac, algo);
+                res = iterDeconv<short>(in, ker, iters, rfac, algo, tol);
                 break;
             case u16:
-                res = iterDeconv<ushort>(in, ker, iters, rfac, algo);
+                res = iterDeconv<ushort>(in, ker, iters, rfac, algo, tol);
+                break;
+            case u8:
+                res = iterDeconv<uchar>(in, ker, iters, rfac, algo, tol);
                 break;
-            case u8: res = iterDeconv<uchar>(in, ker, iters, rfac, algo); break;
             default: TYPE_ERROR(1, inputType);
         }
         std::swap(res, *out);
@@ -274,8 +336,8 @@ af_array invDeconv(const af_array in, const af_array ker, const float gamma,
 
     dim4 inUPad, psfUPad, inLPad, psfLPad, odims(1);
 
-    auto index = calcPadInfo(inLPad, psfLPad, inUPad, psfUPad, odims, nElems,
-                             idims, fdims);
+    auto index =
+        calcPadInfo(inLPad, psfLPad, inUPad, psfUPad, odims, idims, fdims);
     auto paddedIn =
         padArrayBorders<T>(input, inLPad, inUPad, AF_PAD_CLAMP_TO_EDGE);
     auto paddedPsf = padArrayBorders<T>(psf, psfLPad, psfUPad, AF_PAD_ZERO);
@@ -304,6 +366,7 @@ af_array invDeconv(const af_array in, const af_array ker, const float gamma,
 
 af_err af_inverse_deconv(af_array* out, const af_array in, const af_array psf,
                          const float gamma, const af_inverse_deconv_algo algo) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& inputInfo = getInfo(in);
         const dim4& inputDims      = inputInfo.dims();
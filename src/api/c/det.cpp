@@ -70,6 +70,7 @@ T det(const af_array a) {
 }
 
 af_err af_det(double *real_val, double *imag_val, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &i_info = getInfo(in);
 
@@ -54,6 +54,7 @@ using detail::uintl;
 using detail::ushort;
 
 af_err af_set_backend(const af_backend bknd) {
+    AF_API_SCOPE;
     try {
         if (bknd != getBackend() && bknd != AF_BACKEND_DEFAULT) {
             return AF_ERR_ARG;
@@ -65,11 +66,13 @@ af_err af_set_backend(const af_backend bknd) {
 }
 
 af_err af_get_backend_count(unsigned* num_backends) {
+    AF_API_SCOPE;
     *num_backends = 1;
     return AF_SUCCESS;
 }
 
 af_err af_get_available_backends(int* result) {
+    AF_API_SCOPE;
     try {
         *result = getBackend();
     }
@@ -78,6 +81,7 @@ af_err af_get_available_backends(int* result) {
 }
 
 af_err af_get_backend_id(af_backend* result, const af_array in) {
+    AF_API_SCOPE;
     try {
         if (in) {
             const ArrayInfo& info = getInfo(in, false);
@@ -91,6 +95,7 @@ af_err af_get_backend_id(af_backend* result, const af_array in) {
 }
 
 af_err af_get_device_id(int* device, const af_array in) {
+    AF_API_SCOPE;
     try {
         if (in) {
             const ArrayInfo& info = getInfo(in, false);
@@ -104,11 +109,13 @@ af_err af_get_device_id(int* device, const af_array in) {
 }
 
 af_err af_get_active_backend(af_backend* result) {
+    AF_API_SCOPE;
     *result = static_cast<af_backend>(getBackend());
     return AF_SUCCESS;
 }
 
 af_err af_init() {
+    AF_API_SCOPE;
     try {
         thread_local std::once_flag flag;
         std::call_once(flag, []() {
@@ -157,6 +164,7 @@ af_err af_init() {
 }
 
 af_err af_info() {
+    AF_API_SCOPE;
     try {
         printf("%s", getDeviceInfo().c_str());  // NOLINT
     }
@@ -165,6 +173,7 @@ af_err af_info() {
 }
 
 af_err af_info_string(char** str, const bool verbose) {
+    AF_API_SCOPE;
     UNUSED(verbose);  // TODO(umar): Add something useful
     try {
         std::string infoStr = getDeviceInfo();
@@ -184,6 +193,7 @@ af_err af_info_string(char** str, const bool verbose) {
 
 af_err af_device_info(char* d_name, char* d_platform, char* d_toolkit,
                       char* d_compute) {
+    AF_API_SCOPE;
     try {
         devprop(d_name, d_platform, d_toolkit, d_compute);
     }
@@ -192,6 +202,7 @@ af_err af_device_info(char* d_name, char* d_platform, char* d_toolkit,
 }
 
 af_err af_get_dbl_support(bool* available, const int device) {
+    AF_API_SCOPE;
     try {
         *available = isDoubleSupported(device);
     }
@@ -200,6 +211,7 @@ af_err af_get_dbl_support(bool* available, const int device) {
 }
 
 af_err af_get_half_support(bool* available, const int device) {
+    AF_API_SCOPE;
     try {
         *available = isHalfSupported(device);
     }
@@ -208,6 +220,7 @@ af_err af_get_half_support(bool* available, const int device) {
 }
 
 af_err af_get_device_count(int* nDevices) {
+    AF_API_SCOPE;
     try {
         *nDevices = getDeviceCount();
     }
@@ -217,6 +230,7 @@ af_err af_get_device_count(int* nDevices) {
 }
 
 af_err af_get_device(int* device) {
+    AF_API_SCOPE;
     try {
         *device = static_cast<int>(getActiveDeviceId());
     }
@@ -225,6 +239,7 @@ af_err af_get_device(int* device) {
 }
 
 af_err af_set_device(const int device) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, device >= 0);
         if (setDevice(device) < 0) {
@@ -251,6 +266,7 @@ af_err af_set_device(const int device) {
 }
 
 af_err af_sync(const int device) {
+    AF_API_SCOPE;
     try {
         int dev = device == -1 ? static_cast<int>(getActiveDeviceId()) : device;
         detail::sync(dev);
@@ -270,6 +286,7 @@ static inline void sparseEval(af_array arr) {
 }
 
 af_err af_eval(af_array arr) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(arr, false);
         af_dtype type         = info.getType();
@@ -306,6 +323,43 @@ af_err af_eval(af_array arr) {
     return AF_SUCCESS;
 }
 
+#if defined(AF_CPU)
+template<typename T>
+static inline void addEvalOutput(detail::JitOutputs& outputs, af_array arr) {
+    detail::addEvalOutput<T>(outputs, getArray<T>(arr));
+}
+
+af_err af_eval_multiple(int num, af_array* arrays) {
+    AF_API_SCOPE;
+    try {
+        // Arrays of any type and shape are evaluated in a single pass
+        detail::JitOutputs outputs;
+        for (int i = 0; i < num; i++) {
+            af_dtype type = getInfo(arrays[i]).getType();
+            switch (type) {
+                case f32: addEvalOutput<float>(outputs, arrays[i]); break;
+                case f64: addEvalOutput<double>(outputs, arrays[i]); break;
+                case c32: addEvalOutput<cfloat>(outputs, arrays[i]); break;
+                case c64: addEvalOutput<cdouble>(outputs, arrays[i]); break;
+                case s32: addEvalOutput<int>(outputs, arrays[i]); break;
+                case u32: addEvalOutput<uint>(outputs, arrays[i]); break;
+                case u8: addEvalOutput<uchar>(outputs, arrays[i]); break;
+                case b8: addEvalOutput<char>(outputs, arrays[i]); break;
+                case s64: addEvalOutput<intl>(outputs, arrays[i]); break;
+                case u64: addEvalOutput<uintl>(outputs, arrays[i]); break;
+                case s16: addEvalOutput<short>(outputs, arrays[i]); break;
+                case u16: addEvalOutput<ushort>(outputs, arrays[i]); break;
+                case f16: addEvalOutput<half>(outputs, arrays[i]); break;
+                default: TYPE_ERROR(0, type);
+            }
+        }
+        detail::evalOutputs(outputs);
+    }
+    CATCHALL;
+
+    return AF_SUCCESS;
+}
+#else
 template<typename T>
 static inline void evalMultiple(int num, af_array* arrayPtrs) {
     Array<T> empty = createEmptyArray<T>(dim4());
@@ -319,22 +373,22 @@ static inline void evalMultiple(int num, af_array* arrayPtrs) {
 }
 
 af_err af_eval_multiple(int num, af_array* arrays) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(arrays[0]);
         af_dtype type         = info.getType();
         const dim4& dims      = info.dims();
 
+        bool fusable = true;
         for (int i = 1; i < num; i++) {
             const ArrayInfo& currInfo = getInfo(arrays[i]);
+            fusable &= type == currInfo.getType() && dims == currInfo.dims();
+        }
 
-            // FIXME: This needs to be removed when new functionality is added
-            if (type != currInfo.getType()) {
-                AF_ERROR("All arrays must be of same type", AF_ERR_TYPE);
-            }
-
-            if (dims != currInfo.dims()) {
-                AF_ERROR("All arrays must be of same size", AF_ERR_SIZE);
-            }
+        // Only arrays of the same type and size are evaluated together
+        if (!fusable) {
+            for (int i = 0; i < num; i++) { AF_CHECK(af_eval(arrays[i])); }
+            return AF_SUCCESS;
         }
 
         switch (type) {
@@ -358,8 +412,10 @@ af_err af_eval_multiple(int num, af_array* arrays) {
 
     return AF_SUCCESS;
 }
+#endif
 
 af_err af_set_manual_eval_flag(bool flag) {
+    AF_API_SCOPE;
     try {
         bool& backendFlag = evalFlag();
         backendFlag       = !flag;
@@ -369,6 +425,7 @@ af_err af_set_manual_eval_flag(bool flag) {
 }
 
 af_err af_get_manual_eval_flag(bool* flag) {
+    AF_API_SCOPE;
     try {
         bool backendFlag = evalFlag();
         *flag            = !backendFlag;
@@ -378,6 +435,7 @@ af_err af_get_manual_eval_flag(bool* flag) {
 }
 
 af_err af_get_kernel_cache_directory(size_t* length, char* path) {
+    AF_API_SCOPE;
     try {
         std::string& cache_path = getCacheDirectory();
         if (path == nullptr) {
@@ -400,6 +458,7 @@ af_err af_get_kernel_cache_directory(size_t* length, char* path) {
 }
 
 af_err af_set_kernel_cache_directory(const char* path, int override_env) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(path != nullptr, 1);
         if (override_env) {
@@ -54,6 +54,7 @@ static af_array dog(const af_array& in, const int radius1, const int radius2) {
 
 af_err af_dog(af_array* out, const af_array in, const int radius1,
               const int radius2) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(in);
         dim4 inDims           = info.dims();
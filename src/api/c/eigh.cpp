@@ -0,0 +1,85 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <eigh.hpp>
+
+#include <Array.hpp>
+#include <backend.hpp>
+#include <common/ArrayInfo.hpp>
+#include <common/err_common.hpp>
+#include <handle.hpp>
+#include <lapack_common.hpp>
+#include <af/array.h>
+#include <af/defines.h>
+#include <af/dim4.hpp>
+#include <af/lapack.h>
+
+using af::dim4;
+using af::dtype_traits;
+using arrayfire::common::lapackBatchSupported;
+using arrayfire::getArray;
+using detail::Array;
+using detail::cdouble;
+using detail::cfloat;
+using detail::createEmptyArray;
+
+template<typename T>
+static inline void eigh(af_array *values, af_array *vectors, const af_array in,
+                        const unsigned k, const bool is_upper) {
+    using Tr = typename dtype_traits<T>::base_type;
+
+    Array<Tr> valuesArray = createEmptyArray<Tr>(dim4());
+    Array<T> vectorsArray = createEmptyArray<T>(dim4());
+
+    eigh<T, Tr>(valuesArray, vectorsArray, getArray<T>(in), k, is_upper,
+                vectors != nullptr);
+
+    *values = getHandle(valuesArray);
+    if (vectors) { *vectors = getHandle(vectorsArray); }
+}
+
+af_err af_eigh(af_array *values, af_array *vectors, const af_array in,
+               const unsigned k, const bool is_upper) {
+    AF_API_SCOPE;
+    try {
+        ARG_ASSERT(0, values != nullptr);
+
+        const ArrayInfo &i_info = getInfo(in);
+        af_dtype type           = i_info.getType();
+        dim4 dims               = i_info.dims();
+
+        if (!lapackBatchSupported && i_info.ndims() > 2) {
+            AF_ERROR("eigh can not be used in batch mode", AF_ERR_BATCH);
+        }
+
+        ARG_ASSERT(2, i_info.isFloating());  // Only floating and complex types
+        DIM_ASSERT(2, dims[0] == dims[1]);   // Only square matrices
+        ARG_ASSERT(3, k <= dims[0]);
+
+        if (i_info.ndims() == 0) {
+            af_dtype rtype = (type == c32) ? f32 : (type == c64) ? f64 : type;
+            AF_CHECK(af_create_handle(values, 0, nullptr, rtype));
+            if (vectors) {
+                AF_CHECK(af_create_handle(vectors, 0, nullptr, type));
+            }
+            return AF_SUCCESS;
+        }
+
+        switch (type) {
+            case f32: eigh<float>(values, vectors, in, k, is_upper); break;
+            case f64: eigh<double>(values, vectors, in, k, is_upper); break;
+            case c32: eigh<cfloat>(values, vectors, in, k, is_upper); break;
+            case c64: eigh<cdouble>(values, vectors, in, k, is_upper); break;
+            default: TYPE_ERROR(2, type);
+        }
+    }
+    CATCHALL;
+
+    return AF_SUCCESS;
+}
@@ -39,6 +39,7 @@ void af_get_last_error(char **str, dim_t *len) {
 }
 
 af_err af_set_enable_stacktrace(int is_enabled) {
+    AF_API_SCOPE;
     arrayfire::common::is_stacktrace_enabled() = is_enabled;
 
     return AF_SUCCESS;
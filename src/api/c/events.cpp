@@ -28,6 +28,7 @@ Event &getEvent(af_event handle) {
 af_event getHandle(Event &event) { return static_cast<af_event>(&event); }
 
 af_err af_create_event(af_event *handle) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         *handle = createEvent();
@@ -38,6 +39,7 @@ af_err af_create_event(af_event *handle) {
 }
 
 af_err af_delete_event(af_event handle) {
+    AF_API_SCOPE;
     try {
         delete &getEvent(handle);
     }
@@ -47,6 +49,7 @@ af_err af_delete_event(af_event handle) {
 }
 
 af_err af_mark_event(const af_event handle) {
+    AF_API_SCOPE;
     try {
         markEventOnActiveQueue(handle);
     }
@@ -56,6 +59,7 @@ af_err af_mark_event(const af_event handle) {
 }
 
 af_err af_enqueue_wait_event(const af_event handle) {
+    AF_API_SCOPE;
     try {
         enqueueWaitOnActiveQueue(handle);
     }
@@ -65,6 +69,7 @@ af_err af_enqueue_wait_event(const af_event handle) {
 }
 
 af_err af_block_event(const af_event handle) {
+    AF_API_SCOPE;
     try {
         block(handle);
     }
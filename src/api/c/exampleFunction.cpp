@@ -51,6 +51,7 @@ af_array example(const af_array& a, const af_array& b,
 
 af_err af_example_function(af_array* out, const af_array a,
                            const af_someenum_t param) {
+    AF_API_SCOPE;
     try {
         af_array output = 0;
         const ArrayInfo& info =
@@ -10,6 +10,7 @@
 #include <Array.hpp>
 #include <backend.hpp>
 #include <common/err_common.hpp>
+#include <copy.hpp>
 #include <fast.hpp>
 #include <features.hpp>
 #include <handle.hpp>
@@ -18,25 +19,121 @@
 #include <af/features.h>
 #include <af/vision.h>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 using af::dim4;
 using detail::Array;
+using detail::copyData;
 using detail::createEmptyArray;
+using detail::createHostDataArray;
 using detail::createValueArray;
 using detail::uchar;
 using detail::uint;
 using detail::ushort;
+using std::vector;
+
+// Keeps at most max_per_cell features in every cell of a grid_rows x
+// grid_cols grid laid over the image, choosing the ones with the highest
+// scores. If more than max_feat features remain, the cells give up their
+// weakest features first: every cell keeps its k strongest, for the largest
+// k that fits, and the rest of the budget goes to the next strongest by
+// score. Kept features stay in detection order.
+static unsigned capFeaturesPerCell(Array<float> &x, Array<float> &y,
+                                   Array<float> &score, const unsigned n,
+                                   const dim4 &idims, const unsigned grid_rows,
+                                   const unsigned grid_cols,
+                                   const unsigned max_per_cell,
+                                   const unsigned max_feat) {
+    if (n == 0) { return n; }
+
+    vector<float> h_x(n), h_y(n), h_score(n);
+    copyData(h_x.data(), x);
+    copyData(h_y.data(), y);
+    copyData(h_score.data(), score);
+
+    const float cell_h = static_cast<float>(idims[0]) / grid_rows;
+    const float cell_w = static_cast<float>(idims[1]) / grid_cols;
+
+    vector<vector<unsigned>> cells(grid_rows * grid_cols);
+    for (unsigned i = 0; i < n; ++i) {
+        const unsigned r = std::min(static_cast<unsigned>(h_y[i] / cell_h),
+                                    grid_rows - 1);
+        const unsigned c = std::min(static_cast<unsigned>(h_x[i] / cell_w),
+                                    grid_cols - 1);
+        cells[c * grid_rows + r].push_back(i);
+    }
+
+    auto stronger = [&h_score](unsigned a, unsigned b) {
+        return h_score[a] > h_score[b] || (h_score[a] == h_score[b] && a < b);
+    };
+
+    // Rank of every feature within its cell, the strongest is 0
+    vector<unsigned> rank(n);
+    vector<unsigned> candidates;
+    candidates.reserve(n);
+    for (vector<unsigned> &cell : cells) {
+        std::sort(cell.begin(), cell.end(), stronger);
+        const size_t ncell = std::min<size_t>(cell.size(), max_per_cell);
+        for (size_t k = 0; k < ncell; ++k) {
+            rank[cell[k]] = static_cast<unsigned>(k);
+            candidates.push_back(cell[k]);
+        }
+    }
+
+    const unsigned kept =
+        std::min(static_cast<unsigned>(candidates.size()), max_feat);
+    std::nth_element(candidates.begin(), candidates.begin() + kept,
+                     candidates.end(), [&](unsigned a, unsigned b) {
+                         return rank[a] < rank[b] ||
+                                (rank[a] == rank[b] && stronger(a, b));
+                     });
+    candidates.resize(kept);
+    std::sort(candidates.begin(), candidates.end());
+
+    for (unsigned k = 0; k < kept; ++k) {
+        h_x[k]     = h_x[candidates[k]];
+        h_y[k]     = h_y[candidates[k]];
+        h_score[k] = h_score[candidates[k]];
+    }
+
+    if (kept < n) {
+        x     = createHostDataArray<float>(dim4(kept), h_x.data());
+        y     = createHostDataArray<float>(dim4(kept), h_y.data());
+        score = createHostDataArray<float>(dim4(kept), h_score.data());
+    }
+    return kept;
+}
 
 template<typename T>
 static af_features fast(af_array const &in, const float thr,
                         const unsigned arc_length, const bool non_max,
-                        const float feature_ratio, const unsigned edge) {
+                        const float feature_ratio, const unsigned edge,
+                        const unsigned grid_rows, const unsigned grid_cols,
+                        const unsigned max_per_cell) {
     Array<float> x     = createEmptyArray<float>(dim4());
     Array<float> y     = createEmptyArray<float>(dim4());
     Array<float> score = createEmptyArray<float>(dim4());
 
+    const Array<T> &input = getArray<T>(in);
+
+    // With a cell cap, every candidate is detected and the limit set by
+    // feature_ratio is applied after the cap, so that it cannot drop whole
+    // cells at the end of the scan
     af_features_t feat;
-    feat.n = fast<T>(x, y, score, getArray<T>(in), thr, arc_length, non_max,
-                     feature_ratio, edge);
+    if (max_per_cell > 0) {
+        const unsigned max_feat = static_cast<unsigned>(
+            std::ceil(input.elements() * feature_ratio));
+        feat.n = fast<T>(x, y, score, input, thr, arc_length, non_max, 1.0f,
+                         edge);
+        feat.n = capFeaturesPerCell(x, y, score, feat.n, input.dims(),
+                                    grid_rows, grid_cols, max_per_cell,
+                                    max_feat);
+    } else {
+        feat.n = fast<T>(x, y, score, input, thr, arc_length, non_max,
+                         feature_ratio, edge);
+    }
 
     Array<float> orientation = createValueArray<float>(feat.n, 0.0);
     Array<float> size        = createValueArray<float>(feat.n, 1.0);
@@ -53,6 +150,16 @@ static af_features fast(af_array const &in, const float thr,
 af_err af_fast(af_features *out, const af_array in, const float thr,
                const unsigned arc_length, const bool non_max,
                const float feature_ratio, const unsigned edge) {
+    return af_fast_v2(out, in, thr, arc_length, non_max, feature_ratio, edge,
+                      1, 1, 0);
+}
+
+af_err af_fast_v2(af_features *out, const af_array in, const float thr,
+                  const unsigned arc_length, const bool non_max,
+                  const float feature_ratio, const unsigned edge,
+                  const unsigned grid_rows, const unsigned grid_cols,
+                  const unsigned max_per_cell) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         af::dim4 dims         = info.dims();
@@ -62,6 +169,8 @@ af_err af_fast(af_features *out, const af_array in, const float thr,
         ARG_ASSERT(3, thr > 0.0f);
         ARG_ASSERT(4, (arc_length >= 9 && arc_length <= 16));
         ARG_ASSERT(6, (feature_ratio > 0.0f && feature_ratio <= 1.0f));
+        ARG_ASSERT(8, grid_rows > 0);
+        ARG_ASSERT(9, grid_cols > 0);
 
         dim_t in_ndims = dims.ndims();
         DIM_ASSERT(1, (in_ndims == 2));
@@ -70,35 +179,35 @@ af_err af_fast(af_features *out, const af_array in, const float thr,
         switch (type) {
             case f32:
                 *out = fast<float>(in, thr, arc_length, non_max, feature_ratio,
-                                   edge);
+                                   edge, grid_rows, grid_cols, max_per_cell);
                 break;
             case f64:
                 *out = fast<double>(in, thr, arc_length, non_max, feature_ratio,
-                                    edge);
+                                    edge, grid_rows, grid_cols, max_per_cell);
                 break;
             case b8:
                 *out = fast<char>(in, thr, arc_length, non_max, feature_ratio,
-                                  edge);
+                                  edge, grid_rows, grid_cols, max_per_cell);
                 break;
             case s32:
                 *out = fast<int>(in, thr, arc_length, non_max, feature_ratio,
-                                 edge);
+                                 edge, grid_rows, grid_cols, max_per_cell);
                 break;
             case u32:
                 *out = fast<uint>(in, thr, arc_length, non_max, feature_ratio,
-                                  edge);
+                                  edge, grid_rows, grid_cols, max_per_cell);
                 break;
             case s16:
                 *out = fast<short>(in, thr, arc_length, non_max, feature_ratio,
-                                   edge);
+                                   edge, grid_rows, grid_cols, max_per_cell);
                 break;
             case u16:
                 *out = fast<ushort>(in, thr, arc_length, non_max, feature_ratio,
-                                    edge);
+                                    edge, grid_rows, grid_cols, max_per_cell);
                 break;
             case u8:
                 *out = fast<uchar>(in, thr, arc_length, non_max, feature_ratio,
-                                   edge);
+                                   edge, grid_rows, grid_cols, max_per_cell);
                 break;
             default: TYPE_ERROR(1, type);
         }
@@ -82,12 +82,14 @@ af_err fft(af_array *out, const af_array in, const double norm_factor,
 
 af_err af_fft(af_array *out, const af_array in, const double norm_factor,
               const dim_t pad0) {
+    AF_API_SCOPE;
     const dim_t pad[1] = {pad0};
     return fft(out, in, norm_factor, (pad0 > 0 ? 1 : 0), pad, 1, true);
 }
 
 af_err af_fft2(af_array *out, const af_array in, const double norm_factor,
                const dim_t pad0, const dim_t pad1) {
+    AF_API_SCOPE;
     const dim_t pad[2] = {pad0, pad1};
     return fft(out, in, norm_factor, (pad0 > 0 && pad1 > 0 ? 2 : 0), pad, 2,
                true);
@@ -95,6 +97,7 @@ af_err af_fft2(af_array *out, const af_array in, const double norm_factor,
 
 af_err af_fft3(af_array *out, const af_array in, const double norm_factor,
                const dim_t pad0, const dim_t pad1, const dim_t pad2) {
+    AF_API_SCOPE;
     const dim_t pad[3] = {pad0, pad1, pad2};
     return fft(out, in, norm_factor, (pad0 > 0 && pad1 > 0 && pad2 > 0 ? 3 : 0),
                pad, 3, true);
@@ -102,12 +105,14 @@ af_err af_fft3(af_array *out, const af_array in, const double norm_factor,
 
 af_err af_ifft(af_array *out, const af_array in, const double norm_factor,
                const dim_t pad0) {
+    AF_API_SCOPE;
     const dim_t pad[1] = {pad0};
     return fft(out, in, norm_factor, (pad0 > 0 ? 1 : 0), pad, 1, false);
 }
 
 af_err af_ifft2(af_array *out, const af_array in, const double norm_factor,
                 const dim_t pad0, const dim_t pad1) {
+    AF_API_SCOPE;
     const dim_t pad[2] = {pad0, pad1};
     return fft(out, in, norm_factor, (pad0 > 0 && pad1 > 0 ? 2 : 0), pad, 2,
                false);
@@ -115,6 +120,7 @@ af_err af_ifft2(af_array *out, const af_array in, const double norm_factor,
 
 af_err af_ifft3(af_array *out, const af_array in, const double norm_factor,
                 const dim_t pad0, const dim_t pad1, const dim_t pad2) {
+    AF_API_SCOPE;
     const dim_t pad[3] = {pad0, pad1, pad2};
     return fft(out, in, norm_factor, (pad0 > 0 && pad1 > 0 && pad2 > 0 ? 3 : 0),
                pad, 3, false);
@@ -154,26 +160,32 @@ af_err fft_inplace(af_array in, const double norm_factor, int rank,
 }
 
 af_err af_fft_inplace(af_array in, const double norm_factor) {
+    AF_API_SCOPE;
     return fft_inplace(in, norm_factor, 1, true);
 }
 
 af_err af_fft2_inplace(af_array in, const double norm_factor) {
+    AF_API_SCOPE;
     return fft_inplace(in, norm_factor, 2, true);
 }
 
 af_err af_fft3_inplace(af_array in, const double norm_factor) {
+    AF_API_SCOPE;
     return fft_inplace(in, norm_factor, 3, true);
 }
 
 af_err af_ifft_inplace(af_array in, const double norm_factor) {
+    AF_API_SCOPE;
     return fft_inplace(in, norm_factor, 1, false);
 }
 
 af_err af_ifft2_inplace(af_array in, const double norm_factor) {
+    AF_API_SCOPE;
     return fft_inplace(in, norm_factor, 2, false);
 }
 
 af_err af_ifft3_inplace(af_array in, const double norm_factor) {
+    AF_API_SCOPE;
     return fft_inplace(in, norm_factor, 3, false);
 }
 
@@ -217,12 +229,14 @@ af_err fft_r2c(af_array *out, const af_array in, const double norm_factor,
 
 af_err af_fft_r2c(af_array *out, const af_array in, const double norm_factor,
                   const dim_t pad0) {
+    AF_API_SCOPE;
     const dim_t pad[1] = {pad0};
     return fft_r2c(out, in, norm_factor, (pad0 > 0 ? 1 : 0), pad, 1);
 }
 
 af_err af_fft2_r2c(af_array *out, const af_array in, const double norm_factor,
                    const dim_t pad0, const dim_t pad1) {
+    AF_API_SCOPE;
     const dim_t pad[2] = {pad0, pad1};
     return fft_r2c(out, in, norm_factor, (pad0 > 0 && pad1 > 0 ? 2 : 0), pad,
                    2);
@@ -230,6 +244,7 @@ af_err af_fft2_r2c(af_array *out, const af_array in, const double norm_factor,
 
 af_err af_fft3_r2c(af_array *out, const af_array in, const double norm_factor,
                    const dim_t pad0, const dim_t pad1, const dim_t pad2) {
+    AF_API_SCOPE;
     const dim_t pad[3] = {pad0, pad1, pad2};
     return fft_r2c(out, in, norm_factor,
                    (pad0 > 0 && pad1 > 0 && pad2 > 0 ? 3 : 0), pad, 3);
@@ -276,20 +291,24 @@ af_err fft_c2r(af_array *out, const af_array in, const double norm_factor,
 
 af_err af_fft_c2r(af_array *out, const af_array in, const double norm_factor,
                   const bool is_odd) {
+    AF_API_SCOPE;
     return fft_c2r(out, in, norm_factor, is_odd, 1);
 }
 
 af_err af_fft2_c2r(af_array *out, const af_array in, const double norm_factor,
                    const bool is_odd) {
+    AF_API_SCOPE;
     return fft_c2r(out, in, norm_factor, is_odd, 2);
 }
 
 af_err af_fft3_c2r(af_array *out, const af_array in, const double norm_factor,
                    const bool is_odd) {
+    AF_API_SCOPE;
     return fft_c2r(out, in, norm_factor, is_odd, 3);
 }
 
 af_err af_set_fft_plan_cache_size(size_t cache_size) {
+    AF_API_SCOPE;
     try {
         detail::setFFTPlanCacheSize(cache_size);
     }
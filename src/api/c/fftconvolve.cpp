@@ -16,7 +16,9 @@
 #include <common/err_common.hpp>
 #include <complex.hpp>
 #include <fft_common.hpp>
+#include <filter_common.hpp>
 #include <handle.hpp>
+#include <math.hpp>
 #include <af/defines.h>
 #include <af/dim4.hpp>
 #include <af/signal.h>
@@ -27,14 +29,20 @@
 
 using af::dim4;
 using arrayfire::common::cast;
+using arrayfire::common::channels;
+using arrayfire::common::hasState;
+using arrayfire::common::sameChannels;
 using detail::arithOp;
 using detail::Array;
 using detail::cdouble;
 using detail::cfloat;
+using detail::createEmptyArray;
 using detail::createSubArray;
+using detail::createValueArray;
 using detail::fftconvolve;
 using detail::intl;
 using detail::real;
+using detail::scalar;
 using detail::uchar;
 using detail::uint;
 using detail::uintl;
@@ -234,11 +242,13 @@ af_err fft_convolve(af_array *out, const af_array signal, const af_array filter,
 
 af_err af_fft_convolve1(af_array *out, const af_array signal,
                         const af_array filter, const af_conv_mode mode) {
+    AF_API_SCOPE;
     return fft_convolve(out, signal, filter, mode == AF_CONV_EXPAND, 1);
 }
 
 af_err af_fft_convolve2(af_array *out, const af_array signal,
                         const af_array filter, const af_conv_mode mode) {
+    AF_API_SCOPE;
     try {
         if (getInfo(signal).dims().ndims() < 2 &&
             getInfo(filter).dims().ndims() < 2) {
@@ -251,6 +261,7 @@ af_err af_fft_convolve2(af_array *out, const af_array signal,
 
 af_err af_fft_convolve3(af_array *out, const af_array signal,
                         const af_array filter, const af_conv_mode mode) {
+    AF_API_SCOPE;
     try {
         if (getInfo(signal).dims().ndims() < 3 &&
             getInfo(filter).dims().ndims() < 3) {
@@ -260,3 +271,67 @@ af_err af_fft_convolve3(af_array *out, const af_array signal,
     }
     CATCHALL;
 }
+
+namespace {
+
+template<typename T>
+void fftconvolveStream(af_array* y, af_array* zf, const af_array signal,
+                       const af_array filter, const af_array zi,
+                       const dim4& zdims) {
+    const Array<T> pending = hasState(zi)
+                                 ? getArray<T>(zi)
+                                 : createValueArray<T>(zdims, scalar<T>(0));
+    Array<T> zfArray = createEmptyArray<T>(dim4());
+    Array<T> yArray  = fftconvolve<T>(zfArray, getArray<T>(signal),
+                                     getArray<T>(filter), pending);
+
+    *y = getHandle(yArray);
+    if (zf) { *zf = getHandle(zfArray); }
+}
+
+}  // namespace
+
+af_err af_fft_convolve1_stream(af_array* y, af_array* zf, const af_array signal,
+                               const af_array filter, const af_array zi) {
+    AF_API_SCOPE;
+    try {
+        ARG_ASSERT(0, y != nullptr);
+
+        const ArrayInfo& sInfo = getInfo(signal);
+        const ArrayInfo& fInfo = getInfo(filter);
+
+        const af_dtype type = sInfo.getType();
+        ARG_ASSERT(2, type == f32 || type == f64);
+        ARG_ASSERT(3, fInfo.getType() == type);
+        ARG_ASSERT(2, sInfo.elements() > 0);
+
+        // The pending outputs carry at least one sample to the next block
+        const dim4 sdims = sInfo.dims();
+        const dim4 fdims = fInfo.dims();
+        ARG_ASSERT(3, fdims[0] > 1);
+
+        // Single column signals and filters are shared by all channels
+        const dim4 cdims = channels(sdims) == 1 ? fdims : sdims;
+        ARG_ASSERT(2, channels(sdims) == 1 || sameChannels(sdims, cdims));
+        ARG_ASSERT(3, channels(fdims) == 1 || sameChannels(fdims, cdims));
+
+        const dim4 zdims(fdims[0] - 1, cdims[1], cdims[2], cdims[3]);
+        if (hasState(zi)) {
+            const ArrayInfo& zInfo = getInfo(zi);
+            ARG_ASSERT(4, zInfo.getType() == type);
+            DIM_ASSERT(4, zInfo.dims() == zdims);
+        }
+
+        switch (type) {
+            case f32:
+                fftconvolveStream<float>(y, zf, signal, filter, zi, zdims);
+                break;
+            case f64:
+                fftconvolveStream<double>(y, zf, signal, filter, zi, zdims);
+                break;
+            default: TYPE_ERROR(2, type);
+        }
+    }
+    CATCHALL;
+    return AF_SUCCESS;
+}
@@ -0,0 +1,36 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+
+#include <handle.hpp>
+#include <af/defines.h>
+#include <af/dim4.hpp>
+
+namespace arrayfire {
+namespace common {
+
+/// Number of channels of an array, counted over dimensions 1 to 3
+inline dim_t channels(const af::dim4& dims) {
+    return dims[1] * dims[2] * dims[3];
+}
+
+/// True if \p a and \p b have the same sizes along dimensions 1 to 3
+inline bool sameChannels(const af::dim4& a, const af::dim4& b) {
+    return a[1] == b[1] && a[2] == b[2] && a[3] == b[3];
+}
+
+/// True if \p zi holds the state of a filter carried over from an earlier
+/// block of the signal. Null and empty arrays stand for zero states.
+inline bool hasState(const af_array zi) {
+    return zi != 0 && getInfo(zi).elements() > 0;
+}
+
+}  // namespace common
+}  // namespace arrayfire
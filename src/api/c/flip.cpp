@@ -37,6 +37,7 @@ static inline af_array flip(const af_array in, const unsigned dim) {
 }
 
 af_err af_flip(af_array *result, const af_array in, const unsigned dim) {
+    AF_API_SCOPE;
     af_array out;
     try {
         const ArrayInfo &in_info = getInfo(in);
@@ -89,6 +89,7 @@ Array<T> gaussianKernel(const int rows, const int cols, const double sigma_r,
 
 af_err af_gaussian_kernel(af_array *out, const int rows, const int cols,
                           const double sigma_r, const double sigma_c) {
+    AF_API_SCOPE;
     try {
         af_array res;
         res = getHandle<float>(
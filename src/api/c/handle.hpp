@@ -10,6 +10,7 @@
 #pragma once
 #include <Array.hpp>
 #include <backend.hpp>
+#include <common/ObjectPool.hpp>
 #include <common/err_common.hpp>
 #include <common/traits.hpp>
 #include <copy.hpp>
@@ -78,14 +79,14 @@ int getUseCount(const af_array &arr) {
 
 template<typename T>
 af_array getHandle(const detail::Array<T> &A) {
-    detail::Array<T> *ret = new detail::Array<T>(A);
+    detail::Array<T> *ret = common::createPooled<detail::Array<T>>(A);
     return static_cast<af_array>(ret);
 }
 
 template<typename T>
 af_array retainHandle(const af_array in) {
     detail::Array<T> *A   = static_cast<detail::Array<T> *>(in);
-    detail::Array<T> *out = new detail::Array<T>(*A);
+    detail::Array<T> *out = common::createPooled<detail::Array<T>>(*A);
     return static_cast<af_array>(out);
 }
 
@@ -30,6 +30,7 @@ inline af_array histogram(const af_array in, const unsigned &nbins,
 
 af_err af_histogram(af_array *out, const af_array in, const unsigned nbins,
                     const double minval, const double maxval) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         af_dtype type         = info.getType();
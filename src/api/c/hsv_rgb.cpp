@@ -56,9 +56,11 @@ af_err convert(af_array* out, const af_array& in) {
 }
 
 af_err af_hsv2rgb(af_array* out, const af_array in) {
+    AF_API_SCOPE;
     return convert<true>(out, in);
 }
 
 af_err af_rgb2hsv(af_array* out, const af_array in) {
+    AF_API_SCOPE;
     return convert<false>(out, in);
 }
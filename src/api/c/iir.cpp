@@ -9,20 +9,31 @@
 #include <backend.hpp>
 #include <common/err_common.hpp>
 #include <convolve.hpp>
+#include <filter_common.hpp>
 #include <handle.hpp>
 #include <iir.hpp>
+#include <math.hpp>
 #include <af/arith.h>
 #include <af/defines.h>
 #include <af/dim4.hpp>
 #include <af/signal.h>
 
+#include <algorithm>
 #include <cstdio>
 
 using af::dim4;
+using arrayfire::common::channels;
+using arrayfire::common::hasState;
+using arrayfire::common::sameChannels;
+using detail::Array;
 using detail::cdouble;
 using detail::cfloat;
+using detail::createEmptyArray;
+using detail::createValueArray;
+using detail::scalar;
 
 af_err af_fir(af_array* y, const af_array b, const af_array x) {
+    AF_API_SCOPE;
     try {
         af_array out;
         AF_CHECK(af_convolve1(&out, x, b, AF_CONV_EXPAND, AF_CONV_AUTO));
@@ -49,6 +60,7 @@ inline static af_array iir(const af_array b, const af_array a,
 
 af_err af_iir(af_array* y, const af_array b, const af_array a,
               const af_array x) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& ainfo = getInfo(a);
         const ArrayInfo& binfo = getInfo(b);
@@ -97,3 +109,132 @@ af_err af_iir(af_array* y, const af_array b, const af_array a,
     CATCHALL;
     return AF_SUCCESS;
 }
+
+namespace {
+
+bool isFilterType(const af_dtype type) {
+    return type == f32 || type == f64 || type == c32 || type == c64;
+}
+
+/// Checks that the initial states \p zi, argument \p argId, have \p sdims
+/// and the type \p type
+void checkStates(const int argId, const af_array zi, const dim4& sdims,
+                 const af_dtype type) {
+    if (!hasState(zi)) { return; }
+    const ArrayInfo& info = getInfo(zi);
+    ARG_ASSERT(argId, info.getType() == type);
+    DIM_ASSERT(argId, info.dims() == sdims);
+}
+
+template<typename T>
+Array<T> initialStates(const af_array zi, const dim4& sdims) {
+    return hasState(zi) ? getArray<T>(zi)
+                         : createValueArray<T>(sdims, scalar<T>(0));
+}
+
+template<typename T>
+void iirState(af_array* y, af_array* zf, const af_array b, const af_array a,
+              const af_array x, const af_array zi, const dim4& sdims) {
+    Array<T> zfArray = createEmptyArray<T>(dim4());
+    Array<T> yArray  = iir<T>(zfArray, getArray<T>(b), getArray<T>(a),
+                             getArray<T>(x), initialStates<T>(zi, sdims));
+
+    *y = getHandle(yArray);
+    if (zf) { *zf = getHandle(zfArray); }
+}
+
+template<typename T>
+void iirSos(af_array* y, af_array* zf, const af_array sos, const af_array x,
+            const af_array zi, const dim4& sdims) {
+    Array<T> zfArray = createEmptyArray<T>(dim4());
+    Array<T> yArray  = iirSos<T>(zfArray, getArray<T>(sos), getArray<T>(x),
+                                initialStates<T>(zi, sdims));
+
+    *y = getHandle(yArray);
+    if (zf) { *zf = getHandle(zfArray); }
+}
+
+}  // namespace
+
+af_err af_iir_state(af_array* y, af_array* zf, const af_array b,
+                    const af_array a, const af_array x, const af_array zi) {
+    AF_API_SCOPE;
+    try {
+        ARG_ASSERT(0, y != nullptr);
+
+        const ArrayInfo& ainfo = getInfo(a);
+        const ArrayInfo& binfo = getInfo(b);
+        const ArrayInfo& xinfo = getInfo(x);
+
+        const af_dtype xtype = xinfo.getType();
+        ARG_ASSERT(4, isFilterType(xtype));
+        ARG_ASSERT(2, binfo.getType() == xtype);
+        ARG_ASSERT(3, ainfo.getType() == xtype);
+
+        const dim4 adims = ainfo.dims();
+        const dim4 bdims = binfo.dims();
+        const dim4 xdims = xinfo.dims();
+        ARG_ASSERT(2, binfo.elements() > 0);
+        ARG_ASSERT(3, ainfo.elements() > 0);
+
+        // The states carry at least one sample over to the next block
+        const dim_t order = std::max(bdims[0], adims[0]) - 1;
+        ARG_ASSERT(3, order > 0);
+
+        // Single column inputs and coefficients are shared by all channels
+        dim4 cdims = xdims;
+        if (channels(cdims) == 1) {
+            cdims = channels(bdims) > 1 ? bdims : adims;
+        }
+        ARG_ASSERT(2, channels(bdims) == 1 || sameChannels(bdims, cdims));
+        ARG_ASSERT(3, channels(adims) == 1 || sameChannels(adims, cdims));
+        ARG_ASSERT(4, channels(xdims) == 1 || sameChannels(xdims, cdims));
+
+        const dim4 sdims(order, cdims[1], cdims[2], cdims[3]);
+        checkStates(5, zi, sdims, xtype);
+
+        switch (xtype) {
+            case f32: iirState<float>(y, zf, b, a, x, zi, sdims); break;
+            case f64: iirState<double>(y, zf, b, a, x, zi, sdims); break;
+            case c32: iirState<cfloat>(y, zf, b, a, x, zi, sdims); break;
+            case c64: iirState<cdouble>(y, zf, b, a, x, zi, sdims); break;
+            default: TYPE_ERROR(4, xtype);
+        }
+    }
+    CATCHALL;
+    return AF_SUCCESS;
+}
+
+af_err af_iir_sos(af_array* y, af_array* zf, const af_array sos,
+                  const af_array x, const af_array zi) {
+    AF_API_SCOPE;
+    try {
+        ARG_ASSERT(0, y != nullptr);
+
+        const ArrayInfo& sinfo = getInfo(sos);
+        const ArrayInfo& xinfo = getInfo(x);
+
+        const af_dtype xtype = xinfo.getType();
+        ARG_ASSERT(3, isFilterType(xtype));
+        ARG_ASSERT(2, sinfo.getType() == xtype);
+
+        // One column of b0, b1, b2, a0, a1 and a2 per section
+        const dim4 sosdims = sinfo.dims();
+        DIM_ASSERT(2, sosdims[0] == 6 && sosdims[1] > 0);
+        DIM_ASSERT(2, sosdims[2] == 1 && sosdims[3] == 1);
+
+        const dim4 xdims = xinfo.dims();
+        const dim4 sdims(2 * sosdims[1], xdims[1], xdims[2], xdims[3]);
+        checkStates(4, zi, sdims, xtype);
+
+        switch (xtype) {
+            case f32: iirSos<float>(y, zf, sos, x, zi, sdims); break;
+            case f64: iirSos<double>(y, zf, sos, x, zi, sdims); break;
+            case c32: iirSos<cfloat>(y, zf, sos, x, zi, sdims); break;
+            case c64: iirSos<cdouble>(y, zf, sos, x, zi, sdims); break;
+            default: TYPE_ERROR(3, xtype);
+        }
+    }
+    CATCHALL;
+    return AF_SUCCESS;
+}
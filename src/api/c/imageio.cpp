@@ -27,12 +27,15 @@
 #include <af/index.h>
 
 #include <common/DependencyModule.hpp>
+#include <common/parallel.hpp>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
 #include <string>
+#include <vector>
 
 using af::dim4;
 using arrayfire::AFFI_GRAY;
@@ -45,6 +48,7 @@ using arrayfire::FreeImage_Module;
 using arrayfire::FreeImageErrorHandler;
 using arrayfire::getFreeImagePlugin;
 using arrayfire::make_bitmap_ptr;
+using arrayfire::common::parallelFor;
 using detail::pinnedAlloc;
 using detail::pinnedFree;
 using detail::uchar;
@@ -55,6 +59,10 @@ using std::swap;
 
 namespace arrayfire {
 
+/// Number of scanlines converted together when moving between FreeImage's
+/// interleaved, row-major bitmaps and ArrayFire's planar, column-major arrays
+constexpr uint IMAGEIO_TILE = 32;
+
 template<typename T, FI_CHANNELS fi_color, FI_CHANNELS fo_color>
 static af_err readImage(af_array* rImage, const uchar* pSrcLine,
                         const int nSrcPitch, const uint fi_w, const uint fi_h) {
@@ -66,39 +74,43 @@ static af_err readImage(af_array* rImage, const uchar* pSrcLine,
     float* pDst2 = pDst + (fi_w * fi_h * 2);
     float* pDst3 = pDst + (fi_w * fi_h * 3);
 
-    uint indx = 0;
     uint step = fi_color;
 
-    for (uint x = 0; x < fi_w; ++x) {
-        for (uint y = 0; y < fi_h; ++y) {
-            const T* src = reinterpret_cast<const T*>(pSrcLine - y * nSrcPitch);
-            if (fo_color == 1) {
-                pDst0[indx] = static_cast<T>(*(src + (x * step)));
-            } else if (fo_color >= 3) {
-                if (static_cast<af_dtype>(af::dtype_traits<T>::af_type) == u8) {
-                    pDst0[indx] =
-                        static_cast<float>(*(src + (x * step + FI_RGBA_RED)));
-                    pDst1[indx] =
-                        static_cast<float>(*(src + (x * step + FI_RGBA_GREEN)));
-                    pDst2[indx] =
-                        static_cast<float>(*(src + (x * step + FI_RGBA_BLUE)));
-                    if (fo_color == 4) {
-                        pDst3[indx] = static_cast<float>(
-                            *(src + (x * step + FI_RGBA_ALPHA)));
-                    }
-                } else {
-                    // Non 8-bit types do not use ordering
-                    // See Pixel Access Functions Chapter in FreeImage Doc
-                    pDst0[indx] = static_cast<float>(*(src + (x * step + 0)));
-                    pDst1[indx] = static_cast<float>(*(src + (x * step + 1)));
-                    pDst2[indx] = static_cast<float>(*(src + (x * step + 2)));
-                    if (fo_color == 4) {
-                        pDst3[indx] =
-                            static_cast<float>(*(src + (x * step + 3)));
+    // Walk the image in bands of scanlines so the rows read by the inner loop
+    // stay in cache while the planar output is written column by column
+    for (uint y0 = 0; y0 < fi_h; y0 += IMAGEIO_TILE) {
+        const uint y1 = std::min(y0 + IMAGEIO_TILE, fi_h);
+        for (uint x = 0; x < fi_w; ++x) {
+            uint indx = x * fi_h + y0;
+            for (uint y = y0; y < y1; ++y) {
+                const T* src =
+                    reinterpret_cast<const T*>(pSrcLine - y * nSrcPitch) +
+                    x * step;
+                if (fo_color == 1) {
+                    pDst0[indx] = static_cast<T>(*src);
+                } else if (fo_color >= 3) {
+                    if (static_cast<af_dtype>(af::dtype_traits<T>::af_type) ==
+                        u8) {
+                        pDst0[indx] = static_cast<float>(src[FI_RGBA_RED]);
+                        pDst1[indx] = static_cast<float>(src[FI_RGBA_GREEN]);
+                        pDst2[indx] = static_cast<float>(src[FI_RGBA_BLUE]);
+                        if (fo_color == 4) {
+                            pDst3[indx] =
+                                static_cast<float>(src[FI_RGBA_ALPHA]);
+                        }
+                    } else {
+                        // Non 8-bit types do not use ordering
+                        // See Pixel Access Functions Chapter in FreeImage Doc
+                        pDst0[indx] = static_cast<float>(src[0]);
+                        pDst1[indx] = static_cast<float>(src[1]);
+                        pDst2[indx] = static_cast<float>(src[2]);
+                        if (fo_color == 4) {
+                            pDst3[indx] = static_cast<float>(src[3]);
+                        }
                     }
                 }
+                indx++;
             }
-            indx++;
         }
     }
 
@@ -192,29 +204,35 @@ static af_err readImage(af_array* rImage, const uchar* pSrcLine,
     AF_CHECK(af_init());
     auto* pDst = pinnedAlloc<float>(fi_w * fi_h);
 
-    uint indx = 0;
     uint step = nSrcPitch / (fi_w * sizeof(T));
     T r, g, b;
-    for (uint x = 0; x < fi_w; ++x) {
-        for (uint y = 0; y < fi_h; ++y) {
-            const T* src = reinterpret_cast<const T*>(pSrcLine - y * nSrcPitch);
-            if (fo_color == 1) {
-                pDst[indx] = static_cast<T>(*(src + (x * step)));
-            } else if (fo_color >= 3) {
-                if (static_cast<af_dtype>(af::dtype_traits<T>::af_type) == u8) {
-                    r = *(src + (x * step + FI_RGBA_RED));
-                    g = *(src + (x * step + FI_RGBA_GREEN));
-                    b = *(src + (x * step + FI_RGBA_BLUE));
-                } else {
-                    // Non 8-bit types do not use ordering
-                    // See Pixel Access Functions Chapter in FreeImage Doc
-                    r = *(src + (x * step + 0));
-                    g = *(src + (x * step + 1));
-                    b = *(src + (x * step + 2));
+    for (uint y0 = 0; y0 < fi_h; y0 += IMAGEIO_TILE) {
+        const uint y1 = std::min(y0 + IMAGEIO_TILE, fi_h);
+        for (uint x = 0; x < fi_w; ++x) {
+            uint indx = x * fi_h + y0;
+            for (uint y = y0; y < y1; ++y) {
+                const T* src =
+                    reinterpret_cast<const T*>(pSrcLine - y * nSrcPitch) +
+                    x * step;
+                if (fo_color == 1) {
+                    pDst[indx] = static_cast<T>(*src);
+                } else if (fo_color >= 3) {
+                    if (static_cast<af_dtype>(af::dtype_traits<T>::af_type) ==
+                        u8) {
+                        r = src[FI_RGBA_RED];
+                        g = src[FI_RGBA_GREEN];
+                        b = src[FI_RGBA_BLUE];
+                    } else {
+                        // Non 8-bit types do not use ordering
+                        // See Pixel Access Functions Chapter in FreeImage Doc
+                        r = src[0];
+                        g = src[1];
+                        b = src[2];
+                    }
+                    pDst[indx] = r * 0.2989f + g * 0.5870f + b * 0.1140f;
                 }
-                pDst[indx] = r * 0.2989f + g * 0.5870f + b * 0.1140f;
+                indx++;
             }
-            indx++;
         }
     }
 
@@ -225,6 +243,385 @@ static af_err readImage(af_array* rImage, const uchar* pSrcLine,
     return err;
 }
 
+namespace {
+
+/// Where an image of a batch is decoded from. Exactly one member is set.
+struct ImageSource {
+    const char* filename;
+    FIMEMORY* stream;
+};
+
+bitmap_ptr decodeImage(const ImageSource& src, const bool isColor) {
+    FreeImage_Module& _ = getFreeImagePlugin();
+
+    FREE_IMAGE_FORMAT fif = FIF_UNKNOWN;
+    if (src.filename) {
+        fif = _.FreeImage_GetFileType(src.filename, 0);
+        if (fif == FIF_UNKNOWN) {
+            fif = _.FreeImage_GetFIFFromFilename(src.filename);
+        }
+    } else {
+        _.FreeImage_SeekMemory(src.stream, 0L, SEEK_SET);
+        fif = _.FreeImage_GetFileTypeFromMemory(src.stream, 0);
+    }
+
+    if (fif == FIF_UNKNOWN) {
+        AF_ERROR("FreeImage Error: Unknown File or Filetype",
+                 AF_ERR_NOT_SUPPORTED);
+    }
+
+    unsigned flags = 0;
+    if (fif == FIF_JPEG) {
+        flags = flags | static_cast<unsigned>(JPEG_ACCURATE);
+    }
+#ifdef JPEG_GREYSCALE
+    if (fif == FIF_JPEG && !isColor) {
+        flags = flags | static_cast<unsigned>(JPEG_GREYSCALE);
+    }
+#endif
+
+    bitmap_ptr pBitmap = make_bitmap_ptr(NULL);
+    if (_.FreeImage_FIFSupportsReading(fif)) {
+        if (src.filename) {
+            pBitmap.reset(_.FreeImage_Load(fif, src.filename,
+                                           static_cast<int>(flags)));
+        } else {
+            pBitmap.reset(_.FreeImage_LoadFromMemory(
+                fif, src.stream, static_cast<int>(flags)));
+        }
+    }
+
+    if (pBitmap == NULL) {
+        AF_ERROR("FreeImage Error: Error reading image or file does not exist",
+                 AF_ERR_RUNTIME);
+    }
+    return pBitmap;
+}
+
+uint getChannelCount(FIBITMAP* pBitmap) {
+    switch (getFreeImagePlugin().FreeImage_GetColorType(pBitmap)) {
+        case FIC_MINISBLACK:
+        case FIC_MINISWHITE: return AFFI_GRAY;
+        case FIC_RGBALPHA:
+        case FIC_CMYK: return AFFI_RGBA;
+        default: return AFFI_RGB;
+    }
+}
+
+/// Converts the interleaved scanlines of a bitmap into \p fo_color
+/// column-major planes of fi_h x fi_w floats starting at \p pDst.
+///
+/// Color pixels are reduced to their luminance for gray output, gray pixels
+/// are replicated into every plane for color output and alpha is dropped.
+/// Each band of scanlines is first deinterleaved row by row into \p band and
+/// then transposed into the output in square blocks, so both the reads and
+/// the writes of the inner loops are unit stride.
+template<typename T, FI_CHANNELS fi_color, FI_CHANNELS fo_color>
+void scanlinesToPlanes(float* pDst, std::vector<float>& band,
+                       const uchar* pSrcLine, const int nSrcPitch,
+                       const uint fi_w, const uint fi_h) {
+    // 8-bit color bitmaps store their channels in the platform's byte order.
+    // Non 8-bit types do not use ordering, see the Pixel Access Functions
+    // chapter of the FreeImage documentation.
+    constexpr bool ordered = std::is_same<T, uchar>::value && fi_color >= 3;
+    constexpr int ri       = ordered ? FI_RGBA_RED : 0;
+    constexpr int gi       = ordered ? FI_RGBA_GREEN : 1;
+    constexpr int bi       = ordered ? FI_RGBA_BLUE : 2;
+    constexpr uint nbands =
+        (fi_color == AFFI_GRAY || fo_color == AFFI_GRAY) ? 1 : 3;
+
+    const size_t plane     = static_cast<size_t>(fi_w) * fi_h;
+    const size_t bandPlane = static_cast<size_t>(fi_w) * IMAGEIO_TILE;
+    band.resize(bandPlane * nbands);
+
+    for (uint y0 = 0; y0 < fi_h; y0 += IMAGEIO_TILE) {
+        const uint rows = std::min(IMAGEIO_TILE, fi_h - y0);
+
+        for (uint r = 0; r < rows; ++r) {
+            const T* src =
+                reinterpret_cast<const T*>(pSrcLine - (y0 + r) * nSrcPitch);
+            float* row0 = band.data() + r * fi_w;
+            if (fi_color == AFFI_GRAY) {
+                for (uint x = 0; x < fi_w; ++x) {
+                    row0[x] = static_cast<float>(src[x]);
+                }
+            } else if (fo_color == AFFI_GRAY) {
+                for (uint x = 0; x < fi_w; ++x) {
+                    const T* px = src + x * fi_color;
+                    row0[x]     = static_cast<float>(px[ri]) * 0.2989f +
+                              static_cast<float>(px[gi]) * 0.5870f +
+                              static_cast<float>(px[bi]) * 0.1140f;
+                }
+            } else {
+                float* row1 = row0 + bandPlane;
+                float* row2 = row1 + bandPlane;
+                for (uint x = 0; x < fi_w; ++x) {
+                    const T* px = src + x * fi_color;
+                    row0[x]     = static_cast<float>(px[ri]);
+                    row1[x]     = static_cast<float>(px[gi]);
+                    row2[x]     = static_cast<float>(px[bi]);
+                }
+            }
+        }
+
+        for (uint x0 = 0; x0 < fi_w; x0 += IMAGEIO_TILE) {
+            const uint x1 = std::min(x0 + IMAGEIO_TILE, fi_w);
+            for (uint c = 0; c < fo_color; ++c) {
+                const float* tile =
+                    band.data() + std::min(c, nbands - 1) * bandPlane;
+                float* dst = pDst + c * plane + y0;
+                for (uint x = x0; x < x1; ++x) {
+                    float* col = dst + static_cast<size_t>(x) * fi_h;
+                    for (uint r = 0; r < rows; ++r) {
+                        col[r] = tile[r * fi_w + x];
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<typename T, FI_CHANNELS fo_color>
+void convertChannels(float* pDst, std::vector<float>& band,
+                     const uint fi_color, const uchar* pSrcLine,
+                     const int nSrcPitch, const uint fi_w, const uint fi_h) {
+    switch (fi_color) {
+        case AFFI_GRAY:
+            scanlinesToPlanes<T, AFFI_GRAY, fo_color>(pDst, band, pSrcLine,
+                                                      nSrcPitch, fi_w, fi_h);
+            break;
+        case AFFI_RGB:
+            scanlinesToPlanes<T, AFFI_RGB, fo_color>(pDst, band, pSrcLine,
+                                                     nSrcPitch, fi_w, fi_h);
+            break;
+        default:
+            scanlinesToPlanes<T, AFFI_RGBA, fo_color>(pDst, band, pSrcLine,
+                                                      nSrcPitch, fi_w, fi_h);
+            break;
+    }
+}
+
+/// Converts a decoded bitmap into \p fo_color planes of floats at \p pDst
+template<FI_CHANNELS fo_color>
+void convertBitmap(float* pDst, std::vector<float>& band, FIBITMAP* pBitmap) {
+    FreeImage_Module& _ = getFreeImagePlugin();
+
+    const uint fi_color = getChannelCount(pBitmap);
+    const uint fi_bpc   = _.FreeImage_GetBPP(pBitmap) / fi_color;
+    const uint fi_w     = _.FreeImage_GetWidth(pBitmap);
+    const uint fi_h     = _.FreeImage_GetHeight(pBitmap);
+
+    // FI = row major | AF = column major
+    const uint nSrcPitch = _.FreeImage_GetPitch(pBitmap);
+    const uchar* pSrcLine =
+        _.FreeImage_GetBits(pBitmap) + nSrcPitch * (fi_h - 1);
+
+    switch (fi_bpc) {
+        case 8:
+            convertChannels<uchar, fo_color>(pDst, band, fi_color, pSrcLine,
+                                             nSrcPitch, fi_w, fi_h);
+            break;
+        case 16:
+            convertChannels<ushort, fo_color>(pDst, band, fi_color, pSrcLine,
+                                              nSrcPitch, fi_w, fi_h);
+            break;
+        case 32:
+            switch (_.FreeImage_GetImageType(pBitmap)) {
+                case FIT_UINT32:
+                    convertChannels<uint, fo_color>(pDst, band, fi_color,
+                                                    pSrcLine, nSrcPitch, fi_w,
+                                                    fi_h);
+                    break;
+                case FIT_INT32:
+                    convertChannels<int, fo_color>(pDst, band, fi_color,
+                                                   pSrcLine, nSrcPitch, fi_w,
+                                                   fi_h);
+                    break;
+                case FIT_FLOAT:
+                case FIT_RGBF:
+                case FIT_RGBAF:
+                    convertChannels<float, fo_color>(pDst, band, fi_color,
+                                                     pSrcLine, nSrcPitch, fi_w,
+                                                     fi_h);
+                    break;
+                default:
+                    AF_ERROR("FreeImage Error: Unknown image type",
+                             AF_ERR_NOT_SUPPORTED);
+            }
+            break;
+        default:
+            AF_ERROR("FreeImage Error: Bits per channel not supported",
+                     AF_ERR_NOT_SUPPORTED);
+    }
+}
+
+using pinned_ptr = std::unique_ptr<float, void (*)(void*)>;
+
+void loadImages(af_array* out, const ImageSource* sources, const uint count,
+                const bool isColor) {
+    FreeImage_Module& _ = getFreeImagePlugin();
+
+    // set your own FreeImage error handler
+    _.FreeImage_SetOutputMessage(FreeImageErrorHandler);
+
+    // The first image decides the size of every image in the batch
+    bitmap_ptr first      = decodeImage(sources[0], isColor);
+    const uint fi_w       = _.FreeImage_GetWidth(first.get());
+    const uint fi_h       = _.FreeImage_GetHeight(first.get());
+    const uint fo_color   = isColor ? AFFI_RGB : AFFI_GRAY;
+    const size_t imgElems = static_cast<size_t>(fi_w) * fi_h * fo_color;
+
+    AF_CHECK(af_init());
+    pinned_ptr pDst(pinnedAlloc<float>(imgElems * count), pinnedFree);
+
+    parallelFor(count, [&](dim_t i) {
+        bitmap_ptr pBitmap =
+            i == 0 ? std::move(first) : decodeImage(sources[i], isColor);
+        if (_.FreeImage_GetWidth(pBitmap.get()) != fi_w ||
+            _.FreeImage_GetHeight(pBitmap.get()) != fi_h) {
+            AF_ERROR("All the images in a batch must have the same size",
+                     AF_ERR_SIZE);
+        }
+
+        std::vector<float> band;
+        float* dst = pDst.get() + i * imgElems;
+        if (isColor) {
+            convertBitmap<AFFI_RGB>(dst, band, pBitmap.get());
+        } else {
+            convertBitmap<AFFI_GRAY>(dst, band, pBitmap.get());
+        }
+    });
+
+    const dim4 dims(fi_h, fi_w, fo_color, count);
+    af_array rImage = 0;
+    AF_CHECK(af_create_array(&rImage, pDst.get(), dims.ndims(), dims.get(),
+                             f32));
+    swap(*out, rImage);
+}
+
+/// Interleaves \p channels column-major planes of fi_h x fi_w floats into the
+/// 8-bit scanlines of a bitmap. Values are multiplied by \p mul, divided by
+/// \p div and truncated, like af_save_image does.
+void planesToScanlines(uchar* pDstLine, const int nDstPitch,
+                       std::vector<float>& band, const float* pSrc,
+                       const uint channels, const uint fi_w, const uint fi_h,
+                       const float mul, const float div) {
+    static const int order[4] = {FI_RGBA_RED, FI_RGBA_GREEN, FI_RGBA_BLUE,
+                                 FI_RGBA_ALPHA};
+
+    const size_t plane     = static_cast<size_t>(fi_w) * fi_h;
+    const size_t bandPlane = static_cast<size_t>(fi_w) * IMAGEIO_TILE;
+    band.resize(bandPlane * channels);
+
+    for (uint y0 = 0; y0 < fi_h; y0 += IMAGEIO_TILE) {
+        const uint rows = std::min(IMAGEIO_TILE, fi_h - y0);
+
+        for (uint x0 = 0; x0 < fi_w; x0 += IMAGEIO_TILE) {
+            const uint x1 = std::min(x0 + IMAGEIO_TILE, fi_w);
+            for (uint c = 0; c < channels; ++c) {
+                const float* src = pSrc + c * plane + y0;
+                float* tile      = band.data() + c * bandPlane;
+                for (uint x = x0; x < x1; ++x) {
+                    const float* col = src + static_cast<size_t>(x) * fi_h;
+                    for (uint r = 0; r < rows; ++r) {
+                        tile[r * fi_w + x] = col[r];
+                    }
+                }
+            }
+        }
+
+        for (uint r = 0; r < rows; ++r) {
+            uchar* dst = pDstLine - (y0 + r) * nDstPitch;
+            for (uint c = 0; c < channels; ++c) {
+                const float* row = band.data() + c * bandPlane + r * fi_w;
+                const int offset = channels == 1 ? 0 : order[c];
+                for (uint x = 0; x < fi_w; ++x) {
+                    dst[x * channels + offset] =
+                        static_cast<uchar>(row[x] * mul / div);
+                }
+            }
+        }
+    }
+}
+
+void saveImages(const char* const* filenames, const uint count,
+                const af_array in_) {
+    FreeImage_Module& _ = getFreeImagePlugin();
+
+    // set your own FreeImage error handler
+    _.FreeImage_SetOutputMessage(FreeImageErrorHandler);
+
+    const ArrayInfo& info = getInfo(in_);
+    const dim4& dims      = info.dims();
+    const uint channels   = dims[2];
+    DIM_ASSERT(2, dims[3] == count);
+    DIM_ASSERT(2, channels <= 4);
+    DIM_ASSERT(2, channels != 2);
+
+    const uint fi_w       = dims[1];
+    const uint fi_h       = dims[0];
+    const size_t imgElems = static_cast<size_t>(fi_w) * fi_h * channels;
+
+    // Bring the whole batch to the host once
+    af_array in = in_;
+    if (info.getType() != f32) { AF_CHECK(af_cast(&in, in_, f32)); }
+    pinned_ptr pSrc(pinnedAlloc<float>(imgElems * count), pinnedFree);
+    af_err err = af_get_data_ptr(pSrc.get(), in);
+    if (in != in_) { AF_CHECK(af_release_array(in)); }
+    AF_CHECK(err);
+
+    parallelFor(count, [&](dim_t i) {
+        const char* filename = filenames[i];
+
+        // try to guess the file format from the file extension
+        FREE_IMAGE_FORMAT fif = _.FreeImage_GetFileType(filename, 0);
+        if (fif == FIF_UNKNOWN) {
+            fif = _.FreeImage_GetFIFFromFilename(filename);
+        }
+        if (fif == FIF_UNKNOWN) {
+            AF_ERROR("FreeImage Error: Unknown Filetype", AF_ERR_NOT_SUPPORTED);
+        }
+
+        bitmap_ptr pResultBitmap = make_bitmap_ptr(_.FreeImage_Allocate(
+            fi_w, fi_h, static_cast<int>(channels * 8), 0, 0, 0));
+        if (pResultBitmap == NULL) {
+            AF_ERROR("FreeImage Error: Error creating image or file",
+                     AF_ERR_RUNTIME);
+        }
+
+        // FI assumes [0-255], rescale each image the way af_save_image does
+        const float* src = pSrc.get() + i * imgElems;
+        const float maxv = *std::max_element(src, src + imgElems);
+        float mul = 1.f, div = 1.f;
+        if (maxv <= 1) {
+            mul = 255.f;
+        } else if (maxv >= 256 && maxv < 65536) {
+            div = 257.f;
+        }
+
+        // FI = row major | AF = column major
+        const int nDstPitch = _.FreeImage_GetPitch(pResultBitmap.get());
+        uchar* pDstLine =
+            _.FreeImage_GetBits(pResultBitmap.get()) + nDstPitch * (fi_h - 1);
+
+        std::vector<float> band;
+        planesToScanlines(pDstLine, nDstPitch, band, src, channels, fi_w, fi_h,
+                          mul, div);
+
+        unsigned flags = 0;
+        if (fif == FIF_JPEG) {
+            flags = flags | static_cast<unsigned>(JPEG_QUALITYSUPERB);
+        }
+
+        if (_.FreeImage_Save(fif, pResultBitmap.get(), filename,
+                             static_cast<int>(flags)) == FALSE) {
+            AF_ERROR("FreeImage Error: Failed to save image", AF_ERR_RUNTIME);
+        }
+    });
+}
+
+}  // namespace
+
 }  // namespace arrayfire
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +629,7 @@ static af_err readImage(af_array* rImage, const uchar* pSrcLine,
 ////////////////////////////////////////////////////////////////////////////////
 // Load image from disk.
 af_err af_load_image(af_array* out, const char* filename, const bool isColor) {
+    AF_API_SCOPE;
     using arrayfire::readImage;
     try {
         ARG_ASSERT(1, filename != NULL);
@@ -531,6 +929,7 @@ af_err af_load_image(af_array* out, const char* filename, const bool isColor) {
 
 // Save an image to disk.
 af_err af_save_image(const char* filename, const af_array in_) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, filename != NULL);
 
@@ -722,6 +1121,7 @@ af_err af_save_image(const char* filename, const af_array in_) {
 ////////////////////////////////////////////////////////////////////////////////
 /// Load image from memory.
 af_err af_load_image_memory(af_array* out, const void* ptr) {
+    AF_API_SCOPE;
     using arrayfire::readImage;
     try {
         ARG_ASSERT(1, ptr != NULL);
@@ -859,6 +1259,7 @@ af_err af_load_image_memory(af_array* out, const void* ptr) {
 // Save an image to memory.
 af_err af_save_image_memory(void** ptr, const af_array in_,
                             const af_image_format format) {
+    AF_API_SCOPE;
     try {
         FreeImage_Module& _ = getFreeImagePlugin();
 
@@ -1037,6 +1438,7 @@ af_err af_save_image_memory(void** ptr, const af_array in_,
 }
 
 af_err af_delete_image_memory(void* ptr) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, ptr != NULL);
 
@@ -1062,32 +1464,117 @@ af_err af_delete_image_memory(void* ptr) {
     return AF_SUCCESS;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Batch IO
+////////////////////////////////////////////////////////////////////////////////
+af_err af_load_images(af_array* out, const char* const* filenames,
+                      const unsigned count, const bool isColor) {
+    AF_API_SCOPE;
+    using arrayfire::ImageSource;
+    try {
+        ARG_ASSERT(1, filenames != NULL);
+        ARG_ASSERT(2, count > 0);
+
+        std::vector<ImageSource> sources(count);
+        for (unsigned i = 0; i < count; ++i) {
+            ARG_ASSERT(1, filenames[i] != NULL);
+            sources[i] = {filenames[i], nullptr};
+        }
+        arrayfire::loadImages(out, sources.data(), count, isColor);
+    }
+    CATCHALL;
+
+    return AF_SUCCESS;
+}
+
+af_err af_load_images_memory(af_array* out, const void* const* ptrs,
+                             const unsigned count, const bool isColor) {
+    AF_API_SCOPE;
+    using arrayfire::ImageSource;
+    try {
+        ARG_ASSERT(1, ptrs != NULL);
+        ARG_ASSERT(2, count > 0);
+
+        std::vector<ImageSource> sources(count);
+        for (unsigned i = 0; i < count; ++i) {
+            ARG_ASSERT(1, ptrs[i] != NULL);
+            sources[i] = {nullptr,
+                          static_cast<FIMEMORY*>(const_cast<void*>(ptrs[i]))};
+        }
+        arrayfire::loadImages(out, sources.data(), count, isColor);
+    }
+    CATCHALL;
+
+    return AF_SUCCESS;
+}
+
+af_err af_save_images(const char* const* filenames, const unsigned count,
+                      const af_array in) {
+    AF_API_SCOPE;
+    try {
+        ARG_ASSERT(0, filenames != NULL);
+        ARG_ASSERT(1, count > 0);
+        for (unsigned i = 0; i < count; ++i) {
+            ARG_ASSERT(0, filenames[i] != NULL);
+        }
+        arrayfire::saveImages(filenames, count, in);
+    }
+    CATCHALL;
+
+    return AF_SUCCESS;
+}
+
 #else  // WITH_FREEIMAGE
 #include <common/err_common.hpp>
 #include <stdio.h>
 #include <af/image.h>
 af_err af_load_image(af_array *out, const char *filename, const bool isColor) {
+    AF_API_SCOPE;
     AF_RETURN_ERROR("ArrayFire compiled without Image IO (FreeImage) support",
                     AF_ERR_NOT_CONFIGURED);
 }
 
 af_err af_save_image(const char *filename, const af_array in_) {
+    AF_API_SCOPE;
     AF_RETURN_ERROR("ArrayFire compiled without Image IO (FreeImage) support",
                     AF_ERR_NOT_CONFIGURED);
 }
 
 af_err af_load_image_memory(af_array *out, const void *ptr) {
+    AF_API_SCOPE;
     AF_RETURN_ERROR("ArrayFire compiled without Image IO (FreeImage) support",
                     AF_ERR_NOT_CONFIGURED);
 }
 
 af_err af_save_image_memory(void **ptr, const af_array in_,
                             const af_image_format format) {
+    AF_API_SCOPE;
     AF_RETURN_ERROR("ArrayFire compiled without Image IO (FreeImage) support",
                     AF_ERR_NOT_CONFIGURED);
 }
 
 af_err af_delete_image_memory(void *ptr) {
+    AF_API_SCOPE;
+    AF_RETURN_ERROR("ArrayFire compiled without Image IO (FreeImage) support",
+                    AF_ERR_NOT_CONFIGURED);
+}
+af_err af_load_images(af_array *out, const char *const *filenames,
+                      const unsigned count, const bool isColor) {
+    AF_API_SCOPE;
+    AF_RETURN_ERROR("ArrayFire compiled without Image IO (FreeImage) support",
+                    AF_ERR_NOT_CONFIGURED);
+}
+
+af_err af_load_images_memory(af_array *out, const void *const *ptrs,
+                             const unsigned count, const bool isColor) {
+    AF_API_SCOPE;
+    AF_RETURN_ERROR("ArrayFire compiled without Image IO (FreeImage) support",
+                    AF_ERR_NOT_CONFIGURED);
+}
+
+af_err af_save_images(const char *const *filenames, const unsigned count,
+                      const af_array in) {
+    AF_API_SCOPE;
     AF_RETURN_ERROR("ArrayFire compiled without Image IO (FreeImage) support",
                     AF_ERR_NOT_CONFIGURED);
 }
@@ -134,6 +134,7 @@ FREE_IMAGE_TYPE getFIT(FI_CHANNELS channels, af_dtype type) {
 ////////////////////////////////////////////////////////////////////////////////
 // Load image from disk.
 af_err af_load_image_native(af_array* out, const char* filename) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(1, filename != NULL);
 
@@ -408,6 +409,7 @@ static void save_t(T* pDstLine, const af_array in, const dim4& dims,
 
 // Save an image to disk.
 af_err af_save_image_native(const char* filename, const af_array in) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, filename != NULL);
 
@@ -540,6 +542,7 @@ af_err af_save_image_native(const char* filename, const af_array in) {
 }
 
 af_err af_is_image_io_available(bool* out) {
+    AF_API_SCOPE;
     *out = true;
     return AF_SUCCESS;
 }
@@ -549,16 +552,19 @@ af_err af_is_image_io_available(bool* out) {
 #include <stdio.h>
 #include <af/image.h>
 af_err af_load_image_native(af_array* out, const char* filename) {
+    AF_API_SCOPE;
     AF_RETURN_ERROR("ArrayFire compiled without Image IO (FreeImage) support",
                     AF_ERR_NOT_CONFIGURED);
 }
 
 af_err af_save_image_native(const char* filename, const af_array in) {
+    AF_API_SCOPE;
     AF_RETURN_ERROR("ArrayFire compiled without Image IO (FreeImage) support",
                     AF_ERR_NOT_CONFIGURED);
 }
 
 af_err af_is_image_io_available(bool* out) {
+    AF_API_SCOPE;
     *out = false;
     return AF_SUCCESS;
 }
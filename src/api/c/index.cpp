@@ -82,6 +82,7 @@ static af_array indexBySeqs(const af_array& src,
 
 af_err af_index(af_array* result, const af_array in, const unsigned ndims,
                 const af_seq* indices) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(2, (ndims > 0 && ndims <= AF_MAX_DIMS));
 
@@ -157,6 +158,7 @@ static af_array lookup(const af_array& in, const af_array& idx,
 
 af_err af_lookup(af_array* out, const af_array in, const af_array indices,
                  const unsigned dim) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& idxInfo = getInfo(indices);
 
@@ -205,6 +207,7 @@ static inline af_array genIndex(const af_array& in, const af_index_t idxrs[]) {
 
 af_err af_index_gen(af_array* out, const af_array in, const dim_t ndims,
                     const af_index_t* indexs) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(2, (ndims > 0 && ndims <= AF_MAX_DIMS));
         ARG_ASSERT(3, (indexs != NULL));
@@ -305,6 +308,7 @@ af_seq af_make_seq(double begin, double end, double step) {
 }
 
 af_err af_create_indexers(af_index_t** indexers) {
+    AF_API_SCOPE;
     try {
         auto* out = new af_index_t[AF_MAX_DIMS];
         for (int i = 0; i < AF_MAX_DIMS; ++i) {
@@ -320,6 +324,7 @@ af_err af_create_indexers(af_index_t** indexers) {
 
 af_err af_set_array_indexer(af_index_t* indexer, const af_array idx,
                             const dim_t dim) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, (indexer != NULL));
         ARG_ASSERT(1, (idx != NULL));
@@ -332,6 +337,7 @@ af_err af_set_array_indexer(af_index_t* indexer, const af_array idx,
 
 af_err af_set_seq_indexer(af_index_t* indexer, const af_seq* idx,
                           const dim_t dim, const bool is_batch) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, (indexer != NULL));
         ARG_ASSERT(1, (idx != NULL));
@@ -347,6 +353,7 @@ af_err af_set_seq_indexer(af_index_t* indexer, const af_seq* idx,
 af_err af_set_seq_param_indexer(af_index_t* indexer, const double begin,
                                 const double end, const double step,
                                 const dim_t dim, const bool is_batch) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, (indexer != NULL));
         ARG_ASSERT(4, (dim >= 0 && dim <= 3));
@@ -360,6 +367,7 @@ af_err af_set_seq_param_indexer(af_index_t* indexer, const double begin,
 }
 
 af_err af_release_indexers(af_index_t* indexers) {
+    AF_API_SCOPE;
     try {
         delete[] indexers;
     }
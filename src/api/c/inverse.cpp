@@ -12,10 +12,12 @@
 #include <common/err_common.hpp>
 #include <handle.hpp>
 #include <inverse.hpp>
+#include <lapack_common.hpp>
 #include <af/array.h>
 #include <af/defines.h>
 #include <af/lapack.h>
 
+using arrayfire::common::lapackBatchSupported;
 using detail::cdouble;
 using detail::cfloat;
 
@@ -25,10 +27,11 @@ static inline af_array inverse(const af_array in) {
 }
 
 af_err af_inverse(af_array* out, const af_array in, const af_mat_prop options) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& i_info = getInfo(in);
 
-        if (i_info.ndims() > 2) {
+        if (!lapackBatchSupported && i_info.ndims() > 2) {
             AF_ERROR("solve can not be used in batch mode", AF_ERR_BATCH);
         }
 
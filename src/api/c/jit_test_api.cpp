@@ -14,11 +14,13 @@
 #include <platform.hpp>
 
 af_err af_get_max_jit_len(int *jitLen) {
+    AF_API_SCOPE;
     *jitLen = detail::getMaxJitSize();
     return AF_SUCCESS;
 }
 
 af_err af_set_max_jit_len(const int maxJitLen) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(1, maxJitLen > 0);
         detail::getMaxJitSize() = maxJitLen;
@@ -26,3 +28,13 @@ af_err af_set_max_jit_len(const int maxJitLen) {
     CATCHALL;
     return AF_SUCCESS;
 }
+
+af_err af_get_jit_merged_nodes(size_t *count) {
+    AF_API_SCOPE;
+#if defined(AF_CPU)
+    *count = detail::getJitMergedNodes();
+#else
+    *count = 0;
+#endif
+    return AF_SUCCESS;
+}
@@ -23,6 +23,11 @@ AFAPI int getMaxJitLen(void);
 /// \param[in] jit_len is the maximum length of jit tree from root to any
 /// leaf
 AFAPI void setMaxJitLen(const int jitLen);
+
+/// Get the number of JIT nodes merged into an equal node before evaluation
+///
+/// \returns the number of nodes merged since the start of the program
+AFAPI size_t getJitMergedNodes(void);
 }  // namespace af
 #endif  //__cplusplus
 
@@ -46,6 +51,14 @@ AFAPI af_err af_get_max_jit_len(int *jit_len);
 /// \returns Always returns AF_SUCCESS
 AFAPI af_err af_set_max_jit_len(const int jit_len);
 
+/// Get the number of JIT nodes merged into an equal node before evaluation
+///
+/// \param[out] count is the number of nodes merged since the start of the
+/// program. Only the CPU backend merges nodes, the others report 0.
+///
+/// \returns Always returns AF_SUCCESS
+AFAPI af_err af_get_jit_merged_nodes(size_t *count);
+
 #ifdef __cplusplus
 }
 #endif
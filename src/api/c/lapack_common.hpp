@@ -0,0 +1,25 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+
+namespace arrayfire {
+namespace common {
+
+/// True if the dense linear algebra functions accept batches of matrices,
+/// arrays with more than two dimensions. Batches are only supported by the
+/// CPU backend, the other backends reject them.
+#if defined(AF_CPU)
+constexpr bool lapackBatchSupported = true;
+#else
+constexpr bool lapackBatchSupported = false;
+#endif
+
+}  // namespace common
+}  // namespace arrayfire
@@ -11,12 +11,14 @@
 #include <common/ArrayInfo.hpp>
 #include <common/err_common.hpp>
 #include <handle.hpp>
+#include <lapack_common.hpp>
 #include <lu.hpp>
 #include <af/array.h>
 #include <af/defines.h>
 #include <af/lapack.h>
 
 using af::dim4;
+using arrayfire::common::lapackBatchSupported;
 using detail::Array;
 using detail::cdouble;
 using detail::cfloat;
@@ -44,10 +46,11 @@ static inline af_array lu_inplace(af_array in, bool is_lapack_piv) {
 
 af_err af_lu(af_array *lower, af_array *upper, af_array *pivot,
              const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &i_info = getInfo(in);
 
-        if (i_info.ndims() > 2) {
+        if (!lapackBatchSupported && i_info.ndims() > 2) {
             AF_ERROR("lu can not be used in batch mode", AF_ERR_BATCH);
         }
 
@@ -79,11 +82,12 @@ af_err af_lu(af_array *lower, af_array *upper, af_array *pivot,
 }
 
 af_err af_lu_inplace(af_array *pivot, af_array in, const bool is_lapack_piv) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &i_info = getInfo(in);
         af_dtype type           = i_info.getType();
 
-        if (i_info.ndims() > 2) {
+        if (!lapackBatchSupported && i_info.ndims() > 2) {
             AF_ERROR("lu can not be used in batch mode", AF_ERR_BATCH);
         }
 
@@ -110,6 +114,7 @@ af_err af_lu_inplace(af_array *pivot, af_array in, const bool is_lapack_piv) {
 }
 
 af_err af_is_lapack_available(bool *out) {
+    AF_API_SCOPE;
     try {
         *out = isLAPACKAvailable();
     }
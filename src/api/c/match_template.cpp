@@ -38,8 +38,14 @@ static af_array match_template(const af_array& sImg, const af_array tImg,
 af_err af_match_template(af_array* out, const af_array search_img,
                          const af_array template_img,
                          const af_match_type m_type) {
+    AF_API_SCOPE;
     try {
+#if defined(AF_CPU)
+        // The CPU backend also computes the normalized cross correlations
+        ARG_ASSERT(3, (m_type >= AF_SAD && m_type <= AF_ZNCC));
+#else
         ARG_ASSERT(3, (m_type >= AF_SAD && m_type <= AF_LSSD));
+#endif
 
         const ArrayInfo& sInfo = getInfo(search_img);
         const ArrayInfo& tInfo = getInfo(template_img);
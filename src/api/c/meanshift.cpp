@@ -26,14 +26,24 @@ using detail::ushort;
 template<typename T>
 static inline af_array mean_shift(const af_array &in, const float &s_sigma,
                                   const float &c_sigma, const unsigned niters,
-                                  const bool is_color) {
-    return getHandle(
-        meanshift<T>(getArray<T>(in), s_sigma, c_sigma, niters, is_color));
+                                  const bool is_color,
+                                  const af_meanshift_method method) {
+    return getHandle(meanshift<T>(getArray<T>(in), s_sigma, c_sigma, niters,
+                                  is_color, method));
 }
 
 af_err af_mean_shift(af_array *out, const af_array in,
                      const float spatial_sigma, const float chromatic_sigma,
                      const unsigned num_iterations, const bool is_color) {
+    return af_mean_shift_v2(out, in, spatial_sigma, chromatic_sigma,
+                            num_iterations, is_color, AF_MEANSHIFT_DEFAULT);
+}
+
+af_err af_mean_shift_v2(af_array *out, const af_array in,
+                        const float spatial_sigma, const float chromatic_sigma,
+                        const unsigned num_iterations, const bool is_color,
+                        const af_meanshift_method method) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(2, (spatial_sigma >= 0));
         ARG_ASSERT(3, (chromatic_sigma >= 0));
@@ -45,48 +55,53 @@ af_err af_mean_shift(af_array *out, const af_array in,
 
         DIM_ASSERT(1, (dims.ndims() >= 2));
         if (is_color) { DIM_ASSERT(1, (dims[2] == 3)); }
+        ARG_ASSERT(6, (method >= AF_MEANSHIFT_DEFAULT &&
+                       method <= AF_MEANSHIFT_BINNED));
+
+        const af_meanshift_method m =
+            (method == AF_MEANSHIFT_DEFAULT ? AF_MEANSHIFT_EXACT : method);
 
         af_array output;
         switch (type) {
             case f32:
                 output = mean_shift<float>(in, spatial_sigma, chromatic_sigma,
-                                           num_iterations, is_color);
+                                           num_iterations, is_color, m);
                 break;
             case f64:
                 output = mean_shift<double>(in, spatial_sigma, chromatic_sigma,
-                                            num_iterations, is_color);
+                                            num_iterations, is_color, m);
                 break;
             case b8:
                 output = mean_shift<char>(in, spatial_sigma, chromatic_sigma,
-                                          num_iterations, is_color);
+                                          num_iterations, is_color, m);
                 break;
             case s32:
                 output = mean_shift<int>(in, spatial_sigma, chromatic_sigma,
-                                         num_iterations, is_color);
+                                         num_iterations, is_color, m);
                 break;
             case u32:
                 output = mean_shift<uint>(in, spatial_sigma, chromatic_sigma,
-                                          num_iterations, is_color);
+                                          num_iterations, is_color, m);
                 break;
             case s16:
                 output = mean_shift<short>(in, spatial_sigma, chromatic_sigma,
-                                           num_iterations, is_color);
+                                           num_iterations, is_color, m);
                 break;
             case u16:
                 output = mean_shift<ushort>(in, spatial_sigma, chromatic_sigma,
-                                            num_iterations, is_color);
+                                            num_iterations, is_color, m);
                 break;
             case s64:
                 output = mean_shift<intl>(in, spatial_sigma, chromatic_sigma,
-                                          num_iterations, is_color);
+                                          num_iterations, is_color, m);
                 break;
             case u64:
                 output = mean_shift<uintl>(in, spatial_sigma, chromatic_sigma,
-                                           num_iterations, is_color);
+                                           num_iterations, is_color, m);
                 break;
             case u8:
                 output = mean_shift<uchar>(in, spatial_sigma, chromatic_sigma,
-                                           num_iterations, is_color);
+                                           num_iterations, is_color, m);
                 break;
             default: TYPE_ERROR(1, type);
         }
@@ -8,76 +8,37 @@
  ********************************************************/
 
 #include <backend.hpp>
-#include <common/cast.hpp>
 #include <common/err_common.hpp>
+#include <common/moddims.hpp>
+#include <copy.hpp>
 #include <handle.hpp>
-#include <math.hpp>
-#include <sort.hpp>
-#include <af/arith.h>
-#include <af/data.h>
+#include <quantile_common.hpp>
 #include <af/defines.h>
 #include <af/dim4.hpp>
-#include <af/index.h>
 #include <af/statistics.h>
 
+#include <type_traits>
+
 using af::dim4;
+using arrayfire::common::modDims;
+using arrayfire::common::quantile;
 using detail::Array;
-using detail::division;
+using detail::getScalar;
 using detail::uchar;
 using detail::uint;
 using detail::ushort;
-using std::sort;
+
+// The median is the midpoint quantile of probability 0.5, which averages the
+// two middle values of an even number of elements
 
 template<typename T>
 static double median(const af_array& in) {
     dim_t nElems = getInfo(in).elements();
-    dim4 dims(nElems, 1, 1, 1);
     ARG_ASSERT(0, nElems > 0);
 
-    af_array temp = 0;
-    AF_CHECK(af_moddims(&temp, in, 1, dims.get()));
-    const Array<T>& input = getArray<T>(temp);
-
-    // Shortcut cases for 1 or 2 elements
-    if (nElems == 1) {
-        T result;
-        AF_CHECK(af_get_data_ptr((void*)&result, in));
-        return result;
-    }
-    if (nElems == 2) {
-        T result[2];
-        AF_CHECK(af_get_data_ptr((void*)&result, in));
-        return division(
-            (static_cast<double>(result[0]) + static_cast<double>(result[1])),
-            2.0);
-    }
-
-    double mid       = static_cast<double>(nElems + 1) / 2.0;
-    af_seq mdSpan[1] = {af_make_seq(mid - 1, mid, 1)};
-
-    Array<T> sortedArr = sort<T>(input, 0, true);
-
-    af_array sarrHandle = getHandle<T>(sortedArr);
-
-    double result;
-    T resPtr[2];
-    af_array res = 0;
-    AF_CHECK(af_index(&res, sarrHandle, 1, mdSpan));
-    AF_CHECK(af_get_data_ptr((void*)&resPtr, res));
-
-    AF_CHECK(af_release_array(res));
-    AF_CHECK(af_release_array(sarrHandle));
-    AF_CHECK(af_release_array(temp));
-
-    if (nElems % 2 == 1) {
-        result = resPtr[0];
-    } else {
-        result = division(
-            static_cast<double>(resPtr[0]) + static_cast<double>(resPtr[1]),
-            2.0);
-    }
-
-    return result;
+    const Array<T> input = modDims(getArray<T>(in), dim4(nElems));
+    return getScalar<double>(
+        quantile<T, double>(input, {0.5}, 0, AF_QUANTILE_MIDPOINT));
 }
 
 template<typename T>
@@ -90,72 +51,16 @@ static af_array median(const af_array& in, const dim_t dim) {
         return getHandle<T>(result);
     }
 
-    Array<T> sortedIn = sort<T>(input, dim, true);
-
-    size_t dimLength = input.dims()[dim];
-    double mid       = static_cast<double>(dimLength + 1) / 2.0;
-    af_array left    = 0;
-
-    af_seq slices[4] = {af_span, af_span, af_span, af_span};
-    slices[dim]      = af_make_seq(mid - 1.0, mid - 1.0, 1.0);
-
-    af_array sortedIn_handle = getHandle<T>(sortedIn);
-    AF_CHECK(af_index(&left, sortedIn_handle, input.ndims(), slices));
-
-    af_array out = nullptr;
-    if (dimLength % 2 == 1) {
-        // mid-1 is our guy
-        if (input.isFloating()) {
-            AF_CHECK(af_release_array(sortedIn_handle));
-            return left;
-        }
-
-        // Return as floats for consistency
-        af_array out;
-        AF_CHECK(af_cast(&out, left, f32));
-        AF_CHECK(af_release_array(left));
-        AF_CHECK(af_release_array(sortedIn_handle));
-        return out;
-    } else {
-        // ((mid-1)+mid)/2 is our guy
-        dim4 dims      = input.dims();
-        af_array right = 0;
-        slices[dim]    = af_make_seq(mid, mid, 1.0);
-
-        AF_CHECK(af_index(&right, sortedIn_handle, dims.ndims(), slices));
-
-        af_array sumarr = 0;
-        af_array carr   = 0;
-
-        dim4 cdims = dims;
-        cdims[dim] = 1;
-        AF_CHECK(af_constant(&carr, 0.5, cdims.ndims(), cdims.get(),
-                             input.isDouble() ? f64 : f32));
-
-        if (!input.isFloating()) {
-            af_array lleft, rright;
-            AF_CHECK(af_cast(&lleft, left, f32));
-            AF_CHECK(af_cast(&rright, right, f32));
-            AF_CHECK(af_release_array(left));
-            AF_CHECK(af_release_array(right));
-            left  = lleft;
-            right = rright;
-        }
-
-        AF_CHECK(af_add(&sumarr, left, right, false));
-        AF_CHECK(af_mul(&out, sumarr, carr, false));
-
-        AF_CHECK(af_release_array(left));
-        AF_CHECK(af_release_array(right));
-        AF_CHECK(af_release_array(sumarr));
-        AF_CHECK(af_release_array(carr));
-        AF_CHECK(af_release_array(sortedIn_handle));
-    }
-    return out;
+    // Integer types return floats for consistency
+    using To = typename std::conditional<std::is_same<T, double>::value,
+                                         double, float>::type;
+    return getHandle(quantile<T, To>(input, {0.5}, static_cast<int>(dim),
+                                     AF_QUANTILE_MIDPOINT));
 }
 
 af_err af_median_all(double* realVal, double* imagVal,  // NOLINT
                      const af_array in) {
+    AF_API_SCOPE;
     UNUSED(imagVal);
     try {
         const ArrayInfo& info = getInfo(in);
@@ -178,6 +83,7 @@ af_err af_median_all(double* realVal, double* imagVal,  // NOLINT
 }
 
 af_err af_median(af_array* out, const af_array in, const dim_t dim) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(2, (dim >= 0 && dim <= 4));
 
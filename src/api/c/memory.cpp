@@ -52,6 +52,7 @@ using std::swap;
 
 af_err af_device_array(af_array *arr, void *data, const unsigned ndims,
                        const dim_t *const dims, const af_dtype type) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
 
@@ -115,6 +116,7 @@ af_err af_device_array(af_array *arr, void *data, const unsigned ndims,
 }
 
 af_err af_get_device_ptr(void **data, const af_array arr) {
+    AF_API_SCOPE;
     try {
         af_dtype type = getInfo(arr).getType();
 
@@ -150,6 +152,7 @@ inline void lockArray(const af_array arr) {
 af_err af_lock_device_ptr(const af_array arr) { return af_lock_array(arr); }
 
 af_err af_lock_array(const af_array arr) {
+    AF_API_SCOPE;
     try {
         af_dtype type = getInfo(arr).getType();
 
@@ -182,6 +185,7 @@ inline bool checkUserLock(const af_array arr) {
 }
 
 af_err af_is_locked_array(bool *res, const af_array arr) {
+    AF_API_SCOPE;
     try {
         af_dtype type = getInfo(arr).getType();
 
@@ -215,6 +219,7 @@ inline void unlockArray(const af_array arr) {
 af_err af_unlock_device_ptr(const af_array arr) { return af_unlock_array(arr); }
 
 af_err af_unlock_array(const af_array arr) {
+    AF_API_SCOPE;
     try {
         af_dtype type = getInfo(arr).getType();
 
@@ -241,6 +246,7 @@ af_err af_unlock_array(const af_array arr) {
 }
 
 af_err af_alloc_device(void **ptr, const dim_t bytes) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         *ptr = memAllocUser(bytes);
@@ -250,6 +256,7 @@ af_err af_alloc_device(void **ptr, const dim_t bytes) {
 }
 
 af_err af_alloc_device_v2(void **ptr, const dim_t bytes) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
 #ifdef AF_OPENCL
@@ -269,6 +276,7 @@ af_err af_alloc_device_v2(void **ptr, const dim_t bytes) {
 }
 
 af_err af_alloc_pinned(void **ptr, const dim_t bytes) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         *ptr = static_cast<void *>(pinnedAlloc<char>(bytes));
@@ -278,6 +286,7 @@ af_err af_alloc_pinned(void **ptr, const dim_t bytes) {
 }
 
 af_err af_free_device(void *ptr) {
+    AF_API_SCOPE;
     try {
         memFreeUser(ptr);
     }
@@ -286,6 +295,7 @@ af_err af_free_device(void *ptr) {
 }
 
 af_err af_free_device_v2(void *ptr) {
+    AF_API_SCOPE;
     try {
 #ifdef AF_OPENCL
         auto mem = static_cast<cl_mem>(ptr);
@@ -299,6 +309,7 @@ af_err af_free_device_v2(void *ptr) {
 }
 
 af_err af_free_pinned(void *ptr) {
+    AF_API_SCOPE;
     try {
         pinnedFree(ptr);
     }
@@ -307,6 +318,7 @@ af_err af_free_pinned(void *ptr) {
 }
 
 af_err af_alloc_host(void **ptr, const dim_t bytes) {
+    AF_API_SCOPE;
     if ((*ptr = malloc(bytes))) {  // NOLINT(hicpp-no-malloc)
         return AF_SUCCESS;
     }
@@ -314,11 +326,13 @@ af_err af_alloc_host(void **ptr, const dim_t bytes) {
 }
 
 af_err af_free_host(void *ptr) {
+    AF_API_SCOPE;
     free(ptr);  // NOLINT(hicpp-no-malloc)
     return AF_SUCCESS;
 }
 
 af_err af_print_mem_info(const char *msg, const int device_id) {
+    AF_API_SCOPE;
     try {
         int device = device_id;
         if (device == -1) { device = static_cast<int>(getActiveDeviceId()); }
@@ -335,6 +349,7 @@ af_err af_print_mem_info(const char *msg, const int device_id) {
 }
 
 af_err af_device_gc() {
+    AF_API_SCOPE;
     try {
         signalMemoryCleanup();
     }
@@ -344,6 +359,7 @@ af_err af_device_gc() {
 
 af_err af_device_mem_info(size_t *alloc_bytes, size_t *alloc_buffers,
                           size_t *lock_bytes, size_t *lock_buffers) {
+    AF_API_SCOPE;
     try {
         deviceMemoryInfo(alloc_bytes, alloc_buffers, lock_bytes, lock_buffers);
     }
@@ -352,6 +368,7 @@ af_err af_device_mem_info(size_t *alloc_bytes, size_t *alloc_buffers,
 }
 
 af_err af_set_mem_step_size(const size_t step_bytes) {
+    AF_API_SCOPE;
     try {
         detail::setMemStepSize(step_bytes);
     }
@@ -360,6 +377,7 @@ af_err af_set_mem_step_size(const size_t step_bytes) {
 }
 
 af_err af_get_mem_step_size(size_t *step_bytes) {
+    AF_API_SCOPE;
     try {
         *step_bytes = detail::getMemStepSize();
     }
@@ -382,6 +400,7 @@ af_memory_manager getHandle(MemoryManager &manager) {
 }
 
 af_err af_create_memory_manager(af_memory_manager *manager) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         std::unique_ptr<MemoryManager> m(new MemoryManager());
@@ -393,6 +412,7 @@ af_err af_create_memory_manager(af_memory_manager *manager) {
 }
 
 af_err af_release_memory_manager(af_memory_manager handle) {
+    AF_API_SCOPE;
     try {
         // NB: does NOT reset the internal memory manager to be the default:
         // af_unset_memory_manager_pinned must be used to fully-reset with a new
@@ -405,6 +425,7 @@ af_err af_release_memory_manager(af_memory_manager handle) {
 }
 
 af_err af_set_memory_manager(af_memory_manager mgr) {
+    AF_API_SCOPE;
     try {
         std::unique_ptr<MemoryManagerFunctionWrapper> newManager(
             new MemoryManagerFunctionWrapper(mgr));
@@ -418,6 +439,7 @@ af_err af_set_memory_manager(af_memory_manager mgr) {
 }
 
 af_err af_unset_memory_manager() {
+    AF_API_SCOPE;
     try {
         detail::resetMemoryManager();
     }
@@ -427,6 +449,7 @@ af_err af_unset_memory_manager() {
 }
 
 af_err af_set_memory_manager_pinned(af_memory_manager mgr) {
+    AF_API_SCOPE;
     try {
         // NB: does NOT free if a non-default implementation is set as the
         // current memory manager - the user is responsible for freeing any
@@ -443,6 +466,7 @@ af_err af_set_memory_manager_pinned(af_memory_manager mgr) {
 }
 
 af_err af_unset_memory_manager_pinned() {
+    AF_API_SCOPE;
     try {
         detail::resetMemoryManagerPinned();
     }
@@ -452,6 +476,7 @@ af_err af_unset_memory_manager_pinned() {
 }
 
 af_err af_memory_manager_get_payload(af_memory_manager handle, void **payload) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         *payload               = manager.payload;
@@ -462,6 +487,7 @@ af_err af_memory_manager_get_payload(af_memory_manager handle, void **payload) {
 }
 
 af_err af_memory_manager_set_payload(af_memory_manager handle, void *payload) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.payload        = payload;
@@ -476,6 +502,7 @@ af_err af_memory_manager_set_payload(af_memory_manager handle, void *payload) {
 
 af_err af_memory_manager_get_active_device_id(af_memory_manager handle,
                                               int *id) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         *id                    = manager.wrapper->getActiveDeviceId();
@@ -488,6 +515,7 @@ af_err af_memory_manager_get_active_device_id(af_memory_manager handle,
 
 af_err af_memory_manager_native_alloc(af_memory_manager handle, void **ptr,
                                       size_t size) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         *ptr                   = manager.wrapper->nativeAlloc(size);
@@ -498,6 +526,7 @@ af_err af_memory_manager_native_alloc(af_memory_manager handle, void **ptr,
 }
 
 af_err af_memory_manager_native_free(af_memory_manager handle, void *ptr) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.wrapper->nativeFree(ptr);
@@ -509,6 +538,7 @@ af_err af_memory_manager_native_free(af_memory_manager handle, void *ptr) {
 
 af_err af_memory_manager_get_max_memory_size(af_memory_manager handle,
                                              size_t *size, int id) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         *size                  = manager.wrapper->getMaxMemorySize(id);
@@ -520,6 +550,7 @@ af_err af_memory_manager_get_max_memory_size(af_memory_manager handle,
 
 af_err af_memory_manager_get_memory_pressure_threshold(af_memory_manager handle,
                                                        float *value) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         *value                 = manager.wrapper->getMemoryPressureThreshold();
@@ -531,6 +562,7 @@ af_err af_memory_manager_get_memory_pressure_threshold(af_memory_manager handle,
 
 af_err af_memory_manager_set_memory_pressure_threshold(af_memory_manager handle,
                                                        float value) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.wrapper->setMemoryPressureThreshold(value);
@@ -545,6 +577,7 @@ af_err af_memory_manager_set_memory_pressure_threshold(af_memory_manager handle,
 
 af_err af_memory_manager_set_initialize_fn(af_memory_manager handle,
                                            af_memory_manager_initialize_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.initialize_fn  = fn;
@@ -556,6 +589,7 @@ af_err af_memory_manager_set_initialize_fn(af_memory_manager handle,
 
 af_err af_memory_manager_set_shutdown_fn(af_memory_manager handle,
                                          af_memory_manager_shutdown_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.shutdown_fn    = fn;
@@ -567,6 +601,7 @@ af_err af_memory_manager_set_shutdown_fn(af_memory_manager handle,
 
 af_err af_memory_manager_set_alloc_fn(af_memory_manager handle,
                                       af_memory_manager_alloc_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.alloc_fn       = fn;
@@ -578,6 +613,7 @@ af_err af_memory_manager_set_alloc_fn(af_memory_manager handle,
 
 af_err af_memory_manager_set_allocated_fn(af_memory_manager handle,
                                           af_memory_manager_allocated_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.allocated_fn   = fn;
@@ -589,6 +625,7 @@ af_err af_memory_manager_set_allocated_fn(af_memory_manager handle,
 
 af_err af_memory_manager_set_unlock_fn(af_memory_manager handle,
                                        af_memory_manager_unlock_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.unlock_fn      = fn;
@@ -600,6 +637,7 @@ af_err af_memory_manager_set_unlock_fn(af_memory_manager handle,
 
 af_err af_memory_manager_set_signal_memory_cleanup_fn(
     af_memory_manager handle, af_memory_manager_signal_memory_cleanup_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager           = getMemoryManager(handle);
         manager.signal_memory_cleanup_fn = fn;
@@ -611,6 +649,7 @@ af_err af_memory_manager_set_signal_memory_cleanup_fn(
 
 af_err af_memory_manager_set_print_info_fn(af_memory_manager handle,
                                            af_memory_manager_print_info_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.print_info_fn  = fn;
@@ -622,6 +661,7 @@ af_err af_memory_manager_set_print_info_fn(af_memory_manager handle,
 
 af_err af_memory_manager_set_user_lock_fn(af_memory_manager handle,
                                           af_memory_manager_user_lock_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.user_lock_fn   = fn;
@@ -633,6 +673,7 @@ af_err af_memory_manager_set_user_lock_fn(af_memory_manager handle,
 
 af_err af_memory_manager_set_user_unlock_fn(
     af_memory_manager handle, af_memory_manager_user_unlock_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager = getMemoryManager(handle);
         manager.user_unlock_fn = fn;
@@ -644,6 +685,7 @@ af_err af_memory_manager_set_user_unlock_fn(
 
 af_err af_memory_manager_set_is_user_locked_fn(
     af_memory_manager handle, af_memory_manager_is_user_locked_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager    = getMemoryManager(handle);
         manager.is_user_locked_fn = fn;
@@ -655,6 +697,7 @@ af_err af_memory_manager_set_is_user_locked_fn(
 
 af_err af_memory_manager_set_get_memory_pressure_fn(
     af_memory_manager handle, af_memory_manager_get_memory_pressure_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager         = getMemoryManager(handle);
         manager.get_memory_pressure_fn = fn;
@@ -667,6 +710,7 @@ af_err af_memory_manager_set_get_memory_pressure_fn(
 af_err af_memory_manager_set_jit_tree_exceeds_memory_pressure_fn(
     af_memory_manager handle,
     af_memory_manager_jit_tree_exceeds_memory_pressure_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager                      = getMemoryManager(handle);
         manager.jit_tree_exceeds_memory_pressure_fn = fn;
@@ -678,6 +722,7 @@ af_err af_memory_manager_set_jit_tree_exceeds_memory_pressure_fn(
 
 af_err af_memory_manager_set_add_memory_management_fn(
     af_memory_manager handle, af_memory_manager_add_memory_management_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager           = getMemoryManager(handle);
         manager.add_memory_management_fn = fn;
@@ -690,6 +735,7 @@ af_err af_memory_manager_set_add_memory_management_fn(
 af_err af_memory_manager_set_remove_memory_management_fn(
     af_memory_manager handle,
     af_memory_manager_remove_memory_management_fn fn) {
+    AF_API_SCOPE;
     try {
         MemoryManager &manager              = getMemoryManager(handle);
         manager.remove_memory_management_fn = fn;
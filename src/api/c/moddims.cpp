@@ -40,6 +40,7 @@ af_array flat(const af_array in) {
 
 af_err af_moddims(af_array* out, const af_array in, const unsigned ndims,
                   const dim_t* const dims) {
+    AF_API_SCOPE;
     try {
         if (ndims == 0) {
             *out = retain(in);
@@ -82,6 +83,7 @@ af_err af_moddims(af_array* out, const af_array in, const unsigned ndims,
 }
 
 af_err af_flat(af_array* out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(in);
 
@@ -181,17 +181,21 @@ af_err morph3d(af_array *out, const af_array &in, const af_array &mask,
 }
 
 af_err af_dilate(af_array *out, const af_array in, const af_array mask) {
+    AF_API_SCOPE;
     return morph(out, in, mask, true);
 }
 
 af_err af_erode(af_array *out, const af_array in, const af_array mask) {
+    AF_API_SCOPE;
     return morph(out, in, mask, false);
 }
 
 af_err af_dilate3(af_array *out, const af_array in, const af_array mask) {
+    AF_API_SCOPE;
     return morph3d(out, in, mask, true);
 }
 
 af_err af_erode3(af_array *out, const af_array in, const af_array mask) {
+    AF_API_SCOPE;
     return morph3d(out, in, mask, false);
 }
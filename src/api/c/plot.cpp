@@ -333,27 +333,32 @@ af_err plotWrapper(const af_window window, const af_array X, const af_array Y,
 // Plot API
 af_err af_draw_plot_nd(const af_window wind, const af_array in,
                        const af_cell* const props) {
+    AF_API_SCOPE;
     return plotWrapper(wind, in, 1, props);
 }
 
 af_err af_draw_plot_2d(const af_window wind, const af_array X, const af_array Y,
                        const af_cell* const props) {
+    AF_API_SCOPE;
     return plotWrapper(wind, X, Y, props);
 }
 
 af_err af_draw_plot_3d(const af_window wind, const af_array X, const af_array Y,
                        const af_array Z, const af_cell* const props) {
+    AF_API_SCOPE;
     return plotWrapper(wind, X, Y, Z, props);
 }
 
 // Deprecated Plot API
 af_err af_draw_plot(const af_window wind, const af_array X, const af_array Y,
                     const af_cell* const props) {
+    AF_API_SCOPE;
     return plotWrapper(wind, X, Y, props);
 }
 
 af_err af_draw_plot3(const af_window wind, const af_array P,
                      const af_cell* const props) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(P);
         af::dim4 dims         = info.dims();
@@ -385,6 +390,7 @@ af_err af_draw_plot3(const af_window wind, const af_array P,
 af_err af_draw_scatter_nd(const af_window wind, const af_array in,
                           const af_marker_type af_marker,
                           const af_cell* const props) {
+    AF_API_SCOPE;
     try {
         fg_marker_type fg_marker = getFGMarker(af_marker);
         return plotWrapper(wind, in, 1, props, FG_PLOT_SCATTER, fg_marker);
@@ -395,6 +401,7 @@ af_err af_draw_scatter_nd(const af_window wind, const af_array in,
 af_err af_draw_scatter_2d(const af_window wind, const af_array X,
                           const af_array Y, const af_marker_type af_marker,
                           const af_cell* const props) {
+    AF_API_SCOPE;
     try {
         fg_marker_type fg_marker = getFGMarker(af_marker);
         return plotWrapper(wind, X, Y, props, FG_PLOT_SCATTER, fg_marker);
@@ -406,6 +413,7 @@ af_err af_draw_scatter_3d(const af_window wind, const af_array X,
                           const af_array Y, const af_array Z,
                           const af_marker_type af_marker,
                           const af_cell* const props) {
+    AF_API_SCOPE;
     try {
         fg_marker_type fg_marker = getFGMarker(af_marker);
         return plotWrapper(wind, X, Y, Z, props, FG_PLOT_SCATTER, fg_marker);
@@ -417,6 +425,7 @@ af_err af_draw_scatter_3d(const af_window wind, const af_array X,
 af_err af_draw_scatter(const af_window wind, const af_array X, const af_array Y,
                        const af_marker_type af_marker,
                        const af_cell* const props) {
+    AF_API_SCOPE;
     try {
         fg_marker_type fg_marker = getFGMarker(af_marker);
         return plotWrapper(wind, X, Y, props, FG_PLOT_SCATTER, fg_marker);
@@ -427,6 +436,7 @@ af_err af_draw_scatter(const af_window wind, const af_array X, const af_array Y,
 af_err af_draw_scatter3(const af_window wind, const af_array P,
                         const af_marker_type af_marker,
                         const af_cell* const props) {
+    AF_API_SCOPE;
     try {
         fg_marker_type fg_marker = getFGMarker(af_marker);
         const ArrayInfo& info    = getInfo(P);
@@ -140,6 +140,7 @@ static void printSparse(const char *exp, af_array arr, const int precision,
 }
 
 af_err af_print_array(af_array arr) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info =
             getInfo(arr, false);  // Don't assert sparse/dense
@@ -178,6 +179,7 @@ af_err af_print_array(af_array arr) {
 
 af_err af_print_array_gen(const char *exp, const af_array arr,
                           const int precision) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, exp != NULL);
         const ArrayInfo &info =
@@ -217,6 +219,7 @@ af_err af_print_array_gen(const char *exp, const af_array arr,
 
 af_err af_array_to_string(char **output, const char *exp, const af_array arr,
                           const int precision, bool transpose) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, exp != NULL);
         const ArrayInfo &info =
@@ -11,12 +11,14 @@
 #include <common/ArrayInfo.hpp>
 #include <common/err_common.hpp>
 #include <handle.hpp>
+#include <lapack_common.hpp>
 #include <qr.hpp>
 #include <af/array.h>
 #include <af/defines.h>
 #include <af/lapack.h>
 
 using af::dim4;
+using arrayfire::common::lapackBatchSupported;
 using detail::Array;
 using detail::cdouble;
 using detail::cfloat;
@@ -43,10 +45,11 @@ static inline af_array qr_inplace(af_array in) {
 }
 
 af_err af_qr(af_array *q, af_array *r, af_array *tau, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &i_info = getInfo(in);
 
-        if (i_info.ndims() > 2) {
+        if (!lapackBatchSupported && i_info.ndims() > 2) {
             AF_ERROR("qr can not be used in batch mode", AF_ERR_BATCH);
         }
 
@@ -78,10 +81,11 @@ af_err af_qr(af_array *q, af_array *r, af_array *tau, const af_array in) {
 }
 
 af_err af_qr_inplace(af_array *tau, af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &i_info = getInfo(in);
 
-        if (i_info.ndims() > 2) {
+        if (!lapackBatchSupported && i_info.ndims() > 2) {
             AF_ERROR("qr can not be used in batch mode", AF_ERR_BATCH);
         }
 
@@ -0,0 +1,82 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <backend.hpp>
+#include <common/err_common.hpp>
+#include <copy.hpp>
+#include <handle.hpp>
+#include <quantile_common.hpp>
+#include <af/defines.h>
+#include <af/dim4.hpp>
+#include <af/statistics.h>
+
+#include <vector>
+
+using af::dim4;
+using arrayfire::common::castArray;
+using detail::Array;
+using detail::uchar;
+using detail::uint;
+using detail::ushort;
+using std::vector;
+
+template<typename T, typename To>
+static af_array quantile(const af_array in, const vector<double>& probs,
+                         const dim_t dim, const af_quantile_method method) {
+    return getHandle(arrayfire::common::quantile<T, To>(
+        getArray<T>(in), probs, static_cast<int>(dim), method));
+}
+
+af_err af_quantile(af_array* out, const af_array in, const af_array probs,
+                   const dim_t dim, const af_quantile_method method) {
+    AF_API_SCOPE;
+    try {
+        ARG_ASSERT(3, (dim >= 0 && dim < AF_MAX_DIMS));
+        ARG_ASSERT(4, (method >= AF_QUANTILE_DEFAULT &&
+                       method <= AF_QUANTILE_MIDPOINT));
+
+        const ArrayInfo& info  = getInfo(in);
+        const ArrayInfo& pinfo = getInfo(probs);
+        af_dtype type          = info.getType();
+
+        ARG_ASSERT(2, pinfo.isReal() && pinfo.isFloating());
+        DIM_ASSERT(2, pinfo.isScalar() || pinfo.isVector());
+
+        vector<double> p(pinfo.elements());
+        detail::copyData(p.data(), castArray<double>(probs));
+        for (const double v : p) { ARG_ASSERT(2, (v >= 0.0 && v <= 1.0)); }
+
+        const af_quantile_method m =
+            (method == AF_QUANTILE_DEFAULT ? AF_QUANTILE_LINEAR : method);
+
+        af_array output = 0;
+        if (info.elements() == 0) {
+            dim4 odims = info.dims();
+            odims[dim] = static_cast<dim_t>(p.size());
+            AF_CHECK(af_create_handle(&output, AF_MAX_DIMS, odims.get(),
+                                      type == f64 ? f64 : f32));
+            std::swap(*out, output);
+            return AF_SUCCESS;
+        }
+
+        switch (type) {
+            case f64: output = quantile<double, double>(in, p, dim, m); break;
+            case f32: output = quantile<float, float>(in, p, dim, m); break;
+            case s32: output = quantile<int, float>(in, p, dim, m); break;
+            case u32: output = quantile<uint, float>(in, p, dim, m); break;
+            case s16: output = quantile<short, float>(in, p, dim, m); break;
+            case u16: output = quantile<ushort, float>(in, p, dim, m); break;
+            case u8: output = quantile<uchar, float>(in, p, dim, m); break;
+            default: TYPE_ERROR(1, type);
+        }
+        std::swap(*out, output);
+    }
+    CATCHALL;
+    return AF_SUCCESS;
+}
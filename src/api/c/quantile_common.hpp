@@ -0,0 +1,88 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+
+#include <Array.hpp>
+#include <backend.hpp>
+#include <common/quantile.hpp>
+#include <af/defines.h>
+#include <af/dim4.hpp>
+
+#if defined(AF_CPU)
+#include <quantile.hpp>
+#else
+#include <arith.hpp>
+#include <common/cast.hpp>
+#include <join.hpp>
+#include <sort.hpp>
+#endif
+
+#include <vector>
+
+namespace arrayfire {
+namespace common {
+
+/// Quantiles of \p in along \p dim, one for each element of \p probs
+template<typename T, typename To>
+detail::Array<To> quantile(const detail::Array<T>& in,
+                           const std::vector<double>& probs, const int dim,
+                           const af_quantile_method method) {
+    const dim_t count = in.dims()[dim];
+
+    std::vector<QuantileRanks> plan;
+    plan.reserve(probs.size());
+    for (const double p : probs) {
+        plan.push_back(quantileRanks(p, count, method));
+    }
+
+#if defined(AF_CPU)
+    // Selection only partially orders every column
+    return detail::quantile<T, To>(in, plan, dim);
+#else
+    const detail::Array<T> sorted = detail::sort<T>(in, dim, true);
+
+    std::vector<af_seq> index(4, af_span);
+    const auto rank = [&](const dim_t r) {
+        index[dim] = af_make_seq(r, r, 1);
+        return cast<To, T>(detail::createSubArray(sorted, index));
+    };
+
+    std::vector<detail::Array<To>> parts;
+    for (const QuantileRanks& r : plan) {
+        detail::Array<To> lower = rank(r.lower);
+        if (r.lower == r.upper) {
+            parts.push_back(lower);
+            continue;
+        }
+        detail::Array<To> upper = rank(r.upper);
+        const af::dim4 pdims    = lower.dims();
+        if (r.midpoint) {
+            auto sum  = detail::arithOp<To, af_add_t>(lower, upper, pdims);
+            auto half = detail::createValueArray<To>(pdims, To(0.5));
+            parts.push_back(detail::arithOp<To, af_mul_t>(sum, half, pdims));
+        } else {
+            auto diff = detail::arithOp<To, af_sub_t>(upper, lower, pdims);
+            auto w    = detail::createValueArray<To>(pdims, To(r.weight));
+            auto step = detail::arithOp<To, af_mul_t>(diff, w, pdims);
+            parts.push_back(detail::arithOp<To, af_add_t>(lower, step, pdims));
+        }
+    }
+    if (parts.size() == 1) { return parts[0]; }
+
+    af::dim4 odims           = in.dims();
+    odims[dim]               = static_cast<dim_t>(parts.size());
+    detail::Array<To> output = detail::createEmptyArray<To>(odims);
+    detail::join<To>(output, dim, parts);
+    return output;
+#endif
+}
+
+}  // namespace common
+}  // namespace arrayfire
@@ -127,6 +127,7 @@ void validateRandomType(const af_random_engine_type type) {
 }  // namespace
 
 af_err af_get_default_random_engine(af_random_engine *r) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
 
@@ -151,6 +152,7 @@ af_err af_get_default_random_engine(af_random_engine *r) {
 
 af_err af_create_random_engine(af_random_engine *engineHandle,
                                af_random_engine_type rtype, uintl seed) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         validateRandomType(rtype);
@@ -184,6 +186,7 @@ af_err af_create_random_engine(af_random_engine *engineHandle,
 
 af_err af_retain_random_engine(af_random_engine *outHandle,
                                const af_random_engine engineHandle) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         *outHandle = getRandomEngineHandle(*(getRandomEngine(engineHandle)));
@@ -194,6 +197,7 @@ af_err af_retain_random_engine(af_random_engine *outHandle,
 
 af_err af_random_engine_set_type(af_random_engine *engine,
                                  const af_random_engine_type rtype) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         validateRandomType(rtype);
@@ -230,6 +234,7 @@ af_err af_random_engine_set_type(af_random_engine *engine,
 
 af_err af_random_engine_get_type(af_random_engine_type *rtype,
                                  const af_random_engine engine) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         RandomEngine *e = getRandomEngine(engine);
@@ -240,6 +245,7 @@ af_err af_random_engine_get_type(af_random_engine_type *rtype,
 }
 
 af_err af_set_default_random_engine_type(const af_random_engine_type rtype) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         af_random_engine e;
@@ -251,6 +257,7 @@ af_err af_set_default_random_engine_type(const af_random_engine_type rtype) {
 }
 
 af_err af_random_engine_set_seed(af_random_engine *engine, const uintl seed) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         RandomEngine *e = getRandomEngine(*engine);
@@ -266,6 +273,7 @@ af_err af_random_engine_set_seed(af_random_engine *engine, const uintl seed) {
 }
 
 af_err af_random_engine_get_seed(uintl *const seed, af_random_engine engine) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         RandomEngine *e = getRandomEngine(engine);
@@ -278,6 +286,7 @@ af_err af_random_engine_get_seed(uintl *const seed, af_random_engine engine) {
 af_err af_random_uniform(af_array *out, const unsigned ndims,
                          const dim_t *const dims, const af_dtype type,
                          af_random_engine engine) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         af_array result;
@@ -310,6 +319,7 @@ af_err af_random_uniform(af_array *out, const unsigned ndims,
 af_err af_random_normal(af_array *out, const unsigned ndims,
                         const dim_t *const dims, const af_dtype type,
                         af_random_engine engine) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         af_array result;
@@ -332,6 +342,7 @@ af_err af_random_normal(af_array *out, const unsigned ndims,
 }
 
 af_err af_release_random_engine(af_random_engine engineHandle) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         delete getRandomEngine(engineHandle);
@@ -342,6 +353,7 @@ af_err af_release_random_engine(af_random_engine engineHandle) {
 
 af_err af_randu(af_array *out, const unsigned ndims, const dim_t *const dims,
                 const af_dtype type) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         af_array result;
@@ -375,6 +387,7 @@ af_err af_randu(af_array *out, const unsigned ndims, const dim_t *const dims,
 
 af_err af_randn(af_array *out, const unsigned ndims, const dim_t *const dims,
                 const af_dtype type) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         af_array result;
@@ -399,6 +412,7 @@ af_err af_randn(af_array *out, const unsigned ndims, const dim_t *const dims,
 }
 
 af_err af_set_seed(const uintl seed) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         af_random_engine engine;
@@ -410,6 +424,7 @@ af_err af_set_seed(const uintl seed) {
 }
 
 af_err af_get_seed(uintl *seed) {
+    AF_API_SCOPE;
     try {
         AF_CHECK(af_init());
         af_random_engine e;
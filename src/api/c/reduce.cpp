@@ -441,68 +441,82 @@ static af_err reduce_promote_by_key(af_array *keys_out, af_array *vals_out,
 }
 
 af_err af_min(af_array *out, const af_array in, const int dim) {
+    AF_API_SCOPE;
     return reduce_common<af_min_t>(out, in, dim);
 }
 
 af_err af_max(af_array *out, const af_array in, const int dim) {
+    AF_API_SCOPE;
     return reduce_common<af_max_t>(out, in, dim);
 }
 
 af_err af_sum(af_array *out, const af_array in, const int dim) {
+    AF_API_SCOPE;
     return reduce_promote<af_add_t>(out, in, dim);
 }
 
 af_err af_product(af_array *out, const af_array in, const int dim) {
+    AF_API_SCOPE;
     return reduce_promote<af_mul_t>(out, in, dim);
 }
 
 af_err af_sum_nan(af_array *out, const af_array in, const int dim,
                   const double nanval) {
+    AF_API_SCOPE;
     return reduce_promote<af_add_t>(out, in, dim, true, nanval);
 }
 
 af_err af_product_nan(af_array *out, const af_array in, const int dim,
                       const double nanval) {
+    AF_API_SCOPE;
     return reduce_promote<af_mul_t>(out, in, dim, true, nanval);
 }
 
 af_err af_count(af_array *out, const af_array in, const int dim) {
+    AF_API_SCOPE;
     return reduce_type<af_notzero_t, uint>(out, in, dim);
 }
 
 af_err af_all_true(af_array *out, const af_array in, const int dim) {
+    AF_API_SCOPE;
     return reduce_type<af_and_t, char>(out, in, dim);
 }
 
 af_err af_any_true(af_array *out, const af_array in, const int dim) {
+    AF_API_SCOPE;
     return reduce_type<af_or_t, char>(out, in, dim);
 }
 
 // by key versions
 af_err af_min_by_key(af_array *keys_out, af_array *vals_out,
                      const af_array keys, const af_array vals, const int dim) {
+    AF_API_SCOPE;
     return reduce_by_key_common<af_min_t>(keys_out, vals_out, keys, vals, dim);
 }
 
 af_err af_max_by_key(af_array *keys_out, af_array *vals_out,
                      const af_array keys, const af_array vals, const int dim) {
+    AF_API_SCOPE;
     return reduce_by_key_common<af_max_t>(keys_out, vals_out, keys, vals, dim);
 }
 
 af_err af_sum_by_key(af_array *keys_out, af_array *vals_out,
                      const af_array keys, const af_array vals, const int dim) {
+    AF_API_SCOPE;
     return reduce_promote_by_key<af_add_t>(keys_out, vals_out, keys, vals, dim);
 }
 
 af_err af_product_by_key(af_array *keys_out, af_array *vals_out,
                          const af_array keys, const af_array vals,
                          const int dim) {
+    AF_API_SCOPE;
     return reduce_promote_by_key<af_mul_t>(keys_out, vals_out, keys, vals, dim);
 }
 
 af_err af_sum_by_key_nan(af_array *keys_out, af_array *vals_out,
                          const af_array keys, const af_array vals,
                          const int dim, const double nanval) {
+    AF_API_SCOPE;
     return reduce_promote_by_key<af_add_t>(keys_out, vals_out, keys, vals, dim,
                                            true, nanval);
 }
@@ -510,6 +524,7 @@ af_err af_sum_by_key_nan(af_array *keys_out, af_array *vals_out,
 af_err af_product_by_key_nan(af_array *keys_out, af_array *vals_out,
                              const af_array keys, const af_array vals,
                              const int dim, const double nanval) {
+    AF_API_SCOPE;
     return reduce_promote_by_key<af_mul_t>(keys_out, vals_out, keys, vals, dim,
                                            true, nanval);
 }
@@ -517,6 +532,7 @@ af_err af_product_by_key_nan(af_array *keys_out, af_array *vals_out,
 af_err af_count_by_key(af_array *keys_out, af_array *vals_out,
                        const af_array keys, const af_array vals,
                        const int dim) {
+    AF_API_SCOPE;
     return reduce_by_key_type<af_notzero_t, uint>(keys_out, vals_out, keys,
                                                   vals, dim);
 }
@@ -524,6 +540,7 @@ af_err af_count_by_key(af_array *keys_out, af_array *vals_out,
 af_err af_all_true_by_key(af_array *keys_out, af_array *vals_out,
                           const af_array keys, const af_array vals,
                           const int dim) {
+    AF_API_SCOPE;
     return reduce_by_key_type<af_and_t, char>(keys_out, vals_out, keys, vals,
                                               dim);
 }
@@ -531,6 +548,7 @@ af_err af_all_true_by_key(af_array *keys_out, af_array *vals_out,
 af_err af_any_true_by_key(af_array *keys_out, af_array *vals_out,
                           const af_array keys, const af_array vals,
                           const int dim) {
+    AF_API_SCOPE;
     return reduce_by_key_type<af_or_t, char>(keys_out, vals_out, keys, vals,
                                              dim);
 }
@@ -834,58 +852,72 @@ static af_err reduce_all_promote_array(af_array *out, const af_array in,
 }
 
 af_err af_min_all(double *real, double *imag, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_common<af_min_t>(real, imag, in);
 }
 
 af_err af_min_all_array(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_common_array<af_min_t>(out, in);
 }
 
 af_err af_max_all(double *real, double *imag, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_common<af_max_t>(real, imag, in);
 }
 
 af_err af_max_all_array(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_common_array<af_max_t>(out, in);
 }
 
 af_err af_sum_all(double *real, double *imag, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_promote<af_add_t>(real, imag, in);
 }
 
 af_err af_sum_all_array(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_promote_array<af_add_t>(out, in);
 }
 
 af_err af_product_all(double *real, double *imag, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_promote<af_mul_t>(real, imag, in);
 }
 
 af_err af_product_all_array(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_promote_array<af_mul_t>(out, in);
 }
 
 af_err af_count_all(double *real, double *imag, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_type<af_notzero_t, uint>(real, imag, in);
 }
 
 af_err af_count_all_array(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_type_array<af_notzero_t, uint>(out, in);
 }
 
 af_err af_all_true_all(double *real, double *imag, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_type<af_and_t, char>(real, imag, in);
 }
 
 af_err af_all_true_all_array(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_type_array<af_and_t, char>(out, in);
 }
 
 af_err af_any_true_all(double *real, double *imag, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_type<af_or_t, char>(real, imag, in);
 }
 
 af_err af_any_true_all_array(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     return reduce_all_type_array<af_or_t, char>(out, in);
 }
 
@@ -965,10 +997,12 @@ static af_err ireduce_common(af_array *val, af_array *idx, const af_array in,
 }
 
 af_err af_imin(af_array *val, af_array *idx, const af_array in, const int dim) {
+    AF_API_SCOPE;
     return ireduce_common<af_min_t>(val, idx, in, dim);
 }
 
 af_err af_imax(af_array *val, af_array *idx, const af_array in, const int dim) {
+    AF_API_SCOPE;
     return ireduce_common<af_max_t>(val, idx, in, dim);
 }
 
@@ -1041,6 +1075,7 @@ static af_err rreduce_common(af_array *val, af_array *idx, const af_array in,
 
 af_err af_max_ragged(af_array *val, af_array *idx, const af_array in,
                      const af_array ragged_len, const int dim) {
+    AF_API_SCOPE;
     return rreduce_common<af_max_t>(val, idx, in, ragged_len, dim);
 }
 
@@ -1110,30 +1145,36 @@ static af_err ireduce_all_common(double *real_val, double *imag_val,
 
 af_err af_imin_all(double *real, double *imag, unsigned *idx,
                    const af_array in) {
+    AF_API_SCOPE;
     return ireduce_all_common<af_min_t>(real, imag, idx, in);
 }
 
 af_err af_imax_all(double *real, double *imag, unsigned *idx,
                    const af_array in) {
+    AF_API_SCOPE;
     return ireduce_all_common<af_max_t>(real, imag, idx, in);
 }
 
 af_err af_sum_nan_all(double *real, double *imag, const af_array in,
                       const double nanval) {
+    AF_API_SCOPE;
     return reduce_all_promote<af_add_t>(real, imag, in, true, nanval);
 }
 
 af_err af_sum_nan_all_array(af_array *out, const af_array in,
                             const double nanval) {
+    AF_API_SCOPE;
     return reduce_all_promote_array<af_add_t>(out, in, true, nanval);
 }
 
 af_err af_product_nan_all(double *real, double *imag, const af_array in,
                           const double nanval) {
+    AF_API_SCOPE;
     return reduce_all_promote<af_mul_t>(real, imag, in, true, nanval);
 }
 
 af_err af_product_nan_all_array(af_array *out, const af_array in,
                                 const double nanval) {
+    AF_API_SCOPE;
     return reduce_all_promote_array<af_mul_t>(out, in, true, nanval);
 }
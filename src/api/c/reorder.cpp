@@ -71,6 +71,7 @@ static inline af_array reorder(const af_array in, const af::dim4 &rdims0) {
 }
 
 af_err af_reorder(af_array *out, const af_array in, const af::dim4 &rdims) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         af_dtype type         = info.getType();
@@ -125,6 +126,7 @@ af_err af_reorder(af_array *out, const af_array in, const af::dim4 &rdims) {
 
 af_err af_reorder(af_array *out, const af_array in, const unsigned x,
                   const unsigned y, const unsigned z, const unsigned w) {
+    AF_API_SCOPE;
     af::dim4 rdims(x, y, z, w);
     return af_reorder(out, in, rdims);
 }
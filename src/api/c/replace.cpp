@@ -40,6 +40,7 @@ void replace(af_array a, const af_array cond, const af_array b) {
 }
 
 af_err af_replace(af_array a, const af_array cond, const af_array b) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& ainfo = getInfo(a);
         const ArrayInfo& binfo = getInfo(b);
@@ -126,15 +127,18 @@ af_err replaceScalar(af_array a, const af_array cond, const ScalarType b) {
 }
 
 af_err af_replace_scalar(af_array a, const af_array cond, const double b) {
+    AF_API_SCOPE;
     return replaceScalar(a, cond, b);
 }
 
 af_err af_replace_scalar_long(af_array a, const af_array cond,
                               const long long b) {
+    AF_API_SCOPE;
     return replaceScalar(a, cond, b);
 }
 
 af_err af_replace_scalar_ulong(af_array a, const af_array cond,
                                const unsigned long long b) {
+    AF_API_SCOPE;
     return replaceScalar(a, cond, b);
 }
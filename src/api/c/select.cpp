@@ -41,6 +41,7 @@ af_array select(const af_array cond, const af_array a, const af_array b,
 
 af_err af_select(af_array* out, const af_array cond, const af_array a,
                  const af_array b) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& ainfo     = getInfo(a);
         const ArrayInfo& binfo     = getInfo(b);
@@ -182,30 +183,36 @@ af_err selectScalar(af_array* out, const af_array cond, const af_array e,
 
 af_err af_select_scalar_r(af_array* out, const af_array cond, const af_array a,
                           const double b) {
+    AF_API_SCOPE;
     return selectScalar<double, false>(out, cond, a, b);
 }
 
 af_err af_select_scalar_r_long(af_array* out, const af_array cond,
                                const af_array a, const long long b) {
+    AF_API_SCOPE;
     return selectScalar<long long, false>(out, cond, a, b);
 }
 
 af_err af_select_scalar_r_ulong(af_array* out, const af_array cond,
                                 const af_array a, const unsigned long long b) {
+    AF_API_SCOPE;
     return selectScalar<unsigned long long, false>(out, cond, a, b);
 }
 
 af_err af_select_scalar_l(af_array* out, const af_array cond, const double a,
                           const af_array b) {
+    AF_API_SCOPE;
     return selectScalar<double, true>(out, cond, b, a);
 }
 
 af_err af_select_scalar_l_long(af_array* out, const af_array cond,
                                const long long a, const af_array b) {
+    AF_API_SCOPE;
     return selectScalar<long long, true>(out, cond, b, a);
 }
 
 af_err af_select_scalar_l_ulong(af_array* out, const af_array cond,
                                 const unsigned long long a, const af_array b) {
+    AF_API_SCOPE;
     return selectScalar<unsigned long long, true>(out, cond, b, a);
 }
@@ -28,6 +28,7 @@ static inline af_array shift(const af_array in, const int sdims[4]) {
 }
 
 af_err af_shift(af_array *out, const af_array in, const int sdims[4]) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         af_dtype type         = info.getType();
@@ -61,6 +62,7 @@ af_err af_shift(af_array *out, const af_array in, const int sdims[4]) {
 
 af_err af_shift(af_array *out, const af_array in, const int x, const int y,
                 const int z, const int w) {
+    AF_API_SCOPE;
     const int sdims[] = {x, y, z, w};
     return af_shift(out, in, sdims);
 }
@@ -11,12 +11,14 @@
 #include <common/ArrayInfo.hpp>
 #include <common/err_common.hpp>
 #include <handle.hpp>
+#include <lapack_common.hpp>
 #include <solve.hpp>
 #include <af/array.h>
 #include <af/defines.h>
 #include <af/lapack.h>
 
 using af::dim4;
+using arrayfire::common::lapackBatchSupported;
 using detail::Array;
 using detail::cdouble;
 using detail::cfloat;
@@ -30,6 +32,7 @@ static inline af_array solve(const af_array a, const af_array b,
 
 af_err af_solve(af_array* out, const af_array a, const af_array b,
                 const af_mat_prop options) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& a_info = getInfo(a);
         const ArrayInfo& b_info = getInfo(b);
@@ -94,12 +97,14 @@ static inline af_array solve_lu(const af_array a, const af_array pivot,
 
 af_err af_solve_lu(af_array* out, const af_array a, const af_array piv,
                    const af_array b, const af_mat_prop options) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& a_info   = getInfo(a);
         const ArrayInfo& b_info   = getInfo(b);
         const ArrayInfo& piv_info = getInfo(piv);
 
-        if (a_info.ndims() > 2 || b_info.ndims() > 2) {
+        if (!lapackBatchSupported &&
+            (a_info.ndims() > 2 || b_info.ndims() > 2)) {
             AF_ERROR("solveLU can not be used in batch mode", AF_ERR_BATCH);
         }
 
@@ -125,6 +130,11 @@ af_err af_solve_lu(af_array* out, const af_array a, const af_array piv,
         DIM_ASSERT(1, bdims[2] == adims[2]);
         DIM_ASSERT(1, bdims[3] == adims[3]);
 
+        dim4 pdims = piv_info.dims();
+        DIM_ASSERT(2, pdims[0] == adims[0]);
+        DIM_ASSERT(2, pdims[2] == adims[2]);
+        DIM_ASSERT(2, pdims[3] == adims[3]);
+
         if (options != AF_MAT_NONE) {
             AF_ERROR("Using this property is not yet supported in solveLU",
                      AF_ERR_NOT_SUPPORTED);
@@ -178,6 +178,7 @@ af_err af_create_sparse_array(af_array *out, const dim_t nRows,
                               const dim_t nCols, const af_array values,
                               const af_array rowIdx, const af_array colIdx,
                               const af_storage stype) {
+    AF_API_SCOPE;
     try {
         // Checks:
         // rowIdx and colIdx arrays are of s32 type
@@ -250,6 +251,7 @@ af_err af_create_sparse_array_from_ptr(
     af_array *out, const dim_t nRows, const dim_t nCols, const dim_t nNZ,
     const void *const values, const int *const rowIdx, const int *const colIdx,
     const af_dtype type, const af_storage stype, const af_source source) {
+    AF_API_SCOPE;
     try {
         // Checks:
         // rowIdx and colIdx arrays are of s32 type
@@ -302,6 +304,7 @@ af_err af_create_sparse_array_from_ptr(
 
 af_err af_create_sparse_array_from_dense(af_array *out, const af_array in,
                                          const af_storage stype) {
+    AF_API_SCOPE;
     try {
         // Checks:
         // stype is within acceptable range
@@ -345,6 +348,7 @@ af_err af_create_sparse_array_from_dense(af_array *out, const af_array in,
 
 af_err af_sparse_convert_to(af_array *out, const af_array in,
                             const af_storage destStorage) {
+    AF_API_SCOPE;
     try {
         // Handle dense case
         const ArrayInfo &info = getInfo(in, false);
@@ -392,6 +396,7 @@ af_err af_sparse_convert_to(af_array *out, const af_array in,
 }
 
 af_err af_sparse_to_dense(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         af_array output = nullptr;
 
@@ -424,6 +429,7 @@ af_err af_sparse_to_dense(af_array *out, const af_array in) {
 
 af_err af_sparse_get_info(af_array *values, af_array *rows, af_array *cols,
                           af_storage *stype, const af_array in) {
+    AF_API_SCOPE;
     try {
         if (values != NULL) { AF_CHECK(af_sparse_get_values(values, in)); }
         if (rows != NULL) { AF_CHECK(af_sparse_get_row_idx(rows, in)); }
@@ -436,6 +442,7 @@ af_err af_sparse_get_info(af_array *values, af_array *rows, af_array *cols,
 }
 
 af_err af_sparse_get_values(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const SparseArrayBase base = getSparseArrayBase(in);
 
@@ -455,6 +462,7 @@ af_err af_sparse_get_values(af_array *out, const af_array in) {
 }
 
 af_err af_sparse_get_row_idx(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const SparseArrayBase base = getSparseArrayBase(in);
         *out                       = getHandle(base.getRowIdx());
@@ -464,6 +472,7 @@ af_err af_sparse_get_row_idx(af_array *out, const af_array in) {
 }
 
 af_err af_sparse_get_col_idx(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const SparseArrayBase base = getSparseArrayBase(in);
         *out                       = getHandle(base.getColIdx());
@@ -473,6 +482,7 @@ af_err af_sparse_get_col_idx(af_array *out, const af_array in) {
 }
 
 af_err af_sparse_get_nnz(dim_t *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const SparseArrayBase base = getSparseArrayBase(in);
         *out                       = base.getNNZ();
@@ -482,6 +492,7 @@ af_err af_sparse_get_nnz(dim_t *out, const af_array in) {
 }
 
 af_err af_sparse_get_storage(af_storage *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const SparseArrayBase base = getSparseArrayBase(in);
         *out                       = base.getStorage();
@@ -98,6 +98,7 @@ af_err af_stdev_all(double* realVal, double* imagVal, const af_array in) {
 
 af_err af_stdev_all_v2(double* realVal, double* imagVal, const af_array in,
                        const af_var_bias bias) {
+    AF_API_SCOPE;
     UNUSED(imagVal);  // TODO implement for complex values
     try {
         const ArrayInfo& info = getInfo(in);
@@ -137,6 +138,7 @@ af_err af_stdev(af_array* out, const af_array in, const dim_t dim) {
 
 af_err af_stdev_v2(af_array* out, const af_array in, const af_var_bias bias,
                    const dim_t dim) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(2, (dim >= 0 && dim <= 3));
 
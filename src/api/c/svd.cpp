@@ -15,11 +15,13 @@
 #include <backend.hpp>
 #include <common/err_common.hpp>
 #include <handle.hpp>
+#include <lapack_common.hpp>
 #include <svd.hpp>
 #include <af/defines.h>
 
 using af::dim4;
 using af::dtype_traits;
+using arrayfire::common::lapackBatchSupported;
 using detail::Array;
 using detail::cdouble;
 using detail::cfloat;
@@ -37,9 +39,9 @@ static inline void svd(af_array *s, af_array *u, af_array *vt,
     using Tr = typename dtype_traits<T>::base_type;
 
     // Allocate output arrays
-    Array<Tr> sA = createEmptyArray<Tr>(dim4(min(M, N)));
-    Array<T> uA  = createEmptyArray<T>(dim4(M, M));
-    Array<T> vtA = createEmptyArray<T>(dim4(N, N));
+    Array<Tr> sA = createEmptyArray<Tr>(dim4(min(M, N), 1, dims[2], dims[3]));
+    Array<T> uA  = createEmptyArray<T>(dim4(M, M, dims[2], dims[3]));
+    Array<T> vtA = createEmptyArray<T>(dim4(N, N, dims[2], dims[3]));
 
     svd<T, Tr>(sA, uA, vtA, getArray<T>(in));
 
@@ -59,9 +61,9 @@ static inline void svdInPlace(af_array *s, af_array *u, af_array *vt,
     using Tr = typename dtype_traits<T>::base_type;
 
     // Allocate output arrays
-    Array<Tr> sA = createEmptyArray<Tr>(dim4(min(M, N)));
-    Array<T> uA  = createEmptyArray<T>(dim4(M, M));
-    Array<T> vtA = createEmptyArray<T>(dim4(N, N));
+    Array<Tr> sA = createEmptyArray<Tr>(dim4(min(M, N), 1, dims[2], dims[3]));
+    Array<T> uA  = createEmptyArray<T>(dim4(M, M, dims[2], dims[3]));
+    Array<T> vtA = createEmptyArray<T>(dim4(N, N, dims[2], dims[3]));
 
     svdInPlace<T, Tr>(sA, uA, vtA, getArray<T>(in));
 
@@ -71,11 +73,12 @@ static inline void svdInPlace(af_array *s, af_array *u, af_array *vt,
 }
 
 af_err af_svd(af_array *u, af_array *s, af_array *vt, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         dim4 dims             = info.dims();
 
-        ARG_ASSERT(3, (dims.ndims() >= 0 && dims.ndims() <= 2));
+        ARG_ASSERT(3, lapackBatchSupported || dims.ndims() <= 2);
         af_dtype type = info.getType();
 
         if (dims.ndims() == 0) {
@@ -98,11 +101,12 @@ af_err af_svd(af_array *u, af_array *s, af_array *vt, const af_array in) {
 }
 
 af_err af_svd_inplace(af_array *u, af_array *s, af_array *vt, af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         dim4 dims             = info.dims();
 
-        ARG_ASSERT(3, (dims.ndims() >= 0 && dims.ndims() <= 2));
+        ARG_ASSERT(3, lapackBatchSupported || dims.ndims() <= 2);
         af_dtype type = info.getType();
 
         if (dims.ndims() == 0) {
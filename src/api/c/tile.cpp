@@ -38,6 +38,7 @@ static inline af_array tile(const af_array in, const af::dim4 &tileDims) {
 }
 
 af_err af_tile(af_array *out, const af_array in, const af::dim4 &tileDims) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &info = getInfo(in);
         af_dtype type         = info.getType();
@@ -73,6 +74,7 @@ af_err af_tile(af_array *out, const af_array in, const af::dim4 &tileDims) {
 
 af_err af_tile(af_array *out, const af_array in, const unsigned x,
                const unsigned y, const unsigned z, const unsigned w) {
+    AF_API_SCOPE;
     af::dim4 tileDims(x, y, z, w);
     return af_tile(out, in, tileDims);
 }
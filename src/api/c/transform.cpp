@@ -15,6 +15,8 @@
 #include <af/defines.h>
 #include <af/image.h>
 
+#include <utility>
+
 using af::dim4;
 using detail::cdouble;
 using detail::cfloat;
@@ -32,6 +34,14 @@ static inline void transform(af_array *out, const af_array in,
                  method, inverse, perspective);
 }
 
+template<typename T>
+static inline af_array remap(const af_array in, const af_array mapX,
+                             const af_array mapY,
+                             const af_interp_type method) {
+    return getHandle(remap<T>(getArray<T>(in), getArray<float>(mapX),
+                              getArray<float>(mapY), method));
+}
+
 AF_BATCH_KIND getTransformBatchKind(const dim4 &iDims, const dim4 &tDims) {
     static const int baseDim = 2;
 
@@ -168,6 +178,7 @@ void af_transform_common(af_array *out, const af_array in, const af_array tf,
 af_err af_transform(af_array *out, const af_array in, const af_array tf,
                     const dim_t odim0, const dim_t odim1,
                     const af_interp_type method, const bool inverse) {
+    AF_API_SCOPE;
     try {
         af_transform_common(out, in, tf, odim0, odim1, method, inverse, true);
     }
@@ -179,6 +190,7 @@ af_err af_transform(af_array *out, const af_array in, const af_array tf,
 af_err af_transform_v2(af_array *out, const af_array in, const af_array tf,
                        const dim_t odim0, const dim_t odim1,
                        const af_interp_type method, const bool inverse) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(0, out != 0);  // need to dereference out in next call
         af_transform_common(out, in, tf, odim0, odim1, method, inverse,
@@ -192,6 +204,7 @@ af_err af_transform_v2(af_array *out, const af_array in, const af_array tf,
 af_err af_translate(af_array *out, const af_array in, const float trans0,
                     const float trans1, const dim_t odim0, const dim_t odim1,
                     const af_interp_type method) {
+    AF_API_SCOPE;
     try {
         float trans_mat[6] = {1, 0, 0, 0, 1, 0};
         trans_mat[2]       = trans0;
@@ -213,6 +226,7 @@ af_err af_translate(af_array *out, const af_array in, const float trans0,
 af_err af_scale(af_array *out, const af_array in, const float scale0,
                 const float scale1, const dim_t odim0, const dim_t odim1,
                 const af_interp_type method) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &i_info = getInfo(in);
         dim4 idims              = i_info.dims();
@@ -257,6 +271,7 @@ af_err af_scale(af_array *out, const af_array in, const float scale0,
 af_err af_skew(af_array *out, const af_array in, const float skew0,
                const float skew1, const dim_t odim0, const dim_t odim1,
                const af_interp_type method, const bool inverse) {
+    AF_API_SCOPE;
     try {
         float tx = std::tan(skew0);
         float ty = std::tan(skew1);
@@ -290,3 +305,56 @@ af_err af_skew(af_array *out, const af_array in, const float skew0,
 
     return AF_SUCCESS;
 }
+
+af_err af_remap(af_array *out, const af_array in, const af_array map_x,
+                const af_array map_y, const af_interp_type method) {
+    AF_API_SCOPE;
+    try {
+        ARG_ASSERT(0, out != 0);
+
+        const ArrayInfo &i_info = getInfo(in);
+        const ArrayInfo &x_info = getInfo(map_x);
+        const ArrayInfo &y_info = getInfo(map_y);
+
+        const dim4 &idims    = i_info.dims();
+        const dim4 &xdims    = x_info.dims();
+        const af_dtype itype = i_info.getType();
+
+        ARG_ASSERT(2, x_info.getType() == f32);
+        ARG_ASSERT(3, y_info.getType() == f32);
+        ARG_ASSERT(4, method == AF_INTERP_NEAREST ||
+                          method == AF_INTERP_BILINEAR ||
+                          method == AF_INTERP_BILINEAR_COSINE ||
+                          method == AF_INTERP_BICUBIC ||
+                          method == AF_INTERP_BICUBIC_SPLINE ||
+                          method == AF_INTERP_LOWER);
+
+        DIM_ASSERT(1, idims.elements() > 0);
+        // One map for all images, with one position per output pixel
+        DIM_ASSERT(2, xdims.elements() > 0 && xdims[2] * xdims[3] == 1);
+        DIM_ASSERT(3, y_info.dims() == xdims);
+
+        af_array output = 0;
+        // clang-format off
+        switch(itype) {
+        case f32: output = remap<float  >(in, map_x, map_y, method);  break;
+        case f64: output = remap<double >(in, map_x, map_y, method);  break;
+        case c32: output = remap<cfloat >(in, map_x, map_y, method);  break;
+        case c64: output = remap<cdouble>(in, map_x, map_y, method);  break;
+        case s32: output = remap<int    >(in, map_x, map_y, method);  break;
+        case u32: output = remap<uint   >(in, map_x, map_y, method);  break;
+        case s64: output = remap<intl   >(in, map_x, map_y, method);  break;
+        case u64: output = remap<uintl  >(in, map_x, map_y, method);  break;
+        case s16: output = remap<short  >(in, map_x, map_y, method);  break;
+        case u16: output = remap<ushort >(in, map_x, map_y, method);  break;
+        case u8:  output = remap<uchar  >(in, map_x, map_y, method);  break;
+        case b8:  output = remap<char   >(in, map_x, map_y, method);  break;
+        default:  TYPE_ERROR(1, itype);
+        }
+        // clang-format on
+        std::swap(*out, output);
+    }
+    CATCHALL;
+
+    return AF_SUCCESS;
+}
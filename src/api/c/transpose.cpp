@@ -35,6 +35,7 @@ static inline af_array trs(const af_array in, const bool conjugate) {
 }
 
 af_err af_transpose(af_array* out, af_array in, const bool conjugate) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(in);
         af_dtype type         = info.getType();
@@ -88,6 +89,7 @@ static inline void transpose_inplace(af_array in, const bool conjugate) {
 }
 
 af_err af_transpose_inplace(af_array in, const bool conjugate) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(in);
         af_dtype type         = info.getType();
@@ -38,6 +38,7 @@ size_t size_of(af_dtype type) {
 }
 
 af_err af_get_size_of(size_t *size, af_dtype type) {
+    AF_API_SCOPE;
     try {
         *size = size_of(type);
         return AF_SUCCESS;
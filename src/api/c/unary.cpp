@@ -561,6 +561,7 @@ struct unaryOpCplxFun<Tc, Tr, af_sqrt_t> {
 };
 
 af_err af_not(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         af_array tmp;
         const ArrayInfo &in_info = getInfo(in);
@@ -584,6 +585,7 @@ static inline af_array bitOpNot(const af_array in) {
 }
 
 af_err af_bitnot(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &iinfo = getInfo(in);
         const af_dtype type    = iinfo.getType();
@@ -614,6 +616,7 @@ af_err af_bitnot(af_array *out, const af_array in) {
 }
 
 af_err af_arg(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo &in_info = getInfo(in);
         if (in_info.ndims() == 0) { return af_retain_array(out, in); }
@@ -640,6 +643,7 @@ af_err af_arg(af_array *out, const af_array in) {
 }
 
 af_err af_pow2(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         af_array two;
         const ArrayInfo &in_info = getInfo(in);
@@ -658,6 +662,7 @@ af_err af_pow2(af_array *out, const af_array in) {
 }
 
 af_err af_factorial(af_array *out, const af_array in) {
+    AF_API_SCOPE;
     try {
         af_array one;
         const ArrayInfo &in_info = getInfo(in);
@@ -185,6 +185,7 @@ static af_array var_(const af_array& in, const af_array& weights,
 
 af_err af_var(af_array* out, const af_array in, const bool isbiased,
               const dim_t dim) {
+    AF_API_SCOPE;
     const af_var_bias bias =
         (isbiased ? AF_VARIANCE_SAMPLE : AF_VARIANCE_POPULATION);
     return af_var_v2(out, in, bias, dim);
@@ -192,6 +193,7 @@ af_err af_var(af_array* out, const af_array in, const bool isbiased,
 
 af_err af_var_v2(af_array* out, const af_array in, const af_var_bias bias,
                  const dim_t dim) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(3, (dim >= 0 && dim <= 3));
 
@@ -250,6 +252,7 @@ af_err af_var_v2(af_array* out, const af_array in, const af_var_bias bias,
 
 af_err af_var_weighted(af_array* out, const af_array in, const af_array weights,
                        const dim_t dim) {
+    AF_API_SCOPE;
     try {
         ARG_ASSERT(3, (dim >= 0 && dim <= 3));
 
@@ -328,6 +331,7 @@ af_err af_var_weighted(af_array* out, const af_array in, const af_array weights,
 
 af_err af_var_all(double* realVal, double* imagVal, const af_array in,
                   const bool isbiased) {
+    AF_API_SCOPE;
     const af_var_bias bias =
         (isbiased ? AF_VARIANCE_SAMPLE : AF_VARIANCE_POPULATION);
     return af_var_all_v2(realVal, imagVal, in, bias);
@@ -335,6 +339,7 @@ af_err af_var_all(double* realVal, double* imagVal, const af_array in,
 
 af_err af_var_all_v2(double* realVal, double* imagVal, const af_array in,
                      const af_var_bias bias) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& info = getInfo(in);
         af_dtype type         = info.getType();
@@ -369,6 +374,7 @@ af_err af_var_all_v2(double* realVal, double* imagVal, const af_array in,
 
 af_err af_var_all_weighted(double* realVal, double* imagVal, const af_array in,
                            const af_array weights) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& iInfo = getInfo(in);
         const ArrayInfo& wInfo = getInfo(weights);
@@ -413,6 +419,7 @@ af_err af_var_all_weighted(double* realVal, double* imagVal, const af_array in,
 af_err af_meanvar(af_array* mean, af_array* var, const af_array in,
                   const af_array weights, const af_var_bias bias,
                   const dim_t dim) {
+    AF_API_SCOPE;
     try {
         const ArrayInfo& iInfo = getInfo(in);
         if (weights != 0) {
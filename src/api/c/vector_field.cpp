@@ -408,6 +408,7 @@ af_err vectorFieldWrapper(const af_window window, const af_array xPoints,
 af_err af_draw_vector_field_nd(const af_window wind, const af_array points,
                                const af_array directions,
                                const af_cell* const props) {
+    AF_API_SCOPE;
     return vectorFieldWrapper(wind, points, directions, props);
 }
 
@@ -416,6 +417,7 @@ af_err af_draw_vector_field_3d(const af_window wind, const af_array xPoints,
                                const af_array xDirs, const af_array yDirs,
                                const af_array zDirs,
                                const af_cell* const props) {
+    AF_API_SCOPE;
     return vectorFieldWrapper(wind, xPoints, yPoints, zPoints, xDirs, yDirs,
                               zDirs, props);
 }
@@ -424,5 +426,6 @@ af_err af_draw_vector_field_2d(const af_window wind, const af_array xPoints,
                                const af_array yPoints, const af_array xDirs,
                                const af_array yDirs,
                                const af_cell* const props) {
+    AF_API_SCOPE;
     return vectorFieldWrapper(wind, xPoints, yPoints, xDirs, yDirs, props);
 }
@@ -154,10 +154,12 @@ af_err convert(af_array* out, const af_array& in, const af_ycc_std standard) {
 
 af_err af_ycbcr2rgb(af_array* out, const af_array in,
                     const af_ycc_std standard) {
+    AF_API_SCOPE;
     return convert<true>(out, in, standard);
 }
 
 af_err af_rgb2ycbcr(af_array* out, const af_array in,
                     const af_ycc_std standard) {
+    AF_API_SCOPE;
     return convert<false>(out, in, standard);
 }
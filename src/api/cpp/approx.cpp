@@ -45,4 +45,19 @@ array approx2(const array &zi, const array &xo, const int xdim,
                                 offGrid));
     return array(zo);
 }
+
+array approx1Prepare(const array &yi, const interpType method) {
+    af_array coeffs = 0;
+    AF_THROW(af_approx1_prepare(&coeffs, yi.get(), method));
+    return array(coeffs);
+}
+
+array approx1Prepared(const array &coeffs, const array &xo,
+                      const double xi_beg, const double xi_step,
+                      const float offGrid) {
+    af_array yo = 0;
+    AF_THROW(af_approx1_prepared(&yo, coeffs.get(), xo.get(), xi_beg, xi_step,
+                                 offGrid));
+    return array(yo);
+}
 }  // namespace af
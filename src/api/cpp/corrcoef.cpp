@@ -34,4 +34,10 @@ INSTANTIATE_CORRCOEF(unsigned short);
 
 #undef INSTANTIATE_CORRCOEF
 
+array corrcoefMatrix(const array& X) {
+    af_array temp = 0;
+    AF_THROW(af_corrcoef_matrix(&temp, X.get()));
+    return array(temp);
+}
+
 }  // namespace af
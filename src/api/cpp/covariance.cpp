@@ -25,4 +25,10 @@ array cov(const array& X, const array& Y, const af_var_bias bias) {
     return array(temp);
 }
 
+array covMatrix(const array& X, const af_var_bias bias) {
+    af_array temp = 0;
+    AF_THROW(af_cov_matrix(&temp, X.get(), bias));
+    return array(temp);
+}
+
 }  // namespace af
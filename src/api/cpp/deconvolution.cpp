@@ -21,6 +21,15 @@ array iterativeDeconv(const array& in, const array& ker,
     return array(temp);
 }
 
+array iterativeDeconv(const array& in, const array& ker,
+                      const unsigned iterations, const float relaxFactor,
+                      const iterativeDeconvAlgo algo, const float tolerance) {
+    af_array temp = 0;
+    AF_THROW(af_iterative_deconv_v2(&temp, in.get(), ker.get(), iterations,
+                                    relaxFactor, algo, tolerance));
+    return array(temp);
+}
+
 array inverseDeconv(const array& in, const array& psf, const float gamma,
                     const inverseDeconvAlgo algo) {
     af_array temp = 0;
@@ -22,4 +22,15 @@ features fast(const array& in, const float thr, const unsigned arc_length,
     return features(temp);
 }
 
+features fast(const array& in, const float thr, const unsigned arc_length,
+              const bool non_max, const float feature_ratio,
+              const unsigned edge, const unsigned grid_rows,
+              const unsigned grid_cols, const unsigned max_per_cell) {
+    af_features temp;
+    AF_THROW(af_fast_v2(&temp, in.get(), thr, arc_length, non_max,
+                        feature_ratio, edge, grid_rows, grid_cols,
+                        max_per_cell));
+    return features(temp);
+}
+
 }  // namespace af
@@ -34,6 +34,21 @@ array fftConvolve1(const array& signal, const array& filter,
     return array(out);
 }
 
+void fftConvolve1(array& y, array& zf, const array& signal,
+                  const array& filter, const array& zi) {
+    af_array out   = 0;
+    af_array state = 0;
+    AF_THROW(af_fft_convolve1_stream(&out, &state, signal.get(), filter.get(),
+                                     zi.get()));
+    y  = array(out);
+    zf = array(state);
+}
+
+void fftConvolve1(array& y, array& zf, const array& signal,
+                  const array& filter) {
+    fftConvolve1(y, zf, signal, filter, array());
+}
+
 array fftConvolve2(const array& signal, const array& filter,
                    const convMode mode) {
     af_array out = 0;
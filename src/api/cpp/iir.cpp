@@ -26,4 +26,30 @@ array iir(const array& b, const array& a, const array& x) {
     return array(out);
 }
 
+void iir(array& y, array& zf, const array& b, const array& a, const array& x,
+         const array& zi) {
+    af_array out   = 0;
+    af_array state = 0;
+    AF_THROW(af_iir_state(&out, &state, b.get(), a.get(), x.get(), zi.get()));
+    y  = array(out);
+    zf = array(state);
+}
+
+void iir(array& y, array& zf, const array& b, const array& a, const array& x) {
+    iir(y, zf, b, a, x, array());
+}
+
+void iirSos(array& y, array& zf, const array& sos, const array& x,
+            const array& zi) {
+    af_array out   = 0;
+    af_array state = 0;
+    AF_THROW(af_iir_sos(&out, &state, sos.get(), x.get(), zi.get()));
+    y  = array(out);
+    zf = array(state);
+}
+
+void iirSos(array& y, array& zf, const array& sos, const array& x) {
+    iirSos(y, zf, sos, x, array());
+}
+
 }  // namespace af
@@ -56,6 +56,25 @@ void saveImageNative(const char* filename, const array& in) {
     AF_THROW(af_save_image_native(filename, in.get()));
 }
 
+array loadImages(const char* const* filenames, const unsigned count,
+                 const bool is_color) {
+    af_array out = 0;
+    AF_THROW(af_load_images(&out, filenames, count, is_color));
+    return array(out);
+}
+
+array loadImagesMem(const void* const* ptrs, const unsigned count,
+                    const bool is_color) {
+    af_array out = 0;
+    AF_THROW(af_load_images_memory(&out, ptrs, count, is_color));
+    return array(out);
+}
+
+void saveImages(const char* const* filenames, const unsigned count,
+                const array& in) {
+    AF_THROW(af_save_images(filenames, count, in.get()));
+}
+
 bool isImageIOAvailable() {
     bool out = false;
     AF_THROW(af_is_image_io_available(&out));
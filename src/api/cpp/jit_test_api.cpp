@@ -18,4 +18,10 @@ int getMaxJitLen(void) {
 }
 
 void setMaxJitLen(const int jitLen) { AF_THROW(af_set_max_jit_len(jitLen)); }
+
+size_t getJitMergedNodes(void) {
+    size_t retVal = 0;
+    AF_THROW(af_get_jit_merged_nodes(&retVal));
+    return retVal;
+}
 }  // namespace af
@@ -84,6 +84,14 @@ int choleskyInPlace(array &in, const bool is_upper) {
     return info;
 }
 
+void eigh(array &values, array &vectors, const array &in, const unsigned k,
+          const bool is_upper) {
+    af_array v = 0, e = 0;
+    AF_THROW(af_eigh(&v, &e, in.get(), k, is_upper));
+    values  = array(v);
+    vectors = array(e);
+}
+
 array solve(const array &a, const array &b, const matProp options) {
     af_array out;
     AF_THROW(af_solve(&out, a.get(), b.get(), options));
@@ -0,0 +1,25 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <af/array.h>
+#include <af/statistics.h>
+#include "common.hpp"
+#include "error.hpp"
+
+namespace af {
+
+array quantile(const array& in, const array& probs, const dim_t dim,
+               const quantileMethod method) {
+    af_array temp = 0;
+    AF_THROW(af_quantile(&temp, in.get(), probs.get(),
+                         getFNSD(dim, in.dims()), method));
+    return array(temp);
+}
+
+}  // namespace af
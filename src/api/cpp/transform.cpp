@@ -22,4 +22,11 @@ array transform(const array& in, const array& transform, const dim_t odim0,
     return array(out);
 }
 
+array remap(const array& in, const array& mapX, const array& mapY,
+            const interpType method) {
+    af_array out = 0;
+    AF_THROW(af_remap(&out, in.get(), mapX.get(), mapY.get(), method));
+    return array(out);
+}
+
 }  // namespace af
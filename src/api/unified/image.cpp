@@ -51,6 +51,22 @@ af_err af_is_image_io_available(bool *out) {
     CALL(af_is_image_io_available, out);
 }
 
+af_err af_load_images(af_array *out, const char *const *filenames,
+                      const unsigned count, const bool isColor) {
+    CALL(af_load_images, out, filenames, count, isColor);
+}
+
+af_err af_load_images_memory(af_array *out, const void *const *ptrs,
+                             const unsigned count, const bool isColor) {
+    CALL(af_load_images_memory, out, ptrs, count, isColor);
+}
+
+af_err af_save_images(const char *const *filenames, const unsigned count,
+                      const af_array in) {
+    CHECK_ARRAYS(in);
+    CALL(af_save_images, filenames, count, in);
+}
+
 af_err af_resize(af_array *out, const af_array in, const dim_t odim0,
                  const dim_t odim1, const af_interp_type method) {
     CHECK_ARRAYS(in);
@@ -78,6 +94,12 @@ af_err af_transform_coordinates(af_array *out, const af_array tf,
     CALL(af_transform_coordinates, out, tf, d0, d1);
 }
 
+af_err af_remap(af_array *out, const af_array in, const af_array map_x,
+                const af_array map_y, const af_interp_type method) {
+    CHECK_ARRAYS(in, map_x, map_y);
+    CALL(af_remap, out, in, map_x, map_y, method);
+}
+
 af_err af_rotate(af_array *out, const af_array in, const float theta,
                  const bool crop, const af_interp_type method) {
     CHECK_ARRAYS(in);
@@ -137,6 +159,14 @@ af_err af_bilateral(af_array *out, const af_array in, const float spatial_sigma,
     CALL(af_bilateral, out, in, spatial_sigma, chromatic_sigma, isColor);
 }
 
+af_err af_bilateral_v2(af_array *out, const af_array in,
+                       const float spatial_sigma, const float chromatic_sigma,
+                       const bool isColor, const af_bilateral_method method) {
+    CHECK_ARRAYS(in);
+    CALL(af_bilateral_v2, out, in, spatial_sigma, chromatic_sigma, isColor,
+         method);
+}
+
 af_err af_mean_shift(af_array *out, const af_array in,
                      const float spatial_sigma, const float chromatic_sigma,
                      const unsigned iter, const bool is_color) {
@@ -145,6 +175,15 @@ af_err af_mean_shift(af_array *out, const af_array in,
          is_color);
 }
 
+af_err af_mean_shift_v2(af_array *out, const af_array in,
+                        const float spatial_sigma, const float chromatic_sigma,
+                        const unsigned iter, const bool is_color,
+                        const af_meanshift_method method) {
+    CHECK_ARRAYS(in);
+    CALL(af_mean_shift_v2, out, in, spatial_sigma, chromatic_sigma, iter,
+         is_color, method);
+}
+
 af_err af_minfilt(af_array *out, const af_array in, const dim_t wind_length,
                   const dim_t wind_width, const af_border_type edge_pad) {
     CHECK_ARRAYS(in);
@@ -269,6 +308,16 @@ af_err af_iterative_deconv(af_array *out, const af_array in, const af_array ker,
     CALL(af_iterative_deconv, out, in, ker, iterations, relax_factor, algo);
 }
 
+af_err af_iterative_deconv_v2(af_array *out, const af_array in,
+                              const af_array ker, const unsigned iterations,
+                              const float relax_factor,
+                              const af_iterative_deconv_algo algo,
+                              const float tolerance) {
+    CHECK_ARRAYS(in, ker);
+    CALL(af_iterative_deconv_v2, out, in, ker, iterations, relax_factor, algo,
+         tolerance);
+}
+
 af_err af_inverse_deconv(af_array *out, const af_array in, const af_array psf,
                          const float gamma, const af_inverse_deconv_algo algo) {
     CHECK_ARRAYS(in, psf);
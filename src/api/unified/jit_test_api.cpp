@@ -16,3 +16,7 @@ af_err af_get_max_jit_len(int *jitLen) { CALL(af_get_max_jit_len, jitLen); }
 af_err af_set_max_jit_len(const int jitLen) {
     CALL(af_set_max_jit_len, jitLen);
 }
+
+af_err af_get_jit_merged_nodes(size_t *count) {
+    CALL(af_get_jit_merged_nodes, count);
+}
@@ -53,6 +53,12 @@ af_err af_cholesky_inplace(int *info, af_array in, const bool is_upper) {
     CALL(af_cholesky_inplace, info, in, is_upper);
 }
 
+af_err af_eigh(af_array *values, af_array *vectors, const af_array in,
+               const unsigned k, const bool is_upper) {
+    CHECK_ARRAYS(in);
+    CALL(af_eigh, values, vectors, in, k, is_upper);
+}
+
 af_err af_solve(af_array *x, const af_array a, const af_array b,
                 const af_mat_prop options) {
     CHECK_ARRAYS(a, b);
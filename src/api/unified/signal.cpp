@@ -56,6 +56,20 @@ af_err af_approx1_uniform_v2(af_array *yo, const af_array yi, const af_array xo,
          offGrid);
 }
 
+af_err af_approx1_prepare(af_array *coeffs, const af_array in,
+                          const af_interp_type method) {
+    CHECK_ARRAYS(in);
+    CALL(af_approx1_prepare, coeffs, in, method);
+}
+
+af_err af_approx1_prepared(af_array *out, const af_array coeffs,
+                           const af_array pos, const double idx_start,
+                           const double idx_step, const float off_grid) {
+    CHECK_ARRAYS(coeffs, pos);
+    CALL(af_approx1_prepared, out, coeffs, pos, idx_start, idx_step,
+         off_grid);
+}
+
 af_err af_approx2_uniform(af_array *zo, const af_array zi, const af_array xo,
                           const int xdim, const double xi_beg,
                           const double xi_step, const af_array yo,
@@ -207,6 +221,12 @@ FFT_CONV_HAPI_DEF(af_fft_convolve1)
 FFT_CONV_HAPI_DEF(af_fft_convolve2)
 FFT_CONV_HAPI_DEF(af_fft_convolve3)
 
+af_err af_fft_convolve1_stream(af_array *y, af_array *zf, const af_array signal,
+                               const af_array filter, const af_array zi) {
+    CHECK_ARRAYS(signal, filter, zi);
+    CALL(af_fft_convolve1_stream, y, zf, signal, filter, zi);
+}
+
 af_err af_convolve2_sep(af_array *out, const af_array col_filter,
                         const af_array row_filter, const af_array signal,
                         const af_conv_mode mode) {
@@ -225,6 +245,18 @@ af_err af_iir(af_array *y, const af_array b, const af_array a,
     CALL(af_iir, y, b, a, x);
 }
 
+af_err af_iir_state(af_array *y, af_array *zf, const af_array b,
+                    const af_array a, const af_array x, const af_array zi) {
+    CHECK_ARRAYS(b, a, x, zi);
+    CALL(af_iir_state, y, zf, b, a, x, zi);
+}
+
+af_err af_iir_sos(af_array *y, af_array *zf, const af_array sos,
+                  const af_array x, const af_array zi) {
+    CHECK_ARRAYS(sos, x, zi);
+    CALL(af_iir_sos, y, zf, sos, x, zi);
+}
+
 af_err af_medfilt(af_array *out, const af_array in, const dim_t wind_length,
                   const dim_t wind_width, const af_border_type edge_pad) {
     CHECK_ARRAYS(in);
@@ -111,6 +111,22 @@ af_err af_topk(af_array *values, af_array *indices, const af_array in,
     CALL(af_topk, values, indices, in, k, dim, order);
 }
 
+af_err af_quantile(af_array *out, const af_array in, const af_array probs,
+                   const dim_t dim, const af_quantile_method method) {
+    CHECK_ARRAYS(in, probs);
+    CALL(af_quantile, out, in, probs, dim, method);
+}
+
+af_err af_cov_matrix(af_array *out, const af_array X, const af_var_bias bias) {
+    CHECK_ARRAYS(X);
+    CALL(af_cov_matrix, out, X, bias);
+}
+
+af_err af_corrcoef_matrix(af_array *out, const af_array X) {
+    CHECK_ARRAYS(X);
+    CALL(af_corrcoef_matrix, out, X);
+}
+
 af_err af_var_v2(af_array *out, const af_array in, const af_var_bias bias,
                  const dim_t dim) {
     CHECK_ARRAYS(in);
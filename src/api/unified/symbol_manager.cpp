@@ -185,8 +185,20 @@ LibHandle& getActiveHandle() {
     return activeHandle;
 }
 
+const DispatchTable*& getActiveTable() {
+    thread_local const DispatchTable* activeTable =
+        AFSymbolManager::getInstance().getDefaultTable();
+    return activeTable;
+}
+
+int registerSymbol(const char* symbolName) {
+    return AFSymbolManager::getInstance().registerSymbol(symbolName);
+}
+
 AFSymbolManager::AFSymbolManager()
-    : defaultHandle(nullptr)
+    : numSymbols(1)
+    , defaultHandle(nullptr)
+    , defaultTable(nullptr)
     , numBackends(0)
     , backendsAvailable(0)
     , logger(loggerFactory("unified")) {
@@ -194,6 +206,7 @@ AFSymbolManager::AFSymbolManager()
     static const af_backend order[] = {AF_BACKEND_CUDA, AF_BACKEND_ONEAPI,
                                        AF_BACKEND_OPENCL, AF_BACKEND_CPU};
     LibHandle handle                = nullptr;
+    const DispatchTable* table      = nullptr;
     af::Backend backend             = AF_BACKEND_DEFAULT;
     // Decremeting loop. The last successful backend loaded will be the most
     // prefered one.
@@ -202,6 +215,7 @@ AFSymbolManager::AFSymbolManager()
         bkndHandles[bknd_idx] = openDynLibrary(order[i]);
         if (bkndHandles[bknd_idx]) {
             handle  = bkndHandles[bknd_idx];
+            table   = &tables[bknd_idx];
             backend = order[i];
             numBackends++;
             backendsAvailable += order[i];
@@ -218,6 +232,7 @@ AFSymbolManager::AFSymbolManager()
     // Keep a copy of default order handle inorder to use it in ::setBackend
     // when the user passes AF_BACKEND_DEFAULT
     defaultHandle = handle;
+    defaultTable  = table;
 }
 
 AFSymbolManager::~AFSymbolManager() {
@@ -230,11 +245,32 @@ unsigned AFSymbolManager::getBackendCount() const { return numBackends; }
 
 int AFSymbolManager::getAvailableBackends() const { return backendsAvailable; }
 
+int AFSymbolManager::registerSymbol(const char* symbolName) {
+    std::lock_guard<std::mutex> lock(symbolsLock);
+    if (numSymbols == MAX_SYMBOLS) {
+        logger->error("Dispatch table is full, {} cannot be forwarded",
+                      symbolName);
+        return 0;
+    }
+
+    // The entries of a slot are written before the slot is published through
+    // the function local static in CALL, so readers need no lock
+    const int slot = numSymbols++;
+    for (int i = 0; i < NUM_BACKENDS; ++i) {
+        if (bkndHandles[i]) {
+            tables[i][slot] = getFunctionPointer(bkndHandles[i], symbolName);
+        }
+    }
+    AF_TRACE("Registered {} in slot {}", symbolName, slot);
+    return slot;
+}
+
 af_err setBackend(af::Backend bknd) {
     auto& instance = AFSymbolManager::getInstance();
     if (bknd == AF_BACKEND_DEFAULT) {
         if (instance.getDefaultHandle()) {
             getActiveHandle()  = instance.getDefaultHandle();
+            getActiveTable()   = instance.getDefaultTable();
             getActiveBackend() = instance.getDefaultBackend();
             return AF_SUCCESS;
         } else {
@@ -244,6 +280,7 @@ af_err setBackend(af::Backend bknd) {
     int idx = backend_index(bknd);
     if (instance.getHandle(idx)) {
         getActiveHandle()  = instance.getHandle(idx);
+        getActiveTable()   = instance.getTable(idx);
         getActiveBackend() = bknd;
         return AF_SUCCESS;
     } else {
@@ -18,6 +18,7 @@
 #include <spdlog/spdlog.h>
 #include <array>
 #include <cstdlib>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -26,6 +27,14 @@ namespace unified {
 
 const int NUM_BACKENDS = 4;
 
+/// Number of functions the dispatch tables can hold. Slot 0 is never
+/// resolved and is handed out once the tables are full.
+const int MAX_SYMBOLS = 2048;
+
+/// Function pointers of one backend library, indexed by the slot each
+/// forwarding function receives from registerSymbol
+using DispatchTable = std::array<void*, MAX_SYMBOLS>;
+
 #define UNIFIED_ERROR_LOAD_LIB()                                       \
     AF_RETURN_ERROR(                                                   \
         "Failed to load dynamic library. "                             \
@@ -60,6 +69,15 @@ class AFSymbolManager {
     spdlog::logger* getLogger();
     LibHandle getHandle(int idx) { return bkndHandles[idx]; }
 
+    /// Dispatch table of the backend at \p idx, or nullptr if it is not
+    /// loaded
+    const DispatchTable* getTable(int idx) const {
+        return bkndHandles[idx] ? &tables[idx] : nullptr;
+    }
+    const DispatchTable* getDefaultTable() const { return defaultTable; }
+
+    int registerSymbol(const char* symbolName);
+
    protected:
     AFSymbolManager();
 
@@ -72,8 +90,13 @@ class AFSymbolManager {
 
    private:
     LibHandle bkndHandles[NUM_BACKENDS]{};
+    DispatchTable tables[NUM_BACKENDS]{};
+
+    std::mutex symbolsLock;
+    int numSymbols;
 
     LibHandle defaultHandle;
+    const DispatchTable* defaultTable;
     unsigned numBackends;
     int backendsAvailable;
     af_backend defaultBackend;
@@ -86,6 +109,15 @@ af::Backend& getActiveBackend();
 
 LibHandle& getActiveHandle();
 
+/// Dispatch table of the backend active on the calling thread, or nullptr if
+/// no backend could be loaded
+const DispatchTable*& getActiveTable();
+
+/// Assigns a slot of the dispatch tables to \p symbolName and resolves it in
+/// every loaded backend. Called once per forwarding function, the slot is
+/// kept in a function local static by CALL.
+int registerSymbol(const char* symbolName);
+
 namespace {
 bool checkArray(af_backend activeBackend, const af_array a) {
     // Convert af_array into int to retrieve the backend info.
@@ -141,27 +173,27 @@ bool checkArrays(af_backend activeBackend, T a, Args... arg) {
                             AF_ERR_ARR_BKND_MISMATCH);                        \
     } while (0)
 
-#define CALL(FUNCTION, ...)                                                      \
-    using af_func                  = std::add_pointer<decltype(FUNCTION)>::type; \
-    thread_local af_backend index_ = arrayfire::unified::getActiveBackend();     \
-    if (arrayfire::unified::getActiveHandle()) {                                 \
-        thread_local af_func func =                                              \
-            (af_func)arrayfire::common::getFunctionPointer(                      \
-                arrayfire::unified::getActiveHandle(), __func__);                \
-        if (!func) {                                                             \
-            AF_RETURN_ERROR(                                                     \
-                "requested symbol name could not be found in loaded library.",   \
-                AF_ERR_LOAD_LIB);                                                \
-        }                                                                        \
-        if (index_ != arrayfire::unified::getActiveBackend()) {                  \
-            index_ = arrayfire::unified::getActiveBackend();                     \
-            func   = (af_func)arrayfire::common::getFunctionPointer(             \
-                arrayfire::unified::getActiveHandle(), __func__);              \
-        }                                                                        \
-        return func(__VA_ARGS__);                                                \
-    } else {                                                                     \
-        AF_RETURN_ERROR("ArrayFire couldn't locate any backends.",               \
-                        AF_ERR_LOAD_LIB);                                        \
+/// Forwards the enclosing function to the active backend.
+///
+/// The symbol is looked up in all backends on the first call only. Every
+/// later call, including those after af_set_backend, is an index into the
+/// dispatch table of the calling thread's active backend.
+#define CALL(FUNCTION, ...)                                                    \
+    using af_func = std::add_pointer<decltype(FUNCTION)>::type;                \
+    static const int slot_ = arrayfire::unified::registerSymbol(__func__);     \
+    const arrayfire::unified::DispatchTable* table_ =                          \
+        arrayfire::unified::getActiveTable();                                  \
+    if (table_) {                                                              \
+        af_func func = reinterpret_cast<af_func>((*table_)[slot_]);            \
+        if (!func) {                                                           \
+            AF_RETURN_ERROR(                                                   \
+                "requested symbol name could not be found in loaded library.", \
+                AF_ERR_LOAD_LIB);                                              \
+        }                                                                      \
+        return func(__VA_ARGS__);                                              \
+    } else {                                                                   \
+        AF_RETURN_ERROR("ArrayFire couldn't locate any backends.",             \
+                        AF_ERR_LOAD_LIB);                                      \
     }
 
 #define CALL_NO_PARAMS(FUNCTION) CALL(FUNCTION)
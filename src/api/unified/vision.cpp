@@ -18,6 +18,16 @@ af_err af_fast(af_features *out, const af_array in, const float thr,
     CALL(af_fast, out, in, thr, arc_length, non_max, feature_ratio, edge);
 }
 
+af_err af_fast_v2(af_features *out, const af_array in, const float thr,
+                  const unsigned arc_length, const bool non_max,
+                  const float feature_ratio, const unsigned edge,
+                  const unsigned grid_rows, const unsigned grid_cols,
+                  const unsigned max_per_cell) {
+    CHECK_ARRAYS(in);
+    CALL(af_fast_v2, out, in, thr, arc_length, non_max, feature_ratio, edge,
+         grid_rows, grid_cols, max_per_cell);
+}
+
 af_err af_harris(af_features *out, const af_array in,
                  const unsigned max_corners, const float min_response,
                  const float sigma, const unsigned block_size,
@@ -9,6 +9,7 @@
 
 #include <common/DefaultMemoryManager.hpp>
 #include <common/Logger.hpp>
+#include <common/Profiler.hpp>
 #include <common/dispatch.hpp>
 #include <common/err_common.hpp>
 #include <common/util.hpp>
@@ -197,6 +198,8 @@ void *DefaultMemoryManager::alloc(bool user_lock, const unsigned ndims,
                 current.locked_map[ptr] = info;
                 current.lock_bytes += alloc_bytes;
                 current.lock_buffers++;
+                profileAllocation("alloc (cached)", alloc_bytes,
+                                  current.lock_bytes);
             }
         }
 
@@ -218,6 +221,7 @@ void *DefaultMemoryManager::alloc(bool user_lock, const unsigned ndims,
             current.locked_map[ptr] = info;
             current.lock_bytes += alloc_bytes;
             current.lock_buffers++;
+            profileAllocation("alloc", alloc_bytes, current.lock_bytes);
         }
     }
 
@@ -266,6 +270,7 @@ void DefaultMemoryManager::unlock(void *ptr, bool user_unlock) {
         size_t bytes = locked_buffer_info.bytes;
         current.lock_bytes -= locked_buffer_info.bytes;
         current.lock_buffers--;
+        profileRelease(bytes, current.lock_bytes);
 
         if (this->debug_mode) {
             // Just free memory in debug mode
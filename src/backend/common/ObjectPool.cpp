@@ -0,0 +1,90 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <common/ObjectPool.hpp>
+
+#include <array>
+#include <vector>
+
+using std::size_t;
+
+namespace arrayfire {
+namespace common {
+
+namespace {
+
+constexpr size_t kClasses =
+    BlockPool::kMaxBlockSize / BlockPool::kGranularity;
+constexpr std::align_val_t kAlign{BlockPool::kGranularity};
+
+// Set once the free lists of the thread are gone. Objects released after
+// that, e.g. by the destructors of other thread_local or static objects, go
+// straight back to the system allocator.
+thread_local bool listsClosed = false;
+
+struct FreeLists {
+    std::array<std::vector<void *>, kClasses> lists;
+
+    FreeLists() = default;
+    FreeLists(const FreeLists &) = delete;
+    FreeLists &operator=(const FreeLists &) = delete;
+
+    ~FreeLists() {
+        listsClosed = true;
+        for (auto &list : lists) {
+            for (void *block : list) { ::operator delete(block, kAlign); }
+        }
+    }
+};
+
+FreeLists &freeLists() {
+    thread_local FreeLists lists;
+    return lists;
+}
+
+size_t sizeClass(const size_t bytes) {
+    return (bytes + BlockPool::kGranularity - 1) / BlockPool::kGranularity - 1;
+}
+
+size_t blockSize(const size_t bytes) {
+    if (bytes == 0 || bytes > BlockPool::kMaxBlockSize) { return bytes; }
+    return (sizeClass(bytes) + 1) * BlockPool::kGranularity;
+}
+
+}  // namespace
+
+void *BlockPool::allocate(size_t bytes) {
+    if (bytes != 0 && bytes <= kMaxBlockSize && !listsClosed) {
+        std::vector<void *> &list = freeLists().lists[sizeClass(bytes)];
+        if (!list.empty()) {
+            void *block = list.back();
+            list.pop_back();
+            return block;
+        }
+    }
+    // Always round up, so that the block can serve any size of its class
+    return ::operator new(blockSize(bytes), kAlign);
+}
+
+void BlockPool::release(void *block, size_t bytes) noexcept {
+    if (block == nullptr) { return; }
+    if (bytes != 0 && bytes <= kMaxBlockSize && !listsClosed) {
+        std::vector<void *> &list = freeLists().lists[sizeClass(bytes)];
+        if (list.size() < kMaxCachedBytes / blockSize(bytes)) {
+            try {
+                list.push_back(block);
+                return;
+            } catch (const std::bad_alloc &) {}
+        }
+    }
+    ::operator delete(block, kAlign);
+}
+
+}  // namespace common
+}  // namespace arrayfire
@@ -0,0 +1,109 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace arrayfire {
+namespace common {
+
+/// Per thread free lists of small memory blocks, sorted into size classes.
+///
+/// Used for objects that are created and destroyed at a high rate, such as
+/// af_array handles and JIT nodes. A block goes to the free list of the
+/// thread that releases it, whichever thread allocated it, so no locking is
+/// needed. Each size class keeps at most kMaxCachedBytes per thread and
+/// returns the rest to the system allocator.
+class BlockPool {
+   public:
+    /// Block sizes are multiples of this, which is also their alignment
+    static constexpr std::size_t kGranularity = 64;
+
+    /// Larger requests bypass the free lists
+    static constexpr std::size_t kMaxBlockSize = 16384;
+
+    static constexpr std::size_t kMaxCachedBytes = 256 * 1024;
+
+    /// Returns a block of at least \p bytes bytes
+    static void *allocate(std::size_t bytes);
+
+    /// Takes back a block returned by allocate(\p bytes)
+    static void release(void *block, std::size_t bytes) noexcept;
+};
+
+/// Standard allocator drawing from BlockPool. Meant for single objects, such
+/// as the ones made by std::allocate_shared.
+template<typename T>
+class PoolAllocator {
+   public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U> &) noexcept {}
+
+    T *allocate(std::size_t n) {
+        static_assert(alignof(T) <= BlockPool::kGranularity,
+                      "Alignment not supported by BlockPool");
+        if (n > static_cast<std::size_t>(-1) / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(BlockPool::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *ptr, std::size_t n) noexcept {
+        BlockPool::release(ptr, n * sizeof(T));
+    }
+
+    template<typename U>
+    bool operator==(const PoolAllocator<U> &) const noexcept {
+        return true;
+    }
+    template<typename U>
+    bool operator!=(const PoolAllocator<U> &) const noexcept {
+        return false;
+    }
+};
+
+/// std::make_shared with the object and its control block from BlockPool
+template<typename T, typename... Args>
+std::shared_ptr<T> makePooledShared(Args &&...args) {
+    return std::allocate_shared<T>(PoolAllocator<T>(),
+                                   std::forward<Args>(args)...);
+}
+
+/// Creates an object in a block from BlockPool. Must be destroyed with
+/// destroyPooled().
+template<typename T, typename... Args>
+T *createPooled(Args &&...args) {
+    static_assert(alignof(T) <= BlockPool::kGranularity,
+                  "Alignment not supported by BlockPool");
+    void *block = BlockPool::allocate(sizeof(T));
+    try {
+        return new (block) T(std::forward<Args>(args)...);
+    } catch (...) {
+        BlockPool::release(block, sizeof(T));
+        throw;
+    }
+}
+
+/// Destroys an object made by createPooled()
+template<typename T>
+void destroyPooled(T *ptr) noexcept {
+    if (ptr == nullptr) { return; }
+    ptr->~T();
+    BlockPool::release(ptr, sizeof(T));
+}
+
+}  // namespace common
+}  // namespace arrayfire
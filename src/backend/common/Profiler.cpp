@@ -0,0 +1,367 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <common/Profiler.hpp>
+#include <common/util.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using std::lock_guard;
+using std::mutex;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace arrayfire {
+namespace common {
+
+namespace {
+
+using profile_clock = std::chrono::steady_clock;
+
+/// Events kept per thread. Older events are overwritten once it is full.
+constexpr size_t kRingSize = 1 << 16;
+
+/// Totals of all events with the same name, category and phase
+struct ProfileStats {
+    int64_t count    = 0;
+    int64_t total    = 0;
+    int64_t max      = 0;
+    const char *argNames[ProfileEvent::kMaxArgs] = {};
+    int64_t argSums[ProfileEvent::kMaxArgs]      = {};
+};
+
+struct StatsKey {
+    const char *name;
+    const char *category;
+    char phase;
+
+    bool operator==(const StatsKey &other) const {
+        return name == other.name && category == other.category &&
+               phase == other.phase;
+    }
+};
+
+struct StatsKeyHash {
+    size_t operator()(const StatsKey &key) const {
+        const size_t h = std::hash<const void *>()(key.name);
+        return h ^ (std::hash<const void *>()(key.category) << 1) ^
+               static_cast<size_t>(key.phase);
+    }
+};
+
+/// Events and totals of one thread. Only the owning thread writes to it, the
+/// lock is taken for the final dump which may overlap with running threads.
+struct ThreadBuffer {
+    int tid;
+    mutex lock;
+    vector<ProfileEvent> events;
+    size_t next = 0;
+    std::unordered_map<StatsKey, ProfileStats, StatsKeyHash> stats;
+
+    // Reserved up front so that growing the buffer does not show up in the
+    // recorded times
+    explicit ThreadBuffer(int id) : tid(id) { events.reserve(kRingSize); }
+
+    void record(const ProfileEvent &event) {
+        lock_guard<mutex> guard(lock);
+        if (events.size() < kRingSize) {
+            events.push_back(event);
+        } else {
+            events[next] = event;
+        }
+        next = (next + 1) % kRingSize;
+
+        if (event.phase == 'C') { return; }
+        ProfileStats &s = stats[{event.name, event.category, event.phase}];
+        s.count++;
+        s.total += event.duration;
+        s.max = std::max(s.max, event.duration);
+        for (int i = 0; i < ProfileEvent::kMaxArgs; ++i) {
+            if (event.argNames[i] == nullptr) { continue; }
+            s.argNames[i] = event.argNames[i];
+            s.argSums[i] += event.args[i];
+        }
+    }
+
+    /// Events from the oldest to the newest
+    vector<ProfileEvent> ordered() {
+        lock_guard<mutex> guard(lock);
+        vector<ProfileEvent> out;
+        out.reserve(events.size());
+        if (events.size() == kRingSize) {
+            out.insert(out.end(), events.begin() + next, events.end());
+            out.insert(out.end(), events.begin(), events.begin() + next);
+        } else {
+            out = events;
+        }
+        return out;
+    }
+};
+
+struct Profiler {
+    string path;
+    bool enabled;
+    profile_clock::time_point start;
+    mutex lock;
+    vector<unique_ptr<ThreadBuffer>> buffers;
+
+    Profiler();
+};
+
+void writeProfile();
+
+// Never destroyed, so that threads and static objects which are torn down
+// after the profile is written can still record events safely
+Profiler &profiler() {
+    static Profiler *instance = new Profiler();
+    return *instance;
+}
+
+Profiler::Profiler()
+    : path(getEnvVar("AF_PROFILE"))
+    , enabled(!path.empty())
+    , start(profile_clock::now()) {
+    if (enabled) { std::atexit(writeProfile); }
+}
+
+ThreadBuffer &threadBuffer() {
+    thread_local ThreadBuffer *buffer = [] {
+        Profiler &p = profiler();
+        lock_guard<mutex> guard(p.lock);
+        const int tid = static_cast<int>(p.buffers.size());
+        p.buffers.emplace_back(new ThreadBuffer(tid));
+        return p.buffers.back().get();
+    }();
+    return *buffer;
+}
+
+thread_local ProfileScope *currentScope = nullptr;
+
+/// Function name from a call expression such as "af_add(&out, lhs, rhs)",
+/// escaped for JSON
+string displayName(const char *name) {
+    string out;
+    for (const char *c = name; *c != '\0' && *c != '('; ++c) {
+        if (*c == '"' || *c == '\\') { out += '\\'; }
+        out += *c;
+    }
+    while (!out.empty() && out.back() == ' ') { out.pop_back(); }
+    return out;
+}
+
+void writeArgs(FILE *file, const ProfileEvent &event) {
+    std::fprintf(file, ",\"args\":{");
+    bool first = true;
+    for (int i = 0; i < ProfileEvent::kMaxArgs; ++i) {
+        if (event.argNames[i] == nullptr) { continue; }
+        std::fprintf(file, "%s\"%s\":%lld", first ? "" : ",",
+                     event.argNames[i],
+                     static_cast<long long>(event.args[i]));
+        first = false;
+    }
+    std::fprintf(file, "}");
+}
+
+void writeTrace(FILE *file, const vector<ThreadBuffer *> &buffers) {
+    std::fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    std::fprintf(file,
+                 "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+                 "\"args\":{\"name\":\"ArrayFire\"}}");
+    for (ThreadBuffer *buffer : buffers) {
+        std::fprintf(file,
+                     ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                     "\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                     buffer->tid, buffer->tid);
+        for (const ProfileEvent &e : buffer->ordered()) {
+            std::fprintf(file,
+                         ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\","
+                         "\"pid\":1,\"tid\":%d,\"ts\":%.3f",
+                         displayName(e.name).c_str(), e.category, e.phase,
+                         buffer->tid, e.start * 1e-3);
+            if (e.phase == 'X') {
+                std::fprintf(file, ",\"dur\":%.3f", e.duration * 1e-3);
+            } else if (e.phase == 'i') {
+                std::fprintf(file, ",\"s\":\"t\"");
+            }
+            writeArgs(file, e);
+            std::fprintf(file, "}");
+        }
+    }
+    std::fprintf(file, "\n]}\n");
+}
+
+void writeSummary(FILE *file, const vector<ThreadBuffer *> &buffers) {
+    // Call sites of the same function have different name pointers, so the
+    // totals are merged by their printed names
+    std::map<std::tuple<string, string, char>, ProfileStats> merged;
+    for (ThreadBuffer *buffer : buffers) {
+        lock_guard<mutex> guard(buffer->lock);
+        for (const auto &kv : buffer->stats) {
+            const StatsKey &key    = kv.first;
+            const ProfileStats &in = kv.second;
+            ProfileStats &s        = merged[std::make_tuple(
+                displayName(key.name), string(key.category), key.phase)];
+            s.count += in.count;
+            s.total += in.total;
+            s.max = std::max(s.max, in.max);
+            for (int i = 0; i < ProfileEvent::kMaxArgs; ++i) {
+                if (in.argNames[i] == nullptr) { continue; }
+                s.argNames[i] = in.argNames[i];
+                s.argSums[i] += in.argSums[i];
+            }
+        }
+    }
+
+    using row_t = std::pair<std::tuple<string, string, char>, ProfileStats>;
+    vector<row_t> rows(merged.begin(), merged.end());
+    std::stable_sort(rows.begin(), rows.end(),
+                     [](const row_t &a, const row_t &b) {
+                         return a.second.total > b.second.total;
+                     });
+
+    std::fprintf(file, "ArrayFire profile summary\n");
+    std::fprintf(file, "%-8s %-32s %10s %12s %12s %12s  %s\n", "Category",
+                 "Name", "Count", "Total(ms)", "Mean(us)", "Max(us)",
+                 "Mean values");
+    for (const row_t &row : rows) {
+        const ProfileStats &s = row.second;
+        const string &name    = std::get<0>(row.first);
+        const string &cat     = std::get<1>(row.first);
+        std::fprintf(file, "%-8s %-32s %10lld", cat.c_str(), name.c_str(),
+                     static_cast<long long>(s.count));
+        if (std::get<2>(row.first) == 'X') {
+            std::fprintf(file, " %12.3f %12.3f %12.3f ", s.total * 1e-6,
+                         s.total * 1e-3 / s.count, s.max * 1e-3);
+        } else {
+            std::fprintf(file, " %12s %12s %12s ", "-", "-", "-");
+        }
+        for (int i = 0; i < ProfileEvent::kMaxArgs; ++i) {
+            if (s.argNames[i] == nullptr) { continue; }
+            std::fprintf(file, " %s=%.1f", s.argNames[i],
+                         static_cast<double>(s.argSums[i]) / s.count);
+        }
+        std::fprintf(file, "\n");
+    }
+}
+
+void writeProfile() {
+    Profiler &p = profiler();
+    vector<ThreadBuffer *> buffers;
+    {
+        lock_guard<mutex> guard(p.lock);
+        for (auto &b : p.buffers) { buffers.push_back(b.get()); }
+    }
+
+    FILE *file = std::fopen(p.path.c_str(), "w");
+    if (file) {
+        writeTrace(file, buffers);
+        std::fclose(file);
+    } else {
+        std::fprintf(stderr, "ArrayFire: could not write profile to %s\n",
+                     p.path.c_str());
+    }
+    writeSummary(stderr, buffers);
+}
+
+void recordInstant(const char *name, const char *argName0, int64_t arg0,
+                   const char *argName1, int64_t arg1) noexcept {
+    ProfileEvent event{name,
+                       "memory",
+                       'i',
+                       profilerNow(),
+                       0,
+                       {argName0, argName1, nullptr},
+                       {arg0, arg1, 0}};
+    recordProfileEvent(event);
+
+    ProfileEvent counter{"memory in use", "memory", 'C', event.start, 0,
+                         {"bytes", nullptr, nullptr}, {arg1, 0, 0}};
+    recordProfileEvent(counter);
+}
+
+}  // namespace
+
+bool profilerEnabled() noexcept {
+    static const bool enabled = profiler().enabled;
+    return enabled;
+}
+
+int64_t profilerNow() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               profile_clock::now() - profiler().start)
+        .count();
+}
+
+void recordProfileEvent(const ProfileEvent &event) noexcept {
+    if (!profilerEnabled()) { return; }
+    try {
+        threadBuffer().record(event);
+    } catch (...) {
+        // Profiling must never make a call fail
+    }
+}
+
+ProfileScope::ProfileScope(const char *name, const char *category) noexcept
+    : event_{name, category, 'X', 0, 0, {}, {}}
+    , parent_(nullptr)
+    , allocated_(0)
+    , nargs_(0)
+    , active_(profilerEnabled()) {
+    if (!active_) { return; }
+    parent_       = currentScope;
+    currentScope  = this;
+    event_.start  = profilerNow();
+}
+
+ProfileScope::~ProfileScope() {
+    if (!active_) { return; }
+    event_.duration = profilerNow() - event_.start;
+    if (allocated_ > 0) {
+        event_.argNames[nargs_] = "bytes";
+        event_.args[nargs_]     = allocated_;
+    }
+    currentScope = parent_;
+    recordProfileEvent(event_);
+}
+
+void ProfileScope::arg(const char *name, int64_t value) noexcept {
+    if (!active_ || nargs_ == ProfileEvent::kMaxArgs - 1) { return; }
+    event_.argNames[nargs_] = name;
+    event_.args[nargs_]     = value;
+    nargs_++;
+}
+
+const ProfileScope *currentProfileScope() noexcept { return currentScope; }
+
+void profileAllocation(const char *name, int64_t bytes,
+                       int64_t inUse) noexcept {
+    if (!profilerEnabled()) { return; }
+    if (currentScope) { currentScope->allocated_ += bytes; }
+    recordInstant(name, "bytes", bytes, "in use", inUse);
+}
+
+void profileRelease(int64_t bytes, int64_t inUse) noexcept {
+    if (!profilerEnabled()) { return; }
+    recordInstant("free", "bytes", bytes, "in use", inUse);
+}
+
+}  // namespace common
+}  // namespace arrayfire
@@ -0,0 +1,87 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace arrayfire {
+namespace common {
+
+/// True when the AF_PROFILE environment variable names a trace file. The
+/// variable is read once, on the first call.
+///
+/// When enabled, events are kept in a ring buffer per thread. At exit they
+/// are written to the trace file in the Chrome trace event format, which
+/// chrome://tracing and Perfetto open, and a summary table is printed to
+/// stderr.
+bool profilerEnabled() noexcept;
+
+/// Nanoseconds since the profiler started
+int64_t profilerNow() noexcept;
+
+/// One entry of the trace. Names, categories and argument names are stored
+/// as pointers, so they must be string literals.
+struct ProfileEvent {
+    static constexpr int kMaxArgs = 4;
+
+    const char *name;
+    const char *category;
+    /// 'X' for spans, 'i' for instants and 'C' for counters
+    char phase;
+    int64_t start;
+    int64_t duration;
+    const char *argNames[kMaxArgs];
+    int64_t args[kMaxArgs];
+};
+
+/// Adds \p event to the ring buffer of the calling thread
+void recordProfileEvent(const ProfileEvent &event) noexcept;
+
+/// Records a span from its construction to its destruction. Does nothing
+/// unless profilerEnabled() is true.
+///
+/// Memory allocated while the scope is the innermost open one on its thread
+/// is reported in the "bytes" argument of the span.
+class ProfileScope {
+    ProfileEvent event_;
+    ProfileScope *parent_;
+    int64_t allocated_;
+    int nargs_;
+    bool active_;
+
+    friend void profileAllocation(const char *, int64_t, int64_t) noexcept;
+
+   public:
+    ProfileScope(const char *name, const char *category) noexcept;
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope &)            = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+    /// Attaches \p value to the span. Up to three values are kept.
+    void arg(const char *name, int64_t value) noexcept;
+
+    const char *name() const noexcept { return event_.name; }
+};
+
+/// Innermost open ProfileScope of the calling thread, or nullptr
+const ProfileScope *currentProfileScope() noexcept;
+
+/// Records an allocation of \p bytes bytes after which \p inUse bytes are
+/// in use
+void profileAllocation(const char *name, int64_t bytes,
+                       int64_t inUse) noexcept;
+
+/// Records the release of \p bytes bytes after which \p inUse bytes are in
+/// use
+void profileRelease(int64_t bytes, int64_t inUse) noexcept;
+
+}  // namespace common
+}  // namespace arrayfire
@@ -11,6 +11,7 @@
 #include <Array.hpp>
 #include <cast.hpp>
 #include <common/Logger.hpp>
+#include <common/ObjectPool.hpp>
 #include <memory>
 
 #ifdef AF_CPU
@@ -103,7 +104,8 @@ struct CastWrapper {
             }
         }
 
-        auto node = std::make_shared<UnaryNode<To, Ti, af_cast_t>>(in_node);
+        auto node =
+            common::makePooledShared<UnaryNode<To, Ti, af_cast_t>>(in_node);
 
         return detail::createNodeArray<To>(in.dims(), move(node));
     }
@@ -14,6 +14,7 @@
 #pragma GCC diagnostic ignored "-Wparentheses"
 #include <boost/stacktrace.hpp>
 #pragma GCC diagnostic pop
+#include <common/Profiler.hpp>
 #include <common/defines.hpp>
 #include <af/defines.h>
 
@@ -198,6 +199,11 @@ af_err set_global_error_string(const std::string& msg,
         return processException(); \
     }
 
+/// Records the call of the enclosing C API function as an "api" span when
+/// AF_PROFILE is set. Placed first in the body of every C API function.
+#define AF_API_SCOPE \
+    arrayfire::common::ProfileScope afApiScope(__func__, "api")
+
 #define AF_CHECK(fn)                                                       \
     do {                                                                   \
         af_err __err = fn;                                                 \
@@ -1,6 +1,7 @@
 
 #include <Array.hpp>
 #include <binary.hpp>
+#include <common/ObjectPool.hpp>
 #include <common/jit/BinaryNode.hpp>
 #include <complex.hpp>
 #include <types.hpp>
@@ -27,8 +28,8 @@ Array<To> createBinaryNode(const Array<Ti> &lhs, const Array<Ti> &rhs,
     common::Node_ptr lhs_node = lhs.getNode();
     common::Node_ptr rhs_node = rhs.getNode();
 
-    auto node =
-        make_shared<detail::jit::BinaryNode<To, Ti, op>>(lhs_node, rhs_node);
+    auto node = common::makePooledShared<detail::jit::BinaryNode<To, Ti, op>>(
+        lhs_node, rhs_node);
 
     return createNodeArray<To>(odims, move(node));
 }
@@ -317,6 +317,14 @@ class Node {
 
     virtual void setShape(af::dim4 new_shape) { UNUSED(new_shape); }
 
+    /// Returns true if this node computes the same values as \p other when
+    /// both have the same children. Used to merge common sub-expressions.
+    virtual bool isEquivalent(const Node &other) const noexcept {
+        return m_node_type == kNodeType::Nary &&
+               other.m_node_type == kNodeType::Nary &&
+               getOp() == other.getOp() && m_type == other.m_type;
+    }
+
 #endif
 };
 
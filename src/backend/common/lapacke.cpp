@@ -217,6 +217,112 @@ LAPACK_GESDD_REAL(gesdd, d, double, double, double *)
 LAPACK_GESDD_CPLX(gesdd, c, cfloat, float, __CLPK_complex *)
 LAPACK_GESDD_CPLX(gesdd, z, cdouble, double, __CLPK_doublecomplex *)
 
+#define LAPACK_SYEVD_REAL(P, X, T, Tr, TO)                                     \
+    int LAPACKE_##X##P(int layout, char jobz, char uplo, int n, T *a, int lda, \
+                       Tr *w) {                                                \
+        UNUSED(layout);                                                        \
+        int info        = 0;                                                   \
+        int lwork       = -1;                                                  \
+        int liwork      = -1;                                                  \
+        T work_param    = 0;                                                   \
+        int iwork_param = 0;                                                   \
+        X##P##_(&jobz, &uplo, &n, (TO)a, &lda, w, (TO)&work_param, &lwork,     \
+                &iwork_param, &liwork, &info);                                 \
+        lwork  = static_cast<int>(work_param);                                 \
+        liwork = iwork_param;                                                  \
+        std::vector<T> work(lwork);                                            \
+        std::vector<int> iwork(liwork);                                        \
+        X##P##_(&jobz, &uplo, &n, (TO)a, &lda, w, (TO)&work[0], &lwork,        \
+                &iwork[0], &liwork, &info);                                    \
+        return info;                                                           \
+    }
+
+#define LAPACK_SYEVD_CPLX(P, X, T, Tr, TO)                                     \
+    int LAPACKE_##X##P(int layout, char jobz, char uplo, int n, T *a, int lda, \
+                       Tr *w) {                                                \
+        UNUSED(layout);                                                        \
+        int info        = 0;                                                   \
+        int lwork       = -1;                                                  \
+        int lrwork      = -1;                                                  \
+        int liwork      = -1;                                                  \
+        T work_param    = 0;                                                   \
+        Tr rwork_param  = 0;                                                   \
+        int iwork_param = 0;                                                   \
+        X##P##_(&jobz, &uplo, &n, (TO)a, &lda, w, (TO)&work_param, &lwork,     \
+                &rwork_param, &lrwork, &iwork_param, &liwork, &info);          \
+        lwork  = static_cast<int>(std::real(work_param));                      \
+        lrwork = static_cast<int>(rwork_param);                                \
+        liwork = iwork_param;                                                  \
+        std::vector<T> work(lwork);                                            \
+        std::vector<Tr> rwork(lrwork);                                         \
+        std::vector<int> iwork(liwork);                                        \
+        X##P##_(&jobz, &uplo, &n, (TO)a, &lda, w, (TO)&work[0], &lwork,        \
+                &rwork[0], &lrwork, &iwork[0], &liwork, &info);                \
+        return info;                                                           \
+    }
+
+LAPACK_SYEVD_REAL(syevd, s, float, float, float *)
+LAPACK_SYEVD_REAL(syevd, d, double, double, double *)
+LAPACK_SYEVD_CPLX(heevd, c, cfloat, float, __CLPK_complex *)
+LAPACK_SYEVD_CPLX(heevd, z, cdouble, double, __CLPK_doublecomplex *)
+
+#define LAPACK_SYEVR_REAL(P, X, T, Tr, TO)                                   \
+    int LAPACKE_##X##P(int layout, char jobz, char range, char uplo, int n,  \
+                       T *a, int lda, Tr vl, Tr vu, int il, int iu,          \
+                       Tr abstol, int *m, Tr *w, T *z, int ldz,              \
+                       int *isuppz) {                                        \
+        UNUSED(layout);                                                      \
+        int info        = 0;                                                 \
+        int lwork       = -1;                                                \
+        int liwork      = -1;                                                \
+        T work_param    = 0;                                                 \
+        int iwork_param = 0;                                                 \
+        X##P##_(&jobz, &range, &uplo, &n, (TO)a, &lda, &vl, &vu, &il, &iu,   \
+                &abstol, m, w, (TO)z, &ldz, isuppz, (TO)&work_param, &lwork, \
+                &iwork_param, &liwork, &info);                               \
+        lwork  = static_cast<int>(work_param);                               \
+        liwork = iwork_param;                                                \
+        std::vector<T> work(lwork);                                          \
+        std::vector<int> iwork(liwork);                                      \
+        X##P##_(&jobz, &range, &uplo, &n, (TO)a, &lda, &vl, &vu, &il, &iu,   \
+                &abstol, m, w, (TO)z, &ldz, isuppz, (TO)&work[0], &lwork,    \
+                &iwork[0], &liwork, &info);                                  \
+        return info;                                                         \
+    }
+
+#define LAPACK_SYEVR_CPLX(P, X, T, Tr, TO)                                   \
+    int LAPACKE_##X##P(int layout, char jobz, char range, char uplo, int n,  \
+                       T *a, int lda, Tr vl, Tr vu, int il, int iu,          \
+                       Tr abstol, int *m, Tr *w, T *z, int ldz,              \
+                       int *isuppz) {                                        \
+        UNUSED(layout);                                                      \
+        int info        = 0;                                                 \
+        int lwork       = -1;                                                \
+        int lrwork      = -1;                                                \
+        int liwork      = -1;                                                \
+        T work_param    = 0;                                                 \
+        Tr rwork_param  = 0;                                                 \
+        int iwork_param = 0;                                                 \
+        X##P##_(&jobz, &range, &uplo, &n, (TO)a, &lda, &vl, &vu, &il, &iu,   \
+                &abstol, m, w, (TO)z, &ldz, isuppz, (TO)&work_param, &lwork, \
+                &rwork_param, &lrwork, &iwork_param, &liwork, &info);        \
+        lwork  = static_cast<int>(std::real(work_param));                    \
+        lrwork = static_cast<int>(rwork_param);                              \
+        liwork = iwork_param;                                                \
+        std::vector<T> work(lwork);                                          \
+        std::vector<Tr> rwork(lrwork);                                       \
+        std::vector<int> iwork(liwork);                                      \
+        X##P##_(&jobz, &range, &uplo, &n, (TO)a, &lda, &vl, &vu, &il, &iu,   \
+                &abstol, m, w, (TO)z, &ldz, isuppz, (TO)&work[0], &lwork,    \
+                &rwork[0], &lrwork, &iwork[0], &liwork, &info);              \
+        return info;                                                         \
+    }
+
+LAPACK_SYEVR_REAL(syevr, s, float, float, float *)
+LAPACK_SYEVR_REAL(syevr, d, double, double, double *)
+LAPACK_SYEVR_CPLX(heevr, c, cfloat, float, __CLPK_complex *)
+LAPACK_SYEVR_CPLX(heevr, z, cdouble, double, __CLPK_doublecomplex *)
+
 #define LAPACK_LAMCH(X, T) \
     T LAPACKE_##X##lamch(char cmach) { return X##lamch_(&cmach); }
 
@@ -81,6 +81,25 @@ LAPACK_GESDD(gesdd, d, double, double)
 LAPACK_GESDD(gesdd, c, cfloat, float)
 LAPACK_GESDD(gesdd, z, cdouble, double)
 
+#define LAPACK_SYEVD(P, X, T, Tr)                                     \
+    int LAPACKE_##X##P(int layout, char jobz, char uplo, int n, T *a, \
+                       int lda, Tr *w);
+
+LAPACK_SYEVD(syevd, s, float, float)
+LAPACK_SYEVD(syevd, d, double, double)
+LAPACK_SYEVD(heevd, c, cfloat, float)
+LAPACK_SYEVD(heevd, z, cdouble, double)
+
+#define LAPACK_SYEVR(P, X, T, Tr)                                           \
+    int LAPACKE_##X##P(int layout, char jobz, char range, char uplo, int n, \
+                       T *a, int lda, Tr vl, Tr vu, int il, int iu,         \
+                       Tr abstol, int *m, Tr *w, T *z, int ldz, int *isuppz);
+
+LAPACK_SYEVR(syevr, s, float, float)
+LAPACK_SYEVR(syevr, d, double, double)
+LAPACK_SYEVR(heevr, c, cfloat, float)
+LAPACK_SYEVR(heevr, z, cdouble, double)
+
 #define LAPACK_LAMCH(X, T) T LAPACKE_##X##lamch(char cmach);
 
 LAPACK_LAMCH(s, float)
@@ -144,6 +163,8 @@ LAPACK_LACGV_WORK(z, cdouble)
 #undef LAPACK_GQR_WORK
 #undef LAPACK_MQR_WORK
 #undef LAPACK_GESDD
+#undef LAPACK_SYEVD
+#undef LAPACK_SYEVR
 #undef LAPACK_LAMCH
 #undef LAPACK_LACPY
 #undef LAPACK_GBR_WORK
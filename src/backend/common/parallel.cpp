@@ -0,0 +1,172 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <common/parallel.hpp>
+
+#include <common/util.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using arrayfire::common::getEnvVar;
+using std::atomic;
+using std::condition_variable;
+using std::exception_ptr;
+using std::function;
+using std::lock_guard;
+using std::make_shared;
+using std::mutex;
+using std::shared_ptr;
+using std::string;
+using std::thread;
+using std::unique_lock;
+using std::vector;
+
+namespace arrayfire {
+namespace common {
+
+namespace {
+
+/// Set on threads that are currently executing a parallelFor item
+thread_local bool insideParallelRegion = false;
+
+class ThreadPool {
+    /// State of a single parallelFor call. Workers keep a reference to the
+    /// job they were woken up for, so a late worker never picks up items of
+    /// a job that started after it went to sleep.
+    struct Job {
+        const function<void(dim_t)> *func;
+        dim_t count;
+        atomic<dim_t> next{0};
+        atomic<dim_t> pending{0};
+        mutex errorMutex;
+        exception_ptr error;
+    };
+
+   public:
+    explicit ThreadPool(unsigned nworkers) {
+        workers.reserve(nworkers);
+        for (unsigned i = 0; i < nworkers; ++i) {
+            workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    /// Returns false if the pool is already running a job for another thread
+    bool run(dim_t count, const function<void(dim_t)> &func) {
+        unique_lock<mutex> runLock(runMutex, std::try_to_lock);
+        if (!runLock.owns_lock()) { return false; }
+
+        auto job     = make_shared<Job>();
+        job->func    = &func;
+        job->count   = count;
+        job->pending = count;
+        {
+            lock_guard<mutex> lock(poolMutex);
+            current = job;
+            ++generation;
+        }
+        wakeUp.notify_all();
+
+        process(*job);
+
+        {
+            unique_lock<mutex> lock(poolMutex);
+            finished.wait(lock, [&job] { return job->pending == 0; });
+            current.reset();
+        }
+        if (job->error) { std::rethrow_exception(job->error); }
+        return true;
+    }
+
+   private:
+    void process(Job &job) {
+        insideParallelRegion = true;
+        dim_t i;
+        while ((i = job.next.fetch_add(1)) < job.count) {
+            try {
+                (*job.func)(i);
+            } catch (...) {
+                lock_guard<mutex> lock(job.errorMutex);
+                if (!job.error) { job.error = std::current_exception(); }
+            }
+            if (job.pending.fetch_sub(1) == 1) {
+                lock_guard<mutex> lock(poolMutex);
+                finished.notify_all();
+            }
+        }
+        insideParallelRegion = false;
+    }
+
+    void workerLoop() {
+        unsigned seen = 0;
+        while (true) {
+            shared_ptr<Job> job;
+            {
+                unique_lock<mutex> lock(poolMutex);
+                wakeUp.wait(lock, [&] { return generation != seen; });
+                seen = generation;
+                job  = current;
+            }
+            if (job) { process(*job); }
+        }
+    }
+
+    vector<thread> workers;
+    mutex runMutex;
+    mutex poolMutex;
+    condition_variable wakeUp;
+    condition_variable finished;
+    shared_ptr<Job> current;
+    unsigned generation = 0;
+};
+
+ThreadPool &getThreadPool() {
+    // Leaked on purpose, like the DeviceManager. The workers block on a
+    // condition variable and are torn down with the process.
+    static auto *pool = new ThreadPool(getNumThreads() - 1);
+    return *pool;
+}
+
+}  // namespace
+
+unsigned getNumThreads() {
+    static const unsigned numThreads = [] {
+        unsigned count    = thread::hardware_concurrency();
+        const string nstr = getEnvVar("AF_CPU_NUM_THREADS");
+        if (!nstr.empty()) {
+            try {
+                const int requested = std::stoi(nstr);
+                if (requested > 0) { count = static_cast<unsigned>(requested); }
+            } catch (...) {}
+        }
+        return std::max(count, 1U);
+    }();
+    return numThreads;
+}
+
+void parallelFor(dim_t count, const function<void(dim_t)> &func) {
+    if (count <= 0) { return; }
+    if (count == 1) {
+        func(0);
+        return;
+    }
+    if (insideParallelRegion || getNumThreads() == 1 ||
+        !getThreadPool().run(count, func)) {
+        for (dim_t i = 0; i < count; ++i) { func(i); }
+    }
+}
+
+}  // namespace common
+}  // namespace arrayfire
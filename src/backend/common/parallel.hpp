@@ -0,0 +1,63 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+
+#include <af/defines.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace arrayfire {
+namespace common {
+
+/// Returns the number of threads used by the parallel loops on the host, the
+/// CPU kernels and the decoding of image batches, including the calling
+/// thread.
+///
+/// Defaults to the number of hardware threads and can be overridden with the
+/// AF_CPU_NUM_THREADS environment variable.
+unsigned getNumThreads();
+
+/// Calls \p func(i) for every i in [0, \p count).
+///
+/// Items are handed out dynamically to a persistent pool of worker threads
+/// and to the calling thread. The call returns once every item is done. The
+/// first exception thrown by \p func is rethrown on the calling thread.
+///
+/// Calls made from inside \p func run sequentially on the calling thread so
+/// kernels can be composed without oversubscribing the machine.
+void parallelFor(dim_t count, const std::function<void(dim_t)> &func);
+
+/// Splits [\p begin, \p end) into contiguous chunks of at least \p grain
+/// elements and calls \p func(chunkBegin, chunkEnd) for each of them in
+/// parallel.
+template<typename Func>
+void parallelForChunks(dim_t begin, dim_t end, dim_t grain, Func &&func) {
+    const dim_t len = end - begin;
+    if (len <= 0) { return; }
+
+    grain                = std::max(grain, dim_t(1));
+    const dim_t maxChunk = static_cast<dim_t>(getNumThreads()) * 4;
+    const dim_t nchunks  = std::min((len + grain - 1) / grain, maxChunk);
+    if (nchunks <= 1) {
+        func(begin, end);
+        return;
+    }
+
+    const dim_t chunk = (len + nchunks - 1) / nchunks;
+    parallelFor(nchunks, [&](dim_t c) {
+        const dim_t cbeg = begin + c * chunk;
+        const dim_t cend = std::min(cbeg + chunk, end);
+        if (cbeg < cend) { func(cbeg, cend); }
+    });
+}
+
+}  // namespace common
+}  // namespace arrayfire
@@ -0,0 +1,71 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+
+#include <af/defines.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace arrayfire {
+namespace common {
+
+/// The two ranks of a sorted sequence that a quantile is computed from, and
+/// how their values are combined
+struct QuantileRanks {
+    dim_t lower;
+    dim_t upper;
+    /// Weight of the upper value for linear interpolation
+    double weight;
+    /// Use the mean of both values instead of the weight
+    bool midpoint;
+};
+
+/// Ranks that give the quantile \p prob of a sequence of \p count values.
+/// \p prob is in [0, 1] and \p method is not AF_QUANTILE_DEFAULT.
+inline QuantileRanks quantileRanks(const double prob, const dim_t count,
+                                   const af_quantile_method method) {
+    const double pos   = prob * static_cast<double>(count - 1);
+    const dim_t lower  = static_cast<dim_t>(std::floor(pos));
+    const dim_t upper  = std::min(lower + 1, count - 1);
+    const double frac  = pos - static_cast<double>(lower);
+    const bool isExact = frac == 0.0;
+
+    switch (method) {
+        case AF_QUANTILE_LOWER: return {lower, lower, 0.0, false};
+        case AF_QUANTILE_HIGHER: {
+            const dim_t r = isExact ? lower : upper;
+            return {r, r, 0.0, false};
+        }
+        case AF_QUANTILE_NEAREST: {
+            // Ties go to the even rank
+            const bool up = frac > 0.5 || (frac == 0.5 && lower % 2 == 1);
+            const dim_t r = up ? upper : lower;
+            return {r, r, 0.0, false};
+        }
+        case AF_QUANTILE_MIDPOINT:
+            return isExact ? QuantileRanks{lower, lower, 0.0, false}
+                           : QuantileRanks{lower, upper, 0.0, true};
+        case AF_QUANTILE_LINEAR:
+        default:
+            return isExact ? QuantileRanks{lower, lower, 0.0, false}
+                           : QuantileRanks{lower, upper, frac, false};
+    }
+}
+
+/// Combines the values at the ranks of \p r
+inline double interpolateQuantile(const QuantileRanks &r, const double lower,
+                                  const double upper) {
+    if (r.midpoint) { return (lower + upper) * 0.5; }
+    return lower + (upper - lower) * r.weight;
+}
+
+}  // namespace common
+}  // namespace arrayfire
@@ -12,6 +12,7 @@
 
 #include <Param.hpp>
 #include <common/ArrayInfo.hpp>
+#include <common/ObjectPool.hpp>
 #include <common/err_common.hpp>
 #include <common/half.hpp>
 #include <common/jit/NodeIterator.hpp>
@@ -60,7 +61,7 @@ namespace cpu {
 
 template<typename T>
 shared_ptr<BufferNode<T>> bufferNodePtr() {
-    return std::make_shared<BufferNode<T>>();
+    return common::makePooledShared<BufferNode<T>>();
 }
 
 template<typename T>
@@ -173,9 +174,11 @@ void evalMultiple(vector<Array<T> *> array_ptrs) {
                                 return l->dims() != r->dims();
                             });
 
-    // If they are not the same. eval individually
+    // If they are not the same, evaluate them over their combined extent
     if (it != end(array_ptrs)) {
-        for (auto ptr : array_ptrs) { ptr->eval(); }
+        JitOutputs outputs;
+        for (auto ptr : array_ptrs) { addEvalOutput(outputs, *ptr); }
+        evalOutputs(outputs);
         return;
     }
 
@@ -199,6 +202,27 @@ void evalMultiple(vector<Array<T> *> array_ptrs) {
     for (Array<T> *array : outputs) { array->node.reset(); }
 }
 
+template<typename T>
+void addEvalOutput(JitOutputs &outputs, Array<T> &array) {
+    if (getQueue().is_worker()) {
+        AF_ERROR("Array not evaluated", AF_ERR_INTERNAL);
+    }
+    if (array.isReady()) { return; }
+
+    array.setId(getActiveDeviceId());
+    array.data =
+        shared_ptr<T>(memAlloc<T>(array.elements()).release(), memFree);
+
+    outputs.push_back(make_shared<kernel::TypedJitOutput<T>>(
+        array.node, array.dims(), array.strides(), array.data));
+    array.node.reset();
+}
+
+void evalOutputs(const JitOutputs &outputs) {
+    if (outputs.empty()) { return; }
+    getQueue().enqueue(kernel::evalJitOutputs, outputs);
+}
+
 template<typename T>
 Node_ptr Array<T>::getNode() {
     if (node) { return node; }
@@ -228,7 +252,8 @@ Array<T> createDeviceDataArray(const dim4 &dims, void *data, bool copy) {
 
 template<typename T>
 Array<T> createValueArray(const dim4 &dims, const T &value) {
-    return createNodeArray<T>(dims, make_shared<jit::ScalarNode<T>>(value));
+    return createNodeArray<T>(
+        dims, common::makePooledShared<jit::ScalarNode<T>>(value));
 }
 
 template<typename T>
@@ -306,7 +331,7 @@ Array<T> createSubArray(const Array<T> &parent, const vector<af_seq> &index,
 
 template<typename T>
 void destroyArray(Array<T> *A) {
-    delete A;
+    common::destroyPooled(A);
 }
 
 template<typename T>
@@ -357,6 +382,7 @@ void Array<T>::setDataDims(const dim4 &new_dims) {
     template void writeDeviceDataArray<T>(                                    \
         Array<T> & arr, const void *const data, const size_t bytes);          \
     template void evalMultiple<T>(vector<Array<T> *> arrays);                 \
+    template void addEvalOutput<T>(JitOutputs & outputs, Array<T> & array);   \
     template kJITHeuristics passesJitHeuristics<T>(span<Node *> n);           \
     template void Array<T>::setDataDims(const dim4 &new_dims);                \
     template void checkAndMigrate<T>(const Array<T> &arr);
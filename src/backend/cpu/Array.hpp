@@ -44,6 +44,7 @@ template<typename T>
 void evalMultiple(std::vector<Param<T>> arrays,
                   std::vector<common::Node_ptr> nodes);
 
+class JitOutput;
 }  // namespace kernel
 
 template<typename T>
@@ -55,6 +56,17 @@ using std::shared_ptr;
 template<typename T>
 void evalMultiple(std::vector<Array<T> *> array_ptrs);
 
+/// Outputs of a fused evaluation of arrays of any type and shape
+using JitOutputs = std::vector<std::shared_ptr<kernel::JitOutput>>;
+
+/// Allocates the memory of \p array and adds it to \p outputs if it is not
+/// evaluated yet. evalOutputs() has to be called before the array is used.
+template<typename T>
+void addEvalOutput(JitOutputs &outputs, Array<T> &array);
+
+/// Evaluates all \p outputs in a single pass
+void evalOutputs(const JitOutputs &outputs);
+
 // Creates a new Array object on the heap and returns a reference to it.
 template<typename T>
 Array<T> createNodeArray(const af::dim4 &dims, common::Node_ptr node);
@@ -281,6 +293,7 @@ class Array {
     common::Node_ptr getNode();
 
     friend void evalMultiple<T>(std::vector<Array<T> *> arrays);
+    friend void addEvalOutput<T>(JitOutputs &outputs, Array<T> &array);
 
     friend Array<T> createValueArray<T>(const af::dim4 &dims, const T &value);
     friend Array<T> createHostDataArray<T>(const af::dim4 &dims,
@@ -26,10 +26,28 @@ void anisotropicDiffusion(Array<T>& inout, const float dt, const float mct,
     }
 }
 
-#define INSTANTIATE(T)                                     \
-    template void anisotropicDiffusion<T>(                 \
-        Array<T> & inout, const float dt, const float mct, \
-        const af::fluxFunction fftype, const af::diffusionEq eq);
+template<typename T>
+void anisotropicDiffusionIterate(Array<T>& inout, const float dt,
+                                 const float K, const unsigned iterations,
+                                 const af::fluxFunction fftype,
+                                 const af::diffusionEq eq) {
+    if (eq == AF_DIFFUSION_MCDE) {
+        getQueue().enqueue(kernel::anisotropicDiffusionIterate<T, true>, inout,
+                           dt, K, iterations, fftype);
+    } else {
+        getQueue().enqueue(kernel::anisotropicDiffusionIterate<T, false>,
+                           inout, dt, K, iterations, fftype);
+    }
+}
+
+#define INSTANTIATE(T)                                                 \
+    template void anisotropicDiffusion<T>(                             \
+        Array<T> & inout, const float dt, const float mct,             \
+        const af::fluxFunction fftype, const af::diffusionEq eq);      \
+    template void anisotropicDiffusionIterate<T>(                      \
+        Array<T> & inout, const float dt, const float K,               \
+        const unsigned iterations, const af::fluxFunction fftype,      \
+        const af::diffusionEq eq);
 
 INSTANTIATE(double)
 INSTANTIATE(float)
@@ -18,5 +18,13 @@ template<typename T>
 void anisotropicDiffusion(Array<T>& inout, const float dt, const float mct,
                           const af::fluxFunction fftype,
                           const af::diffusionEq eq);
+
+/// Runs \p iterations diffusion steps, including the computation of the
+/// conductance scale from the mean gradient energy before every step
+template<typename T>
+void anisotropicDiffusionIterate(Array<T>& inout, const float dt,
+                                 const float K, const unsigned iterations,
+                                 const af::fluxFunction fftype,
+                                 const af::diffusionEq eq);
 }  // namespace cpu
 }  // namespace arrayfire
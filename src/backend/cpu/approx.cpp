@@ -12,6 +12,8 @@
 #include <platform.hpp>
 #include <af/dim4.hpp>
 
+using af::dim4;
+
 namespace arrayfire {
 namespace cpu {
 
@@ -72,6 +74,29 @@ void approx2(Array<Ty> &zo, const Array<Ty> &zi, const Array<Tp> &xo,
     }
 }
 
+template<typename Ty>
+Array<Ty> approx1Prepare(const Array<Ty> &yi, const af_interp_type method) {
+    dim4 cdims = yi.dims();
+    cdims[0] *= 4;
+
+    Array<Ty> coeffs = createEmptyArray<Ty>(cdims);
+    getQueue().enqueue(kernel::approx1Prepare<Ty>, coeffs, yi, method);
+    return coeffs;
+}
+
+template<typename Ty, typename Tp>
+Array<Ty> approx1Prepared(const Array<Ty> &coeffs, const Array<Tp> &xo,
+                          const Tp &xi_beg, const Tp &xi_step,
+                          const float offGrid) {
+    dim4 odims = coeffs.dims();
+    odims[0]   = xo.dims()[0];
+
+    Array<Ty> yo = createEmptyArray<Ty>(odims);
+    getQueue().enqueue(kernel::approx1Prepared<Ty, Tp>, yo, coeffs, xo,
+                       xi_beg, xi_step, offGrid);
+    return yo;
+}
+
 #define INSTANTIATE(Ty, Tp)                                       \
     template void approx1<Ty, Tp>(                                \
         Array<Ty> & yo, const Array<Ty> &yi, const Array<Tp> &xo, \
@@ -88,5 +113,17 @@ INSTANTIATE(double, double)
 INSTANTIATE(cfloat, float)
 INSTANTIATE(cdouble, double)
 
+#define INSTANTIATE_PREPARED(Ty, Tp)                                    \
+    template Array<Ty> approx1Prepare<Ty>(const Array<Ty> &yi,          \
+                                          const af_interp_type method); \
+    template Array<Ty> approx1Prepared<Ty, Tp>(                         \
+        const Array<Ty> &coeffs, const Array<Tp> &xo, const Tp &xi_beg, \
+        const Tp &xi_step, const float offGrid);
+
+INSTANTIATE_PREPARED(float, float)
+INSTANTIATE_PREPARED(double, double)
+INSTANTIATE_PREPARED(cfloat, float)
+INSTANTIATE_PREPARED(cdouble, double)
+
 }  // namespace cpu
 }  // namespace arrayfire
@@ -23,5 +23,13 @@ void approx2(Array<Ty> &zo, const Array<Ty> &zi, const Array<Tp> &xo,
              const Array<Tp> &yo, const int ydim, const Tp &yi_beg,
              const Tp &yi_step, const af_interp_type method,
              const float offGrid);
+
+template<typename Ty>
+Array<Ty> approx1Prepare(const Array<Ty> &yi, const af_interp_type method);
+
+template<typename Ty, typename Tp>
+Array<Ty> approx1Prepared(const Array<Ty> &coeffs, const Array<Tp> &xo,
+                          const Tp &xi_beg, const Tp &xi_step,
+                          const float offGrid);
 }  // namespace cpu
 }  // namespace arrayfire
@@ -22,16 +22,30 @@ namespace cpu {
 
 template<typename inType, typename outType>
 Array<outType> bilateral(const Array<inType> &in, const float &sSigma,
-                         const float &cSigma) {
+                         const float &cSigma, const bool isColor,
+                         const af_bilateral_method method) {
     Array<outType> out = createEmptyArray<outType>(in.dims());
-    getQueue().enqueue(kernel::bilateral<outType, inType>, out, in, sSigma,
-                       cSigma);
+    switch (method) {
+        case AF_BILATERAL_GRID:
+            getQueue().enqueue(kernel::bilateralGrid<outType, inType>, out, in,
+                               sSigma, cSigma);
+            break;
+        case AF_BILATERAL_PERMUTOHEDRAL:
+            getQueue().enqueue(kernel::bilateralLattice<outType, inType>, out,
+                               in, sSigma, cSigma, isColor);
+            break;
+        default:
+            getQueue().enqueue(kernel::bilateral<outType, inType>, out, in,
+                               sSigma, cSigma);
+            break;
+    }
     return out;
 }
 
-#define INSTANTIATE(inT, outT)                                    \
-    template Array<outT> bilateral<inT, outT>(const Array<inT> &, \
-                                              const float &, const float &);
+#define INSTANTIATE(inT, outT)                                        \
+    template Array<outT> bilateral<inT, outT>(                        \
+        const Array<inT> &, const float &, const float &, const bool, \
+        const af_bilateral_method);
 
 INSTANTIATE(double, double)
 INSTANTIATE(float, float)
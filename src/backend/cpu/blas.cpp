@@ -167,6 +167,12 @@ using gemv_func_def = void (*)(const CBLAS_ORDER, const CBLAS_TRANSPOSE,
                                typename scale_type<T>::api_type, ptr_type<T>,
                                const blasint);
 
+template<typename T>
+using syrk_func_def = void (*)(const CBLAS_ORDER, const CBLAS_UPLO,
+                               const CBLAS_TRANSPOSE, const blasint,
+                               const blasint, const T, const T *, const blasint,
+                               const T, T *, const blasint);
+
 #ifdef USE_MKL
 template<typename T>
 using gemm_batch_func_def = void (*)(
@@ -199,6 +205,10 @@ BLAS_FUNC(gemv, double, d)
 BLAS_FUNC(gemv, cfloat, c)
 BLAS_FUNC(gemv, cdouble, z)
 
+BLAS_FUNC_DEF(syrk)
+BLAS_FUNC(syrk, float, s)
+BLAS_FUNC(syrk, double, d)
+
 #ifdef USE_MKL
 BLAS_FUNC_DEF(gemm_batch)
 BLAS_FUNC(gemm_batch, float, s)
@@ -341,6 +351,17 @@ void gemm<half>(Array<half> &out, af_mat_prop optLhs, af_mat_prop optRhs,
     copyArray(out, outArr);
 }
 
+template<typename T>
+void syrk(Array<T> &out, const T alpha, const Array<T> &in) {
+    auto func = [=](Param<T> output, CParam<T> input) {
+        const dim4 &dims = input.dims();
+        syrk_func<T>()(CblasColMajor, CblasLower, CblasTrans, dims[1], dims[0],
+                       alpha, input.get(), input.strides()[1], T(0),
+                       output.get(), output.strides()[1]);
+    };
+    getQueue().enqueue(func, out, in);
+}
+
 template<typename T>
 Array<T> dot(const Array<T> &lhs, const Array<T> &rhs, af_mat_prop optLhs,
              af_mat_prop optRhs) {
@@ -392,5 +413,12 @@ INSTANTIATE_DOT(double);
 INSTANTIATE_DOT(cfloat);
 INSTANTIATE_DOT(cdouble);
 
+#define INSTANTIATE_SYRK(TYPE)                                    \
+    template void syrk<TYPE>(Array<TYPE> & out, const TYPE alpha, \
+                             const Array<TYPE> &in)
+
+INSTANTIATE_SYRK(float);
+INSTANTIATE_SYRK(double);
+
 }  // namespace cpu
 }  // namespace arrayfire
@@ -30,6 +30,11 @@ Array<T> matmul(const Array<T> &lhs, const Array<T> &rhs, af_mat_prop optLhs,
     return res;
 }
 
+/// Lower triangle of \p alpha * in^T * in for real types. The upper
+/// triangle of \p out is not written.
+template<typename T>
+void syrk(Array<T> &out, const T alpha, const Array<T> &in);
+
 template<typename T>
 Array<T> dot(const Array<T> &lhs, const Array<T> &rhs, af_mat_prop optLhs,
              af_mat_prop optRhs);
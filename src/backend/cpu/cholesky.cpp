@@ -16,6 +16,7 @@
 #include <Array.hpp>
 #include <Param.hpp>
 #include <copy.hpp>
+#include <kernel/batched_linalg.hpp>
 #include <types.hpp>
 
 #include <lapack_helper.hpp>
@@ -24,6 +25,9 @@
 #include <triangle.hpp>
 #include <af/dim4.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace arrayfire {
 namespace cpu {
 
@@ -64,17 +68,31 @@ int cholesky_inplace(Array<T> &in, const bool is_upper) {
     char uplo = 'L';
     if (is_upper) { uplo = 'U'; }
 
-    int info  = 0;
-    auto func = [&](int *info, Param<T> in) {
-        *info = potrf_func<T>()(AF_LAPACK_COL_MAJOR, uplo, N, in.get(),
-                                in.strides(1));
-    };
-
-    getQueue().enqueue(func, &info, in);
+    // Every matrix of a batch reports its own status, the first failure in
+    // batch order is returned
+    std::vector<int> info(iDims[2] * iDims[3], 0);
+    if (kernel::useBatchedLinAlg(iDims)) {
+        getQueue().enqueue(kernel::choleskyBatched<T>, in, info.data(),
+                           is_upper);
+    } else {
+        auto func = [&](int *info, Param<T> in) {
+            for (dim_t w = 0; w < iDims[3]; ++w) {
+                for (dim_t z = 0; z < iDims[2]; ++z) {
+                    info[w * iDims[2] + z] = potrf_func<T>()(
+                        AF_LAPACK_COL_MAJOR, uplo, N,
+                        in.get() + z * in.strides(2) + w * in.strides(3),
+                        in.strides(1));
+                }
+            }
+        };
+        getQueue().enqueue(func, info.data(), in);
+    }
     // Ensure the value of info has been written into info.
     getQueue().sync();
 
-    return info;
+    auto failed = std::find_if(info.begin(), info.end(),
+                               [](int i) { return i != 0; });
+    return failed == info.end() ? 0 : *failed;
 }
 
 #define INSTANTIATE_CH(T)                                                 \
@@ -8,6 +8,7 @@
  ********************************************************/
 
 #include <Array.hpp>
+#include <common/ObjectPool.hpp>
 #include <err_cpu.hpp>
 #include <jit/BinaryNode.hpp>
 #include <jit/UnaryNode.hpp>
@@ -55,7 +56,8 @@ CPLX_UNARY_FN(abs)
 template<typename To, typename Ti>
 Array<To> real(const Array<Ti> &in) {
     common::Node_ptr in_node = in.getNode();
-    auto node = std::make_shared<jit::UnaryNode<To, Ti, af_real_t>>(in_node);
+    auto node =
+        common::makePooledShared<jit::UnaryNode<To, Ti, af_real_t>>(in_node);
 
     return createNodeArray<To>(in.dims(), move(node));
 }
@@ -63,7 +65,8 @@ Array<To> real(const Array<Ti> &in) {
 template<typename To, typename Ti>
 Array<To> imag(const Array<Ti> &in) {
     common::Node_ptr in_node = in.getNode();
-    auto node = std::make_shared<jit::UnaryNode<To, Ti, af_imag_t>>(in_node);
+    auto node =
+        common::makePooledShared<jit::UnaryNode<To, Ti, af_imag_t>>(in_node);
 
     return createNodeArray<To>(in.dims(), move(node));
 }
@@ -71,7 +74,8 @@ Array<To> imag(const Array<Ti> &in) {
 template<typename To, typename Ti>
 Array<To> abs(const Array<Ti> &in) {
     common::Node_ptr in_node = in.getNode();
-    auto node = std::make_shared<jit::UnaryNode<To, Ti, af_abs_t>>(in_node);
+    auto node =
+        common::makePooledShared<jit::UnaryNode<To, Ti, af_abs_t>>(in_node);
 
     return createNodeArray<To>(in.dims(), move(node));
 }
@@ -79,7 +83,8 @@ Array<To> abs(const Array<Ti> &in) {
 template<typename T>
 Array<T> conj(const Array<T> &in) {
     common::Node_ptr in_node = in.getNode();
-    auto node = std::make_shared<jit::UnaryNode<T, T, af_conj_t>>(in_node);
+    auto node =
+        common::makePooledShared<jit::UnaryNode<T, T, af_conj_t>>(in_node);
 
     return createNodeArray<T>(in.dims(), move(node));
 }
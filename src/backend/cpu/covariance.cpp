@@ -0,0 +1,91 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <covariance.hpp>
+
+#include <Array.hpp>
+#include <blas.hpp>
+#include <kernel/comoments.hpp>
+#include <platform.hpp>
+#include <queue.hpp>
+#include <types.hpp>
+#include <af/dim4.hpp>
+
+#include <cmath>
+
+using af::dim4;
+
+namespace arrayfire {
+namespace cpu {
+
+template<typename T, typename To>
+Array<To> cov(const Array<T> &x, const Array<T> &y, const af_var_bias bias) {
+    dim4 odims    = x.dims();
+    const dim_t n = odims[0];
+    odims[0]      = 1;
+    Array<To> out = createEmptyArray<To>(odims);
+
+    const double norm =
+        static_cast<double>(bias == AF_VARIANCE_SAMPLE ? n - 1 : n);
+    getQueue().enqueue(kernel::cov<T, To>, out, x, y, norm);
+
+    return out;
+}
+
+template<typename T, typename To>
+To corrcoef(const Array<T> &x, const Array<T> &y) {
+    x.eval();
+    y.eval();
+    getQueue().sync();
+
+    const kernel::Comoments m = kernel::comoments<T>(x, y);
+    return static_cast<To>(m.cXY / (std::sqrt(m.m2X) * std::sqrt(m.m2Y)));
+}
+
+template<typename T, typename To>
+Array<To> covMatrix(const Array<T> &in, const af_var_bias bias,
+                    const bool correlation) {
+    const dim4 &idims = in.dims();
+    const dim_t n     = idims[0];
+
+    // A centred copy keeps the cancellation of the naive formula out of
+    // the rank-k update
+    Array<To> centred = createEmptyArray<To>(idims);
+    getQueue().enqueue(kernel::centreColumns<T, To>, centred, in);
+
+    Array<To> out = createEmptyArray<To>(dim4(idims[1], idims[1]));
+    const To alpha =
+        static_cast<To>(1.0 / (bias == AF_VARIANCE_SAMPLE ? n - 1 : n));
+    syrk<To>(out, alpha, centred);
+
+    getQueue().enqueue(kernel::symmetricCovariance<To>, out, correlation);
+    return out;
+}
+
+#define INSTANTIATE(T, To)                                              \
+    template Array<To> cov<T, To>(const Array<T> &x, const Array<T> &y, \
+                                  const af_var_bias bias);              \
+    template To corrcoef<T, To>(const Array<T> &x, const Array<T> &y);  \
+    template Array<To> covMatrix<T, To>(const Array<T> &in,             \
+                                        const af_var_bias bias,         \
+                                        const bool correlation);
+
+INSTANTIATE(double, double)
+INSTANTIATE(float, float)
+INSTANTIATE(int, float)
+INSTANTIATE(uint, float)
+INSTANTIATE(intl, double)
+INSTANTIATE(uintl, double)
+INSTANTIATE(short, float)
+INSTANTIATE(ushort, float)
+INSTANTIATE(uchar, float)
+INSTANTIATE(char, float)
+
+}  // namespace cpu
+}  // namespace arrayfire
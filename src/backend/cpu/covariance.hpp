@@ -0,0 +1,31 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+#include <Array.hpp>
+#include <af/defines.h>
+
+namespace arrayfire {
+namespace cpu {
+/// Covariance of every column of \p x with the same column of \p y, about
+/// the means of all values of \p x and \p y, in a single pass
+template<typename T, typename To>
+Array<To> cov(const Array<T> &x, const Array<T> &y, const af_var_bias bias);
+
+/// Pearson correlation of all values of \p x and \p y, in a single pass
+template<typename T, typename To>
+To corrcoef(const Array<T> &x, const Array<T> &y);
+
+/// Covariance matrix of the columns of \p in, or their correlation matrix
+/// when \p correlation is true
+template<typename T, typename To>
+Array<To> covMatrix(const Array<T> &in, const af_var_bias bias,
+                    const bool correlation);
+}  // namespace cpu
+}  // namespace arrayfire
@@ -0,0 +1,308 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <deconvolution.hpp>
+
+#include <Array.hpp>
+#include <Param.hpp>
+#include <fftw3.h>
+#include <platform.hpp>
+#include <queue.hpp>
+#include <types.hpp>
+#include <af/dim4.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace arrayfire {
+namespace cpu {
+
+namespace {
+
+template<typename T>
+struct fftw_deconv;
+
+#define DECONV_TRANSFORM(PRE, TY)                                         \
+    template<>                                                            \
+    struct fftw_deconv<TY> {                                              \
+        typedef PRE##_plan plan_t;                                        \
+        typedef PRE##_complex ctype_t;                                    \
+                                                                          \
+        static plan_t planR2C(int n0, int n1, TY *in, ctype_t *out) {     \
+            return PRE##_plan_dft_r2c_2d(n1, n0, in, out, FFTW_ESTIMATE); \
+        }                                                                 \
+        static plan_t planC2R(int n0, int n1, ctype_t *in, TY *out) {     \
+            return PRE##_plan_dft_c2r_2d(n1, n0, in, out, FFTW_ESTIMATE); \
+        }                                                                 \
+        static void r2c(plan_t plan, TY *in, ctype_t *out) {              \
+            PRE##_execute_dft_r2c(plan, in, out);                         \
+        }                                                                 \
+        static void c2r(plan_t plan, ctype_t *in, TY *out) {              \
+            PRE##_execute_dft_c2r(plan, in, out);                         \
+        }                                                                 \
+        static void destroy(plan_t plan) { PRE##_destroy_plan(plan); }    \
+        static void *alloc(size_t bytes) { return PRE##_malloc(bytes); }  \
+        static void release(void *ptr) { PRE##_free(ptr); }               \
+    };
+
+DECONV_TRANSFORM(fftwf, float)
+DECONV_TRANSFORM(fftw, double)
+
+#undef DECONV_TRANSFORM
+
+/// Buffers and FFT plans that live for all iterations of one deconvolution.
+/// Every buffer comes from the FFTW allocator, so a single pair of plans
+/// serves all of them through the new-array execute functions.
+template<typename T, typename CT>
+class DeconvWorkspace {
+    using fftw    = fftw_deconv<T>;
+    using ctype_t = typename fftw::ctype_t;
+    using buffer  = std::unique_ptr<void, void (*)(void *)>;
+
+    template<typename U>
+    buffer allocate(const dim_t count) {
+        return buffer(fftw::alloc(sizeof(U) * count), fftw::release);
+    }
+
+    const int n0;
+    const int n1;
+    buffer estimateBuf;
+    buffer observedBuf;
+    buffer workBuf;
+    buffer spectrumBuf;
+    buffer psfBuf;
+    typename fftw::plan_t r2cPlan;
+    typename fftw::plan_t c2rPlan;
+
+   public:
+    const dim_t reals;
+    const dim_t bins;
+
+    DeconvWorkspace(const dim_t d0, const dim_t d1)
+        : n0(static_cast<int>(d0))
+        , n1(static_cast<int>(d1))
+        , estimateBuf(allocate<T>(d0 * d1))
+        , observedBuf(allocate<T>(d0 * d1))
+        , workBuf(allocate<T>(d0 * d1))
+        , spectrumBuf(allocate<CT>((d0 / 2 + 1) * d1))
+        , psfBuf(allocate<CT>((d0 / 2 + 1) * d1))
+        , reals(d0 * d1)
+        , bins((d0 / 2 + 1) * d1) {
+        // FFTW_ESTIMATE planning leaves the buffers untouched
+        r2cPlan = fftw::planR2C(n0, n1, work(), spectrumRaw());
+        c2rPlan = fftw::planC2R(n0, n1, spectrumRaw(), work());
+    }
+
+    ~DeconvWorkspace() {
+        fftw::destroy(r2cPlan);
+        fftw::destroy(c2rPlan);
+    }
+
+    DeconvWorkspace(const DeconvWorkspace &)            = delete;
+    DeconvWorkspace &operator=(const DeconvWorkspace &) = delete;
+
+    T *estimate() { return static_cast<T *>(estimateBuf.get()); }
+    T *observed() { return static_cast<T *>(observedBuf.get()); }
+    T *work() { return static_cast<T *>(workBuf.get()); }
+    CT *spectrum() { return static_cast<CT *>(spectrumBuf.get()); }
+    CT *psf() { return static_cast<CT *>(psfBuf.get()); }
+    ctype_t *spectrumRaw() { return static_cast<ctype_t *>(spectrumBuf.get()); }
+
+    /// spectrum = fft(in)
+    void forward(T *in) { fftw::r2c(r2cPlan, in, spectrumRaw()); }
+
+    /// out = unnormalised ifft(spectrum). Overwrites the spectrum.
+    void inverse(T *out) { fftw::c2r(c2rPlan, spectrumRaw(), out); }
+};
+
+template<typename T, typename U>
+void load(U *dst, CParam<T> src) {
+    const af::dim4 dims    = src.dims();
+    const af::dim4 strides = src.strides();
+    for (dim_t j = 0; j < dims[1]; ++j) {
+        const T *col = src.get() + j * strides[1];
+        for (dim_t i = 0; i < dims[0]; ++i) {
+            dst[i + j * dims[0]] = col[i * strides[0]];
+        }
+    }
+}
+
+template<typename T>
+void store(Param<T> dst, const T *src, const T scale) {
+    const af::dim4 dims    = dst.dims();
+    const af::dim4 strides = dst.strides();
+    for (dim_t j = 0; j < dims[1]; ++j) {
+        T *col = dst.get() + j * strides[1];
+        for (dim_t i = 0; i < dims[0]; ++i) {
+            col[i * strides[0]] = src[i + j * dims[0]] * scale;
+        }
+    }
+}
+
+// Plain products, without the special cases of std::complex for infinities
+template<typename CT>
+CT mul(const CT a, const CT b) {
+    return CT(a.real() * b.real() - a.imag() * b.imag(),
+              a.real() * b.imag() + a.imag() * b.real());
+}
+
+template<typename CT>
+CT mulConj(const CT a, const CT b) {
+    return CT(a.real() * b.real() + a.imag() * b.imag(),
+              a.imag() * b.real() - a.real() * b.imag());
+}
+
+template<typename T, typename CT>
+void richardsonLucyKernel(Param<T> out, CParam<T> in, CParam<CT> psf,
+                          const unsigned iters, const float tolerance) {
+    DeconvWorkspace<T, CT> ws(in.dims()[0], in.dims()[1]);
+    T *est      = ws.estimate();
+    T *obs      = ws.observed();
+    T *work     = ws.work();
+    CT *spec    = ws.spectrum();
+    CT *P       = ws.psf();
+    const T one = T(1);
+
+    load(obs, in);
+    std::copy(obs, obs + ws.reals, est);
+
+    // The scale of both inverse transforms is folded into the spectrum
+    load(P, psf);
+    const T norm = one / static_cast<T>(ws.reals);
+    for (dim_t b = 0; b < ws.bins; ++b) { P[b] *= norm; }
+
+    const double tol2 = static_cast<double>(tolerance) * tolerance;
+    for (unsigned it = 0; it < iters; ++it) {
+        // Reblur the estimate and compare it with the observation
+        ws.forward(est);
+        for (dim_t b = 0; b < ws.bins; ++b) { spec[b] = mul(spec[b], P[b]); }
+        ws.inverse(work);
+        for (dim_t i = 0; i < ws.reals; ++i) { work[i] = obs[i] / work[i]; }
+
+        // Correlate the ratio with the PSF and update the estimate
+        ws.forward(work);
+        for (dim_t b = 0; b < ws.bins; ++b) {
+            spec[b] = mulConj(spec[b], P[b]);
+        }
+        ws.inverse(work);
+
+        double change = 0.0;
+        double size   = 0.0;
+        for (dim_t i = 0; i < ws.reals; ++i) {
+            const T next = est[i] * work[i];
+            const T diff = next - est[i];
+            change += static_cast<double>(diff) * diff;
+            size += static_cast<double>(est[i]) * est[i];
+            est[i] = next;
+        }
+        if (tolerance > 0.f && change <= tol2 * size) { break; }
+    }
+
+    store(out, est, one);
+}
+
+template<typename T, typename CT>
+void landweberKernel(Param<T> out, CParam<T> in, CParam<CT> psf,
+                     const unsigned iters, const float relaxFactor,
+                     const float tolerance) {
+    DeconvWorkspace<T, CT> ws(in.dims()[0], in.dims()[1]);
+    T *obs   = ws.observed();
+    T *work  = ws.work();
+    CT *spec = ws.spectrum();
+    CT *P    = ws.psf();
+
+    load(obs, in);
+    load(P, psf);
+    ws.forward(obs);
+
+    // Every iteration is X = (1 - a) X + r per frequency, with
+    // a = alpha |P|^2 and r = alpha conj(P) I
+    const double alpha = relaxFactor;
+    if (tolerance > 0.f) {
+        const double tol2 = static_cast<double>(tolerance) * tolerance;
+        T *a              = work;
+        CT *r             = P;
+        for (dim_t b = 0; b < ws.bins; ++b) {
+            a[b] = static_cast<T>(alpha * std::norm(P[b]));
+            r[b] = mulConj(spec[b], P[b]) * static_cast<T>(alpha);
+        }
+        for (unsigned it = 0; it < iters; ++it) {
+            double change = 0.0;
+            double size   = 0.0;
+            for (dim_t b = 0; b < ws.bins; ++b) {
+                const CT diff = r[b] - a[b] * spec[b];
+                change += std::norm(diff);
+                size += std::norm(spec[b]);
+                spec[b] += diff;
+            }
+            if (change <= tol2 * size) { break; }
+        }
+    } else {
+        // All iterations at once: X_k = (1 - a)^k I + r (1 - (1 - a)^k) / a
+        const double k = static_cast<double>(iters);
+        for (dim_t b = 0; b < ws.bins; ++b) {
+            const double a = alpha * std::norm(P[b]);
+            double decay, sum;
+            if (a == 0.0) {
+                decay = 1.0;
+                sum   = k;
+            } else if (a < 1.0) {
+                const double l = k * std::log1p(-a);
+                decay          = std::exp(l);
+                sum            = -std::expm1(l) / a;
+            } else {
+                decay = std::pow(1.0 - a, k);
+                sum   = (1.0 - decay) / a;
+            }
+            const CT r = mulConj(spec[b], P[b]) * static_cast<T>(alpha);
+            spec[b]    = spec[b] * static_cast<T>(decay) +
+                      r * static_cast<T>(sum);
+        }
+    }
+
+    ws.inverse(work);
+    store(out, work, T(1) / static_cast<T>(ws.reals));
+}
+
+}  // namespace
+
+template<typename T, typename CT>
+Array<T> richardsonLucy(const Array<T> &in, const Array<CT> &psf,
+                        const unsigned iters, const float tolerance) {
+    Array<T> out = createEmptyArray<T>(in.dims());
+    getQueue().enqueue(richardsonLucyKernel<T, CT>, out, in, psf, iters,
+                       tolerance);
+    return out;
+}
+
+template<typename T, typename CT>
+Array<T> landweber(const Array<T> &in, const Array<CT> &psf,
+                   const unsigned iters, const float relaxFactor,
+                   const float tolerance) {
+    Array<T> out = createEmptyArray<T>(in.dims());
+    getQueue().enqueue(landweberKernel<T, CT>, out, in, psf, iters,
+                       relaxFactor, tolerance);
+    return out;
+}
+
+#define INSTANTIATE(T, CT)                                                   \
+    template Array<T> richardsonLucy<T, CT>(const Array<T> &in,              \
+                                            const Array<CT> &psf,            \
+                                            const unsigned iters,            \
+                                            const float tolerance);          \
+    template Array<T> landweber<T, CT>(                                      \
+        const Array<T> &in, const Array<CT> &psf, const unsigned iters,      \
+        const float relaxFactor, const float tolerance);
+
+INSTANTIATE(float, cfloat)
+INSTANTIATE(double, cdouble)
+
+}  // namespace cpu
+}  // namespace arrayfire
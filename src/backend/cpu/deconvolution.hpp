@@ -0,0 +1,31 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+#include <Array.hpp>
+
+namespace arrayfire {
+namespace cpu {
+/// Richardson-Lucy deconvolution of the padded image \p in. \p psf is the
+/// spectrum of the padded and shifted point spread function, as returned by
+/// fft_r2c. Stops after \p iters iterations, or earlier once the relative
+/// change of the estimate is at most \p tolerance.
+template<typename T, typename CT>
+Array<T> richardsonLucy(const Array<T> &in, const Array<CT> &psf,
+                        const unsigned iters, const float tolerance);
+
+/// Landweber deconvolution of the padded image \p in with the relaxation
+/// factor \p relaxFactor. \p psf is as for richardsonLucy(). The relative
+/// change is measured on the spectrum of the estimate.
+template<typename T, typename CT>
+Array<T> landweber(const Array<T> &in, const Array<CT> &psf,
+                   const unsigned iters, const float relaxFactor,
+                   const float tolerance);
+}  // namespace cpu
+}  // namespace arrayfire
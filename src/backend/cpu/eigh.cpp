@@ -0,0 +1,148 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <eigh.hpp>
+
+#include <Array.hpp>
+#include <common/err_common.hpp>
+#include <err_cpu.hpp>
+
+#if defined(WITH_LINEAR_ALGEBRA)
+#include <copy.hpp>
+#include <lapack_helper.hpp>
+#include <platform.hpp>
+#include <queue.hpp>
+#include <af/dim4.hpp>
+
+#include <vector>
+
+using af::dim4;
+
+namespace arrayfire {
+namespace cpu {
+
+template<typename T, typename Tr>
+using syevd_func_def = int (*)(ORDER_TYPE, char jobz, char uplo, int n, T *a,
+                               int lda, Tr *w);
+
+template<typename T, typename Tr>
+using syevr_func_def = int (*)(ORDER_TYPE, char jobz, char range, char uplo,
+                               int n, T *a, int lda, Tr vl, Tr vu, int il,
+                               int iu, Tr abstol, int *m, Tr *w, T *z, int ldz,
+                               int *isuppz);
+
+#define EIGH_FUNC_DEF(FUNC)           \
+    template<typename T, typename Tr> \
+    FUNC##_func_def<T, Tr> FUNC##_func();
+
+#define EIGH_FUNC(FUNC, T, Tr, NAME)              \
+    template<>                                    \
+    FUNC##_func_def<T, Tr> FUNC##_func<T, Tr>() { \
+        return &LAPACK_NAME(NAME);                \
+    }
+
+EIGH_FUNC_DEF(syevd)
+EIGH_FUNC(syevd, float, float, ssyevd)
+EIGH_FUNC(syevd, double, double, dsyevd)
+EIGH_FUNC(syevd, cfloat, float, cheevd)
+EIGH_FUNC(syevd, cdouble, double, zheevd)
+
+EIGH_FUNC_DEF(syevr)
+EIGH_FUNC(syevr, float, float, ssyevr)
+EIGH_FUNC(syevr, double, double, dsyevr)
+EIGH_FUNC(syevr, cfloat, float, cheevr)
+EIGH_FUNC(syevr, cdouble, double, zheevr)
+
+template<typename T, typename Tr>
+void eigh(Array<Tr> &values, Array<T> &vectors, const Array<T> &in,
+          const unsigned k, const bool is_upper, const bool want_vectors) {
+    const dim4 iDims = in.dims();
+    const int N      = iDims[0];
+    const int K      = (k == 0) ? N : static_cast<int>(k);
+    const char uplo  = is_upper ? 'U' : 'L';
+    const char jobz  = want_vectors ? 'V' : 'N';
+
+    Array<T> A = copyArray<T>(in);
+    values     = createEmptyArray<Tr>(dim4(K, 1, iDims[2], iDims[3]));
+
+    if (K == N) {
+        // The divide and conquer driver overwrites A with the eigenvectors
+        auto func = [=](Param<T> A, Param<Tr> w) {
+            for (dim_t b3 = 0; b3 < A.dims(3); ++b3) {
+                for (dim_t b2 = 0; b2 < A.dims(2); ++b2) {
+                    syevd_func<T, Tr>()(
+                        AF_LAPACK_COL_MAJOR, jobz, uplo, N,
+                        A.get() + b2 * A.strides(2) + b3 * A.strides(3),
+                        A.strides(1),
+                        w.get() + b2 * w.strides(2) + b3 * w.strides(3));
+                }
+            }
+        };
+        getQueue().enqueue(func, A, values);
+        if (want_vectors) { vectors = A; }
+        return;
+    }
+
+    // Only the K largest eigenpairs, selected by index
+    Array<T> Z = createEmptyArray<T>(
+        want_vectors ? dim4(N, K, iDims[2], iDims[3]) : dim4(0));
+    auto func = [=](Param<T> A, Param<Tr> w, Param<T> Z) {
+        std::vector<int> isuppz(2 * K);
+        for (dim_t b3 = 0; b3 < A.dims(3); ++b3) {
+            for (dim_t b2 = 0; b2 < A.dims(2); ++b2) {
+                int found      = 0;
+                const dim_t zo = b2 * Z.strides(2) + b3 * Z.strides(3);
+                T *zPtr        = want_vectors ? Z.get() + zo : nullptr;
+                syevr_func<T, Tr>()(
+                    AF_LAPACK_COL_MAJOR, jobz, 'I', uplo, N,
+                    A.get() + b2 * A.strides(2) + b3 * A.strides(3),
+                    A.strides(1), Tr(0), Tr(0), N - K + 1, N, Tr(0), &found,
+                    w.get() + b2 * w.strides(2) + b3 * w.strides(3), zPtr,
+                    want_vectors ? Z.strides(1) : 1, isuppz.data());
+            }
+        }
+    };
+    getQueue().enqueue(func, A, values, Z);
+    if (want_vectors) { vectors = Z; }
+}
+
+}  // namespace cpu
+}  // namespace arrayfire
+
+#else  // WITH_LINEAR_ALGEBRA
+
+namespace arrayfire {
+namespace cpu {
+
+template<typename T, typename Tr>
+void eigh(Array<Tr> &values, Array<T> &vectors, const Array<T> &in,
+          const unsigned k, const bool is_upper, const bool want_vectors) {
+    AF_ERROR("Linear Algebra is disabled on CPU", AF_ERR_NOT_CONFIGURED);
+}
+
+}  // namespace cpu
+}  // namespace arrayfire
+
+#endif  // WITH_LINEAR_ALGEBRA
+
+namespace arrayfire {
+namespace cpu {
+
+#define INSTANTIATE_EIGH(T, Tr)                                       \
+    template void eigh<T, Tr>(Array<Tr> & values, Array<T> & vectors, \
+                              const Array<T> &in, const unsigned k,   \
+                              const bool is_upper, const bool want_vectors);
+
+INSTANTIATE_EIGH(float, float)
+INSTANTIATE_EIGH(double, double)
+INSTANTIATE_EIGH(cfloat, float)
+INSTANTIATE_EIGH(cdouble, double)
+
+}  // namespace cpu
+}  // namespace arrayfire
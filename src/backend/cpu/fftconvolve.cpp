@@ -12,16 +12,24 @@
 #include <Array.hpp>
 #include <common/dispatch.hpp>
 #include <fftw3.h>
+#include <kernel/channels.hpp>
 #include <kernel/fftconvolve.hpp>
+#include <parallel.hpp>
 #include <queue.hpp>
 #include <af/dim4.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <complex>
 #include <functional>
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 using af::dim4;
+using arrayfire::cpu::kernel::channelOffset;
+using arrayfire::cpu::kernel::channels;
 using std::array;
 using std::ceil;
 
@@ -35,6 +43,296 @@ using reorderFunc = std::function<void(
     const dim4 sig_tmp_strides, const dim4 filter_tmp_dims,
     const dim4 filter_tmp_strides, AF_BATCH_KIND kind)>;
 
+namespace {
+
+template<typename T>
+struct fftw_real;
+
+#define FFTW_REAL(PRE, TY)                                                  \
+    template<>                                                              \
+    struct fftw_real<TY> {                                                  \
+        typedef PRE##_plan plan_t;                                          \
+        typedef PRE##_complex ctype_t;                                      \
+                                                                            \
+        static plan_t forward(int n, TY* in, ctype_t* out) {                \
+            return PRE##_plan_dft_r2c_1d(n, in, out, FFTW_ESTIMATE);        \
+        }                                                                   \
+        static plan_t inverse(int n, ctype_t* in, TY* out) {                \
+            return PRE##_plan_dft_c2r_1d(n, in, out, FFTW_ESTIMATE);        \
+        }                                                                   \
+        static void execute(plan_t plan, TY* in, ctype_t* out) {            \
+            PRE##_execute_dft_r2c(plan, in, out);                           \
+        }                                                                   \
+        static void execute(plan_t plan, ctype_t* in, TY* out) {            \
+            PRE##_execute_dft_c2r(plan, in, out);                           \
+        }                                                                   \
+        static void destroy(plan_t plan) { PRE##_destroy_plan(plan); }      \
+        static void* allocate(size_t bytes) { return PRE##_malloc(bytes); } \
+        static void release(void* ptr) { PRE##_free(ptr); }                 \
+    };
+
+FFTW_REAL(fftwf, float)
+FFTW_REAL(fftw, double)
+
+/// Smallest overlap-save block. Smaller transforms spend more time copying
+/// samples and calling FFTW than transforming.
+constexpr dim_t MinBlockSize = 256;
+
+/// Transform size of the overlap-save blocks for a filter with \p taps
+/// coefficients and \p count outputs per channel.
+///
+/// A block of size n yields n - taps + 1 outputs for one forward and one
+/// inverse transform, so the power of two with the lowest total cost is
+/// taken. Sizes beyond the one that covers all outputs at once only add
+/// work.
+dim_t blockSize(const dim_t taps, const dim_t count) {
+    dim_t size = MinBlockSize;
+    while (size < taps) { size *= 2; }
+
+    dim_t best      = size;
+    double bestCost = -1.0;
+    for (;; size *= 2) {
+        const dim_t blocks = divup(count, size - taps + 1);
+        const double cost  = static_cast<double>(blocks) *
+                            static_cast<double>(size) *
+                            (std::log2(static_cast<double>(size)) + 1.0);
+        if (bestCost < 0.0 || cost < bestCost) {
+            best     = size;
+            bestCost = cost;
+        }
+        if (blocks == 1) { return best; }
+    }
+}
+
+/// Linear convolution of long signals by overlap-save.
+///
+/// Each block transforms \p size input samples, of which the last size -
+/// taps + 1 outputs are free of wrap around. The spectra of the filters are
+/// computed once, with the scale of the inverse transform folded in, and
+/// serve every block of every channel. The plans are shared too and run on
+/// buffers owned by each thread, so memory use does not grow with the
+/// signal.
+template<typename convT>
+class OverlapSave {
+    using traits    = fftw_real<convT>;
+    using complex_t = std::complex<convT>;
+    using buffer    = std::unique_ptr<void, void (*)(void*)>;
+
+    static buffer allocate(const size_t bytes) {
+        return buffer(traits::allocate(bytes), traits::release);
+    }
+
+    const dim_t size;
+    const dim_t taps;
+    const dim_t bins;
+    std::vector<complex_t> spectra;
+    typename traits::plan_t r2cPlan;
+    typename traits::plan_t c2rPlan;
+
+   public:
+    /// Transform buffers of one thread
+    struct Workspace {
+        buffer realBuf;
+        buffer spectrumBuf;
+
+        convT* samples() { return static_cast<convT*>(realBuf.get()); }
+        complex_t* spectrum() {
+            return static_cast<complex_t*>(spectrumBuf.get());
+        }
+        typename traits::ctype_t* raw() {
+            return static_cast<typename traits::ctype_t*>(spectrumBuf.get());
+        }
+    };
+
+    Workspace workspace() const {
+        return Workspace{allocate(sizeof(convT) * size),
+                         allocate(sizeof(complex_t) * bins)};
+    }
+
+    template<typename T>
+    OverlapSave(CParam<T> filter, const dim_t blockLen)
+        : size(blockLen)
+        , taps(filter.dims(0))
+        , bins(blockLen / 2 + 1)
+        , spectra(bins * channels(filter.dims())) {
+        Workspace ws = workspace();
+        r2cPlan      = traits::forward(static_cast<int>(size), ws.samples(),
+                                       ws.raw());
+        c2rPlan      = traits::inverse(static_cast<int>(size), ws.raw(),
+                                       ws.samples());
+
+        const dim4 fdims    = filter.dims();
+        const dim4 fstrides = filter.strides();
+        const convT scale   = convT(1) / static_cast<convT>(size);
+        for (dim_t f = 0; f < channels(fdims); ++f) {
+            const T* src = filter.get() + channelOffset(f, fdims, fstrides);
+            convT* dst   = ws.samples();
+            std::fill(dst, dst + size, convT(0));
+            for (dim_t k = 0; k < taps; ++k) {
+                dst[k] = static_cast<convT>(src[k * fstrides[0]]);
+            }
+            traits::execute(r2cPlan, ws.samples(), ws.raw());
+            std::transform(ws.spectrum(), ws.spectrum() + bins,
+                           spectra.begin() + f * bins,
+                           [scale](const complex_t v) { return v * scale; });
+        }
+    }
+
+    ~OverlapSave() {
+        traits::destroy(r2cPlan);
+        traits::destroy(c2rPlan);
+    }
+
+    OverlapSave(const OverlapSave&)            = delete;
+    OverlapSave& operator=(const OverlapSave&) = delete;
+
+    /// Outputs per block
+    dim_t step() const { return size - taps + 1; }
+
+    /// Convolves \p len samples at \p x with filter \p f and returns the
+    /// outputs from \p first on. The step() outputs stay valid until the next
+    /// call with the same workspace.
+    template<typename T>
+    const convT* block(Workspace& ws, const T* x, const dim_t len,
+                       const dim_t stride, const dim_t f,
+                       const dim_t first) const {
+        // Outputs from first on depend on the inputs from first - taps + 1
+        const dim_t start = first - taps + 1;
+        const dim_t beg   = std::max(start, dim_t(0));
+        const dim_t end   = std::min(start + size, len);
+        convT* buf        = ws.samples();
+        std::fill(buf, buf + size, convT(0));
+        for (dim_t i = beg; i < end; ++i) {
+            buf[i - start] = static_cast<convT>(x[i * stride]);
+        }
+
+        traits::execute(r2cPlan, buf, ws.raw());
+        complex_t* spec        = ws.spectrum();
+        const complex_t* fspec = spectra.data() + f * bins;
+        for (dim_t b = 0; b < bins; ++b) { spec[b] *= fspec[b]; }
+        traits::execute(c2rPlan, ws.raw(), buf);
+
+        return buf + taps - 1;
+    }
+};
+
+/// Runs the blocks of outputs [first, first + count) of every channel of
+/// \p cdims in parallel. store(c, off, values, n) receives the n outputs
+/// from first + off on of channel c.
+template<typename T, typename convT, typename Store>
+void overlapSave(CParam<T> signal, CParam<T> filter, const dim4& cdims,
+                 const dim_t first, const dim_t count, const dim_t size,
+                 Store&& store) {
+    const OverlapSave<convT> conv(filter, size);
+
+    const dim4 sdims    = signal.dims();
+    const dim4 sstrides = signal.strides();
+    const dim_t len     = sdims[0];
+    const dim_t stride  = sstrides[0];
+    const bool shared   = channels(filter.dims()) == 1;
+    const dim_t step    = conv.step();
+    const dim_t nblocks = divup(count, step);
+
+    parallelForChunks(
+        0, channels(cdims) * nblocks, 1, [&](dim_t tbeg, dim_t tend) {
+            auto ws = conv.workspace();
+            for (dim_t t = tbeg; t < tend; ++t) {
+                const dim_t c   = t / nblocks;
+                const dim_t off = (t % nblocks) * step;
+                const T* x = signal.get() + channelOffset(c, sdims, sstrides);
+                const convT* values =
+                    conv.block(ws, x, len, stride, shared ? 0 : c, first + off);
+                store(c, off, values, std::min(step, count - off));
+            }
+        });
+}
+
+template<typename T, typename convT>
+T convertOutput(const convT value) {
+    if constexpr (std::is_integral<T>::value) {
+        return static_cast<T>(std::round(value));
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
+/// One dimensional convolution by overlap-save, with output i of every
+/// channel being output \p first + i of the full convolution
+template<typename T, typename convT>
+void fftconvolveBlocks(Param<T> out, CParam<T> signal, CParam<T> filter,
+                       const dim_t first, const dim_t size) {
+    const dim4 odims    = out.dims();
+    const dim4 ostrides = out.strides();
+    const dim_t stride  = ostrides[0];
+
+    overlapSave<T, convT>(
+        signal, filter, odims, first, odims[0], size,
+        [&](dim_t c, dim_t off, const convT* values, dim_t n) {
+            T* dst = out.get() + channelOffset(c, odims, ostrides);
+            for (dim_t i = 0; i < n; ++i) {
+                dst[(off + i) * stride] = convertOutput<T>(values[i]);
+            }
+        });
+}
+
+/// Streaming convolution. The first len(x) outputs of the full convolution
+/// plus the pending tail \p zi go to \p y, the rest to \p zf.
+template<typename T>
+void fftconvolveStream(Param<T> y, Param<T> zf, CParam<T> signal,
+                       CParam<T> filter, CParam<T> zi, const dim_t size) {
+    const dim4 ydims     = y.dims();
+    const dim4 ystrides  = y.strides();
+    const dim4 zdims     = zi.dims();
+    const dim4 zistrides = zi.strides();
+    const dim4 zfstrides = zf.strides();
+    const dim_t len      = ydims[0];
+    const dim_t pending  = zdims[0];
+    const dim_t ystride  = ystrides[0];
+    const dim_t zistride = zistrides[0];
+    const dim_t zfstride = zfstrides[0];
+
+    overlapSave<T, T>(
+        signal, filter, ydims, 0, len + pending, size,
+        [&](dim_t c, dim_t off, const T* values, dim_t n) {
+            const T* zin = zi.get() + channelOffset(c, zdims, zistrides);
+            T* yout      = y.get() + channelOffset(c, ydims, ystrides);
+            T* zout      = zf.get() + channelOffset(c, zdims, zfstrides);
+            for (dim_t k = 0; k < n; ++k) {
+                const dim_t i = off + k;
+                T v           = values[k];
+                if (i < pending) { v += zin[i * zistride]; }
+                if (i < len) {
+                    yout[i * ystride] = v;
+                } else {
+                    zout[(i - len) * zfstride] = v;
+                }
+            }
+        });
+}
+
+/// Dimensions of the output of fftconvolve
+dim4 outputDims(const dim4& sd, const dim4& fd, const bool expand,
+                AF_BATCH_KIND kind, const int rank) {
+    dim4 oDims(1);
+    if (expand) {
+        for (int d = 0; d < AF_MAX_DIMS; ++d) {
+            if (kind == AF_BATCH_NONE || kind == AF_BATCH_RHS) {
+                oDims[d] = sd[d] + fd[d] - 1;
+            } else {
+                oDims[d] = (d < rank ? sd[d] + fd[d] - 1 : sd[d]);
+            }
+        }
+    } else {
+        oDims = sd;
+        if (kind == AF_BATCH_RHS) {
+            for (int i = rank; i < AF_MAX_DIMS; ++i) { oDims[i] = fd[i]; }
+        }
+    }
+    return oDims;
+}
+
+}  // namespace
+
 template<typename T>
 Array<T> fftconvolve(Array<T> const& signal, Array<T> const& filter,
                      const bool expand, AF_BATCH_KIND kind, const int rank) {
@@ -46,6 +344,22 @@ Array<T> fftconvolve(Array<T> const& signal, Array<T> const& filter,
 
     const dim4& sd = signal.dims();
     const dim4& fd = filter.dims();
+
+    // Signals much longer than the filter are convolved in blocks instead of
+    // through one transform of the padded signal
+    if (rank == 1) {
+        const dim_t first = expand ? 0 : fd[0] / 2;
+        const dim_t count = expand ? sd[0] + fd[0] - 1 : sd[0];
+        const dim_t size  = blockSize(fd[0], count);
+        if (size - fd[0] + 1 < count) {
+            Array<T> out =
+                createEmptyArray<T>(outputDims(sd, fd, expand, kind, rank));
+            getQueue().enqueue(fftconvolveBlocks<T, convT>, out, signal,
+                               filter, first, size);
+            return out;
+        }
+    }
+
     dim_t fftScale = 1;
 
     dim4 packedDims(1, 1, 1, 1);
@@ -164,24 +478,7 @@ Array<T> fftconvolve(Array<T> const& signal, Array<T> const& filter,
     };
     getQueue().enqueue(upstream_idft, packed, fftDims);
 
-    // Compute output dimensions
-    dim4 oDims(1);
-    if (expand) {
-        for (int d = 0; d < AF_MAX_DIMS; ++d) {
-            if (kind == AF_BATCH_NONE || kind == AF_BATCH_RHS) {
-                oDims[d] = sd[d] + fd[d] - 1;
-            } else {
-                oDims[d] = (d < rank ? sd[d] + fd[d] - 1 : sd[d]);
-            }
-        }
-    } else {
-        oDims = sd;
-        if (kind == AF_BATCH_RHS) {
-            for (int i = rank; i < AF_MAX_DIMS; ++i) { oDims[i] = fd[i]; }
-        }
-    }
-
-    Array<T> out = createEmptyArray<T>(oDims);
+    Array<T> out = createEmptyArray<T>(outputDims(sd, fd, expand, kind, rank));
 
     static const reorderFunc<T, convT> funcs[6] = {
         kernel::reorder<T, convT, 1, false>,
@@ -199,6 +496,21 @@ Array<T> fftconvolve(Array<T> const& signal, Array<T> const& filter,
     return out;
 }
 
+template<typename T>
+Array<T> fftconvolve(Array<T>& zf, Array<T> const& signal,
+                     Array<T> const& filter, Array<T> const& zi) {
+    dim4 ydims = zi.dims();
+    ydims[0]   = signal.dims()[0];
+
+    zf         = createEmptyArray<T>(zi.dims());
+    Array<T> y = createEmptyArray<T>(ydims);
+
+    const dim_t size = blockSize(filter.dims()[0], ydims[0] + zi.dims()[0]);
+    getQueue().enqueue(fftconvolveStream<T>, y, zf, signal, filter, zi, size);
+
+    return y;
+}
+
 #define INSTANTIATE(T)                                                 \
     template Array<T> fftconvolve<T>(Array<T> const&, Array<T> const&, \
                                      const bool, AF_BATCH_KIND, const int);
@@ -214,5 +526,12 @@ INSTANTIATE(intl)
 INSTANTIATE(ushort)
 INSTANTIATE(short)
 
+#define INSTANTIATE_STREAM(T)                                          \
+    template Array<T> fftconvolve<T>(Array<T>&, Array<T> const&,       \
+                                     Array<T> const&, Array<T> const&);
+
+INSTANTIATE_STREAM(float)
+INSTANTIATE_STREAM(double)
+
 }  // namespace cpu
 }  // namespace arrayfire
@@ -15,5 +15,13 @@ namespace cpu {
 template<typename T>
 Array<T> fftconvolve(Array<T> const& signal, Array<T> const& filter,
                      const bool expand, AF_BATCH_KIND kind, const int rank);
+
+/// One dimensional convolution of a block of a long signal. \p zi holds the
+/// last len(filter) - 1 outputs of the previous blocks that overlap this
+/// one, with one column per output channel. The outputs of this block that
+/// overlap the next one are returned in \p zf.
+template<typename T>
+Array<T> fftconvolve(Array<T>& zf, Array<T> const& signal,
+                     Array<T> const& filter, Array<T> const& zi);
 }  // namespace cpu
 }  // namespace arrayfire
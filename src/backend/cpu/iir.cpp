@@ -8,13 +8,15 @@
  ********************************************************/
 
 #include <Array.hpp>
-#include <convolve.hpp>
 #include <iir.hpp>
 #include <kernel/iir.hpp>
+#include <math.hpp>
 #include <platform.hpp>
 #include <queue.hpp>
 #include <af/dim4.hpp>
 
+#include <algorithm>
+
 using af::dim4;
 
 namespace arrayfire {
@@ -22,27 +24,57 @@ namespace cpu {
 
 template<typename T>
 Array<T> iir(const Array<T> &b, const Array<T> &a, const Array<T> &x) {
-    AF_BATCH_KIND type = x.ndims() == 1 ? AF_BATCH_NONE : AF_BATCH_SAME;
-    if (x.ndims() != b.ndims()) {
-        type = (x.ndims() < b.ndims()) ? AF_BATCH_RHS : AF_BATCH_LHS;
+    // A vector input is filtered once per column of the coefficients
+    dim4 ydims = x.dims();
+    if (x.ndims() < b.ndims()) {
+        for (int i = 1; i < 4; ++i) { ydims[i] = b.dims()[i]; }
     }
 
-    // Extract the first N elements
-    Array<T> c = convolve<T, T>(x, b, type, 1, true);
-    dim4 cdims = c.dims();
-    cdims[0]   = x.dims()[0];
-    c.resetDims(cdims);
+    const dim_t order = std::max(b.dims()[0], a.dims()[0]) - 1;
+    Array<T> zi =
+        createValueArray<T>(dim4(order, ydims[1], ydims[2], ydims[3]),
+                            scalar<T>(0));
+    Array<T> zf = createEmptyArray<T>(zi.dims());
+    Array<T> y  = createEmptyArray<T>(ydims);
+
+    getQueue().enqueue(kernel::iir<T>, y, zf, b, a, x, zi);
+
+    return y;
+}
+
+template<typename T>
+Array<T> iir(Array<T> &zf, const Array<T> &b, const Array<T> &a,
+             const Array<T> &x, const Array<T> &zi) {
+    dim4 ydims = zi.dims();
+    ydims[0]   = x.dims()[0];
 
-    Array<T> y = createEmptyArray<T>(c.dims());
+    zf         = createEmptyArray<T>(zi.dims());
+    Array<T> y = createEmptyArray<T>(ydims);
+
+    getQueue().enqueue(kernel::iir<T>, y, zf, b, a, x, zi);
+
+    return y;
+}
+
+template<typename T>
+Array<T> iirSos(Array<T> &zf, const Array<T> &sos, const Array<T> &x,
+                const Array<T> &zi) {
+    zf         = createEmptyArray<T>(zi.dims());
+    Array<T> y = createEmptyArray<T>(x.dims());
 
-    getQueue().enqueue(kernel::iir<T>, y, c, a);
+    getQueue().enqueue(kernel::iirSos<T>, y, zf, sos, x, zi);
 
     return y;
 }
 
-#define INSTANTIATE(T)                                          \
-    template Array<T> iir(const Array<T> &b, const Array<T> &a, \
-                          const Array<T> &x);
+#define INSTANTIATE(T)                                                     \
+    template Array<T> iir(const Array<T> &b, const Array<T> &a,            \
+                          const Array<T> &x);                              \
+    template Array<T> iir(Array<T> &zf, const Array<T> &b,                 \
+                          const Array<T> &a, const Array<T> &x,            \
+                          const Array<T> &zi);                             \
+    template Array<T> iirSos(Array<T> &zf, const Array<T> &sos,            \
+                             const Array<T> &x, const Array<T> &zi);
 
 INSTANTIATE(float)
 INSTANTIATE(double)
@@ -14,5 +14,18 @@ namespace cpu {
 
 template<typename T>
 Array<T> iir(const Array<T> &b, const Array<T> &a, const Array<T> &x);
+
+/// Transposed direct form II filter starting from the states \p zi, which
+/// has one column of max(len(b), len(a)) - 1 states per output channel. The
+/// states after the last sample are returned in \p zf.
+template<typename T>
+Array<T> iir(Array<T> &zf, const Array<T> &b, const Array<T> &a,
+             const Array<T> &x, const Array<T> &zi);
+
+/// Cascade of the second order sections in the columns of \p sos. \p zi
+/// and \p zf hold the two states of every section, in section order.
+template<typename T>
+Array<T> iirSos(Array<T> &zf, const Array<T> &sos, const Array<T> &x,
+                const Array<T> &zi);
 }  // namespace cpu
 }  // namespace arrayfire
@@ -19,6 +19,7 @@
 #include <cassert>
 
 #include <identity.hpp>
+#include <kernel/batched_linalg.hpp>
 #include <lapack_helper.hpp>
 #include <lu.hpp>
 #include <platform.hpp>
@@ -57,12 +58,24 @@ Array<T> inverse(const Array<T> &in) {
         return solve(in, I);
     }
 
-    Array<T> A       = copyArray<T>(in);
+    Array<T> A = copyArray<T>(in);
+    if (kernel::useBatchedLinAlg(in.dims())) {
+        getQueue().enqueue(kernel::inverseBatched<T>, A);
+        return A;
+    }
+
     Array<int> pivot = lu_inplace<T>(A, false);
 
     auto func = [=](Param<T> A, Param<int> pivot, int M) {
-        getri_func<T>()(AF_LAPACK_COL_MAJOR, M, A.get(), A.strides(1),
-                        pivot.get());
+        for (dim_t w = 0; w < A.dims(3); ++w) {
+            for (dim_t z = 0; z < A.dims(2); ++z) {
+                getri_func<T>()(
+                    AF_LAPACK_COL_MAJOR, M,
+                    A.get() + z * A.strides(2) + w * A.strides(3),
+                    A.strides(1),
+                    pivot.get() + z * pivot.strides(2) + w * pivot.strides(3));
+            }
+        }
     };
     getQueue().enqueue(func, A, pivot, M);
 
@@ -8,6 +8,7 @@
  ********************************************************/
 
 #pragma once
+#include <common/ObjectPool.hpp>
 #include <common/defines.hpp>
 #include <common/half.hpp>
 #include <common/jit/Node.hpp>
@@ -52,6 +53,15 @@ class TNode : public common::Node {
     }
 
     virtual ~TNode() = default;
+
+    // Nodes and their clones are made and dropped for every operation, so
+    // they come from the per thread pool instead of the heap
+    static void *operator new(size_t bytes) {
+        return common::BlockPool::allocate(bytes);
+    }
+    static void operator delete(void *ptr, size_t bytes) noexcept {
+        common::BlockPool::release(ptr, bytes);
+    }
 };
 
 }  // namespace cpu
@@ -9,6 +9,7 @@
 
 #pragma once
 #include <optypes.hpp>
+#include <cstring>
 #include <vector>
 #include "Node.hpp"
 
@@ -26,6 +27,15 @@ class ScalarNode : public TNode<T> {
         return std::make_unique<ScalarNode>(*this);
     }
 
+    bool isEquivalent(const common::Node &other) const noexcept final {
+        if (!other.isScalar() || other.getType() != this->getType()) {
+            return false;
+        }
+        const auto &rhs = static_cast<const ScalarNode<T> &>(other);
+        return std::memcmp(this->m_val.data(), rhs.m_val.data(),
+                           sizeof(this->m_val[0])) == 0;
+    }
+
     void genKerName(std::string &kerString,
                     const common::Node_ids &ids) const final {
         UNUSED(kerString);
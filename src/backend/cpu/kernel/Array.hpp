@@ -9,6 +9,9 @@
 
 #pragma once
 #include <Param.hpp>
+#include <common/Logger.hpp>
+#include <common/ObjectPool.hpp>
+#include <common/Profiler.hpp>
 #include <common/jit/ModdimNode.hpp>
 #include <common/jit/Node.hpp>
 #include <common/jit/NodeIterator.hpp>
@@ -16,6 +19,10 @@
 #include <jit/Node.hpp>
 #include <jit/UnaryNode.hpp>
 #include <platform.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace arrayfire {
@@ -23,7 +30,7 @@ namespace cpu {
 namespace kernel {
 
 /// Clones node_index_map and update the child pointers
-std::vector<std::shared_ptr<common::Node>> cloneNodes(
+inline std::vector<std::shared_ptr<common::Node>> cloneNodes(
     const std::vector<common::Node *> &node_index_map,
     const std::vector<common::Node_ids> &ids) {
     using arrayfire::common::Node;
@@ -31,7 +38,12 @@ std::vector<std::shared_ptr<common::Node>> cloneNodes(
     std::vector<std::shared_ptr<Node>> node_clones;
     node_clones.reserve(node_index_map.size());
     transform(begin(node_index_map), end(node_index_map),
-              back_inserter(node_clones), [](Node *n) { return n->clone(); });
+              back_inserter(node_clones), [](Node *n) {
+                  // Keep the control block in the pool along with the clone
+                  return std::shared_ptr<Node>(n->clone().release(),
+                                               std::default_delete<Node>(),
+                                               common::PoolAllocator<Node>());
+              });
 
     for (common::Node_ids id : ids) {
         auto &children = node_clones[id.id]->m_children;
@@ -44,7 +56,7 @@ std::vector<std::shared_ptr<common::Node>> cloneNodes(
 
 /// Sets the shape of the buffer node_index_map under the moddims node to the
 /// new shape
-void propagateModdimsShape(
+inline void propagateModdimsShape(
     std::vector<std::shared_ptr<common::Node>> &node_clones) {
     using arrayfire::common::NodeIterator;
     for (auto &node : node_clones) {
@@ -66,7 +78,7 @@ void propagateModdimsShape(
 }
 
 /// Removes node_index_map whos operation matchs a unary operation \p op.
-void removeNodeOfOperation(
+inline void removeNodeOfOperation(
     std::vector<std::shared_ptr<common::Node>> &node_index_map, af_op_t op) {
     using arrayfire::common::Node;
 
@@ -90,11 +102,108 @@ void removeNodeOfOperation(
                          end(node_index_map));
 }
 
+inline spdlog::logger *getLogger() noexcept {
+    static std::shared_ptr<spdlog::logger> logger =
+        common::loggerFactory("jit");
+    return logger.get();
+}
+
+/// Merges the nodes of \p node_clones that compute the same values, such as
+/// the two copies of x - m in (x - m) * (x - m), so they are computed once.
+///
+/// Nodes are equal when they have the same children and Node::isEquivalent
+/// holds. The clones must be in the order of evaluation, children first.
+/// The pointers in \p outputs are updated to the nodes that are kept. The
+/// removed nodes are added to getJitMergedNodes().
+///
+/// \returns the number of nodes removed
+template<typename NodeT>
+int mergeCommonNodes(std::vector<std::shared_ptr<common::Node>> &node_clones,
+                     std::vector<NodeT *> &outputs) {
+    using common::Node;
+
+    const auto childHash = [](const Node &node) {
+        std::hash<const void *> ptr_hash;
+        size_t h = std::hash<int>()(node.getOp()) ^
+                   (std::hash<int>()(node.getType()) << 1);
+        for (int i = 0; i < Node::kMaxChildren && node.m_children[i]; i++) {
+            h = h * 31 + ptr_hash(node.m_children[i].get());
+        }
+        return h;
+    };
+
+    std::unordered_map<const Node *, std::shared_ptr<Node>> replaced;
+    std::unordered_multimap<size_t, std::shared_ptr<Node>> kept;
+    for (auto &node : node_clones) {
+        // Point the children to the nodes that replaced them
+        for (int i = 0; i < Node::kMaxChildren && node->m_children[i]; i++) {
+            auto it = replaced.find(node->m_children[i].get());
+            if (it != replaced.end()) { node->m_children[i] = it->second; }
+        }
+        if (node->isBuffer()) { continue; }
+
+        const size_t h = childHash(*node);
+        auto range     = kept.equal_range(h);
+        auto match     = std::find_if(range.first, range.second, [&](auto &k) {
+            return k.second->m_children == node->m_children &&
+                   node->isEquivalent(*k.second);
+        });
+        if (match != range.second) {
+            replaced[node.get()] = match->second;
+        } else {
+            kept.emplace(h, node);
+        }
+    }
+    if (replaced.empty()) { return 0; }
+
+    for (auto &out : outputs) {
+        auto it = replaced.find(out);
+        if (it != replaced.end()) {
+            out = static_cast<NodeT *>(it->second.get());
+        }
+    }
+
+    node_clones.erase(
+        std::remove_if(begin(node_clones), end(node_clones),
+                       [&](const std::shared_ptr<Node> &node) {
+                           return replaced.count(node.get()) > 0;
+                       }),
+        end(node_clones));
+
+    AF_TRACE("Merged {} of {} JIT nodes", replaced.size(),
+             node_clones.size() + replaced.size());
+    getJitMergedNodes() += replaced.size();
+    return static_cast<int>(replaced.size());
+}
+
+/// Returns the cloned version of \p output_node located in the node_clones
+/// array. If the output node is a moddim node, then it returns its first
+/// non-moddim node child
+inline common::Node *getClonedOutputNode(
+    common::Node_map_t &node_index_map,
+    const std::vector<std::shared_ptr<common::Node>> &node_clones,
+    const common::Node_ptr &output_node) {
+    common::Node *ptr;
+    if (output_node->getOp() == af_moddims_t) {
+        // if the output node is a moddims node, then set the output node
+        // to be the child of the moddims node. This is necessary because
+        // we remove the moddim node_index_map from the tree later
+        int child_index = node_index_map[output_node->m_children[0].get()];
+        ptr             = node_clones[child_index].get();
+        while (ptr->getOp() == af_moddims_t) {
+            ptr = ptr->m_children[0].get();
+        }
+    } else {
+        int node_index = node_index_map[output_node.get()];
+        ptr            = node_clones[node_index].get();
+    }
+    return ptr;
+}
+
 /// Returns the cloned output_nodes located in the node_clones array
 ///
 /// This function returns the new cloned version of the output_nodes_ from
-/// the node_clones array. If the output node is a moddim node, then it will
-/// set the output node to be its first non-moddim node child
+/// the node_clones array. See getClonedOutputNode.
 template<typename T>
 std::vector<TNode<T> *> getClonedOutputNodes(
     common::Node_map_t &node_index_map,
@@ -103,25 +212,60 @@ std::vector<TNode<T> *> getClonedOutputNodes(
     std::vector<TNode<T> *> cloned_output_nodes;
     cloned_output_nodes.reserve(output_nodes_.size());
     for (auto &n : output_nodes_) {
-        TNode<T> *ptr;
-        if (n->getOp() == af_moddims_t) {
-            // if the output node is a moddims node, then set the output node
-            // to be the child of the moddims node. This is necessary because
-            // we remove the moddim node_index_map from the tree later
-            int child_index = node_index_map[n->m_children[0].get()];
-            ptr = static_cast<TNode<T> *>(node_clones[child_index].get());
-            while (ptr->getOp() == af_moddims_t) {
-                ptr = static_cast<TNode<T> *>(ptr->m_children[0].get());
-            }
-        } else {
-            int node_index = node_index_map[n.get()];
-            ptr = static_cast<TNode<T> *>(node_clones[node_index].get());
-        }
-        cloned_output_nodes.push_back(ptr);
+        cloned_output_nodes.push_back(static_cast<TNode<T> *>(
+            getClonedOutputNode(node_index_map, node_clones, n)));
     }
     return cloned_output_nodes;
 }
 
+/// Evaluates a JIT tree one block of at most jit::VECTOR_LENGTH values at a
+/// time, for kernels that consume the values of an unevaluated array without
+/// writing them to memory first.
+///
+/// The tree is cloned, so the evaluator does not modify the nodes of the
+/// array and can be used from the worker thread.
+template<typename T>
+class NodeEvaluator {
+    std::vector<std::shared_ptr<common::Node>> node_clones;
+    TNode<T> *output;
+    bool is_linear;
+
+   public:
+    NodeEvaluator(const common::Node_ptr &node, const af::dim4 &dims) {
+        common::Node_map_t node_index_map;
+        std::vector<common::Node *> full_nodes;
+        std::vector<common::Node_ids> ids;
+        node->getNodesMap(node_index_map, full_nodes, ids);
+
+        node_clones = cloneNodes(full_nodes, ids);
+        std::vector<TNode<T> *> outputs =
+            getClonedOutputNodes<T>(node_index_map, node_clones, {node});
+        propagateModdimsShape(node_clones);
+        removeNodeOfOperation(node_clones, af_moddims_t);
+        mergeCommonNodes(node_clones, outputs);
+        output = outputs[0];
+
+        is_linear = true;
+        for (auto &n : node_clones) { is_linear &= n->isLinear(dims.get()); }
+    }
+
+    /// True when the values can be fetched with the linear calc()
+    bool isLinear() const { return is_linear; }
+
+    /// Values x to x + lim - 1 of the column (y, z, w)
+    const compute_t<T> *calc(int x, int y, int z, int w, int lim) {
+        for (auto &n : node_clones) { n->calc(x, y, z, w, lim); }
+        return output->m_val.data();
+    }
+
+    /// Values idx to idx + lim - 1 in column major order. Only valid when
+    /// isLinear() is true.
+    const compute_t<T> *calc(int idx, int lim) {
+        for (auto &n : node_clones) { n->calc(idx, lim); }
+        return output->m_val.data();
+    }
+};
+
 template<typename T>
 void evalMultiple(std::vector<Param<T>> arrays,
                   std::vector<common::Node_ptr> output_nodes_) {
@@ -130,6 +274,7 @@ void evalMultiple(std::vector<Param<T>> arrays,
     using arrayfire::common::Node_map_t;
     using arrayfire::common::NodeIterator;
 
+    common::ProfileScope profile("eval", "jit");
     af::dim4 odims = arrays[0].dims();
     af::dim4 ostrs = arrays[0].strides();
 
@@ -150,6 +295,9 @@ void evalMultiple(std::vector<Param<T>> arrays,
         getClonedOutputNodes<T>(node_index_map, node_clones, output_nodes_);
     propagateModdimsShape(node_clones);
     removeNodeOfOperation(node_clones, af_moddims_t);
+    profile.arg("merged", mergeCommonNodes(node_clones, cloned_output_nodes));
+    profile.arg("nodes", full_nodes.size());
+    profile.arg("evaluated", node_clones.size());
 
     bool is_linear = true;
     for (auto &node : node_clones) { is_linear &= node->isLinear(odims.get()); }
@@ -204,6 +352,161 @@ void evalMultiple(std::vector<Param<T>> arrays,
     }
 }
 
+/// One output of a fused evaluation of arrays with different types and
+/// shapes. Only store() knows the type of the output.
+class JitOutput {
+   public:
+    common::Node_ptr node;
+    af::dim4 dims;
+    af::dim4 strides;
+
+    JitOutput(common::Node_ptr node_, const af::dim4 &dims_,
+              const af::dim4 &strides_)
+        : node(std::move(node_)), dims(dims_), strides(strides_) {}
+    virtual ~JitOutput() = default;
+
+    /// Copies the first \p lim values of the evaluated clone \p n of the
+    /// output node to the elements starting at \p offset
+    virtual void store(const common::Node *n, dim_t offset, int lim) = 0;
+};
+
+template<typename T>
+class TypedJitOutput final : public JitOutput {
+    std::shared_ptr<T> data;
+
+   public:
+    TypedJitOutput(common::Node_ptr node_, const af::dim4 &dims_,
+                   const af::dim4 &strides_, std::shared_ptr<T> data_)
+        : JitOutput(std::move(node_), dims_, strides_)
+        , data(std::move(data_)) {}
+
+    void store(const common::Node *n, dim_t offset, int lim) final {
+        const auto &val = static_cast<const TNode<T> *>(n)->m_val;
+        std::copy(val.begin(), val.begin() + lim, data.get() + offset);
+    }
+};
+
+/// Evaluates the trees of all \p outputs in one pass, so sub-trees and
+/// buffers they share are computed and read once.
+///
+/// The outputs may have different types and shapes. The pass covers the
+/// largest extent along every dimension, and at every position only the
+/// nodes needed by the outputs which contain that position are computed.
+inline void evalJitOutputs(std::vector<std::shared_ptr<JitOutput>> outputs) {
+    common::ProfileScope profile("eval", "jit");
+    common::Node_map_t node_index_map;
+    std::vector<common::Node *> full_nodes;
+    std::vector<common::Node_ids> ids;
+    for (auto &out : outputs) {
+        out->node->getNodesMap(node_index_map, full_nodes, ids);
+    }
+    auto node_clones = cloneNodes(full_nodes, ids);
+
+    std::vector<const common::Node *> out_nodes;
+    out_nodes.reserve(outputs.size());
+    for (auto &out : outputs) {
+        out_nodes.push_back(
+            getClonedOutputNode(node_index_map, node_clones, out->node));
+    }
+    propagateModdimsShape(node_clones);
+    removeNodeOfOperation(node_clones, af_moddims_t);
+    profile.arg("merged", mergeCommonNodes(node_clones, out_nodes));
+    profile.arg("nodes", full_nodes.size());
+    profile.arg("evaluated", node_clones.size());
+
+    const int num_nodes   = static_cast<int>(node_clones.size());
+    const int num_outputs = static_cast<int>(outputs.size());
+
+    af::dim4 dims(0, 0, 0, 0);
+    bool same_dims = true;
+    for (auto &out : outputs) {
+        for (int d = 0; d < AF_MAX_DIMS; d++) {
+            dims[d] = std::max(dims[d], out->dims[d]);
+        }
+        same_dims &= out->dims == outputs[0]->dims;
+    }
+
+    bool is_linear = same_dims;
+    for (auto &node : node_clones) { is_linear &= node->isLinear(dims.get()); }
+
+    if (is_linear) {
+        int num = static_cast<int>(dims.elements());
+        for (int i = 0; i < num; i += jit::VECTOR_LENGTH) {
+            int lim = std::min(jit::VECTOR_LENGTH, num - i);
+            for (int n = 0; n < num_nodes; n++) {
+                node_clones[n]->calc(i, lim);
+            }
+            for (int o = 0; o < num_outputs; o++) {
+                outputs[o]->store(out_nodes[o], i, lim);
+            }
+        }
+        return;
+    }
+
+    // The nodes each output depends on. The clones are in the order of
+    // evaluation, children first.
+    std::unordered_map<const common::Node *, int> node_ids;
+    for (int n = 0; n < num_nodes; n++) { node_ids[node_clones[n].get()] = n; }
+    std::vector<std::vector<char>> depends(num_outputs,
+                                           std::vector<char>(num_nodes, 0));
+    for (int o = 0; o < num_outputs; o++) {
+        std::vector<const common::Node *> stack = {out_nodes[o]};
+        while (!stack.empty()) {
+            const common::Node *node = stack.back();
+            stack.pop_back();
+            char &seen = depends[o][node_ids[node]];
+            if (seen) { continue; }
+            seen = 1;
+            for (int i = 0; i < common::Node::kMaxChildren &&
+                            node->m_children[i] != nullptr;
+                 i++) {
+                stack.push_back(node->m_children[i].get());
+            }
+        }
+    }
+
+    std::vector<char> active(num_outputs), last_active;
+    std::vector<char> needed(num_nodes);
+    for (int w = 0; w < (int)dims[3]; w++) {
+        for (int z = 0; z < (int)dims[2]; z++) {
+            for (int y = 0; y < (int)dims[1]; y++) {
+                for (int x = 0; x < (int)dims[0]; x += jit::VECTOR_LENGTH) {
+                    int lim = std::min(jit::VECTOR_LENGTH, (int)dims[0] - x);
+
+                    for (int o = 0; o < num_outputs; o++) {
+                        const af::dim4 &odims = outputs[o]->dims;
+                        active[o] = x < odims[0] && y < odims[1] &&
+                                    z < odims[2] && w < odims[3];
+                    }
+                    if (active != last_active) {
+                        std::fill(needed.begin(), needed.end(), 0);
+                        for (int o = 0; o < num_outputs; o++) {
+                            if (!active[o]) { continue; }
+                            for (int n = 0; n < num_nodes; n++) {
+                                needed[n] |= depends[o][n];
+                            }
+                        }
+                        last_active = active;
+                    }
+
+                    for (int n = 0; n < num_nodes; n++) {
+                        if (!needed[n]) { continue; }
+                        node_clones[n]->calc(x, y, z, w, lim);
+                    }
+                    for (int o = 0; o < num_outputs; o++) {
+                        if (!active[o]) { continue; }
+                        const JitOutput &out = *outputs[o];
+                        dim_t id = x + y * out.strides[1] + z * out.strides[2] +
+                                   w * out.strides[3];
+                        int olim = std::min(lim, (int)out.dims[0] - x);
+                        outputs[o]->store(out_nodes[o], id, olim);
+                    }
+                }
+            }
+        }
+    }
+}
+
 }  // namespace kernel
 }  // namespace cpu
 }  // namespace arrayfire
@@ -10,11 +10,14 @@
 #pragma once
 
 #include <Array.hpp>
+#include <common/dispatch.hpp>
 #include <math.hpp>
+#include <parallel.hpp>
 
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 using std::exp;
 using std::pow;
@@ -132,59 +135,223 @@ float computeCurvatureBasedUpdate(const float mct, const float NW,
     return sqrt(prop_grad) * delta;
 }
 
+/// Lines along dimension 1 updated by one task of a diffusion sweep
+constexpr dim_t DiffusionBandLines = 32;
+
+/// One 2D slice of a diffusion buffer, lines along dimension 0 are contiguous
+template<typename T>
+struct DiffusionImage {
+    T *ptr;
+    dim_t lineStride;
+
+    T *line(const dim_t j) const { return ptr + j * lineStride; }
+};
+
+/// Updates the interior of line \p j of \p dst from the 3x3 neighbourhoods
+/// in \p src
 template<typename T, bool isMCDE>
-void anisotropicDiffusion(Param<T> inout, const float dt, const float mct,
-                          const af_flux_function fftype) {
-    const auto dims     = inout.dims();
-    const auto strides  = inout.strides();
-    const auto d1stride = strides[1];
-    const int d0        = dims[0] - 1;
-    const int d1        = dims[1] - 1;
-    const int d2        = dims[2];
-    const int d3        = dims[3];
-
-    for (int b3 = 0; b3 < d3; ++b3) {
-        for (int b2 = 0; b2 < d2; ++b2) {
-            T* img = inout.get() + b2 * strides[2] + b3 * strides[3];
-            for (int j = 1; j < d1; ++j) {
-                for (int i = 1; i < d0; ++i) {
-                    float C     = 0.f;
-                    float delta = 0.f;
-
-                    const int ip1 = i + 1;
-                    const int im1 = i - 1;
-                    const int jp1 = j + 1;
-                    const int jm1 = j - 1;
-
-                    if (isMCDE) {
-                        delta = computeCurvatureBasedUpdate(
-                            mct, img[index(im1, jm1, d1stride)],
-                            img[index(i, jm1, d1stride)],
-                            img[index(ip1, jm1, d1stride)],
-                            img[index(im1, j, d1stride)],
-                            C = img[index(i, j, d1stride)],
-                            img[index(ip1, j, d1stride)],
-                            img[index(im1, jp1, d1stride)],
-                            img[index(i, jp1, d1stride)],
-                            img[index(ip1, jp1, d1stride)]);
-
-                    } else {
-                        delta = computeGradientBasedUpdate(
-                            mct, img[index(im1, jm1, d1stride)],
-                            img[index(i, jm1, d1stride)],
-                            img[index(ip1, jm1, d1stride)],
-                            img[index(im1, j, d1stride)],
-                            C = img[index(i, j, d1stride)],
-                            img[index(ip1, j, d1stride)],
-                            img[index(im1, jp1, d1stride)],
-                            img[index(i, jp1, d1stride)],
-                            img[index(ip1, jp1, d1stride)], fftype);
-                    }
-
-                    img[i + j * d1stride] = (T)(C + delta * dt);
+void diffusionLine(const DiffusionImage<T> &dst, const DiffusionImage<T> &src,
+                   const dim_t j, const dim_t d0, const float dt,
+                   const float mct, const af_flux_function fftype) {
+    const T *north  = src.line(j - 1);
+    const T *center = src.line(j);
+    const T *south  = src.line(j + 1);
+    T *out          = dst.line(j);
+
+    for (dim_t i = 1; i < d0 - 1; ++i) {
+        const float C = center[i];
+        float delta   = 0.f;
+        if (isMCDE) {
+            delta = computeCurvatureBasedUpdate(
+                mct, north[i - 1], north[i], north[i + 1], center[i - 1], C,
+                center[i + 1], south[i - 1], south[i], south[i + 1]);
+        } else {
+            delta = computeGradientBasedUpdate(
+                mct, north[i - 1], north[i], north[i + 1], center[i - 1], C,
+                center[i + 1], south[i - 1], south[i], south[i + 1], fftype);
+        }
+        out[i] = (T)(C + delta * dt);
+    }
+}
+
+/// Sum of the squared gradient magnitudes of line \p j, using the same
+/// differences as gradient()
+template<typename T>
+double gradientEnergy(const DiffusionImage<T> &img, const dim_t j,
+                      const dim_t d0, const dim_t d1) {
+    const T *center = img.line(j);
+    const T *next   = img.line(j == d1 - 1 ? j : j + 1);
+    const T *prev   = img.line(j == 0 ? j : j - 1);
+    const T f1      = (j == 0 || j == d1 - 1) ? T(1) : T(0.5);
+
+    const auto energy = [&](const dim_t i, const T g0) {
+        const T g1 = f1 * (next[i] - prev[i]);
+        return g0 * g0 + g1 * g1;
+    };
+
+    if (d0 == 1) { return energy(0, T(0)); }
+
+    double sum = energy(0, center[1] - center[0]);
+    for (dim_t i = 1; i < d0 - 1; ++i) {
+        sum += energy(i, T(0.5) * (center[i + 1] - center[i - 1]));
+    }
+    sum += energy(d0 - 1, center[d0 - 1] - center[d0 - 2]);
+    return sum;
+}
+
+/// Runs one explicit diffusion step from \p src into \p dst, which must
+/// hold the same border values as \p src.
+///
+/// The slices are split into bands of lines that are updated in parallel.
+/// When \p energy is not null it receives the gradient energy of \p dst,
+/// which is accumulated while the band is still in cache. Only the lines at
+/// the edges of the bands need a second, short pass.
+template<typename T, bool isMCDE>
+void diffusionSweep(const std::vector<DiffusionImage<T>> &dst,
+                    const std::vector<DiffusionImage<T>> &src,
+                    const dim_t d0, const dim_t d1, const float dt,
+                    const float mct, const af_flux_function fftype,
+                    double *energy) {
+    const dim_t nbands = divup(d1, DiffusionBandLines);
+    const dim_t ntasks = static_cast<dim_t>(dst.size()) * nbands;
+
+    std::vector<double> partial(energy ? ntasks : 0, 0.0);
+
+    const auto bandOf = [&](const dim_t t, dim_t &r0, dim_t &r1) {
+        r0 = (t % nbands) * DiffusionBandLines;
+        r1 = std::min(r0 + DiffusionBandLines, d1);
+    };
+    // Lines whose gradient depends on a line of the neighbouring band
+    const auto isBandEdge = [&](const dim_t j, const dim_t r0,
+                                const dim_t r1) {
+        return (j == r0 && r0 > 0) || (j == r1 - 1 && r1 < d1);
+    };
+
+    parallelFor(ntasks, [&](dim_t t) {
+        const DiffusionImage<T> &out = dst[t / nbands];
+        dim_t r0, r1;
+        bandOf(t, r0, r1);
+
+        const dim_t j1 = std::min(r1, d1 - 1);
+        for (dim_t j = std::max(r0, dim_t(1)); j < j1; ++j) {
+            diffusionLine<T, isMCDE>(out, src[t / nbands], j, d0, dt, mct,
+                                     fftype);
+        }
+
+        if (energy) {
+            for (dim_t j = r0; j < r1; ++j) {
+                if (!isBandEdge(j, r0, r1)) {
+                    partial[t] += gradientEnergy(out, j, d0, d1);
                 }
             }
         }
+    });
+
+    if (energy) {
+        parallelFor(ntasks, [&](dim_t t) {
+            dim_t r0, r1;
+            bandOf(t, r0, r1);
+            if (isBandEdge(r0, r0, r1)) {
+                partial[t] += gradientEnergy(dst[t / nbands], r0, d0, d1);
+            }
+            if (r1 - 1 != r0 && isBandEdge(r1 - 1, r0, r1)) {
+                partial[t] += gradientEnergy(dst[t / nbands], r1 - 1, d0, d1);
+            }
+        });
+
+        // Summed in task order so the result does not depend on the number
+        // of threads
+        *energy = 0.0;
+        for (const double p : partial) { *energy += p; }
+    }
+}
+
+/// Views of every 2D slice of \p inout and of a dense copy of it
+template<typename T>
+void diffusionBuffers(Param<T> inout, std::vector<T> &scratch,
+                      std::vector<DiffusionImage<T>> &images,
+                      std::vector<DiffusionImage<T>> &copies) {
+    const auto dims    = inout.dims();
+    const auto strides = inout.strides();
+    const dim_t plane  = dims[0] * dims[1];
+
+    scratch.resize(plane * dims[2] * dims[3]);
+    for (dim_t b3 = 0; b3 < dims[3]; ++b3) {
+        for (dim_t b2 = 0; b2 < dims[2]; ++b2) {
+            images.push_back(
+                {inout.get() + b2 * strides[2] + b3 * strides[3], strides[1]});
+            copies.push_back(
+                {scratch.data() + (b3 * dims[2] + b2) * plane, dims[0]});
+        }
+    }
+
+    parallelFor(static_cast<dim_t>(images.size()), [&](dim_t img) {
+        for (dim_t j = 0; j < dims[1]; ++j) {
+            std::copy(images[img].line(j), images[img].line(j) + dims[0],
+                      copies[img].line(j));
+        }
+    });
+}
+
+template<typename T, bool isMCDE>
+void anisotropicDiffusion(Param<T> inout, const float dt, const float mct,
+                          const af_flux_function fftype) {
+    const auto dims = inout.dims();
+
+    std::vector<T> scratch;
+    std::vector<DiffusionImage<T>> images, copies;
+    diffusionBuffers(inout, scratch, images, copies);
+
+    diffusionSweep<T, isMCDE>(images, copies, dims[0], dims[1], dt, mct,
+                              fftype, nullptr);
+}
+
+/// Runs all the iterations of the diffusion without leaving the kernel.
+///
+/// Every iteration needs the mean gradient energy of the whole array, which
+/// is computed by the sweep of the previous iteration. Each iteration hence
+/// reads and writes the data once, instead of going through separate
+/// gradient, arithmetic and reduction passes.
+template<typename T, bool isMCDE>
+void anisotropicDiffusionIterate(Param<T> inout, const float dt, const float K,
+                                 const unsigned iterations,
+                                 const af_flux_function fftype) {
+    const auto dims = inout.dims();
+    const dim_t d0  = dims[0];
+    const dim_t d1  = dims[1];
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    const float cnst = -2.0f * K * K / dims.elements();
+
+    std::vector<T> scratch;
+    std::vector<DiffusionImage<T>> images, copies;
+    diffusionBuffers(inout, scratch, images, copies);
+
+    std::vector<double> partial(images.size());
+    parallelFor(static_cast<dim_t>(images.size()), [&](dim_t img) {
+        for (dim_t j = 0; j < d1; ++j) {
+            partial[img] += gradientEnergy(images[img], j, d0, d1);
+        }
+    });
+    double energy = 0.0;
+    for (const double p : partial) { energy += p; }
+
+    for (unsigned it = 0; it < iterations; ++it) {
+        const bool toCopies = (it % 2 == 0);
+        const float mct     = 1.0f / (cnst * static_cast<float>(energy));
+        const bool last     = (it + 1 == iterations);
+
+        diffusionSweep<T, isMCDE>(toCopies ? copies : images,
+                                  toCopies ? images : copies, d0, d1, dt, mct,
+                                  fftype, last ? nullptr : &energy);
+    }
+
+    if (iterations % 2 == 1) {
+        parallelFor(static_cast<dim_t>(images.size()), [&](dim_t img) {
+            for (dim_t j = 1; j < d1 - 1; ++j) {
+                std::copy(copies[img].line(j), copies[img].line(j) + d0,
+                          images[img].line(j));
+            }
+        });
     }
 }
 }  // namespace kernel
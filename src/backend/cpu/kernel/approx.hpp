@@ -10,132 +10,455 @@
 #pragma once
 #include <Param.hpp>
 #include <math.hpp>
+#include <parallel.hpp>
 #include "interp.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace arrayfire {
 namespace cpu {
 namespace kernel {
 
-template<typename InT, typename LocT, int order>
+/// Queries of one column handled by a task of the parallel loops
+constexpr dim_t ApproxBlockSize = 1024;
+
+/// Outputs per chunk of the parallel loops at least, so that small calls
+/// stay on the calling thread
+constexpr dim_t ApproxGrain = 4096;
+
+/// Input offsets and weights of one query along one dimension. Nearest and
+/// lower use one tap, linear two and cubic four. Queries off the grid are
+/// not valid and produce the off grid value.
+template<typename LocT, int Order>
+struct ApproxTap {
+    static constexpr int Taps = Order == 3 ? 4 : Order;
+
+    dim_t offset[Taps];
+    LocT weight[Taps];
+    bool valid;
+};
+
+/// Taps of the query at grid position \p x along a dimension of \p lim
+/// samples, \p stride elements apart. Follows Interp1: nearest rounds, lower
+/// floors, and the linear and cubic taps past the edges repeat the edge
+/// samples.
+template<typename LocT, int Order>
+ApproxTap<LocT, Order> approxTap(const LocT x, const dim_t lim,
+                                 const dim_t stride,
+                                 const af_interp_type method) {
+    ApproxTap<LocT, Order> t{};
+    // Written so that NaN positions are off the grid as well
+    t.valid = x >= 0 && x + 1 <= lim;
+    if (!t.valid) { return t; }
+
+    if constexpr (Order == 1) {
+        const dim_t id = static_cast<dim_t>(
+            method == AF_INTERP_LOWER ? std::floor(x) : std::round(x));
+        t.offset[0] = id * stride;
+        t.weight[0] = LocT(1);
+    } else if constexpr (Order == 2) {
+        const dim_t grid = static_cast<dim_t>(std::floor(x));
+        LocT ratio       = x - grid;
+        if (method == AF_INTERP_LINEAR_COSINE ||
+            method == AF_INTERP_BILINEAR_COSINE) {
+            // Smooth the factional part with cosine
+            ratio = (1 - std::cos(ratio * af::Pi)) / 2;
+        }
+        t.offset[0] = grid * stride;
+        t.offset[1] = std::min(grid + 1, lim - 1) * stride;
+        t.weight[0] = 1 - ratio;
+        t.weight[1] = ratio;
+    } else {
+        const dim_t grid  = static_cast<dim_t>(std::floor(x));
+        const bool spline = method == AF_INTERP_CUBIC_SPLINE ||
+                            method == AF_INTERP_BICUBIC_SPLINE;
+        cubicWeights(t.weight, x - grid, spline);
+        for (int k = 0; k < 4; ++k) {
+            const dim_t id = std::max(grid - 1 + k, dim_t(0));
+            t.offset[k]    = std::min(id, lim - 1) * stride;
+        }
+    }
+    return t;
+}
+
+/// Weighted sum of the taps of \p t, starting from \p in
+template<typename InT, typename LocT, int Order>
+InT approxValue(const InT *in, const ApproxTap<LocT, Order> &t) {
+    if constexpr (Order == 1) {
+        return in[t.offset[0]];
+    } else {
+        using VT = vtype_t<InT>;
+        VT sum   = t.weight[0] * VT(in[t.offset[0]]);
+        for (int k = 1; k < ApproxTap<LocT, Order>::Taps; ++k) {
+            sum += t.weight[k] * VT(in[t.offset[k]]);
+        }
+        return InT(sum);
+    }
+}
+
+/// Separable weighted sum of the taps of \p tx and \p ty, starting from
+/// \p in
+template<typename InT, typename LocT, int Order>
+InT approxValue(const InT *in, const ApproxTap<LocT, Order> &tx,
+                const ApproxTap<LocT, Order> &ty) {
+    if constexpr (Order == 1) {
+        return in[tx.offset[0] + ty.offset[0]];
+    } else {
+        using VT = vtype_t<InT>;
+        VT sum   = ty.weight[0] * VT(approxValue(in + ty.offset[0], tx));
+        for (int k = 1; k < ApproxTap<LocT, Order>::Taps; ++k) {
+            sum += ty.weight[k] * VT(approxValue(in + ty.offset[k], tx));
+        }
+        return InT(sum);
+    }
+}
+
+/// Strides of an array with \p dims, with 0 for the dimensions that have a
+/// single element or are skipped
+inline void batchStrides(dim_t out[4], const af::dim4 &dims,
+                         const af::dim4 &strides, const int skip0 = -1,
+                         const int skip1 = -1) {
+    for (int d = 0; d < 4; ++d) {
+        const bool skipped = d == skip0 || d == skip1 || dims[d] == 1;
+        out[d]             = skipped ? 0 : strides[d];
+    }
+}
+
+/// Interpolates the columns of \p yi along \p xdim at the positions in
+/// \p xo.
+///
+/// The taps of every query are computed once. When all columns share the
+/// positions along dimension 0, they are kept in a table and applied to
+/// every column, and when a column has a single position they are applied
+/// to all of its elements. Blocks of queries of every column run in
+/// parallel.
+template<typename InT, typename LocT, int Order>
 void approx1(Param<InT> yo, CParam<InT> yi, CParam<LocT> xo, const int xdim,
              const LocT &xi_beg, const LocT &xi_step, const float offGrid,
              af_interp_type method) {
+    using Tap = ApproxTap<LocT, Order>;
+
     InT *yo_ptr        = yo.get();
+    const InT *yi_ptr  = yi.get();
     const LocT *xo_ptr = xo.get();
 
-    const af::dim4 yo_dims = yo.dims();
-    const af::dim4 yi_dims = yi.dims();
-    const af::dim4 xo_dims = xo.dims();
-
+    const af::dim4 yo_dims    = yo.dims();
     const af::dim4 yo_strides = yo.strides();
-    const af::dim4 yi_strides = yi.strides();
-    const af::dim4 xo_strides = xo.strides();
-
-    Interp1<InT, LocT, order> interp;
-    bool is_xo_off[] = {xo_dims[0] > 1, xo_dims[1] > 1, xo_dims[2] > 1,
-                        xo_dims[3] > 1};
-    bool is_yi_off[] = {true, true, true, true};
-    is_yi_off[xdim]  = false;
-
-    for (dim_t idw = 0; idw < yo_dims[3]; idw++) {
-        for (dim_t idz = 0; idz < yo_dims[2]; idz++) {
-            dim_t yo_off_zw = idw * yo_strides[3] + idz * yo_strides[2];
-            dim_t yi_off_zw = idw * yi_strides[3] * is_yi_off[3] +
-                              idz * yi_strides[2] * is_yi_off[2];
-            dim_t xo_off_zw = idw * xo_strides[3] * is_xo_off[3] +
-                              idz * xo_strides[2] * is_xo_off[2];
-
-            for (dim_t idy = 0; idy < yo_dims[1]; idy++) {
-                dim_t yo_off = yo_off_zw + idy * yo_strides[1];
-                dim_t yi_off = yi_off_zw + idy * yi_strides[1] * is_yi_off[1];
-                dim_t xo_off = xo_off_zw + idy * xo_strides[1] * is_xo_off[1];
-
-                for (dim_t idx = 0; idx < yo_dims[0]; idx++) {
-                    dim_t yi_idx = idx * is_yi_off[0];
-                    const LocT x =
-                        (xo_ptr[xo_off + idx * is_xo_off[0]] - xi_beg) /
-                        xi_step;
-
-                    // FIXME: Only cubic interpolation is doing clamping
-                    // We need to make it consistent across all methods
-                    // Not changing the behavior because tests will fail
-                    bool clamp = order == 3;
-
-                    if (x < 0 || yi_dims[xdim] < x + 1) {
-                        yo_ptr[yo_off + idx] = scalar<InT>(offGrid);
-                    } else {
-                        interp(yo, yo_off + idx, yi, yi_off + yi_idx, x, method,
-                               1, clamp, xdim);
+
+    dim_t yo_s[4], yi_s[4], xo_s[4];
+    batchStrides(yo_s, yo_dims, yo_strides);
+    batchStrides(yi_s, yi.dims(), yi.strides(), xdim);
+    batchStrides(xo_s, xo.dims(), xo.strides());
+
+    const dim_t n0       = yo_dims[0];
+    const dim_t d1       = yo_dims[1];
+    const dim_t d12      = yo_dims[1] * yo_dims[2];
+    const dim_t ncols    = d12 * yo_dims[3];
+    const dim_t lim      = yi.dims(xdim);
+    const dim_t stride   = yi.strides(xdim);
+    const InT offValue   = scalar<InT>(offGrid);
+    const dim_t nblocks  = (n0 + ApproxBlockSize - 1) / ApproxBlockSize;
+    const dim_t taskSize = std::max<dim_t>(1, std::min(n0, ApproxBlockSize));
+
+    auto tapAt = [&](const LocT pos) {
+        return approxTap<LocT, Order>((pos - xi_beg) / xi_step, lim, stride,
+                                      method);
+    };
+
+    std::vector<Tap> shared;
+    if (xdim == 0 && ncols > 1 && xo_s[1] == 0 && xo_s[2] == 0 &&
+        xo_s[3] == 0) {
+        shared.resize(n0);
+        parallelForChunks(0, n0, ApproxGrain, [&](dim_t beg, dim_t end) {
+            for (dim_t i = beg; i < end; ++i) {
+                shared[i] = tapAt(xo_ptr[i * xo_s[0]]);
+            }
+        });
+    }
+
+    const dim_t grain = std::max<dim_t>(1, ApproxGrain / taskSize);
+    parallelForChunks(0, ncols * nblocks, grain, [&](dim_t beg, dim_t end) {
+        for (dim_t task = beg; task < end; ++task) {
+            const dim_t col = task / nblocks;
+            const dim_t ib  = (task % nblocks) * ApproxBlockSize;
+            const dim_t ie  = std::min(ib + ApproxBlockSize, n0);
+            const dim_t c1  = col % d1;
+            const dim_t c2  = (col % d12) / d1;
+            const dim_t c3  = col / d12;
+
+            InT *dst = yo_ptr + c1 * yo_s[1] + c2 * yo_s[2] + c3 * yo_s[3];
+            const InT *src =
+                yi_ptr + c1 * yi_s[1] + c2 * yi_s[2] + c3 * yi_s[3];
+            const LocT *pos =
+                xo_ptr + c1 * xo_s[1] + c2 * xo_s[2] + c3 * xo_s[3];
+
+            if (!shared.empty()) {
+                for (dim_t i = ib; i < ie; ++i) {
+                    const Tap &t = shared[i];
+                    dst[i * yo_s[0]] =
+                        t.valid ? approxValue(src, t) : offValue;
+                }
+            } else if (xo_s[0] == 0) {
+                // One position for the whole column, the taps only move
+                // along dimension 0 with the input
+                const Tap t = tapAt(pos[0]);
+                if (!t.valid) {
+                    for (dim_t i = ib; i < ie; ++i) {
+                        dst[i * yo_s[0]] = offValue;
                     }
+                    continue;
+                }
+                for (dim_t i = ib; i < ie; ++i) {
+                    dst[i * yo_s[0]] = approxValue(src + i * yi_s[0], t);
+                }
+            } else {
+                for (dim_t i = ib; i < ie; ++i) {
+                    const Tap t = tapAt(pos[i * xo_s[0]]);
+                    dst[i * yo_s[0]] =
+                        t.valid ? approxValue(src + i * yi_s[0], t) : offValue;
                 }
             }
         }
-    }
+    });
 }
 
-template<typename InT, typename LocT, int order>
+/// Interpolates the planes of \p zi along \p xdim and \p ydim at the
+/// positions in \p xo and \p yo, in the same way as approx1. The taps of
+/// positions shared by all planes of dimensions 2 and 3 are computed once.
+template<typename InT, typename LocT, int Order>
 void approx2(Param<InT> zo, CParam<InT> zi, CParam<LocT> xo, const int xdim,
              const LocT &xi_beg, const LocT &xi_step, CParam<LocT> yo,
              const int ydim, const LocT &yi_beg, const LocT &yi_step,
              float const offGrid, af_interp_type method) {
+    using Tap = ApproxTap<LocT, Order>;
+
     InT *zo_ptr        = zo.get();
+    const InT *zi_ptr  = zi.get();
     const LocT *xo_ptr = xo.get();
     const LocT *yo_ptr = yo.get();
 
-    af::dim4 const zo_dims    = zo.dims();
-    af::dim4 const zi_dims    = zi.dims();
-    af::dim4 const xo_dims    = xo.dims();
-    af::dim4 const zo_strides = zo.strides();
-    af::dim4 const zi_strides = zi.strides();
-    af::dim4 const xo_strides = xo.strides();
-    af::dim4 const yo_strides = yo.strides();
-
-    Interp2<InT, LocT, order> interp;
-    bool is_xo_off[] = {xo_dims[0] > 1, xo_dims[1] > 1, xo_dims[2] > 1,
-                        xo_dims[3] > 1};
-    bool is_zi_off[] = {true, true, true, true};
-    is_zi_off[xdim]  = false;
-    is_zi_off[ydim]  = false;
-
-    for (dim_t idw = 0; idw < zo_dims[3]; idw++) {
-        for (dim_t idz = 0; idz < zo_dims[2]; idz++) {
-            dim_t zo_off_zw = idw * zo_strides[3] + idz * zo_strides[2];
-            dim_t zi_off_zw = idw * zi_strides[3] * is_zi_off[3] +
-                              idz * zi_strides[2] * is_zi_off[2];
-            dim_t xo_off_zw = idw * xo_strides[3] * is_xo_off[3] +
-                              idz * xo_strides[2] * is_xo_off[2];
-            dim_t yo_off_zw = idw * yo_strides[3] * is_xo_off[3] +
-                              idz * yo_strides[2] * is_xo_off[2];
-
-            for (dim_t idy = 0; idy < zo_dims[1]; idy++) {
-                dim_t xo_off = xo_off_zw + idy * xo_strides[1] * is_xo_off[1];
-                dim_t yo_off = yo_off_zw + idy * yo_strides[1] * is_xo_off[1];
-                dim_t zi_off = zi_off_zw + idy * zi_strides[1] * is_zi_off[1];
-                dim_t zo_off = zo_off_zw + idy * zo_strides[1];
-
-                for (dim_t idx = 0; idx < zo_dims[0]; idx++) {
-                    const LocT x = (xo_ptr[xo_off + idx] - xi_beg) / xi_step;
-                    const LocT y = (yo_ptr[yo_off + idx] - yi_beg) / yi_step;
-
-                    dim_t zi_idx = idx * zi_strides[0] * is_zi_off[0];
-
-                    // FIXME: Only cubic interpolation is doing clamping
-                    // We need to make it consistent across all methods
-                    // Not changing the behavior because tests will fail
-                    bool clamp = order == 3;
-
-                    if (x < 0 || zi_dims[xdim] < x + 1 || y < 0 ||
-                        zi_dims[ydim] < y + 1) {
-                        zo_ptr[zo_off + idx] = scalar<InT>(offGrid);
-                    } else {
-                        interp(zo, zo_off + idx, zi, zi_off + zi_idx, x, y,
-                               method, 1, clamp, xdim, ydim);
-                    }
+    const af::dim4 zo_dims = zo.dims();
+
+    // The positions have the same dimensions, and views of them may still
+    // have different strides
+    dim_t zo_s[4], zi_s[4], xo_s[4], yo_s[4];
+    batchStrides(zo_s, zo_dims, zo.strides());
+    batchStrides(zi_s, zi.dims(), zi.strides(), xdim, ydim);
+    batchStrides(xo_s, xo.dims(), xo.strides());
+    batchStrides(yo_s, yo.dims(), yo.strides());
+
+    const dim_t n0       = zo_dims[0];
+    const dim_t d1       = zo_dims[1];
+    const dim_t d12      = zo_dims[1] * zo_dims[2];
+    const dim_t ncols    = d12 * zo_dims[3];
+    const dim_t xlim     = zi.dims(xdim);
+    const dim_t ylim     = zi.dims(ydim);
+    const dim_t xstride  = zi.strides(xdim);
+    const dim_t ystride  = zi.strides(ydim);
+    const InT offValue   = scalar<InT>(offGrid);
+    const dim_t nblocks  = (n0 + ApproxBlockSize - 1) / ApproxBlockSize;
+    const dim_t taskSize = std::max<dim_t>(1, std::min(n0, ApproxBlockSize));
+
+    auto tapsAt = [&](const dim_t xoff, const dim_t yoff, Tap &tx, Tap &ty) {
+        tx = approxTap<LocT, Order>((xo_ptr[xoff] - xi_beg) / xi_step, xlim,
+                                    xstride, method);
+        ty = approxTap<LocT, Order>((yo_ptr[yoff] - yi_beg) / yi_step, ylim,
+                                    ystride, method);
+    };
+
+    // Positions that only vary along the first two dimensions are shared by
+    // the planes of the other two
+    std::vector<Tap> sharedX, sharedY;
+    if (ncols > d1 && xo_s[2] == 0 && xo_s[3] == 0) {
+        sharedX.resize(n0 * d1);
+        sharedY.resize(n0 * d1);
+        parallelForChunks(0, d1, 1, [&](dim_t beg, dim_t end) {
+            for (dim_t c1 = beg; c1 < end; ++c1) {
+                for (dim_t i = 0; i < n0; ++i) {
+                    tapsAt(c1 * xo_s[1] + i * xo_s[0],
+                           c1 * yo_s[1] + i * yo_s[0], sharedX[c1 * n0 + i],
+                           sharedY[c1 * n0 + i]);
                 }
             }
-        }
+        });
     }
+
+    const dim_t grain = std::max<dim_t>(1, ApproxGrain / taskSize);
+    parallelForChunks(0, ncols * nblocks, grain, [&](dim_t beg, dim_t end) {
+        for (dim_t task = beg; task < end; ++task) {
+            const dim_t col = task / nblocks;
+            const dim_t ib  = (task % nblocks) * ApproxBlockSize;
+            const dim_t ie  = std::min(ib + ApproxBlockSize, n0);
+            const dim_t c1  = col % d1;
+            const dim_t c2  = (col % d12) / d1;
+            const dim_t c3  = col / d12;
+
+            InT *dst = zo_ptr + c1 * zo_s[1] + c2 * zo_s[2] + c3 * zo_s[3];
+            const InT *src =
+                zi_ptr + c1 * zi_s[1] + c2 * zi_s[2] + c3 * zi_s[3];
+
+            if (!sharedX.empty()) {
+                const Tap *tx = sharedX.data() + c1 * n0;
+                const Tap *ty = sharedY.data() + c1 * n0;
+                for (dim_t i = ib; i < ie; ++i) {
+                    dst[i * zo_s[0]] =
+                        tx[i].valid && ty[i].valid
+                            ? approxValue(src + i * zi_s[0], tx[i], ty[i])
+                            : offValue;
+                }
+                continue;
+            }
+
+            const dim_t xoff = c1 * xo_s[1] + c2 * xo_s[2] + c3 * xo_s[3];
+            const dim_t yoff = c1 * yo_s[1] + c2 * yo_s[2] + c3 * yo_s[3];
+            for (dim_t i = ib; i < ie; ++i) {
+                Tap tx, ty;
+                tapsAt(xoff + i * xo_s[0], yoff + i * yo_s[0], tx, ty);
+                dst[i * zo_s[0]] =
+                    tx.valid && ty.valid
+                        ? approxValue(src + i * zi_s[0], tx, ty)
+                        : offValue;
+            }
+        }
+    });
+}
+
+/// Coefficients of the polynomials that approx1 evaluates along dimension 0
+/// of \p in with the linear or cubic \p method. The polynomial of the
+/// interval from sample i to i + 1 takes the fraction t in [0, 1) and its
+/// coefficients, from the constant term up, are rows 4 * i to 4 * i + 3 of
+/// \p coeffs. The last interval holds the last sample.
+template<typename T>
+void approx1Prepare(Param<T> coeffs, CParam<T> in,
+                    const af_interp_type method) {
+    using VT = vtype_t<T>;
+
+    const af::dim4 dims = in.dims();
+    const dim_t n       = dims[0];
+    const dim_t d1      = dims[1];
+    const dim_t d12     = dims[1] * dims[2];
+    const dim_t ncols   = d12 * dims[3];
+    const dim_t is0     = in.strides(0);
+
+    dim_t in_s[4], co_s[4];
+    batchStrides(in_s, dims, in.strides());
+    batchStrides(co_s, coeffs.dims(), coeffs.strides());
+
+    const bool spline = method == AF_INTERP_CUBIC_SPLINE;
+    const VT half     = scalar<VT>(0.5);
+
+    const dim_t grain = std::max<dim_t>(1, ApproxGrain / std::max<dim_t>(n, 1));
+    parallelForChunks(0, ncols, grain, [&](dim_t beg, dim_t end) {
+        for (dim_t col = beg; col < end; ++col) {
+            const dim_t c1 = col % d1;
+            const dim_t c2 = (col % d12) / d1;
+            const dim_t c3 = col / d12;
+
+            const T *src =
+                in.get() + c1 * in_s[1] + c2 * in_s[2] + c3 * in_s[3];
+            T *dst = coeffs.get() + c1 * co_s[1] + c2 * co_s[2] +
+                     c3 * co_s[3];
+
+            auto at = [&](const dim_t i) {
+                return VT(src[std::min(std::max(i, dim_t(0)), n - 1) * is0]);
+            };
+
+            for (dim_t i = 0; i < n; ++i) {
+                const VT v0 = at(i - 1);
+                const VT v1 = at(i);
+                const VT v2 = at(i + 1);
+                const VT v3 = at(i + 2);
+
+                VT c[4];
+                if (method == AF_INTERP_LINEAR) {
+                    c[0] = v1;
+                    c[1] = v2 - v1;
+                    c[2] = scalar<VT>(0);
+                    c[3] = scalar<VT>(0);
+                } else if (spline) {
+                    c[0] = v1;
+                    c[1] = half * (v2 - v0);
+                    c[2] = v0 - scalar<VT>(2.5) * v1 + scalar<VT>(2) * v2 -
+                           half * v3;
+                    c[3] = half * (v3 - v0) + scalar<VT>(1.5) * (v1 - v2);
+                } else {
+                    c[3] = v3 - v2 - v0 + v1;
+                    c[2] = v0 - v1 - c[3];
+                    c[1] = v2 - v0;
+                    c[0] = v1;
+                }
+                for (int k = 0; k < 4; ++k) {
+                    dst[(4 * i + k) * co_s[0]] = c[k];
+                }
+            }
+        }
+    });
+}
+
+/// Evaluates the polynomials from approx1Prepare at the positions in
+/// \p xo, which are shared by all columns or hold one column per column of
+/// \p yo. Positions off the grid give \p offGrid, as in approx1.
+template<typename T, typename LocT>
+void approx1Prepared(Param<T> yo, CParam<T> coeffs, CParam<LocT> xo,
+                     const LocT xi_beg, const LocT xi_step,
+                     const float offGrid) {
+    using VT = vtype_t<T>;
+
+    const af::dim4 yo_dims = yo.dims();
+
+    dim_t yo_s[4], co_s[4], xo_s[4];
+    batchStrides(yo_s, yo_dims, yo.strides());
+    batchStrides(co_s, coeffs.dims(), coeffs.strides());
+    batchStrides(xo_s, xo.dims(), xo.strides());
+
+    const dim_t n0       = yo_dims[0];
+    const dim_t d1       = yo_dims[1];
+    const dim_t d12      = yo_dims[1] * yo_dims[2];
+    const dim_t ncols    = d12 * yo_dims[3];
+    const dim_t lim      = coeffs.dims(0) / 4;
+    const dim_t cs0      = coeffs.strides(0);
+    const T offValue     = scalar<T>(offGrid);
+    const dim_t nblocks  = (n0 + ApproxBlockSize - 1) / ApproxBlockSize;
+    const dim_t taskSize = std::max<dim_t>(1, std::min(n0, ApproxBlockSize));
+
+    const dim_t grain = std::max<dim_t>(1, ApproxGrain / taskSize);
+    parallelForChunks(0, ncols * nblocks, grain, [&](dim_t beg, dim_t end) {
+        for (dim_t task = beg; task < end; ++task) {
+            const dim_t col = task / nblocks;
+            const dim_t ib  = (task % nblocks) * ApproxBlockSize;
+            const dim_t ie  = std::min(ib + ApproxBlockSize, n0);
+            const dim_t c1  = col % d1;
+            const dim_t c2  = (col % d12) / d1;
+            const dim_t c3  = col / d12;
+
+            T *dst = yo.get() + c1 * yo_s[1] + c2 * yo_s[2] + c3 * yo_s[3];
+            const T *src = coeffs.get() + c1 * co_s[1] + c2 * co_s[2] +
+                           c3 * co_s[3];
+            const LocT *pos =
+                xo.get() + c1 * xo_s[1] + c2 * xo_s[2] + c3 * xo_s[3];
+
+            for (dim_t i = ib; i < ie; ++i) {
+                const LocT x = (pos[i * xo_s[0]] - xi_beg) / xi_step;
+                if (!(x >= 0 && x + 1 <= lim)) {
+                    dst[i * yo_s[0]] = offValue;
+                    continue;
+                }
+                const dim_t grid = static_cast<dim_t>(std::floor(x));
+                const LocT t     = x - grid;
+                const T *c       = src + 4 * grid * cs0;
+
+                VT value = VT(c[3 * cs0]);
+                value    = value * t + VT(c[2 * cs0]);
+                value    = value * t + VT(c[cs0]);
+                value    = value * t + VT(c[0]);
+                dst[i * yo_s[0]] = T(value);
+            }
+        }
+    });
 }
+
 }  // namespace kernel
 }  // namespace cpu
 }  // namespace arrayfire
@@ -0,0 +1,861 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+#include <Param.hpp>
+#include <common/dispatch.hpp>
+#include <parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace arrayfire {
+namespace cpu {
+namespace kernel {
+
+/// Largest matrix dimension handled by the batched kernels. Batches of
+/// larger matrices are handed to LAPACK one matrix at a time.
+constexpr dim_t BatchedLinAlgMaxSize = 64;
+
+/// Returns true if \p dims describes more than one matrix and the matrices
+/// are small enough for the batched kernels
+inline bool useBatchedLinAlg(const af::dim4 &dims) {
+    return dims[2] * dims[3] > 1 &&
+           std::max(dims[0], dims[1]) <= BatchedLinAlgMaxSize;
+}
+
+/// Number of matrices factorized together by the batched kernels.
+///
+/// The elements of these matrices are interleaved, element (i, j) of lane l
+/// is stored at ((j * rows + i) * lanes + l). The innermost loops of the
+/// kernels run over the lanes, so they vectorize even though every matrix
+/// picks its own pivots.
+template<typename T>
+constexpr int batchLanes() {
+    return sizeof(T) >= 32 ? 1 : static_cast<int>(32 / sizeof(T));
+}
+
+template<typename T>
+struct LinAlgTraits {
+    using base = T;
+    static T conj(const T v) { return v; }
+    static base real(const T v) { return v; }
+    static base imag(const T) { return base(0); }
+    static base abs2(const T v) { return v * v; }
+    // Pivot magnitude used by LAPACK's i?amax
+    static base pivotMag(const T v) { return std::abs(v); }
+};
+
+template<typename T>
+struct LinAlgTraits<std::complex<T>> {
+    using base = T;
+    static std::complex<T> conj(const std::complex<T> v) {
+        return std::conj(v);
+    }
+    static base real(const std::complex<T> v) { return v.real(); }
+    static base imag(const std::complex<T> v) { return v.imag(); }
+    static base abs2(const std::complex<T> v) { return std::norm(v); }
+    static base pivotMag(const std::complex<T> v) {
+        return std::abs(v.real()) + std::abs(v.imag());
+    }
+};
+
+/// Calls \p func with a std::integral_constant holding \p n for the sizes
+/// that get fully unrolled kernels, and holding 0 for all other sizes
+template<typename Func>
+void dispatchMatrixSize(const int n, Func &&func) {
+    switch (n) {
+        case 2: func(std::integral_constant<int, 2>{}); break;
+        case 3: func(std::integral_constant<int, 3>{}); break;
+        case 4: func(std::integral_constant<int, 4>{}); break;
+        case 6: func(std::integral_constant<int, 6>{}); break;
+        case 8: func(std::integral_constant<int, 8>{}); break;
+        default: func(std::integral_constant<int, 0>{}); break;
+    }
+}
+
+/// Offset of matrix \p b of a batch along dimensions 2 and 3
+inline dim_t batchOffset(const dim_t b, const af::dim4 &dims,
+                         const af::dim4 &strides) {
+    return (b % dims[2]) * strides[2] + (b / dims[2]) * strides[3];
+}
+
+/// Copies the top left \p rows x \p cols block of the matrices [b, b + count)
+/// into lanes. Unused lanes repeat the last matrix. With \p conjTrans the
+/// conjugate transpose of the block is stored instead.
+template<typename T>
+void gatherLanes(T *lanes, const T *base, const af::dim4 &dims,
+                 const af::dim4 &strides, const dim_t b, const int count,
+                 const int rows, const int cols, const bool conjTrans = false) {
+    constexpr int L = batchLanes<T>();
+    const T *src[L];
+    for (int l = 0; l < L; ++l) {
+        src[l] = base + batchOffset(b + std::min(l, count - 1), dims, strides);
+    }
+    const dim_t si = conjTrans ? strides[1] : 1;
+    const dim_t sj = conjTrans ? 1 : strides[1];
+    for (int j = 0; j < cols; ++j) {
+        for (int i = 0; i < rows; ++i) {
+            const dim_t off = i * si + j * sj;
+            T *dst          = lanes + (j * rows + i) * L;
+            for (int l = 0; l < L; ++l) { dst[l] = src[l][off]; }
+            if (conjTrans) {
+                for (int l = 0; l < L; ++l) {
+                    dst[l] = LinAlgTraits<T>::conj(dst[l]);
+                }
+            }
+        }
+    }
+}
+
+/// Inverse of gatherLanes for the first \p count lanes. With \p lowerOnly
+/// only the lower triangle of the lanes is stored.
+template<typename T>
+void scatterLanes(T *base, const T *lanes, const af::dim4 &dims,
+                  const af::dim4 &strides, const dim_t b, const int count,
+                  const int rows, const int cols, const bool conjTrans = false,
+                  const bool lowerOnly = false) {
+    constexpr int L = batchLanes<T>();
+    T *dst[L];
+    for (int l = 0; l < count; ++l) {
+        dst[l] = base + batchOffset(b + l, dims, strides);
+    }
+    const dim_t si = conjTrans ? strides[1] : 1;
+    const dim_t sj = conjTrans ? 1 : strides[1];
+    for (int j = 0; j < cols; ++j) {
+        for (int i = lowerOnly ? j : 0; i < rows; ++i) {
+            const dim_t off = i * si + j * sj;
+            const T *src    = lanes + (j * rows + i) * L;
+            for (int l = 0; l < count; ++l) {
+                dst[l][off] =
+                    conjTrans ? LinAlgTraits<T>::conj(src[l]) : src[l];
+            }
+        }
+    }
+}
+
+/// LU factorization with partial pivoting of an m x n matrix per lane, like
+/// getrf. Pivots are 1 based and stored as ipiv[k * lanes + l].
+template<typename T, int Size>
+void luLanes(T *a, int *ipiv, int *info, int m, int n) {
+    using Tr        = LinAlgTraits<T>;
+    using B         = typename Tr::base;
+    constexpr int L = batchLanes<T>();
+    if (Size > 0) {
+        m = Size;
+        n = Size;
+    }
+    const auto at = [&](const int i, const int j) {
+        return a + (j * m + i) * L;
+    };
+
+    for (int l = 0; l < L; ++l) { info[l] = 0; }
+
+    const int k = std::min(m, n);
+    for (int c = 0; c < k; ++c) {
+        int piv[L];
+        B best[L];
+        for (int l = 0; l < L; ++l) {
+            piv[l]  = c;
+            best[l] = Tr::pivotMag(at(c, c)[l]);
+        }
+        for (int i = c + 1; i < m; ++i) {
+            const T *v = at(i, c);
+            for (int l = 0; l < L; ++l) {
+                const B mag       = Tr::pivotMag(v[l]);
+                const bool better = mag > best[l];
+                best[l]           = better ? mag : best[l];
+                piv[l]            = better ? i : piv[l];
+            }
+        }
+
+        for (int l = 0; l < L; ++l) {
+            ipiv[c * L + l] = piv[l] + 1;
+            if (piv[l] != c) {
+                for (int j = 0; j < n; ++j) {
+                    std::swap(at(c, j)[l], at(piv[l], j)[l]);
+                }
+            }
+        }
+
+        // A zero pivot means the rest of the column is zero as well, it is
+        // left as is and reported like getrf does
+        T inv[L];
+        for (int l = 0; l < L; ++l) {
+            const T p = at(c, c)[l];
+            if (p == T(0) && info[l] == 0) { info[l] = c + 1; }
+            inv[l] = (p == T(0)) ? T(1) : T(1) / p;
+        }
+        for (int i = c + 1; i < m; ++i) {
+            T *v = at(i, c);
+            for (int l = 0; l < L; ++l) { v[l] *= inv[l]; }
+        }
+
+        for (int j = c + 1; j < n; ++j) {
+            const T *u = at(c, j);
+            for (int i = c + 1; i < m; ++i) {
+                const T *lc = at(i, c);
+                T *v        = at(i, j);
+                for (int l = 0; l < L; ++l) { v[l] -= lc[l] * u[l]; }
+            }
+        }
+    }
+}
+
+/// Solves A X = B per lane from the factorization of luLanes, like getrs.
+/// \p b holds n x nrhs matrices.
+template<typename T, int Size>
+void luSolveLanes(const T *a, const int *ipiv, T *b, int n, const int nrhs) {
+    constexpr int L = batchLanes<T>();
+    if (Size > 0) { n = Size; }
+    const auto A = [&](const int i, const int j) {
+        return a + (j * n + i) * L;
+    };
+    const auto X = [&](const int i, const int j) {
+        return b + (j * n + i) * L;
+    };
+
+    for (int c = 0; c < n; ++c) {
+        for (int l = 0; l < L; ++l) {
+            const int p = ipiv[c * L + l] - 1;
+            if (p != c) {
+                for (int r = 0; r < nrhs; ++r) {
+                    std::swap(X(c, r)[l], X(p, r)[l]);
+                }
+            }
+        }
+    }
+
+    for (int r = 0; r < nrhs; ++r) {
+        for (int c = 0; c < n; ++c) {
+            const T *x = X(c, r);
+            for (int i = c + 1; i < n; ++i) {
+                const T *lc = A(i, c);
+                T *y        = X(i, r);
+                for (int l = 0; l < L; ++l) { y[l] -= lc[l] * x[l]; }
+            }
+        }
+        for (int c = n - 1; c >= 0; --c) {
+            T *x       = X(c, r);
+            const T *d = A(c, c);
+            for (int l = 0; l < L; ++l) { x[l] /= d[l]; }
+            for (int i = 0; i < c; ++i) {
+                const T *uc = A(i, c);
+                T *y        = X(i, r);
+                for (int l = 0; l < L; ++l) { y[l] -= uc[l] * x[l]; }
+            }
+        }
+    }
+}
+
+/// Cholesky factorization A = L L^H of the lower triangle per lane, like
+/// potrf. \p info is set to the order of the first minor that is not
+/// positive definite. The factorization of that lane is not completed.
+template<typename T, int Size>
+void choleskyLanes(T *a, int *info, int n) {
+    using Tr        = LinAlgTraits<T>;
+    using B         = typename Tr::base;
+    constexpr int L = batchLanes<T>();
+    if (Size > 0) { n = Size; }
+    const auto at = [&](const int i, const int j) {
+        return a + (j * n + i) * L;
+    };
+
+    for (int l = 0; l < L; ++l) { info[l] = 0; }
+
+    for (int c = 0; c < n; ++c) {
+        B inv[L];
+        T *d = at(c, c);
+        for (int l = 0; l < L; ++l) {
+            const B v     = Tr::real(d[l]);
+            const bool ok = (info[l] == 0) && v > B(0);
+            if (!ok && info[l] == 0) { info[l] = c + 1; }
+            const B s = ok ? std::sqrt(v) : B(1);
+            d[l]      = ok ? T(s) : d[l];
+            inv[l]    = B(1) / s;
+        }
+        for (int i = c + 1; i < n; ++i) {
+            T *v = at(i, c);
+            for (int l = 0; l < L; ++l) { v[l] *= inv[l]; }
+        }
+
+        for (int j = c + 1; j < n; ++j) {
+            const T *lj = at(j, c);
+            for (int i = j; i < n; ++i) {
+                const T *li = at(i, c);
+                T *v        = at(i, j);
+                for (int l = 0; l < L; ++l) {
+                    v[l] -= li[l] * Tr::conj(lj[l]);
+                }
+            }
+        }
+    }
+}
+
+/// Householder QR factorization of an m x n matrix per lane, like geqrf.
+/// The reflectors are stored below the diagonal and their scalar factors in
+/// tau[k * lanes + l].
+template<typename T, int Size>
+void qrLanes(T *a, T *tau, int m, int n) {
+    using Tr        = LinAlgTraits<T>;
+    using B         = typename Tr::base;
+    constexpr int L = batchLanes<T>();
+    if (Size > 0) {
+        m = Size;
+        n = Size;
+    }
+    const auto at = [&](const int i, const int j) {
+        return a + (j * m + i) * L;
+    };
+
+    const int k = std::min(m, n);
+    for (int c = 0; c < k; ++c) {
+        B xnorm2[L] = {};
+        for (int i = c + 1; i < m; ++i) {
+            const T *v = at(i, c);
+            for (int l = 0; l < L; ++l) { xnorm2[l] += Tr::abs2(v[l]); }
+        }
+
+        T scale[L];
+        T *t = tau + c * L;
+        for (int l = 0; l < L; ++l) {
+            const T alpha = at(c, c)[l];
+            const B ar    = Tr::real(alpha);
+            const B ai    = Tr::imag(alpha);
+            if (xnorm2[l] == B(0) && ai == B(0)) {
+                t[l]     = T(0);
+                scale[l] = T(1);
+            } else {
+                const B norm = std::sqrt(ar * ar + ai * ai + xnorm2[l]);
+                const B beta = -std::copysign(norm, ar);
+                t[l]         = (T(beta) - alpha) / T(beta);
+                scale[l]     = T(1) / (alpha - T(beta));
+                at(c, c)[l]  = T(beta);
+            }
+        }
+        for (int i = c + 1; i < m; ++i) {
+            T *v = at(i, c);
+            for (int l = 0; l < L; ++l) { v[l] *= scale[l]; }
+        }
+
+        // Apply H^H = I - conj(tau) v v^H to the trailing columns
+        for (int j = c + 1; j < n; ++j) {
+            T w[L];
+            T *top = at(c, j);
+            for (int l = 0; l < L; ++l) { w[l] = top[l]; }
+            for (int i = c + 1; i < m; ++i) {
+                const T *v = at(i, c);
+                const T *x = at(i, j);
+                for (int l = 0; l < L; ++l) { w[l] += Tr::conj(v[l]) * x[l]; }
+            }
+            for (int l = 0; l < L; ++l) {
+                w[l] *= Tr::conj(t[l]);
+                top[l] -= w[l];
+            }
+            for (int i = c + 1; i < m; ++i) {
+                const T *v = at(i, c);
+                T *x       = at(i, j);
+                for (int l = 0; l < L; ++l) { x[l] -= v[l] * w[l]; }
+            }
+        }
+    }
+}
+
+/// Forms the m x m matrix Q from the first \p k reflectors of qrLanes in
+/// place, like orgqr. \p v is scratch space for m x k lanes.
+template<typename T, int Size>
+void qrFormQLanes(T *q, const T *tau, T *v, int m, const int k) {
+    using Tr        = LinAlgTraits<T>;
+    constexpr int L = batchLanes<T>();
+    if (Size > 0) { m = Size; }
+    const auto Q = [&](const int i, const int j) {
+        return q + (j * m + i) * L;
+    };
+    const auto V = [&](const int i, const int j) {
+        return v + (j * m + i) * L;
+    };
+
+    std::copy(q, q + m * k * L, v);
+    for (int j = 0; j < m; ++j) {
+        for (int i = 0; i < m; ++i) {
+            T *e = Q(i, j);
+            for (int l = 0; l < L; ++l) { e[l] = (i == j) ? T(1) : T(0); }
+        }
+    }
+
+    // Q = H(0) H(1) ... H(k-1), accumulated from the last reflector. Columns
+    // before c are still unit vectors that H(c) does not change.
+    for (int c = k - 1; c >= 0; --c) {
+        const T *t = tau + c * L;
+        for (int j = c; j < m; ++j) {
+            T w[L];
+            T *top = Q(c, j);
+            for (int l = 0; l < L; ++l) { w[l] = top[l]; }
+            for (int i = c + 1; i < m; ++i) {
+                const T *vi = V(i, c);
+                const T *x  = Q(i, j);
+                for (int l = 0; l < L; ++l) { w[l] += Tr::conj(vi[l]) * x[l]; }
+            }
+            for (int l = 0; l < L; ++l) {
+                w[l] *= t[l];
+                top[l] -= w[l];
+            }
+            for (int i = c + 1; i < m; ++i) {
+                const T *vi = V(i, c);
+                T *x        = Q(i, j);
+                for (int l = 0; l < L; ++l) { x[l] -= vi[l] * w[l]; }
+            }
+        }
+    }
+}
+
+/// One sided Jacobi SVD of a p x q matrix per lane, p >= q. The columns of
+/// \p w are rotated until they are orthogonal and \p v accumulates the
+/// rotations, so that A V = W. Lanes that converge early keep getting
+/// identity rotations until all lanes of the block have converged.
+template<typename T, int Size>
+void jacobiSvdLanes(T *w, T *v, int p, int q) {
+    using Tr        = LinAlgTraits<T>;
+    using B         = typename Tr::base;
+    constexpr int L = batchLanes<T>();
+    if (Size > 0) {
+        p = Size;
+        q = Size;
+    }
+    const auto W = [&](const int i, const int j) {
+        return w + (j * p + i) * L;
+    };
+    const auto V = [&](const int i, const int j) {
+        return v + (j * q + i) * L;
+    };
+
+    for (int j = 0; j < q; ++j) {
+        for (int i = 0; i < q; ++i) {
+            std::fill_n(V(i, j), L, (i == j) ? T(1) : T(0));
+        }
+    }
+
+    // Same sweep limit and threshold scaling as LAPACK's gesvj
+    constexpr int maxSweeps = 30;
+    const B tol = std::sqrt(B(p)) * std::numeric_limits<B>::epsilon();
+
+    const auto rotate = [&](T *x, T *y, const B *c, const B *s, const T *ph) {
+        for (int l = 0; l < L; ++l) {
+            const T a = x[l];
+            const T b = y[l] * ph[l];
+            x[l]      = c[l] * a - s[l] * b;
+            y[l]      = s[l] * a + c[l] * b;
+        }
+    };
+
+    for (int sweep = 0; sweep < maxSweeps; ++sweep) {
+        bool rotated = false;
+        for (int ci = 0; ci < q - 1; ++ci) {
+            for (int cj = ci + 1; cj < q; ++cj) {
+                B alpha[L] = {};
+                B beta[L]  = {};
+                T gamma[L] = {};
+                for (int i = 0; i < p; ++i) {
+                    const T *a = W(i, ci);
+                    const T *b = W(i, cj);
+                    for (int l = 0; l < L; ++l) {
+                        alpha[l] += Tr::abs2(a[l]);
+                        beta[l] += Tr::abs2(b[l]);
+                        gamma[l] += Tr::conj(a[l]) * b[l];
+                    }
+                }
+
+                // Column j is first multiplied by the phase of gamma, which
+                // leaves a real rotation
+                B c[L], s[L];
+                T ph[L];
+                bool any = false;
+                for (int l = 0; l < L; ++l) {
+                    const B g    = std::abs(gamma[l]);
+                    const bool r = g > tol * std::sqrt(alpha[l] * beta[l]);
+                    const B gs   = r ? g : B(1);
+                    const B z    = (beta[l] - alpha[l]) / (2 * gs);
+                    const B t    = std::copysign(B(1), z) /
+                                (std::abs(z) + std::sqrt(1 + z * z));
+                    const B cs   = 1 / std::sqrt(1 + t * t);
+                    c[l]         = r ? cs : B(1);
+                    s[l]         = r ? cs * t : B(0);
+                    ph[l]        = r ? Tr::conj(gamma[l]) / gs : T(1);
+                    any          = any || r;
+                }
+                if (!any) { continue; }
+                rotated = true;
+
+                for (int i = 0; i < p; ++i) {
+                    rotate(W(i, ci), W(i, cj), c, s, ph);
+                }
+                for (int i = 0; i < q; ++i) {
+                    rotate(V(i, ci), V(i, cj), c, s, ph);
+                }
+            }
+        }
+        if (!rotated) { break; }
+    }
+}
+
+/// Extracts the SVD of lane \p l from jacobiSvdLanes. The singular values
+/// are sorted in descending order, \p u receives the p x p left singular
+/// vectors and \p vs the q x q right singular vectors, both contiguous.
+/// Left singular vectors of (numerically) zero singular values and the
+/// p - q missing ones are completed to an orthonormal basis.
+template<typename T>
+void jacobiSvdExtract(typename LinAlgTraits<T>::base *sv, T *u, T *vs,
+                      const T *w, const T *v, const int l, const int p,
+                      const int q) {
+    using Tr        = LinAlgTraits<T>;
+    using B         = typename Tr::base;
+    constexpr int L = batchLanes<T>();
+    const auto W    = [&](const int i, const int j) {
+        return w[(j * p + i) * L + l];
+    };
+
+    std::vector<B> norms(q);
+    for (int j = 0; j < q; ++j) {
+        B n2 = 0;
+        for (int i = 0; i < p; ++i) { n2 += Tr::abs2(W(i, j)); }
+        norms[j] = std::sqrt(n2);
+    }
+    std::vector<int> order(q);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return norms[a] > norms[b]; });
+
+    const B largest = (q > 0 && norms[order[0]] > 0) ? norms[order[0]] : B(1);
+    const B cutoff  = largest * p * std::numeric_limits<B>::epsilon();
+
+    std::vector<char> present(p, 0);
+    std::vector<B> rowNorm2(p, B(0));
+    for (int r = 0; r < q; ++r) {
+        const int j = order[r];
+        sv[r]       = norms[j];
+        for (int i = 0; i < q; ++i) { vs[r * q + i] = v[(j * q + i) * L + l]; }
+        if (norms[j] > cutoff) {
+            for (int i = 0; i < p; ++i) {
+                u[r * p + i] = W(i, j) / norms[j];
+                rowNorm2[i] += Tr::abs2(u[r * p + i]);
+            }
+            present[r] = 1;
+        }
+    }
+
+    // Each missing column starts from the unit vector least covered by the
+    // columns so far and is orthogonalized against them twice
+    std::vector<T> x(p);
+    for (int r = 0; r < p; ++r) {
+        if (present[r]) { continue; }
+        const int k = static_cast<int>(
+            std::min_element(rowNorm2.begin(), rowNorm2.end()) -
+            rowNorm2.begin());
+        std::fill(x.begin(), x.end(), T(0));
+        x[k] = T(1);
+        for (int pass = 0; pass < 2; ++pass) {
+            for (int c = 0; c < p; ++c) {
+                if (!present[c]) { continue; }
+                T dot = 0;
+                for (int i = 0; i < p; ++i) {
+                    dot += Tr::conj(u[c * p + i]) * x[i];
+                }
+                for (int i = 0; i < p; ++i) { x[i] -= dot * u[c * p + i]; }
+            }
+        }
+        B n2 = 0;
+        for (int i = 0; i < p; ++i) { n2 += Tr::abs2(x[i]); }
+        const B inv = 1 / std::sqrt(n2);
+        for (int i = 0; i < p; ++i) {
+            u[r * p + i] = x[i] * inv;
+            rowNorm2[i] += Tr::abs2(u[r * p + i]);
+        }
+        present[r] = 1;
+    }
+}
+
+/// Runs \p func(b, count, bufs) over the blocks of batchLanes matrices of a
+/// batch in parallel. Every chunk of blocks gets \p nbuf scratch buffers of
+/// \p bufSize lanes each.
+template<typename T, typename Func>
+void forEachLaneBlock(const dim_t nbatch, const int nbuf, const dim_t bufSize,
+                      Func &&func) {
+    constexpr int L     = batchLanes<T>();
+    const dim_t nblocks = divup(nbatch, L);
+    parallelForChunks(0, nblocks, 16, [&](dim_t cbeg, dim_t cend) {
+        std::vector<std::vector<T>> bufs(nbuf, std::vector<T>(bufSize * L));
+        for (dim_t blk = cbeg; blk < cend; ++blk) {
+            const dim_t b   = blk * L;
+            const int count = static_cast<int>(std::min<dim_t>(L, nbatch - b));
+            func(b, count, bufs);
+        }
+    });
+}
+
+/// Batched getrf. \p pivot receives the 1 based pivots of every matrix.
+template<typename T>
+void luBatched(Param<T> a, Param<int> pivot) {
+    constexpr int L     = batchLanes<T>();
+    const af::dim4 dims = a.dims();
+    const int m         = dims[0];
+    const int n         = dims[1];
+    const int k         = std::min(m, n);
+    const dim_t nbatch  = dims[2] * dims[3];
+
+    dispatchMatrixSize(m == n ? n : 0, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        forEachLaneBlock<T>(nbatch, 1, m * n, [&](dim_t b, int count,
+                                                   auto &bufs) {
+            int ipiv[BatchedLinAlgMaxSize * L];
+            int info[L];
+            T *lu = bufs[0].data();
+            gatherLanes(lu, a.get(), dims, a.strides(), b, count, m, n);
+            luLanes<T, S>(lu, ipiv, info, m, n);
+            scatterLanes(a.get(), lu, dims, a.strides(), b, count, m, n);
+            for (int l = 0; l < count; ++l) {
+                int *p = pivot.get() +
+                         batchOffset(b + l, pivot.dims(), pivot.strides());
+                for (int c = 0; c < k; ++c) { p[c] = ipiv[c * L + l]; }
+            }
+        });
+    });
+}
+
+/// Batched getrs with the factorization and pivots from luBatched
+template<typename T>
+void luSolveBatched(CParam<T> a, CParam<int> pivot, Param<T> b) {
+    constexpr int L     = batchLanes<T>();
+    const af::dim4 dims = a.dims();
+    const int n         = dims[0];
+    const int nrhs      = b.dims()[1];
+    const dim_t nbatch  = dims[2] * dims[3];
+    const dim_t bufSize = n * std::max(n, nrhs);
+
+    dispatchMatrixSize(n, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        forEachLaneBlock<T>(nbatch, 2, bufSize, [&](dim_t bi, int count,
+                                                    auto &bufs) {
+            int ipiv[BatchedLinAlgMaxSize * L];
+            for (int l = 0; l < L; ++l) {
+                const int *p =
+                    pivot.get() + batchOffset(bi + std::min(l, count - 1),
+                                              pivot.dims(), pivot.strides());
+                for (int c = 0; c < n; ++c) { ipiv[c * L + l] = p[c]; }
+            }
+            T *lu = bufs[0].data();
+            T *x  = bufs[1].data();
+            gatherLanes(lu, a.get(), dims, a.strides(), bi, count, n, n);
+            gatherLanes(x, b.get(), b.dims(), b.strides(), bi, count, n, nrhs);
+            luSolveLanes<T, S>(lu, ipiv, x, n, nrhs);
+            scatterLanes(b.get(), x, b.dims(), b.strides(), bi, count, n,
+                         nrhs);
+        });
+    });
+}
+
+/// Batched gesv, \p a is overwritten by its factorization and \p b by the
+/// solutions
+template<typename T>
+void solveBatched(Param<T> a, Param<T> b) {
+    constexpr int L     = batchLanes<T>();
+    const af::dim4 dims = a.dims();
+    const int n         = dims[0];
+    const int nrhs      = b.dims()[1];
+    const dim_t nbatch  = dims[2] * dims[3];
+    const dim_t bufSize = n * std::max(n, nrhs);
+
+    dispatchMatrixSize(n, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        forEachLaneBlock<T>(nbatch, 2, bufSize, [&](dim_t bi, int count,
+                                                    auto &bufs) {
+            int ipiv[BatchedLinAlgMaxSize * L];
+            int info[L];
+            T *lu = bufs[0].data();
+            T *x  = bufs[1].data();
+            gatherLanes(lu, a.get(), dims, a.strides(), bi, count, n, n);
+            gatherLanes(x, b.get(), b.dims(), b.strides(), bi, count, n, nrhs);
+            luLanes<T, S>(lu, ipiv, info, n, n);
+            luSolveLanes<T, S>(lu, ipiv, x, n, nrhs);
+            scatterLanes(a.get(), lu, dims, a.strides(), bi, count, n, n);
+            scatterLanes(b.get(), x, b.dims(), b.strides(), bi, count, n,
+                         nrhs);
+        });
+    });
+}
+
+/// Batched inverse of square matrices through their LU factorization
+template<typename T>
+void inverseBatched(Param<T> a) {
+    constexpr int L     = batchLanes<T>();
+    const af::dim4 dims = a.dims();
+    const int n         = dims[0];
+    const dim_t nbatch  = dims[2] * dims[3];
+
+    dispatchMatrixSize(n, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        forEachLaneBlock<T>(nbatch, 2, n * n, [&](dim_t b, int count,
+                                                  auto &bufs) {
+            int ipiv[BatchedLinAlgMaxSize * L];
+            int info[L];
+            T *lu = bufs[0].data();
+            T *x  = bufs[1].data();
+            gatherLanes(lu, a.get(), dims, a.strides(), b, count, n, n);
+            luLanes<T, S>(lu, ipiv, info, n, n);
+            for (int j = 0; j < n; ++j) {
+                for (int i = 0; i < n; ++i) {
+                    std::fill_n(x + (j * n + i) * L, L,
+                                (i == j) ? T(1) : T(0));
+                }
+            }
+            luSolveLanes<T, S>(lu, ipiv, x, n, n);
+            scatterLanes(a.get(), x, dims, a.strides(), b, count, n, n);
+        });
+    });
+}
+
+/// Batched potrf. \p info receives the status of every matrix. Like potrf
+/// only the requested triangle of \p a is written.
+template<typename T>
+void choleskyBatched(Param<T> a, int *info, const bool isUpper) {
+    constexpr int L     = batchLanes<T>();
+    const af::dim4 dims = a.dims();
+    const int n         = dims[0];
+    const dim_t nbatch  = dims[2] * dims[3];
+
+    // The upper factor is the conjugate transpose of the lower factor of the
+    // conjugate transpose
+    dispatchMatrixSize(n, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        forEachLaneBlock<T>(nbatch, 1, n * n, [&](dim_t b, int count,
+                                                  auto &bufs) {
+            int laneInfo[L];
+            T *c = bufs[0].data();
+            gatherLanes(c, a.get(), dims, a.strides(), b, count, n, n,
+                        isUpper);
+            choleskyLanes<T, S>(c, laneInfo, n);
+            scatterLanes(a.get(), c, dims, a.strides(), b, count, n, n,
+                         isUpper, true);
+            std::copy(laneInfo, laneInfo + count, info + b);
+        });
+    });
+}
+
+/// Batched geqrf. \p tau receives the scalar factors of the reflectors.
+template<typename T>
+void qrBatched(Param<T> a, Param<T> tau) {
+    const af::dim4 dims = a.dims();
+    const int m         = dims[0];
+    const int n         = dims[1];
+    const int k         = std::min(m, n);
+    const dim_t nbatch  = dims[2] * dims[3];
+
+    dispatchMatrixSize(m == n ? n : 0, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        forEachLaneBlock<T>(nbatch, 2, m * n, [&](dim_t b, int count,
+                                                  auto &bufs) {
+            T *r = bufs[0].data();
+            T *t = bufs[1].data();
+            gatherLanes(r, a.get(), dims, a.strides(), b, count, m, n);
+            qrLanes<T, S>(r, t, m, n);
+            scatterLanes(a.get(), r, dims, a.strides(), b, count, m, n);
+            scatterLanes(tau.get(), t, tau.dims(), tau.strides(), b, count,
+                         k, 1);
+        });
+    });
+}
+
+/// Batched orgqr / ungqr. Forms the square matrices Q in \p q from the first
+/// \p k reflectors stored in its columns by qrBatched.
+template<typename T>
+void qrFormQBatched(Param<T> q, CParam<T> tau, const int k) {
+    const af::dim4 dims = q.dims();
+    const int m         = dims[0];
+    const dim_t nbatch  = dims[2] * dims[3];
+
+    dispatchMatrixSize(m, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        forEachLaneBlock<T>(nbatch, 3, m * m, [&](dim_t b, int count,
+                                                  auto &bufs) {
+            T *r = bufs[0].data();
+            T *t = bufs[1].data();
+            gatherLanes(r, q.get(), dims, q.strides(), b, count, m, k);
+            gatherLanes(t, tau.get(), tau.dims(), tau.strides(), b, count, k,
+                        1);
+            qrFormQLanes<T, S>(r, t, bufs[2].data(), m, k);
+            scatterLanes(q.get(), r, dims, q.strides(), b, count, m, m);
+        });
+    });
+}
+
+/// Batched SVD of small matrices with one sided Jacobi rotations. Wide
+/// matrices are factorized through their conjugate transpose.
+template<typename T>
+void svdBatched(Param<typename LinAlgTraits<T>::base> s, Param<T> u,
+                Param<T> vt, CParam<T> in) {
+    using Tr            = LinAlgTraits<T>;
+    using B             = typename Tr::base;
+    const af::dim4 dims = in.dims();
+    const int m         = dims[0];
+    const int n         = dims[1];
+    const bool wide     = m < n;
+    const int p         = std::max(m, n);
+    const int q         = std::min(m, n);
+    const dim_t nbatch  = dims[2] * dims[3];
+    const dim_t ldu     = u.strides(1);
+    const dim_t ldvt    = vt.strides(1);
+
+    dispatchMatrixSize(m == n ? n : 0, [&](auto size) {
+        constexpr int S = decltype(size)::value;
+        forEachLaneBlock<T>(nbatch, 4, p * p, [&](dim_t b, int count,
+                                                  auto &bufs) {
+            T *w     = bufs[0].data();
+            T *v     = bufs[1].data();
+            T *left  = bufs[2].data();
+            T *right = bufs[3].data();
+            B sv[BatchedLinAlgMaxSize];
+
+            gatherLanes(w, in.get(), dims, in.strides(), b, count, p, q,
+                        wide);
+            jacobiSvdLanes<T, S>(w, v, p, q);
+
+            for (int l = 0; l < count; ++l) {
+                jacobiSvdExtract(sv, left, right, w, v, l, p, q);
+
+                B *sp = s.get() + batchOffset(b + l, s.dims(), s.strides());
+                T *up = u.get() + batchOffset(b + l, u.dims(), u.strides());
+                T *vp = vt.get() + batchOffset(b + l, vt.dims(), vt.strides());
+                std::copy(sv, sv + q, sp);
+
+                // A^H = U' S V'^H for wide matrices, so U = V' and
+                // V^H = U'^H
+                const T *uSrc = wide ? right : left;
+                const T *vSrc = wide ? left : right;
+                for (int j = 0; j < m; ++j) {
+                    for (int i = 0; i < m; ++i) {
+                        up[i + j * ldu] = uSrc[j * m + i];
+                    }
+                }
+                for (int j = 0; j < n; ++j) {
+                    for (int i = 0; i < n; ++i) {
+                        vp[i + j * ldvt] = Tr::conj(vSrc[i * n + j]);
+                    }
+                }
+            }
+        });
+    });
+}
+}  // namespace kernel
+}  // namespace cpu
+}  // namespace arrayfire
@@ -10,8 +10,14 @@
 #pragma once
 #include <Param.hpp>
 #include <math.hpp>
+#include <parallel.hpp>
 #include <utility.hpp>
+
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
 
 namespace arrayfire {
 namespace cpu {
@@ -32,57 +38,641 @@ void bilateral(Param<OutT> out, CParam<InT> in, float const s_sigma,
     float space_       = min(11.5f, max(s_sigma, 0.f));
     float color_       = max(c_sigma, 0.f);
     dim_t const radius = max((dim_t)(space_ * 1.5f), (dim_t)1);
+    dim_t const wlen   = 2 * radius + 1;
     float const svar   = space_ * space_;
     float const cvar   = color_ * color_;
 
-    for (dim_t b3 = 0; b3 < dims[3]; ++b3) {
-        OutT *outData     = out.get() + b3 * ostrides[3];
-        InT const *inData = in.get() + b3 * istrides[3];
-
-        // b3 for loop handles following batch configurations
-        //  - gfor
-        //  - input based batch
-        //      - when input is 4d array for color images
-        for (dim_t b2 = 0; b2 < dims[2]; ++b2) {
-            // b2 for loop handles following batch configurations
-            //  - channels
-            //  - input based batch
-            //      - when input is 3d array for grayscale images
-            for (dim_t j = 0; j < dims[1]; ++j) {
-                // j steps along 2nd dimension
+    // The spatial weight only depends on the offset within the window
+    std::vector<OutT> spaceWeights(wlen * wlen);
+    for (dim_t wj = -radius; wj <= radius; ++wj) {
+        for (dim_t wi = -radius; wi <= radius; ++wi) {
+            OutT const gauss_space = (wi * wi + wj * wj) / (-2.0 * svar);
+            spaceWeights[(wj + radius) * wlen + wi + radius] =
+                std::exp(gauss_space);
+        }
+    }
+
+    // 8 and 16 bit inputs have few enough distinct intensity differences to
+    // tabulate the range weight as well
+    constexpr bool useRangeLUT =
+        std::is_integral<InT>::value && sizeof(InT) <= 2;
+    std::vector<OutT> rangeWeights(useRangeLUT ? (1 << (8 * sizeof(InT))) : 0);
+    for (size_t d = 0; d < rangeWeights.size(); ++d) {
+        OutT const gauss_range = (OutT(d) * OutT(d)) / (-2.0 * cvar);
+        rangeWeights[d]        = std::exp(gauss_range);
+    }
+
+    // Clamped column offsets of every window position, so that the inner
+    // loop does not need to clamp
+    std::vector<dim_t> cols(dims[0] + 2 * radius);
+    for (dim_t c = 0; c < (dim_t)cols.size(); ++c) {
+        cols[c] = clamp(c - radius, dim_t(0), dims[0] - 1) * istrides[0];
+    }
+
+    OutT *const outPtr     = out.get();
+    InT const *const inPtr = in.get();
+
+    // Every (column, channel, batch) row is independent
+    parallelForChunks(
+        0, dims[1] * dims[2] * dims[3], 4, [&](dim_t rbeg, dim_t rend) {
+            for (dim_t r = rbeg; r < rend; ++r) {
+                dim_t const j  = r % dims[1];
+                dim_t const b2 = (r / dims[1]) % dims[2];
+                dim_t const b3 = r / (dims[1] * dims[2]);
+
+                InT const *inData = inPtr + b3 * istrides[3] + b2 * istrides[2];
+                OutT *outData     = outPtr + b3 * ostrides[3] +
+                                b2 * ostrides[2] + j * ostrides[1];
+
                 for (dim_t i = 0; i < dims[0]; ++i) {
-                    // i steps along 1st dimension
                     OutT norm         = 0.0;
                     OutT res          = 0.0;
-                    OutT const center = (OutT)inData[getIdx(istrides, i, j)];
+                    InT const center  = inData[getIdx(istrides, i, j)];
+                    dim_t const *wcol = cols.data() + i;
                     for (dim_t wj = -radius; wj <= radius; ++wj) {
-                        // clamps offsets
-                        dim_t tj = clamp(j + wj, dim_t(0), dims[1] - 1);
-                        for (dim_t wi = -radius; wi <= radius; ++wi) {
-                            // clamps offsets
-                            dim_t ti = clamp(i + wi, dim_t(0), dims[0] - 1);
-                            // proceed
-                            OutT const val =
-                                (OutT)inData[getIdx(istrides, ti, tj)];
-                            OutT const gauss_space =
-                                (wi * wi + wj * wj) / (-2.0 * svar);
-                            OutT const gauss_range =
-                                ((center - val) * (center - val)) /
-                                (-2.0 * cvar);
-                            OutT const weight =
-                                std::exp(gauss_space + gauss_range);
+                        dim_t const tj = clamp(j + wj, dim_t(0), dims[1] - 1);
+                        InT const *row = inData + tj * istrides[1];
+                        OutT const *sw =
+                            spaceWeights.data() + (wj + radius) * wlen;
+                        for (dim_t wi = 0; wi < wlen; ++wi) {
+                            InT const val = row[wcol[wi]];
+                            OutT weight;
+                            if constexpr (useRangeLUT) {
+                                weight = sw[wi] *
+                                         rangeWeights[std::abs(int(center) -
+                                                               int(val))];
+                            } else {
+                                OutT const diff = (OutT)center - (OutT)val;
+                                OutT const gauss_range =
+                                    (diff * diff) / (-2.0 * cvar);
+                                weight = sw[wi] * std::exp(gauss_range);
+                            }
                             norm += weight;
-                            res += val * weight;
+                            res += (OutT)val * weight;
                         }
                     }  // filter loop ends here
 
-                    outData[getIdx(ostrides, i, j)] = res / norm;
+                    outData[i * ostrides[0]] = res / norm;
                 }  // 1st dimension loop ends here
-            }      // 2nd dimension loop ends here
-            outData += ostrides[2];
-            inData += istrides[2];
+            }
+        });
+}
+
+/// Maximum number of cells along the range axis of the bilateral grid. Wide
+/// integer ranges are sampled more coarsely than the chromatic sigma.
+constexpr dim_t BILATERAL_GRID_MAX_RANGE_CELLS = 256;
+
+/// Fewest cells along the range axis of the bilateral grid. Grids that would
+/// need fewer to stay within BILATERAL_GRID_MAX_BYTES use the exact filter.
+constexpr dim_t BILATERAL_GRID_MIN_RANGE_CELLS = 16;
+
+/// Largest total size, in bytes, of the bilateral grids of the channels that
+/// are filtered at the same time
+constexpr size_t BILATERAL_GRID_MAX_BYTES = size_t(256) << 20;
+
+/// Smallest spatial sigma filtered through the bilateral grid. Below it the
+/// grid has about a cell per pixel, while the window of the exact filter is
+/// only a few pixels wide.
+constexpr float BILATERAL_GRID_MIN_SPATIAL_SIGMA = 3.f;
+
+/// Filters a single channel with the bilateral grid of Chen, Paris and
+/// Durand. The image is splatted into a 3D (x, y, intensity) grid sampled at
+/// the spatial and chromatic sigmas, the grid is blurred with a separable
+/// gaussian and the result is sliced back with trilinear interpolation. The
+/// cost is linear in the pixel count for any sigma.
+template<typename OutT, typename InT>
+void bilateralGridChannel(OutT *outData, af::dim4 const &ostrides,
+                          InT const *inData, af::dim4 const &istrides,
+                          dim_t const width, dim_t const height,
+                          float const s_sigma, float const c_sigma,
+                          dim_t const maxRangeCells) {
+    using std::max;
+    using std::min;
+
+    auto inAt = [&](dim_t i, dim_t j) {
+        return (OutT)inData[i * istrides[0] + j * istrides[1]];
+    };
+
+    OutT minVal = inAt(0, 0);
+    OutT maxVal = minVal;
+    for (dim_t j = 0; j < height; ++j) {
+        for (dim_t i = 0; i < width; ++i) {
+            minVal = min(minVal, inAt(i, j));
+            maxVal = max(maxVal, inAt(i, j));
+        }
+    }
+
+    if (!(s_sigma > 0.f) || !(c_sigma > 0.f) || minVal == maxVal) {
+        for (dim_t j = 0; j < height; ++j) {
+            for (dim_t i = 0; i < width; ++i) {
+                outData[i * ostrides[0] + j * ostrides[1]] = inAt(i, j);
+            }
+        }
+        return;
+    }
+
+    // Sample the grid at the sigmas, but never finer than a pixel and never
+    // with more than maxRangeCells intensity cells
+    OutT const sstep = max(OutT(s_sigma), OutT(1));
+    OutT const rstep =
+        max(OutT(c_sigma), (maxVal - minVal) / OutT(maxRangeCells - 1));
+    OutT const sSigmaCells = OutT(s_sigma) / sstep;
+    OutT const rSigmaCells = OutT(c_sigma) / rstep;
+    int const sRadius      = (int)std::ceil(2 * sSigmaCells);
+    int const rRadius      = (int)std::ceil(2 * rSigmaCells);
+    int const sPad         = sRadius + 1;
+    int const rPad         = rRadius + 1;
+
+    dim_t const gw = (dim_t)((width - 1) / sstep) + 2 + 2 * sPad;
+    dim_t const gh = (dim_t)((height - 1) / sstep) + 2 + 2 * sPad;
+    dim_t const gd = (dim_t)((maxVal - minVal) / rstep) + 2 + 2 * rPad;
+
+    // Intensity is the fastest moving grid axis, it varies the most between
+    // neighbouring pixels. Values and weights are interleaved.
+    std::vector<OutT> grid(gw * gh * gd * 2, OutT(0));
+    auto cell = [&](dim_t x, dim_t y, dim_t z) {
+        return ((y * gw + x) * gd + z) * 2;
+    };
+
+    struct Coord {
+        dim_t x, y, z;
+        OutT fx, fy, fz;
+    };
+    auto gridCoord = [&](dim_t i, dim_t j, OutT val) {
+        OutT const gx = i / sstep + sPad;
+        OutT const gy = j / sstep + sPad;
+        OutT const gz = (val - minVal) / rstep + rPad;
+        Coord c;
+        c.x  = (dim_t)gx;
+        c.y  = (dim_t)gy;
+        c.z  = (dim_t)gz;
+        c.fx = gx - c.x;
+        c.fy = gy - c.y;
+        c.fz = gz - c.z;
+        return c;
+    };
+
+    // Splat with trilinear weights
+    for (dim_t j = 0; j < height; ++j) {
+        for (dim_t i = 0; i < width; ++i) {
+            OutT const val = inAt(i, j);
+            Coord const c  = gridCoord(i, j, val);
+            for (int dy = 0; dy < 2; ++dy) {
+                OutT const wy = dy ? c.fy : 1 - c.fy;
+                for (int dx = 0; dx < 2; ++dx) {
+                    OutT const wxy = wy * (dx ? c.fx : 1 - c.fx);
+                    OutT *g = grid.data() + cell(c.x + dx, c.y + dy, c.z);
+                    g[0] += wxy * (1 - c.fz) * val;
+                    g[1] += wxy * (1 - c.fz);
+                    g[2] += wxy * c.fz * val;
+                    g[3] += wxy * c.fz;
+                }
+            }
+        }
+    }
+
+    // Separable gaussian blur of the grid along each axis
+    auto blurAxis = [&](dim_t len, dim_t stride, dim_t nlines,
+                        auto lineStart, OutT sigmaCells, int radius) {
+        std::vector<OutT> taps(2 * radius + 1);
+        for (int t = -radius; t <= radius; ++t) {
+            taps[t + radius] =
+                std::exp(-(t * t) / (2 * sigmaCells * sigmaCells));
+        }
+        parallelForChunks(0, nlines, 16, [&](dim_t lbeg, dim_t lend) {
+            std::vector<OutT> line(2 * len);
+            for (dim_t l = lbeg; l < lend; ++l) {
+                OutT *g = grid.data() + lineStart(l);
+                for (dim_t k = 0; k < len; ++k) {
+                    line[2 * k]     = g[k * stride];
+                    line[2 * k + 1] = g[k * stride + 1];
+                }
+                for (dim_t k = 0; k < len; ++k) {
+                    OutT v = 0, w = 0;
+                    dim_t const tbeg = max(dim_t(-radius), -k);
+                    dim_t const tend = min(dim_t(radius), len - 1 - k);
+                    for (dim_t t = tbeg; t <= tend; ++t) {
+                        v += taps[t + radius] * line[2 * (k + t)];
+                        w += taps[t + radius] * line[2 * (k + t) + 1];
+                    }
+                    g[k * stride]     = v;
+                    g[k * stride + 1] = w;
+                }
+            }
+        });
+    };
+    blurAxis(
+        gd, 2, gw * gh, [&](dim_t l) { return l * gd * 2; }, rSigmaCells,
+        rRadius);
+    blurAxis(
+        gw, gd * 2, gh * gd,
+        [&](dim_t l) { return cell(0, l / gd, l % gd); }, sSigmaCells,
+        sRadius);
+    blurAxis(
+        gh, gw * gd * 2, gw * gd,
+        [&](dim_t l) { return cell(l / gd, 0, l % gd); }, sSigmaCells,
+        sRadius);
+
+    // Slice with trilinear interpolation
+    parallelForChunks(0, height, 8, [&](dim_t jbeg, dim_t jend) {
+        for (dim_t j = jbeg; j < jend; ++j) {
+            for (dim_t i = 0; i < width; ++i) {
+                OutT const val = inAt(i, j);
+                Coord const c  = gridCoord(i, j, val);
+                OutT v = 0, w = 0;
+                for (int dy = 0; dy < 2; ++dy) {
+                    OutT const wy = dy ? c.fy : 1 - c.fy;
+                    for (int dx = 0; dx < 2; ++dx) {
+                        OutT const wxy = wy * (dx ? c.fx : 1 - c.fx);
+                        OutT const *g =
+                            grid.data() + cell(c.x + dx, c.y + dy, c.z);
+                        v += wxy * ((1 - c.fz) * g[0] + c.fz * g[2]);
+                        w += wxy * ((1 - c.fz) * g[1] + c.fz * g[3]);
+                    }
+                }
+                outData[i * ostrides[0] + j * ostrides[1]] =
+                    (w > 0) ? v / w : val;
+            }
+        }
+    });
+}
+
+/// Number of cells of the bilateral grid along a spatial axis of \p len
+/// pixels. With a sigma of at least a pixel, the blur spans two cells on
+/// either side and the grid is padded by one more.
+inline dim_t bilateralGridCells(dim_t const len, float const s_sigma) {
+    return (dim_t)((len - 1) / s_sigma) + 2 + 2 * 3;
+}
+
+template<typename OutT, typename InT>
+void bilateralGrid(Param<OutT> out, CParam<InT> in, float const s_sigma,
+                   float const c_sigma) {
+    af::dim4 const dims     = in.dims();
+    af::dim4 const istrides = in.strides();
+    af::dim4 const ostrides = out.strides();
+
+    // Small spatial sigmas and grids that do not fit in
+    // BILATERAL_GRID_MAX_BYTES even with few intensity cells use the exact
+    // filter. The range axis can add up to 8 cells of padding.
+    dim_t rangeCells = BILATERAL_GRID_MAX_RANGE_CELLS;
+    if (s_sigma > 0.f && c_sigma > 0.f) {
+        if (s_sigma < BILATERAL_GRID_MIN_SPATIAL_SIGMA) {
+            bilateral<OutT, InT>(out, in, s_sigma, c_sigma);
+            return;
+        }
+        dim_t const grids = std::min(dims[2] * dims[3],
+                                     static_cast<dim_t>(getNumThreads()));
+        dim_t const maxCells =
+            dim_t(BILATERAL_GRID_MAX_BYTES / (2 * sizeof(OutT))) / grids;
+        dim_t const spatialCells = bilateralGridCells(dims[0], s_sigma) *
+                                   bilateralGridCells(dims[1], s_sigma);
+        rangeCells = std::min(rangeCells, maxCells / spatialCells - 8);
+        if (rangeCells < BILATERAL_GRID_MIN_RANGE_CELLS) {
+            bilateral<OutT, InT>(out, in, s_sigma, c_sigma);
+            return;
         }
     }
+
+    OutT *const outPtr     = out.get();
+    InT const *const inPtr = in.get();
+
+    // Channels and batches are filtered independently
+    parallelFor(dims[2] * dims[3], [&](dim_t s) {
+        dim_t const b2 = s % dims[2];
+        dim_t const b3 = s / dims[2];
+        bilateralGridChannel(
+            outPtr + b2 * ostrides[2] + b3 * ostrides[3], ostrides,
+            inPtr + b2 * istrides[2] + b3 * istrides[3], istrides, dims[0],
+            dims[1], s_sigma, c_sigma, rangeCells);
+    });
+}
+
+/// Sparse storage for the points of a permutohedral lattice. Keys are the
+/// first d coordinates of a lattice point, the last one is implied because
+/// the coordinates of a lattice point sum to zero.
+class LatticeHashTable {
+   public:
+    explicit LatticeHashTable(int d, size_t expected)
+        : keySize(d), filled(0) {
+        size_t capacity = 64;
+        while (capacity < 2 * expected) { capacity <<= 1; }
+        table.assign(capacity, -1);
+        keys.reserve(expected * d);
+    }
+
+    int size() const { return filled; }
+
+    const int *key(int idx) const { return keys.data() + idx * keySize; }
+
+    /// Returns the index of \p k or -1 if \p k is not in the table
+    int find(const int *k) const {
+        size_t const mask = table.size() - 1;
+        for (size_t h = hash(k) & mask;; h = (h + 1) & mask) {
+            int const idx = table[h];
+            if (idx < 0) { return -1; }
+            if (std::equal(k, k + keySize, key(idx))) { return idx; }
+        }
+    }
+
+    /// Returns the index of \p k, adding it if it is not in the table
+    int insert(const int *k) {
+        if (2 * size_t(filled + 1) > table.size()) { grow(); }
+        size_t const mask = table.size() - 1;
+        for (size_t h = hash(k) & mask;; h = (h + 1) & mask) {
+            int const idx = table[h];
+            if (idx < 0) {
+                keys.insert(keys.end(), k, k + keySize);
+                table[h] = filled;
+                return filled++;
+            }
+            if (std::equal(k, k + keySize, key(idx))) { return idx; }
+        }
+    }
+
+   private:
+    size_t hash(const int *k) const {
+        size_t h = 0;
+        for (int i = 0; i < keySize; ++i) {
+            h = (h + static_cast<size_t>(k[i])) * 2531011;
+        }
+        return h;
+    }
+
+    void grow() {
+        std::vector<int> old(table.size() * 2, -1);
+        table.swap(old);
+        size_t const mask = table.size() - 1;
+        for (int idx = 0; idx < filled; ++idx) {
+            size_t h = hash(key(idx)) & mask;
+            while (table[h] >= 0) { h = (h + 1) & mask; }
+            table[h] = idx;
+        }
+    }
+
+    int keySize;
+    int filled;
+    std::vector<int> keys;
+    std::vector<int> table;
+};
+
+/// Computes the enclosing simplex of a d-dimensional position in the
+/// permutohedral lattice of Adams, Baek and Davis.
+///
+/// \param[out] rem0        the remainder-0 vertex of the simplex, d+1 values
+/// \param[out] rank        the rank of each coordinate, d+1 values
+/// \param[out] barycentric the barycentric weights, d+2 values
+/// \param[out] elevated    scratch space, d+1 values
+/// \param[in]  pos         the scaled position, d values
+/// \param[in]  scale       the per axis elevation factors, d values
+template<typename T>
+void latticeSimplex(int *rem0, int *rank, T *barycentric, T *elevated,
+                    const T *pos, const T *scale, int const d) {
+    // Elevate the position onto the hyperplane H_d
+    T sm = 0;
+    for (int i = d; i > 0; --i) {
+        T const cf  = pos[i - 1] * scale[i - 1];
+        elevated[i] = sm - i * cf;
+        sm += cf;
+    }
+    elevated[0] = sm;
+
+    // Find the closest remainder-0 point
+    T const down = T(1) / T(d + 1);
+    int sum      = 0;
+    for (int i = 0; i <= d; ++i) {
+        T const v     = elevated[i] * down;
+        int const up  = (int)std::ceil(v) * (d + 1);
+        int const low = (int)std::floor(v) * (d + 1);
+        rem0[i]       = (up - elevated[i] < elevated[i] - low) ? up : low;
+        sum += rem0[i];
+    }
+    sum /= d + 1;
+
+    // Rank the differential to find the permutation between this simplex
+    // and the canonical one
+    std::fill(rank, rank + d + 1, 0);
+    for (int i = 0; i < d; ++i) {
+        T const di = elevated[i] - rem0[i];
+        for (int j = i + 1; j <= d; ++j) {
+            if (di < elevated[j] - rem0[j]) {
+                rank[i]++;
+            } else {
+                rank[j]++;
+            }
+        }
+    }
+
+    // Wrap around if the remainder-0 point is not on H_d
+    if (sum > 0) {
+        for (int i = 0; i <= d; ++i) {
+            if (rank[i] >= d + 1 - sum) {
+                rem0[i] -= d + 1;
+                rank[i] += sum - (d + 1);
+            } else {
+                rank[i] += sum;
+            }
+        }
+    } else if (sum < 0) {
+        for (int i = 0; i <= d; ++i) {
+            if (rank[i] < -sum) {
+                rem0[i] += d + 1;
+                rank[i] += (d + 1) + sum;
+            } else {
+                rank[i] += sum;
+            }
+        }
+    }
+
+    std::fill(barycentric, barycentric + d + 2, T(0));
+    for (int i = 0; i <= d; ++i) {
+        T const v = (elevated[i] - rem0[i]) * down;
+        barycentric[d - rank[i]] += v;
+        barycentric[d - rank[i] + 1] -= v;
+    }
+    barycentric[0] += T(1) + barycentric[d + 1];
+}
+
+/// Filters one image with the permutohedral lattice. The pixels are
+/// positioned at (x / s_sigma, y / s_sigma, c_0 / c_sigma, ...) over all the
+/// \p channels, so colour images are filtered with the joint colour distance.
+/// The cost is linear in the pixel count and in the number of channels for
+/// any sigma.
+template<typename OutT, typename InT>
+void bilateralLatticeImage(OutT *outData, af::dim4 const &ostrides,
+                           InT const *inData, af::dim4 const &istrides,
+                           dim_t const width, dim_t const height,
+                           int const channels, float const s_sigma,
+                           float const c_sigma) {
+    int const d   = 2 + channels;
+    int const vd  = channels + 1;
+    dim_t const n = width * height;
+
+    if (!(s_sigma > 0.f) || !(c_sigma > 0.f)) {
+        for (int c = 0; c < channels; ++c) {
+            for (dim_t j = 0; j < height; ++j) {
+                for (dim_t i = 0; i < width; ++i) {
+                    outData[i * ostrides[0] + j * ostrides[1] +
+                            c * ostrides[2]] =
+                        (OutT)inData[i * istrides[0] + j * istrides[1] +
+                                     c * istrides[2]];
+                }
+            }
+        }
+        return;
+    }
+
+    // Scaling that makes the lattice blur a unit variance gaussian in the
+    // position space
+    std::vector<OutT> scale(d);
+    OutT const invStdDev = std::sqrt(OutT(2) / OutT(3)) * (d + 1);
+    for (int i = 0; i < d; ++i) {
+        scale[i] = invStdDev / std::sqrt(OutT((i + 1) * (i + 2)));
+    }
+
+    // Offsets from the remainder-0 vertex to the other simplex vertices
+    std::vector<int> canonical((d + 1) * (d + 1));
+    for (int i = 0; i <= d; ++i) {
+        for (int j = 0; j <= d - i; ++j) { canonical[i * (d + 1) + j] = i; }
+        for (int j = d - i + 1; j <= d; ++j) {
+            canonical[i * (d + 1) + j] = i - (d + 1);
+        }
+    }
+
+    struct Scratch {
+        std::vector<int> rem0, rank, key;
+        std::vector<OutT> bary, elevated, pos;
+        explicit Scratch(int d)
+            : rem0(d + 1)
+            , rank(d + 1)
+            , key(d)
+            , bary(d + 2)
+            , elevated(d + 1)
+            , pos(d) {}
+    };
+
+    auto pixelSimplex = [&](Scratch &s, dim_t p) {
+        dim_t const i = p % width;
+        dim_t const j = p / width;
+        s.pos[0]      = OutT(i) / s_sigma;
+        s.pos[1]      = OutT(j) / s_sigma;
+        for (int c = 0; c < channels; ++c) {
+            s.pos[2 + c] = OutT(inData[i * istrides[0] + j * istrides[1] +
+                                       c * istrides[2]]) /
+                           c_sigma;
+        }
+        latticeSimplex(s.rem0.data(), s.rank.data(), s.bary.data(),
+                       s.elevated.data(), s.pos.data(), scale.data(), d);
+    };
+    auto vertexKey = [&](Scratch &s, int remainder) {
+        for (int k = 0; k < d; ++k) {
+            s.key[k] = s.rem0[k] + canonical[remainder * (d + 1) + s.rank[k]];
+        }
+    };
+
+    // Splat. The hash table is built sequentially, it is the only part of
+    // the algorithm that is not trivially parallel.
+    LatticeHashTable lattice(d, size_t(n));
+    std::vector<OutT> values;
+    values.reserve(size_t(n) * vd);
+    {
+        Scratch s(d);
+        for (dim_t p = 0; p < n; ++p) {
+            pixelSimplex(s, p);
+            dim_t const i = p % width;
+            dim_t const j = p / width;
+            for (int r = 0; r <= d; ++r) {
+                vertexKey(s, r);
+                int const idx = lattice.insert(s.key.data());
+                if (size_t(idx + 1) * vd > values.size()) {
+                    values.resize(size_t(idx + 1) * vd, OutT(0));
+                }
+                OutT *v       = values.data() + size_t(idx) * vd;
+                OutT const wt = s.bary[r];
+                for (int c = 0; c < channels; ++c) {
+                    v[c] += wt * (OutT)inData[i * istrides[0] +
+                                              j * istrides[1] +
+                                              c * istrides[2]];
+                }
+                v[channels] += wt;
+            }
+        }
+    }
+
+    // Blur along each of the d+1 lattice directions with a [1 2 1] kernel
+    int const npoints = lattice.size();
+    std::vector<OutT> blurred(values.size());
+    for (int axis = 0; axis <= d; ++axis) {
+        parallelForChunks(0, npoints, 1024, [&](dim_t pbeg, dim_t pend) {
+            std::vector<int> n1(d), n2(d);
+            for (dim_t p = pbeg; p < pend; ++p) {
+                int const *key = lattice.key(int(p));
+                for (int k = 0; k < d; ++k) {
+                    n1[k] = key[k] + 1;
+                    n2[k] = key[k] - 1;
+                }
+                if (axis < d) {
+                    n1[axis] = key[axis] - d;
+                    n2[axis] = key[axis] + d;
+                }
+                int const i1  = lattice.find(n1.data());
+                int const i2  = lattice.find(n2.data());
+                OutT const *v = values.data() + p * vd;
+                OutT *b       = blurred.data() + p * vd;
+                for (int c = 0; c < vd; ++c) {
+                    OutT const v1 = (i1 >= 0) ? values[size_t(i1) * vd + c] : 0;
+                    OutT const v2 = (i2 >= 0) ? values[size_t(i2) * vd + c] : 0;
+                    b[c]          = OutT(0.5) * v[c] + OutT(0.25) * (v1 + v2);
+                }
+            }
+        });
+        values.swap(blurred);
+    }
+
+    // Slice
+    parallelForChunks(0, n, 1024, [&](dim_t pbeg, dim_t pend) {
+        Scratch s(d);
+        std::vector<OutT> acc(vd);
+        for (dim_t p = pbeg; p < pend; ++p) {
+            pixelSimplex(s, p);
+            std::fill(acc.begin(), acc.end(), OutT(0));
+            for (int r = 0; r <= d; ++r) {
+                vertexKey(s, r);
+                int const idx = lattice.find(s.key.data());
+                OutT const *v = values.data() + size_t(idx) * vd;
+                for (int c = 0; c < vd; ++c) { acc[c] += s.bary[r] * v[c]; }
+            }
+            dim_t const i = p % width;
+            dim_t const j = p / width;
+            for (int c = 0; c < channels; ++c) {
+                outData[i * ostrides[0] + j * ostrides[1] + c * ostrides[2]] =
+                    acc[c] / acc[channels];
+            }
+        }
+    });
+}
+
+template<typename OutT, typename InT>
+void bilateralLattice(Param<OutT> out, CParam<InT> in, float const s_sigma,
+                      float const c_sigma, bool const isColor) {
+    af::dim4 const dims     = in.dims();
+    af::dim4 const istrides = in.strides();
+    af::dim4 const ostrides = out.strides();
+
+    OutT *const outPtr     = out.get();
+    InT const *const inPtr = in.get();
+
+    // Colour images use all the channels along the third dimension as the
+    // range space, otherwise every channel is filtered on its own
+    int const channels = isColor ? int(dims[2]) : 1;
+    dim_t const nimgs  = isColor ? dims[3] : dims[2] * dims[3];
+    parallelFor(nimgs, [&](dim_t s) {
+        dim_t const b2 = isColor ? 0 : s % dims[2];
+        dim_t const b3 = isColor ? s : s / dims[2];
+        bilateralLatticeImage(
+            outPtr + b2 * ostrides[2] + b3 * ostrides[3], ostrides,
+            inPtr + b2 * istrides[2] + b3 * istrides[3], istrides, dims[0],
+            dims[1], channels, s_sigma, c_sigma);
+    });
 }
 
 }  // namespace kernel
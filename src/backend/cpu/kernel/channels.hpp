@@ -0,0 +1,36 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+#include <af/defines.h>
+#include <af/dim4.hpp>
+
+namespace arrayfire {
+namespace cpu {
+namespace kernel {
+
+/// Number of channels of an array, counted over dimensions 1 to 3
+inline dim_t channels(const af::dim4 &dims) {
+    return dims[1] * dims[2] * dims[3];
+}
+
+/// Offset of channel \p c, counted over dimensions 1 to 3. Arrays with a
+/// single channel are shared by all channels.
+inline dim_t channelOffset(const dim_t c, const af::dim4 &dims,
+                           const af::dim4 &strides) {
+    if (channels(dims) == 1) { return 0; }
+    const dim_t c1 = c % dims[1];
+    const dim_t c2 = (c / dims[1]) % dims[2];
+    const dim_t c3 = c / (dims[1] * dims[2]);
+    return c1 * strides[1] + c2 * strides[2] + c3 * strides[3];
+}
+
+}  // namespace kernel
+}  // namespace cpu
+}  // namespace arrayfire
@@ -0,0 +1,242 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+#include <Param.hpp>
+#include <common/dispatch.hpp>
+#include <parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace arrayfire {
+namespace cpu {
+namespace kernel {
+
+/// Rows of a column whose moments are found directly. The block stays in
+/// cache between the pass for the means and the pass for the sums of squares.
+constexpr dim_t ComomentsBlock = 512;
+
+/// Rows of a column handled by a single task
+constexpr dim_t ComomentsChunk = 64 * ComomentsBlock;
+
+/// Count, means and centred second order sums of two sequences
+struct Comoments {
+    double count = 0.0;
+    double meanX = 0.0;
+    double meanY = 0.0;
+    /// Sum of (x - meanX)^2
+    double m2X = 0.0;
+    /// Sum of (y - meanY)^2
+    double m2Y = 0.0;
+    /// Sum of (x - meanX)(y - meanY)
+    double cXY = 0.0;
+};
+
+/// Moments of the union of two disjoint sets of values (Chan, Golub and
+/// LeVeque)
+inline Comoments merge(const Comoments &a, const Comoments &b) {
+    if (a.count == 0.0) { return b; }
+    if (b.count == 0.0) { return a; }
+
+    const double count = a.count + b.count;
+    const double dx    = b.meanX - a.meanX;
+    const double dy    = b.meanY - a.meanY;
+    const double wb    = b.count / count;
+    const double f     = a.count * wb;
+
+    Comoments r;
+    r.count = count;
+    r.meanX = a.meanX + dx * wb;
+    r.meanY = a.meanY + dy * wb;
+    r.m2X   = a.m2X + b.m2X + dx * dx * f;
+    r.m2Y   = a.m2Y + b.m2Y + dy * dy * f;
+    r.cXY   = a.cXY + b.cXY + dx * dy * f;
+    return r;
+}
+
+/// Moments of \p n values of \p x and \p y. Only x is read when \p Paired is
+/// false, and the fields of y are left at zero.
+template<bool Paired, typename T>
+Comoments blockComoments(const T *x, const T *y, const dim_t n) {
+    double sx = 0.0, sy = 0.0;
+    for (dim_t i = 0; i < n; ++i) {
+        sx += static_cast<double>(x[i]);
+        if (Paired) { sy += static_cast<double>(y[i]); }
+    }
+
+    Comoments r;
+    r.count = static_cast<double>(n);
+    r.meanX = sx / r.count;
+    r.meanY = sy / r.count;
+
+    double m2x = 0.0, m2y = 0.0, cxy = 0.0;
+    for (dim_t i = 0; i < n; ++i) {
+        const double dx = static_cast<double>(x[i]) - r.meanX;
+        m2x += dx * dx;
+        if (Paired) {
+            const double dy = static_cast<double>(y[i]) - r.meanY;
+            m2y += dy * dy;
+            cxy += dx * dy;
+        }
+    }
+    r.m2X = m2x;
+    r.m2Y = m2y;
+    r.cXY = cxy;
+    return r;
+}
+
+/// Moments of every column (along dimension 0) of \p x, and of \p x against
+/// \p y when \p Paired is true, in a single pass over the data.
+///
+/// Long columns are split into chunks that run in parallel together with
+/// the other columns. The partial results are merged in row order so the
+/// result does not depend on the number of threads.
+template<bool Paired, typename T>
+std::vector<Comoments> columnComoments(CParam<T> x, CParam<T> y) {
+    const af::dim4 dims = x.dims();
+    const af::dim4 xstr = x.strides();
+    const af::dim4 ystr = Paired ? y.strides() : xstr;
+    const dim_t rows    = dims[0];
+    const dim_t ncols   = dims[1] * dims[2] * dims[3];
+    const dim_t nchunks = divup(rows, ComomentsChunk);
+
+    std::vector<Comoments> parts(ncols * nchunks);
+    parallelForChunks(0, ncols * nchunks, 1, [&](dim_t tbeg, dim_t tend) {
+        for (dim_t t = tbeg; t < tend; ++t) {
+            const dim_t c  = t / nchunks;
+            const dim_t r0 = (t % nchunks) * ComomentsChunk;
+            const dim_t i1 = c % dims[1];
+            const dim_t i2 = (c / dims[1]) % dims[2];
+            const dim_t i3 = c / (dims[1] * dims[2]);
+            const dim_t n  = std::min(ComomentsChunk, rows - r0);
+
+            const T *px = x.get() + i1 * xstr[1] + i2 * xstr[2] +
+                          i3 * xstr[3] + r0;
+            const T *py = Paired ? y.get() + i1 * ystr[1] + i2 * ystr[2] +
+                                       i3 * ystr[3] + r0
+                                 : px;
+
+            Comoments acc;
+            for (dim_t b = 0; b < n; b += ComomentsBlock) {
+                const dim_t m = std::min(ComomentsBlock, n - b);
+                acc = merge(acc, blockComoments<Paired>(px + b, py + b, m));
+            }
+            parts[t] = acc;
+        }
+    });
+
+    std::vector<Comoments> cols(ncols);
+    for (dim_t c = 0; c < ncols; ++c) {
+        for (dim_t k = 0; k < nchunks; ++k) {
+            cols[c] = merge(cols[c], parts[c * nchunks + k]);
+        }
+    }
+    return cols;
+}
+
+/// Moments of all values of \p x against \p y
+template<typename T>
+Comoments comoments(CParam<T> x, CParam<T> y) {
+    Comoments all;
+    for (const Comoments &c : columnComoments<true>(x, y)) {
+        all = merge(all, c);
+    }
+    return all;
+}
+
+/// Sum along dimension 0 of (x - mean(x))(y - mean(y)) divided by \p norm,
+/// where the means are those of all values of each array
+template<typename T, typename To>
+void cov(Param<To> out, CParam<T> x, CParam<T> y, const double norm) {
+    const std::vector<Comoments> cols = columnComoments<true>(x, y);
+
+    Comoments all;
+    for (const Comoments &c : cols) { all = merge(all, c); }
+
+    // Shift the co-moment of each column to the means of all values
+    To *dst          = out.get();
+    const dim_t ostr = out.strides()[1];
+    for (size_t c = 0; c < cols.size(); ++c) {
+        const Comoments &m = cols[c];
+        const double sum   = m.cXY + m.count * (m.meanX - all.meanX) *
+                                       (m.meanY - all.meanY);
+        dst[c * ostr] = static_cast<To>(sum / norm);
+    }
+}
+
+/// Subtracts the mean of each column of \p in and stores the result in
+/// \p out
+template<typename T, typename To>
+void centreColumns(Param<To> out, CParam<T> in) {
+    const std::vector<Comoments> cols = columnComoments<false>(in, in);
+
+    const af::dim4 dims = in.dims();
+    const af::dim4 istr = in.strides();
+    const af::dim4 ostr = out.strides();
+    const dim_t ncols   = static_cast<dim_t>(cols.size());
+
+    parallelForChunks(0, ncols, 1, [&](dim_t cbeg, dim_t cend) {
+        for (dim_t c = cbeg; c < cend; ++c) {
+            const dim_t i1 = c % dims[1];
+            const dim_t i2 = (c / dims[1]) % dims[2];
+            const dim_t i3 = c / (dims[1] * dims[2]);
+            const T *src =
+                in.get() + i1 * istr[1] + i2 * istr[2] + i3 * istr[3];
+            To *dst = out.get() + i1 * ostr[1] + i2 * ostr[2] + i3 * ostr[3];
+
+            const double mean = cols[c].meanX;
+            for (dim_t i = 0; i < dims[0]; ++i) {
+                dst[i] = static_cast<To>(static_cast<double>(src[i]) - mean);
+            }
+        }
+    });
+}
+
+/// Copies the lower triangle of the square matrix \p out to its upper
+/// triangle. When \p correlation is true, the covariances are first scaled
+/// by the standard deviations on the diagonal.
+template<typename T>
+void symmetricCovariance(Param<T> out, const bool correlation) {
+    const dim_t n  = out.dims()[0];
+    const dim_t ld = out.strides()[1];
+    T *const c     = out.get();
+
+    if (correlation) {
+        std::vector<double> inv(n);
+        for (dim_t i = 0; i < n; ++i) {
+            inv[i] = 1.0 / std::sqrt(static_cast<double>(c[i + i * ld]));
+        }
+        for (dim_t j = 0; j < n; ++j) {
+            for (dim_t i = j + 1; i < n; ++i) {
+                double r = c[i + j * ld] * inv[i] * inv[j];
+                // Rounding can push a correlation just outside [-1, 1]
+                if (r > 1.0) {
+                    r = 1.0;
+                } else if (r < -1.0) {
+                    r = -1.0;
+                }
+                c[i + j * ld] = static_cast<T>(r);
+            }
+            // Columns without any variance have no correlation at all
+            const bool varies = c[j + j * ld] * inv[j] * inv[j] > 0.0;
+            c[j + j * ld] =
+                varies ? T(1) : std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+    for (dim_t j = 0; j < n; ++j) {
+        for (dim_t i = j + 1; i < n; ++i) { c[j + i * ld] = c[i + j * ld]; }
+    }
+}
+
+}  // namespace kernel
+}  // namespace cpu
+}  // namespace arrayfire
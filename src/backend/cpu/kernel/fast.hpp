@@ -10,6 +10,10 @@
 #pragma once
 #include <Param.hpp>
 #include <math.hpp>
+#include <parallel.hpp>
+
+#include <algorithm>
+#include <vector>
 
 namespace arrayfire {
 namespace cpu {
@@ -58,111 +62,187 @@ inline unsigned abs_diff(unsigned x, unsigned y) {
 inline float abs_diff(float x, float y) { return fabs(x - y); }
 inline double abs_diff(double x, double y) { return fabs(x - y); }
 
+// Number of image rows scanned by one locate_features task
+constexpr int FastBandRows = 32;
+
+// segment_test()
+// Runs the full segment test on pixel (y, x) of image. Returns true and sets
+// score when the pixel is a corner.
+template<typename T>
+inline bool segment_test(const T *in_ptr, const float p, const float thr,
+                         const int y, const int x, const unsigned idim0,
+                         const unsigned arc_length, float *score) {
+    // Start by testing opposite pixels of the circle that will result in a
+    // non-kepoint
+    int d;
+    d = test_pixel<T>(in_ptr, p, thr, y - 3, x, idim0) |
+        test_pixel<T>(in_ptr, p, thr, y + 3, x, idim0);
+    if (d == 0) return false;
+
+    d &= test_pixel<T>(in_ptr, p, thr, y - 2, x + 2, idim0) |
+         test_pixel<T>(in_ptr, p, thr, y + 2, x - 2, idim0);
+    d &= test_pixel<T>(in_ptr, p, thr, y, x + 3, idim0) |
+         test_pixel<T>(in_ptr, p, thr, y, x - 3, idim0);
+    d &= test_pixel<T>(in_ptr, p, thr, y + 2, x + 2, idim0) |
+         test_pixel<T>(in_ptr, p, thr, y - 2, x - 2, idim0);
+    if (d == 0) return false;
+
+    d &= test_pixel<T>(in_ptr, p, thr, y - 3, x + 1, idim0) |
+         test_pixel<T>(in_ptr, p, thr, y + 3, x - 1, idim0);
+    d &= test_pixel<T>(in_ptr, p, thr, y - 1, x + 3, idim0) |
+         test_pixel<T>(in_ptr, p, thr, y + 1, x - 3, idim0);
+    d &= test_pixel<T>(in_ptr, p, thr, y + 1, x + 3, idim0) |
+         test_pixel<T>(in_ptr, p, thr, y - 1, x - 3, idim0);
+    d &= test_pixel<T>(in_ptr, p, thr, y + 3, x + 1, idim0) |
+         test_pixel<T>(in_ptr, p, thr, y - 3, x - 1, idim0);
+    if (d == 0) return false;
+
+    int sum = 0;
+
+    // Sum responses [-1, 0 or 1] of first arc_length pixels
+    for (int i = 0; i < static_cast<int>(arc_length); i++)
+        sum += test_pixel<T>(in_ptr, p, thr, y + idx_y(i), x + idx_x(i), idim0);
+
+    // Test maximum and mininmum responses of first segment of arc_length
+    // pixels
+    int max_sum = 0, min_sum = 0;
+    max_sum = std::max(max_sum, sum);
+    min_sum = std::min(min_sum, sum);
+
+    // Sum responses and test the remaining 16-arc_length pixels of the circle
+    for (int i = arc_length; i < 16; i++) {
+        sum -= test_pixel<T>(in_ptr, p, thr, y + idx_y(i - arc_length),
+                             x + idx_x(i - arc_length), idim0);
+        sum += test_pixel<T>(in_ptr, p, thr, y + idx_y(i), x + idx_x(i), idim0);
+        max_sum = std::max(max_sum, sum);
+        min_sum = std::min(min_sum, sum);
+    }
+
+    // To completely test all possible segments, it's necessary to test
+    // segments that include the top junction of the circle
+    for (int i = 0; i < static_cast<int>(arc_length - 1); i++) {
+        sum -= test_pixel<T>(in_ptr, p, thr, y + idx_y(16 - arc_length + i),
+                             x + idx_x(16 - arc_length + i), idim0);
+        sum += test_pixel<T>(in_ptr, p, thr, y + idx_y(i), x + idx_x(i), idim0);
+        max_sum = std::max(max_sum, sum);
+        min_sum = std::min(min_sum, sum);
+    }
+
+    // If sum at some point was equal to (+-)arc_length, there is a segment
+    // that for which all pixels are much brighter or much brighter than
+    // central pixel p.
+    if (max_sum != static_cast<int>(arc_length) &&
+        min_sum != -static_cast<int>(arc_length))
+        return false;
+
+    float s_bright = 0, s_dark = 0;
+    for (int i = 0; i < 16; i++) {
+        float p_x = (float)in_ptr[idx(y + idx_y(i), x + idx_x(i), idim0)];
+
+        s_bright += test_greater(p_x, p, thr) * (abs_diff(p_x, p) - thr);
+        s_dark += test_smaller(p_x, p, thr) * (abs_diff(p, p_x) - thr);
+    }
+
+    *score = std::max(s_bright, s_dark);
+    return true;
+}
+
+// compass_test()
+// Flags the pixels of rows [y0, y1) in column x for which both pairs of
+// opposite compass points of the circle are not entirely similar to the
+// center. Every corner passes this test, and the loop runs along the
+// contiguous column so it vectorizes.
+template<typename T>
+inline void compass_test(unsigned char *cand, const T *in_ptr, const float thr,
+                         const int y0, const int y1, const int x,
+                         const unsigned idim0) {
+    const T *col  = in_ptr + idx(0, x, idim0);
+    const T *colW = in_ptr + idx(0, x - 3, idim0);
+    const T *colE = in_ptr + idx(0, x + 3, idim0);
+
+    for (int y = y0; y < y1; y++) {
+        const float p  = (float)col[y];
+        const float hi = p + thr;
+        const float lo = p - thr;
+        const float pn = (float)col[y - 3];
+        const float ps = (float)col[y + 3];
+        const float pw = (float)colW[y];
+        const float pe = (float)colE[y];
+
+        cand[y - y0] = ((pn > hi) | (pn < lo) | (ps > hi) | (ps < lo)) &
+                       ((pw > hi) | (pw < lo) | (pe > hi) | (pe < lo));
+    }
+}
+
 template<typename T>
 void locate_features(CParam<T> in, Param<float> score, Param<float> x_out,
                      Param<float> y_out, Param<float> score_out,
                      unsigned *count, float const thr,
                      unsigned const arc_length, unsigned const nonmax,
                      unsigned const max_feat, unsigned const edge) {
+    struct Corner {
+        int y, x;
+        float score;
+    };
+
     af::dim4 in_dims = in.dims();
     T const *in_ptr  = in.get();
 
-    for (int y = edge; y < (int)(in_dims[0] - edge); y++) {
-        for (int x = edge; x < (int)(in_dims[1] - edge); x++) {
-            float p = in_ptr[idx(y, x, in_dims[0])];
-
-            // Start by testing opposite pixels of the circle that will result
-            // in a non-kepoint
-            int d;
-            d = test_pixel<T>(in_ptr, p, thr, y - 3, x, in_dims[0]) |
-                test_pixel<T>(in_ptr, p, thr, y + 3, x, in_dims[0]);
-            if (d == 0) continue;
-
-            d &= test_pixel<T>(in_ptr, p, thr, y - 2, x + 2, in_dims[0]) |
-                 test_pixel<T>(in_ptr, p, thr, y + 2, x - 2, in_dims[0]);
-            d &= test_pixel<T>(in_ptr, p, thr, y, x + 3, in_dims[0]) |
-                 test_pixel<T>(in_ptr, p, thr, y, x - 3, in_dims[0]);
-            d &= test_pixel<T>(in_ptr, p, thr, y + 2, x + 2, in_dims[0]) |
-                 test_pixel<T>(in_ptr, p, thr, y - 2, x - 2, in_dims[0]);
-            if (d == 0) continue;
-
-            d &= test_pixel<T>(in_ptr, p, thr, y - 3, x + 1, in_dims[0]) |
-                 test_pixel<T>(in_ptr, p, thr, y + 3, x - 1, in_dims[0]);
-            d &= test_pixel<T>(in_ptr, p, thr, y - 1, x + 3, in_dims[0]) |
-                 test_pixel<T>(in_ptr, p, thr, y + 1, x - 3, in_dims[0]);
-            d &= test_pixel<T>(in_ptr, p, thr, y + 1, x + 3, in_dims[0]) |
-                 test_pixel<T>(in_ptr, p, thr, y - 1, x - 3, in_dims[0]);
-            d &= test_pixel<T>(in_ptr, p, thr, y + 3, x + 1, in_dims[0]) |
-                 test_pixel<T>(in_ptr, p, thr, y - 3, x - 1, in_dims[0]);
-            if (d == 0) continue;
-
-            int sum = 0;
-
-            // Sum responses [-1, 0 or 1] of first arc_length pixels
-            for (int i = 0; i < static_cast<int>(arc_length); i++)
-                sum += test_pixel<T>(in_ptr, p, thr, y + idx_y(i), x + idx_x(i),
-                                     in_dims[0]);
-
-            // Test maximum and mininmum responses of first segment of
-            // arc_length pixels
-            int max_sum = 0, min_sum = 0;
-            max_sum = std::max(max_sum, sum);
-            min_sum = std::min(min_sum, sum);
-
-            // Sum responses and test the remaining 16-arc_length pixels of the
-            // circle
-            for (int i = arc_length; i < 16; i++) {
-                sum -= test_pixel<T>(in_ptr, p, thr, y + idx_y(i - arc_length),
-                                     x + idx_x(i - arc_length), in_dims[0]);
-                sum += test_pixel<T>(in_ptr, p, thr, y + idx_y(i), x + idx_x(i),
-                                     in_dims[0]);
-                max_sum = std::max(max_sum, sum);
-                min_sum = std::min(min_sum, sum);
-            }
+    const int y_beg = edge, y_end = (int)(in_dims[0] - edge);
+    const int x_beg = edge, x_end = (int)(in_dims[1] - edge);
+    if (y_beg >= y_end || x_beg >= x_end) return;
 
-            // To completely test all possible segments, it's necessary to test
-            // segments that include the top junction of the circle
-            for (int i = 0; i < static_cast<int>(arc_length - 1); i++) {
-                sum -= test_pixel<T>(
-                    in_ptr, p, thr, y + idx_y(16 - arc_length + i),
-                    x + idx_x(16 - arc_length + i), in_dims[0]);
-                sum += test_pixel<T>(in_ptr, p, thr, y + idx_y(i), x + idx_x(i),
-                                     in_dims[0]);
-                max_sum = std::max(max_sum, sum);
-                min_sum = std::min(min_sum, sum);
-            }
+    // Bands of rows are scanned in parallel. Corners are buffered per band
+    // and emitted row by row, so they come out in the same order as a
+    // sequential row major scan.
+    const int nbands = (y_end - y_beg + FastBandRows - 1) / FastBandRows;
+    std::vector<std::vector<Corner>> corners(nbands);
+
+    parallelFor(nbands, [&](dim_t b) {
+        const int y0   = y_beg + b * FastBandRows;
+        const int y1   = std::min(y0 + FastBandRows, y_end);
+        const int rows = y1 - y0;
+
+        std::vector<unsigned char> cand(rows);
+        std::vector<unsigned char> found(rows * (x_end - x_beg), 0);
+        std::vector<float> found_score(rows * (x_end - x_beg));
+
+        for (int x = x_beg; x < x_end; x++) {
+            compass_test<T>(cand.data(), in_ptr, thr, y0, y1, x, in_dims[0]);
 
-            float s_bright = 0, s_dark = 0;
-            for (int i = 0; i < 16; i++) {
-                float p_x =
-                    (float)in_ptr[idx(y + idx_y(i), x + idx_x(i), in_dims[0])];
+            const int off = (x - x_beg) * rows;
+            for (int y = y0; y < y1; y++) {
+                if (!cand[y - y0]) continue;
 
-                s_bright +=
-                    test_greater(p_x, p, thr) * (abs_diff(p_x, p) - thr);
-                s_dark += test_smaller(p_x, p, thr) * (abs_diff(p, p_x) - thr);
+                float p = in_ptr[idx(y, x, in_dims[0])];
+                found[off + y - y0] =
+                    segment_test<T>(in_ptr, p, thr, y, x, in_dims[0],
+                                    arc_length, &found_score[off + y - y0]);
             }
+        }
+
+        for (int y = y0; y < y1; y++) {
+            for (int x = x_beg; x < x_end; x++) {
+                const int i = (x - x_beg) * rows + y - y0;
+                if (found[i]) corners[b].push_back({y, x, found_score[i]});
+            }
+        }
+    });
 
-            // If sum at some point was equal to (+-)arc_length, there is a
-            // segment that for which all pixels are much brighter or much
-            // brighter than central pixel p.
-            if (max_sum == static_cast<int>(arc_length) ||
-                min_sum == -static_cast<int>(arc_length)) {
-                unsigned j = *count;
-                ++*count;
-                if (j < max_feat) {
-                    float *x_out_ptr     = x_out.get();
-                    float *y_out_ptr     = y_out.get();
-                    float *score_out_ptr = score_out.get();
-                    x_out_ptr[j]         = static_cast<float>(x);
-                    y_out_ptr[j]         = static_cast<float>(y);
-                    score_out_ptr[j] =
-                        static_cast<float>(std::max(s_bright, s_dark));
-                    if (nonmax == 1) {
-                        float *score_ptr = score.get();
-                        score_ptr[idx(y, x, in_dims[0])] =
-                            std::max(s_bright, s_dark);
-                    }
-                }
+    float *x_out_ptr     = x_out.get();
+    float *y_out_ptr     = y_out.get();
+    float *score_out_ptr = score_out.get();
+    float *score_ptr     = nonmax == 1 ? score.get() : nullptr;
+
+    for (const auto &band : corners) {
+        for (const Corner &c : band) {
+            unsigned j = *count;
+            ++*count;
+            if (j < max_feat) {
+                x_out_ptr[j]     = static_cast<float>(c.x);
+                y_out_ptr[j]     = static_cast<float>(c.y);
+                score_out_ptr[j] = c.score;
+                if (nonmax == 1) score_ptr[idx(c.y, c.x, in_dims[0])] = c.score;
             }
         }
     }
@@ -9,46 +9,245 @@
 
 #pragma once
 #include <Param.hpp>
+#include <kernel/channels.hpp>
+#include <parallel.hpp>
+
+#include <algorithm>
+#include <vector>
 
 namespace arrayfire {
 namespace cpu {
 namespace kernel {
 
+/// Number of channels filtered together.
+///
+/// Sample i of lane l is stored at (i * lanes + l) and the states and
+/// coefficients of the lanes are interleaved the same way. The innermost
+/// loops run over the lanes, so the recursion of all of them vectorizes even
+/// though every channel depends on its own previous outputs.
+template<typename T>
+constexpr int iirLanes() {
+    return sizeof(T) >= 64 ? 1 : static_cast<int>(64 / sizeof(T));
+}
+
+/// Samples copied into the interleaved buffer at a time
+constexpr dim_t IirBlockSize = 256;
+
+/// Runs one transposed direct form II section over the interleaved samples
+/// in \p buf, in place. \p bc and \p ac hold the coefficients 0 to order of
+/// the section normalized by a0, \p z its order states.
+template<typename T>
+void iirSection(T *buf, const dim_t n, const T *bc, const T *ac, T *z,
+                const int order) {
+    constexpr int L = iirLanes<T>();
+
+    for (dim_t i = 0; i < n; ++i) {
+        T *v = buf + i * L;
+        T out[L];
+        for (int l = 0; l < L; ++l) { out[l] = bc[l] * v[l] + z[l]; }
+        for (int k = 1; k < order; ++k) {
+            const T *bk = bc + k * L;
+            const T *ak = ac + k * L;
+            T *zk       = z + (k - 1) * L;
+            for (int l = 0; l < L; ++l) {
+                zk[l] = zk[l + L] + bk[l] * v[l] - ak[l] * out[l];
+            }
+        }
+        if (order > 0) {
+            const T *bm = bc + order * L;
+            const T *am = ac + order * L;
+            T *zm       = z + (order - 1) * L;
+            for (int l = 0; l < L; ++l) {
+                zm[l] = bm[l] * v[l] - am[l] * out[l];
+            }
+        }
+        for (int l = 0; l < L; ++l) { v[l] = out[l]; }
+    }
+}
+
+/// iirSection for an order \p M known at compile time. The coefficients and
+/// states are copied to local arrays, which the compiler knows are not
+/// aliased by the samples, so they stay in registers across the samples.
+template<typename T, int M>
+void iirSection(T *buf, const dim_t n, const T *bc, const T *ac, T *z) {
+    constexpr int L = iirLanes<T>();
+
+    T b[M + 1][L], a[M + 1][L], s[M][L];
+    for (int k = 0; k <= M; ++k) {
+        for (int l = 0; l < L; ++l) {
+            b[k][l] = bc[k * L + l];
+            a[k][l] = ac[k * L + l];
+            if (k < M) { s[k][l] = z[k * L + l]; }
+        }
+    }
+
+    for (dim_t i = 0; i < n; ++i) {
+        T *v = buf + i * L;
+        T in[L], out[L];
+        for (int l = 0; l < L; ++l) {
+            in[l]  = v[l];
+            out[l] = b[0][l] * in[l] + s[0][l];
+        }
+        for (int k = 1; k < M; ++k) {
+            for (int l = 0; l < L; ++l) {
+                s[k - 1][l] = s[k][l] + b[k][l] * in[l] - a[k][l] * out[l];
+            }
+        }
+        for (int l = 0; l < L; ++l) {
+            s[M - 1][l] = b[M][l] * in[l] - a[M][l] * out[l];
+            v[l]        = out[l];
+        }
+    }
+
+    for (int k = 0; k < M; ++k) {
+        for (int l = 0; l < L; ++l) { z[k * L + l] = s[k][l]; }
+    }
+}
+
+/// Runs iirSection with the orders up to 8 unrolled
 template<typename T>
-void iir(Param<T> y, Param<T> c, CParam<T> a) {
-    dim4 ydims = c.dims();
-    int num_a  = a.dims(0);
-
-    for (int l = 0; l < (int)ydims[3]; l++) {
-        dim_t yidx3 = l * y.strides(3);
-        dim_t cidx3 = l * c.strides(3);
-        dim_t aidx3 = l * a.strides(3);
-
-        for (int k = 0; k < (int)ydims[2]; k++) {
-            dim_t yidx2 = k * y.strides(2) + yidx3;
-            dim_t cidx2 = k * c.strides(2) + cidx3;
-            dim_t aidx2 = k * a.strides(2) + aidx3;
-
-            for (int j = 0; j < (int)ydims[1]; j++) {
-                dim_t yidx1 = j * y.strides(1) + yidx2;
-                dim_t cidx1 = j * c.strides(1) + cidx2;
-                dim_t aidx1 = j * a.strides(1) + aidx2;
-
-                std::vector<T> h_z(num_a);
-
-                const T *h_a = a.get() + (a.dims().ndims() > 1 ? aidx1 : 0);
-                T *h_c       = c.get() + cidx1;
-                T *h_y       = y.get() + yidx1;
-
-                for (int i = 0; i < (int)ydims[0]; i++) {
-                    T y = h_y[i] = (h_c[i] + h_z[0]) / h_a[0];
-                    for (int ii = 1; ii < num_a; ii++) {
-                        h_z[ii - 1] = h_z[ii] - h_a[ii] * y;
+void iirSectionDispatch(T *buf, const dim_t n, const T *bc, const T *ac,
+                        T *z, const int order) {
+    switch (order) {
+        case 1: iirSection<T, 1>(buf, n, bc, ac, z); break;
+        case 2: iirSection<T, 2>(buf, n, bc, ac, z); break;
+        case 3: iirSection<T, 3>(buf, n, bc, ac, z); break;
+        case 4: iirSection<T, 4>(buf, n, bc, ac, z); break;
+        case 5: iirSection<T, 5>(buf, n, bc, ac, z); break;
+        case 6: iirSection<T, 6>(buf, n, bc, ac, z); break;
+        case 7: iirSection<T, 7>(buf, n, bc, ac, z); break;
+        case 8: iirSection<T, 8>(buf, n, bc, ac, z); break;
+        default: iirSection<T>(buf, n, bc, ac, z, order); break;
+    }
+}
+
+/// Filters every channel of \p x through \p nsections cascaded sections of
+/// order \p order, starting from the states in \p zi and leaving the final
+/// states in \p zf.
+///
+/// \p loadCoefs(c, bc, ac) writes the coefficients of channel \p c for
+/// every section, normalized by a0, into its lane of \p bc and \p ac. The
+/// coefficients of section s and index k go to ((s * (order + 1) + k) *
+/// lanes + lane). States are rows (s * order + k) of zi and zf.
+template<typename T, typename LoadCoefs>
+void iirCascade(Param<T> y, Param<T> zf, CParam<T> x, CParam<T> zi,
+                const int nsections, const int order, LoadCoefs &&loadCoefs) {
+    constexpr int L = iirLanes<T>();
+
+    const af::dim4 ydims = y.dims();
+    const dim_t n        = ydims[0];
+    const dim_t nchans   = ydims[1] * ydims[2] * ydims[3];
+    const dim_t ngroups  = (nchans + L - 1) / L;
+    const int nstates    = nsections * order;
+    const int ncoefs     = nsections * (order + 1);
+    const dim_t xstride  = x.strides(0);
+    const dim_t ystride  = y.strides(0);
+    const dim_t zistride = zi.strides(0);
+    const dim_t zfstride = zf.strides(0);
+
+    parallelForChunks(0, ngroups, 1, [&](dim_t gbeg, dim_t gend) {
+        std::vector<T> buf(IirBlockSize * L);
+        std::vector<T> bc(ncoefs * L, T(0));
+        std::vector<T> ac(ncoefs * L, T(0));
+        std::vector<T> z(std::max(nstates, 1) * L, T(0));
+
+        for (dim_t g = gbeg; g < gend; ++g) {
+            const int count =
+                static_cast<int>(std::min<dim_t>(L, nchans - g * L));
+
+            // Unused lanes repeat the last channel and are never stored
+            const T *xs[L];
+            T *ys[L];
+            for (int l = 0; l < L; ++l) {
+                const dim_t c = g * L + std::min(l, count - 1);
+
+                xs[l] = x.get() + channelOffset(c, x.dims(), x.strides());
+                ys[l] = y.get() + channelOffset(c, ydims, y.strides());
+                loadCoefs(c, bc.data() + l, ac.data() + l);
+
+                const T *src =
+                    zi.get() + channelOffset(c, zi.dims(), zi.strides());
+                for (int k = 0; k < nstates; ++k) {
+                    z[k * L + l] = src[k * zistride];
+                }
+            }
+
+            for (dim_t i0 = 0; i0 < n; i0 += IirBlockSize) {
+                const dim_t len = std::min(IirBlockSize, n - i0);
+                for (int l = 0; l < L; ++l) {
+                    const T *src = xs[l] + i0 * xstride;
+                    for (dim_t i = 0; i < len; ++i) {
+                        buf[i * L + l] = src[i * xstride];
+                    }
+                }
+                for (int s = 0; s < nsections; ++s) {
+                    const dim_t coff = s * (order + 1) * L;
+                    iirSectionDispatch(buf.data(), len, bc.data() + coff,
+                                       ac.data() + coff,
+                                       z.data() + s * order * L, order);
+                }
+                for (int l = 0; l < count; ++l) {
+                    T *dst = ys[l] + i0 * ystride;
+                    for (dim_t i = 0; i < len; ++i) {
+                        dst[i * ystride] = buf[i * L + l];
                     }
                 }
             }
+
+            for (int l = 0; l < count; ++l) {
+                T *dst = zf.get() +
+                         channelOffset(g * L + l, zf.dims(), zf.strides());
+                for (int k = 0; k < nstates; ++k) {
+                    dst[k * zfstride] = z[k * L + l];
+                }
+            }
         }
-    }
+    });
+}
+
+/// Transposed direct form II filter with the feedforward coefficients \p b
+/// and the feedback coefficients \p a, both padded with zeros to
+/// max(len(b), len(a)). \p b and \p a hold one column per channel or a
+/// single column for all of them.
+template<typename T>
+void iir(Param<T> y, Param<T> zf, CParam<T> b, CParam<T> a, CParam<T> x,
+         CParam<T> zi) {
+    constexpr int L = iirLanes<T>();
+
+    const int nb    = static_cast<int>(b.dims(0));
+    const int na    = static_cast<int>(a.dims(0));
+    const int order = std::max(nb, na) - 1;
+
+    iirCascade(y, zf, x, zi, 1, order, [&](dim_t c, T *bc, T *ac) {
+        const T *bcol = b.get() + channelOffset(c, b.dims(), b.strides());
+        const T *acol = a.get() + channelOffset(c, a.dims(), a.strides());
+        const T a0    = acol[0];
+        for (int k = 0; k <= order; ++k) {
+            bc[k * L] = k < nb ? bcol[k] / a0 : T(0);
+            ac[k * L] = k < na ? acol[k] / a0 : T(0);
+        }
+    });
+}
+
+/// Cascade of second order sections. Column s of \p sos holds b0, b1, b2,
+/// a0, a1 and a2 of section s, shared by all channels.
+template<typename T>
+void iirSos(Param<T> y, Param<T> zf, CParam<T> sos, CParam<T> x,
+            CParam<T> zi) {
+    constexpr int L = iirLanes<T>();
+
+    const int nsections = static_cast<int>(sos.dims(1));
+
+    iirCascade(y, zf, x, zi, nsections, 2, [&](dim_t, T *bc, T *ac) {
+        for (int s = 0; s < nsections; ++s) {
+            const T *col = sos.get() + s * sos.strides(1);
+            const T a0   = col[3];
+            for (int k = 0; k <= 2; ++k) {
+                bc[(s * 3 + k) * L] = col[k] / a0;
+                ac[(s * 3 + k) * L] = col[3 + k] / a0;
+            }
+        }
+    });
 }
 
 }  // namespace kernel
@@ -67,6 +67,24 @@ InT cubicInterpFunc(InT val[4], LocT xratio, bool spline) {
     return a0 * xratio3 + a1 * xratio2 + a2 * xratio + a3;
 }
 
+/// Weights of the four taps of cubicInterpFunc at the fraction \p t
+template<typename WT>
+void cubicWeights(WT w[4], const WT t, const bool spline) {
+    const WT t2 = t * t;
+    const WT t3 = t2 * t;
+    if (spline) {
+        w[0] = WT(-0.5) * t3 + t2 - WT(0.5) * t;
+        w[1] = WT(1.5) * t3 - WT(2.5) * t2 + WT(1);
+        w[2] = WT(-1.5) * t3 + WT(2) * t2 + WT(0.5) * t;
+        w[3] = WT(0.5) * t3 - WT(0.5) * t2;
+    } else {
+        w[0] = -t3 + WT(2) * t2 - t;
+        w[1] = t3 - WT(2) * t2 + WT(1);
+        w[2] = -t3 + t2 + t;
+        w[3] = t3 - t2;
+    }
+}
+
 template<typename InT, typename LocT>
 InT bicubicInterpFunc(InT val[4][4], LocT xratio, LocT yratio, bool spline) {
     InT res[4];
@@ -285,7 +303,7 @@ struct Interp2<InT, LocT, 2> {
                 }
             }
             outptr[ooff + n * ostrides[batch_dim]] =
-                bilinearInterpFunc(val, off_x, off_y);
+                bilinearInterpFunc(val, xratio, yratio);
         }
     }
 };
@@ -62,13 +62,18 @@ void lu_split(Param<T> lower, Param<T> upper, CParam<T> in) {
     }
 }
 
-void convertPivot(Param<int> p, Param<int> pivot) {
-    int *d_pi = pivot.get();
-    int *d_po = p.get();
-    dim_t d0  = pivot.dims(0);
-    for (int j = 0; j < (int)d0; j++) {
-        // 1 indexed in pivot
-        std::swap(d_po[j], d_po[d_pi[j] - 1]);
+inline void convertPivot(Param<int> p, Param<int> pivot) {
+    const af::dim4 dims = pivot.dims();
+    for (dim_t w = 0; w < dims[3]; w++) {
+        for (dim_t z = 0; z < dims[2]; z++) {
+            const int *d_pi =
+                pivot.get() + z * pivot.strides(2) + w * pivot.strides(3);
+            int *d_po = p.get() + z * p.strides(2) + w * p.strides(3);
+            for (int j = 0; j < (int)dims[0]; j++) {
+                // 1 indexed in pivot
+                std::swap(d_po[j], d_po[d_pi[j] - 1]);
+            }
+        }
     }
 }
 
@@ -9,135 +9,289 @@
 
 #pragma once
 #include <Param.hpp>
+#include <parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace arrayfire {
 namespace cpu {
 namespace kernel {
 
-template<typename OutT, typename InT, af::matchType MatchType>
-void matchTemplate(Param<OutT> out, CParam<InT> sImg, CParam<InT> tImg) {
-    constexpr bool needMean = MatchType == AF_ZSAD || MatchType == AF_LSAD ||
-                              MatchType == AF_ZSSD || MatchType == AF_LSSD ||
-                              MatchType == AF_ZNCC;
+/// True for the metrics that are computed from the cross-correlation of the
+/// window with the template and the sums and energies of both
+constexpr bool isCorrelationMetric(const af::matchType type) {
+    return type == AF_SSD || type == AF_ZSSD || type == AF_LSSD ||
+           type == AF_NCC || type == AF_ZNCC;
+}
 
-    const af::dim4 sDims    = sImg.dims();
-    const af::dim4 tDims    = tImg.dims();
-    const af::dim4 sStrides = sImg.strides();
-    const af::dim4 tStrides = tImg.strides();
+/// One 2D image with its sizes and strides held as plain integers, so that
+/// the inner loops do not go through dim4
+template<typename T>
+struct Plane {
+    const T *ptr;
+    dim_t dim0;
+    dim_t dim1;
+    dim_t stride0;
+    dim_t stride1;
 
-    const dim_t tDim0 = tDims[0];
-    const dim_t tDim1 = tDims[1];
-    const dim_t sDim0 = sDims[0];
-    const dim_t sDim1 = sDims[1];
+    Plane(const T *p, const af::dim4 &dims, const af::dim4 &strides)
+        : ptr(p)
+        , dim0(dims[0])
+        , dim1(dims[1])
+        , stride0(strides[0])
+        , stride1(strides[1]) {}
 
-    const af::dim4 oStrides = out.strides();
+    T operator()(const dim_t i, const dim_t j) const {
+        return ptr[j * stride1 + i * stride0];
+    }
+};
+
+/// Sum and sum of squares of every template sized window of one image, from
+/// summed-area tables. The window at (i, j) covers [i, i + tDim0) x
+/// [j, j + tDim1), and the parts outside of the image count as zeros.
+///
+/// The tables are kept in double so that the energies of large windows do
+/// not lose the precision needed by the zero mean metrics.
+class WindowSums {
+    std::vector<double> sums;
+    std::vector<double> energies;
+    dim_t rows;
+    dim_t dim0;
+    dim_t dim1;
+    dim_t tDim0;
+    dim_t tDim1;
+
+    double rect(const std::vector<double> &sat, const dim_t i,
+                const dim_t j) const {
+        const dim_t i1 = std::min(i + tDim0, dim0);
+        const dim_t j1 = std::min(j + tDim1, dim1);
+        return sat[j1 * rows + i1] - sat[j * rows + i1] - sat[j1 * rows + i] +
+               sat[j * rows + i];
+    }
 
-    OutT tImgMean        = OutT(0);
-    dim_t winNumElements = tImg.dims().elements();
-    const InT* tpl       = tImg.get();
+   public:
+    template<typename T>
+    WindowSums(const Plane<T> &img, const dim_t tRows, const dim_t tCols)
+        : sums((img.dim0 + 1) * (img.dim1 + 1), 0.0)
+        , energies(sums.size(), 0.0)
+        , rows(img.dim0 + 1)
+        , dim0(img.dim0)
+        , dim1(img.dim1)
+        , tDim0(tRows)
+        , tDim1(tCols) {
+        for (dim_t j = 0; j < dim1; ++j) {
+            double sum  = 0.0;
+            double sum2 = 0.0;
+            for (dim_t i = 0; i < dim0; ++i) {
+                const double v = static_cast<double>(img(i, j));
+                sum += v;
+                sum2 += v * v;
+                const dim_t idx = (j + 1) * rows + i + 1;
+                sums[idx]       = sums[idx - rows] + sum;
+                energies[idx]   = energies[idx - rows] + sum2;
+            }
+        }
+    }
+
+    double sum(const dim_t i, const dim_t j) const { return rect(sums, i, j); }
+    double energy(const dim_t i, const dim_t j) const {
+        return rect(energies, i, j);
+    }
+};
+
+/// Sum, energy and size of the template
+struct TemplateStats {
+    double sum    = 0.0;
+    double energy = 0.0;
+    double count  = 0.0;
+
+    template<typename T>
+    explicit TemplateStats(const Plane<T> &tpl) {
+        for (dim_t j = 0; j < tpl.dim1; ++j) {
+            for (dim_t i = 0; i < tpl.dim0; ++i) {
+                const double v = static_cast<double>(tpl(i, j));
+                sum += v;
+                energy += v * v;
+            }
+        }
+        count = static_cast<double>(tpl.dim0 * tpl.dim1);
+    }
+
+    double mean() const { return sum / count; }
+};
+
+/// Metric of one window from its cross-correlation \p corr with the
+/// template, its sum \p wSum and its energy \p wEnergy. Differences that
+/// should be non-negative are clamped against rounding.
+template<typename OutT, af::matchType MatchType>
+OutT fromCorrelation(const double corr, const double wSum,
+                     const double wEnergy, const TemplateStats &t) {
+    const double n = t.count;
+    switch (MatchType) {
+        case AF_SSD:
+            return static_cast<OutT>(
+                std::max(wEnergy - 2.0 * corr + t.energy, 0.0));
+        case AF_ZSSD: {
+            const double wVar = wEnergy - wSum * wSum / n;
+            const double tVar = t.energy - t.sum * t.sum / n;
+            const double cov  = corr - wSum * t.sum / n;
+            return static_cast<OutT>(std::max(wVar - 2.0 * cov + tVar, 0.0));
+        }
+        case AF_LSSD: {
+            const double scale = wSum / t.sum;
+            return static_cast<OutT>(std::max(
+                wEnergy - 2.0 * scale * corr + scale * scale * t.energy, 0.0));
+        }
+        case AF_NCC: {
+            const double norm = std::sqrt(wEnergy * t.energy);
+            return static_cast<OutT>(norm > 0.0 ? corr / norm : 0.0);
+        }
+        case AF_ZNCC: {
+            const double wVar = std::max(wEnergy - wSum * wSum / n, 0.0);
+            const double tVar = std::max(t.energy - t.sum * t.sum / n, 0.0);
+            const double norm = std::sqrt(wVar * tVar);
+            const double cov  = corr - wSum * t.sum / n;
+            return static_cast<OutT>(norm > 0.0 ? cov / norm : 0.0);
+        }
+        default: return OutT(0);
+    }
+}
 
-    if (needMean) {
-        for (dim_t tj = 0; tj < tDim1; tj++) {
-            dim_t tjStride = tj * tStrides[1];
+/// Term of one pixel pair for the metrics that are summed directly. The
+/// window and template means are fixed per window, so they are passed in
+/// rather than recomputed.
+template<typename OutT, af::matchType MatchType>
+struct MatchTerm {
+    OutT wMean;
+    OutT tMean;
 
-            for (dim_t ti = 0; ti < tDim0; ti++) {
-                tImgMean += (OutT)tpl[tjStride + ti * tStrides[0]];
+    OutT operator()(const OutT s, const OutT t) const {
+        switch (MatchType) {
+            case AF_SAD: return std::fabs(s - t);
+            case AF_ZSAD: return std::fabs(s - wMean - t + tMean);
+            case AF_LSAD: return std::fabs(s - (wMean / tMean) * t);
+            case AF_SSD: return (s - t) * (s - t);
+            case AF_ZSSD: {
+                const OutT d = s - wMean - t + tMean;
+                return d * d;
+            }
+            case AF_LSSD: {
+                const OutT d = s - (wMean / tMean) * t;
+                return d * d;
             }
+            // The normalized metrics sum the plain products
+            default: return s * t;
+        }
+    }
+};
+
+/// Sum of term(s, t) over the window at (si, sj). Windows that reach past
+/// the image are cut to the image, since the terms of the padded zeros are
+/// added separately.
+template<typename OutT, typename InT, typename Term>
+OutT windowSum(const Plane<InT> &img, const Plane<InT> &tpl, const dim_t si,
+               const dim_t sj, const Term &term) {
+    const dim_t iEnd = std::min(tpl.dim0, img.dim0 - si);
+    const dim_t jEnd = std::min(tpl.dim1, img.dim1 - sj);
+    OutT sum         = OutT(0);
+    for (dim_t tj = 0; tj < jEnd; ++tj) {
+        const InT *s = img.ptr + (sj + tj) * img.stride1 + si * img.stride0;
+        const InT *t = tpl.ptr + tj * tpl.stride1;
+        for (dim_t ti = 0; ti < iEnd; ++ti) {
+            sum += term(static_cast<OutT>(s[ti * img.stride0]),
+                        static_cast<OutT>(t[ti * tpl.stride0]));
         }
-        tImgMean /= winNumElements;
     }
+    return sum;
+}
 
-    OutT* dst      = out.get();
-    const InT* src = sImg.get();
+/// Sum of term(0, t) over the template pixels that fall outside of the
+/// image for the window at (si, sj)
+template<typename OutT, typename InT, typename Term>
+OutT paddingSum(const Plane<InT> &img, const Plane<InT> &tpl, const dim_t si,
+                const dim_t sj, const Term &term) {
+    const dim_t iEnd = std::min(tpl.dim0, img.dim0 - si);
+    const dim_t jEnd = std::min(tpl.dim1, img.dim1 - sj);
+    OutT sum         = OutT(0);
+    if (iEnd == tpl.dim0 && jEnd == tpl.dim1) { return sum; }
+    for (dim_t tj = 0; tj < tpl.dim1; ++tj) {
+        for (dim_t ti = tj < jEnd ? iEnd : 0; ti < tpl.dim0; ++ti) {
+            sum += term(OutT(0), static_cast<OutT>(tpl(ti, tj)));
+        }
+    }
+    return sum;
+}
+
+/// Direct evaluation of the metric at every offset, for small templates.
+///
+/// Window means and energies come from WindowSums instead of being summed
+/// for every offset. The metric is a template parameter of the term, so the
+/// innermost loop has no branches. Columns of the output run in parallel.
+template<typename OutT, typename InT, af::matchType MatchType>
+void matchTemplate(Param<OutT> out, CParam<InT> sImg, CParam<InT> tImg) {
+    // Pixels outside of the image add nothing to the plain products
+    constexpr bool normalized = MatchType == AF_NCC || MatchType == AF_ZNCC;
+
+    const af::dim4 sDims    = sImg.dims();
+    const af::dim4 sStrides = sImg.strides();
+    const af::dim4 oStrides = out.strides();
+    const dim_t oStride1    = oStrides[1];
+
+    const Plane<InT> tpl(tImg.get(), tImg.dims(), tImg.strides());
+    const TemplateStats tStats(tpl);
+    const OutT tMean = static_cast<OutT>(tStats.mean());
 
     for (dim_t b3 = 0; b3 < sDims[3]; ++b3) {
         for (dim_t b2 = 0; b2 < sDims[2]; ++b2) {
-            // slide through image window after window
-            for (dim_t sj = 0; sj < sDim1; sj++) {
-                dim_t ojStride = sj * oStrides[1];
-
-                for (dim_t si = 0; si < sDim0; si++) {
-                    OutT disparity = OutT(0);
-
-                    // mean for window
-                    // this variable will be used based on MatchType value
-                    OutT wImgMean = OutT(0);
-                    if (needMean) {
-                        for (dim_t tj = 0, j = sj; tj < tDim1; tj++, j++) {
-                            dim_t jStride = j * sStrides[1];
-
-                            for (dim_t ti = 0, i = si; ti < tDim0; ti++, i++) {
-                                InT sVal = ((j < sDim1 && i < sDim0)
-                                                ? src[jStride + i * sStrides[0]]
-                                                : InT(0));
-                                wImgMean += (OutT)sVal;
-                            }
-                        }
-                        wImgMean /= winNumElements;
-                    }
+            const Plane<InT> img(
+                sImg.get() + b2 * sStrides[2] + b3 * sStrides[3], sDims,
+                sStrides);
+            OutT *dst = out.get() + b2 * oStrides[2] + b3 * oStrides[3];
+            const WindowSums sums(img, tpl.dim0, tpl.dim1);
+
+            parallelForChunks(0, img.dim1, 8, [&](dim_t jBeg, dim_t jEnd) {
+                for (dim_t sj = jBeg; sj < jEnd; ++sj) {
+                    for (dim_t si = 0; si < img.dim0; ++si) {
+                        const double wSum = sums.sum(si, sj);
+                        const MatchTerm<OutT, MatchType> term{
+                            static_cast<OutT>(wSum / tStats.count), tMean};
 
-                    // run the window match metric
-                    for (dim_t tj = 0, j = sj; tj < tDim1; tj++, j++) {
-                        dim_t jStride  = j * sStrides[1];
-                        dim_t tjStride = tj * tStrides[1];
-
-                        for (dim_t ti = 0, i = si; ti < tDim0; ti++, i++) {
-                            InT sVal = ((j < sDim1 && i < sDim0)
-                                            ? src[jStride + i * sStrides[0]]
-                                            : InT(0));
-                            InT tVal = tpl[tjStride + ti * tStrides[0]];
-                            OutT temp;
-                            switch (MatchType) {
-                                case AF_SAD:
-                                    disparity += fabs((OutT)sVal - (OutT)tVal);
-                                    break;
-                                case AF_ZSAD:
-                                    disparity += fabs((OutT)sVal - wImgMean -
-                                                      (OutT)tVal + tImgMean);
-                                    break;
-                                case AF_LSAD:
-                                    disparity +=
-                                        fabs((OutT)sVal -
-                                             (wImgMean / tImgMean) * tVal);
-                                    break;
-                                case AF_SSD:
-                                    disparity += ((OutT)sVal - (OutT)tVal) *
-                                                 ((OutT)sVal - (OutT)tVal);
-                                    break;
-                                case AF_ZSSD:
-                                    temp = ((OutT)sVal - wImgMean - (OutT)tVal +
-                                            tImgMean);
-                                    disparity += temp * temp;
-                                    break;
-                                case AF_LSSD:
-                                    temp = ((OutT)sVal -
-                                            (wImgMean / tImgMean) * tVal);
-                                    disparity += temp * temp;
-                                    break;
-                                case AF_NCC:
-                                    // TODO: furture implementation
-                                    break;
-                                case AF_ZNCC:
-                                    // TODO: furture implementation
-                                    break;
-                                case AF_SHD:
-                                    // TODO: furture implementation
-                                    break;
-                            }
+                        OutT value = windowSum<OutT>(img, tpl, si, sj, term);
+                        if (normalized) {
+                            value = fromCorrelation<OutT, MatchType>(
+                                static_cast<double>(value), wSum,
+                                sums.energy(si, sj), tStats);
+                        } else {
+                            value += paddingSum<OutT>(img, tpl, si, sj, term);
                         }
+                        dst[sj * oStride1 + si] = value;
                     }
-                    // output is just created, hence not doing the
-                    // extra multiplication for 0th dim stride
-                    dst[ojStride + si] = disparity;
                 }
-            }
-            src += sStrides[2];
-            dst += oStrides[2];
+            });
         }
-        src += sStrides[3];
-        dst += oStrides[3];
     }
-};
+}
+
+/// Writes the metric of every window of \p img to \p dst, given the
+/// cross-correlation \p corr of the image with the template. Element (i, j)
+/// of the correlation is at corr[j * corrStride + i].
+template<typename OutT, typename InT, af::matchType MatchType>
+void matchFromCorrelation(OutT *dst, const dim_t dstStride, const double *corr,
+                          const dim_t corrStride, const Plane<InT> &img,
+                          const Plane<InT> &tpl, const TemplateStats &tStats) {
+    const WindowSums sums(img, tpl.dim0, tpl.dim1);
+    parallelForChunks(0, img.dim1, 16, [&](dim_t jBeg, dim_t jEnd) {
+        for (dim_t j = jBeg; j < jEnd; ++j) {
+            for (dim_t i = 0; i < img.dim0; ++i) {
+                dst[j * dstStride + i] = fromCorrelation<OutT, MatchType>(
+                    corr[j * corrStride + i], sums.sum(i, j),
+                    sums.energy(i, j), tStats);
+            }
+        }
+    });
+}
 
 }  // namespace kernel
 }  // namespace cpu
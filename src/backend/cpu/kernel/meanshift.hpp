@@ -9,134 +9,296 @@
 
 #pragma once
 #include <Param.hpp>
+#include <parallel.hpp>
 #include <utility.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
 #include <type_traits>
 #include <vector>
 
 namespace arrayfire {
 namespace cpu {
 namespace kernel {
-template<typename T, bool IsColor>
+
+/// Width of a colour bin of the binned method, as a fraction of the
+/// chromatic sigma
+constexpr int MeanShiftBinsPerSigma = 4;
+
+/// Largest number of colour bins per channel of the binned method
+constexpr double MeanShiftMaxBins = 65536.0;
+
+/// One image of the input, converted to the accumulation type with one
+/// contiguous plane per channel. The binned method additionally keeps the
+/// colour bin of every pixel in the same layout.
+template<typename AccType, int Channels>
+struct MeanShiftImage {
+    const AccType *colors;
+    const std::uint16_t *bins;
+    dim_t width;
+    dim_t height;
+    dim_t plane;
+};
+
+/// Colour quantization of the binned method
+template<typename AccType, int Channels>
+struct MeanShiftBinning {
+    AccType minColor[Channels];
+    AccType invWidth;
+    int maxBin;
+    int threshold;
+
+    int bin(const AccType color, const int ch) const {
+        const AccType b = std::floor((color - minColor[ch]) * invWidth);
+        return static_cast<int>(std::min(std::max(b, AccType(0)),
+                                         static_cast<AccType>(maxBin)));
+    }
+};
+
+/// Runs the mean shift iterations of the pixel at (\p i, \p j) and leaves
+/// the converged colour in \p center. \p hits is scratch space for one
+/// window row.
+template<typename AccType, int Channels, bool Binned>
+void meanShiftPixel(AccType (&center)[Channels],
+                    const MeanShiftImage<AccType, Channels> &img,
+                    const MeanShiftBinning<AccType, Channels> &binning,
+                    const dim_t i, const dim_t j, const dim_t radius,
+                    const AccType cvar, const unsigned numIterations,
+                    unsigned char *hits) {
+    int meanPosJ = j;
+    int meanPosI = i;
+
+    for (unsigned it = 0; it < numIterations; ++it) {
+        int oldMeanPosJ = meanPosJ;
+        int oldMeanPosI = meanPosI;
+        unsigned count  = 0;
+        int shift_y     = 0;
+        int shift_x     = 0;
+
+        AccType mean[Channels] = {0};
+        int centerBin[Channels];
+        if (Binned) {
+            for (int ch = 0; ch < Channels; ++ch) {
+                centerBin[ch] = binning.bin(center[ch], ch);
+            }
+        }
+
+        // The window is clamped to the image once instead of testing every
+        // tap
+        const dim_t j0  = std::max(meanPosJ - radius, dim_t(0));
+        const dim_t j1  = std::min(meanPosJ + radius, img.height - 1);
+        const dim_t i0  = std::max(meanPosI - radius, dim_t(0));
+        const dim_t i1  = std::min(meanPosI + radius, img.width - 1);
+        const dim_t len = i1 - i0 + 1;
+
+        for (dim_t tj = j0; tj <= j1; ++tj) {
+            const dim_t off = tj * img.width + i0;
+
+            // Range test of the whole window row, free of branches so it
+            // can be vectorized
+            if (Binned) {
+                const int maxDiff = MeanShiftBinsPerSigma + 1;
+                for (dim_t k = 0; k < len; ++k) {
+                    int dist = 0;
+                    for (int ch = 0; ch < Channels; ++ch) {
+                        const int b =
+                            img.bins[ch * img.plane + off + k] - centerBin[ch];
+                        const int d = std::min(std::abs(b), maxDiff);
+                        dist += d * d;
+                    }
+                    hits[k] = dist <= binning.threshold;
+                }
+            } else {
+                for (dim_t k = 0; k < len; ++k) {
+                    AccType norm = 0;
+                    for (int ch = 0; ch < Channels; ++ch) {
+                        const AccType diff =
+                            center[ch] - img.colors[ch * img.plane + off + k];
+                        norm += diff * diff;
+                    }
+                    hits[k] = norm <= cvar;
+                }
+            }
+
+            int hit_count = 0;
+            for (dim_t k = 0; k < len; ++k) {
+                if (hits[k]) {
+                    for (int ch = 0; ch < Channels; ++ch) {
+                        mean[ch] += img.colors[ch * img.plane + off + k];
+                    }
+                    shift_x += i0 + k;
+                    ++hit_count;
+                }
+            }
+            count += hit_count;
+            shift_y += tj * hit_count;
+        }
+
+        if (count == 0) break;
+
+        const AccType fcount = 1 / static_cast<AccType>(count);
+
+        meanPosJ = static_cast<int>(std::trunc(shift_y * fcount));
+        meanPosI = static_cast<int>(std::trunc(shift_x * fcount));
+
+        for (int ch = 0; ch < Channels; ++ch) {
+            mean[ch] = std::trunc(mean[ch] * fcount);
+        }
+
+        AccType norm = 0;
+        for (int ch = 0; ch < Channels; ++ch) {
+            AccType diff = mean[ch] - center[ch];
+            norm += (diff * diff);
+        }
+
+        // stop the process if mean converged or within given tolerance range
+        bool stop = (meanPosJ == oldMeanPosJ && oldMeanPosI == meanPosI) ||
+                    ((abs(oldMeanPosJ - meanPosJ) +
+                      abs(oldMeanPosI - meanPosI) + norm) <= 1);
+
+        for (int ch = 0; ch < Channels; ++ch) { center[ch] = mean[ch]; }
+
+        if (stop) break;
+    }
+}
+
+template<typename T, bool IsColor, bool Binned>
 void meanShift(Param<T> out, CParam<T> in, const float spatialSigma,
                const float chromaticSigma, const unsigned numIterations) {
     typedef typename std::conditional<std::is_same<T, double>::value, double,
                                       float>::type AccType;
+    constexpr int channels = (IsColor ? 3 : 1);
 
     const af::dim4 dims     = in.dims();
     const af::dim4 istrides = in.strides();
     const af::dim4 ostrides = out.strides();
-    const unsigned bCount   = (IsColor ? 1 : dims[2]);
-    const unsigned channels = (IsColor ? dims[2] : 1);
+    const dim_t bCount      = (IsColor ? 1 : dims[2]);
+    const dim_t nimages     = bCount * dims[3];
+    const dim_t plane       = dims[0] * dims[1];
     const dim_t radius      = std::max((int)(spatialSigma * 1.5f), 1);
     const AccType cvar      = chromaticSigma * chromaticSigma;
 
-    std::array<AccType, 4> currentCenterColors{{0}};
-    std::array<AccType, 4> currentMeanColors{{0}};
-    std::array<AccType, 4> tempColors{{0}};
-    for (dim_t b3 = 0; b3 < dims[3]; ++b3) {
-        for (unsigned b2 = 0; b2 < bCount; ++b2) {
-            T* outData      = out.get() + b2 * ostrides[2] + b3 * ostrides[3];
-            const T* inData = in.get() + b2 * istrides[2] + b3 * istrides[3];
-
-            for (dim_t j = 0; j < dims[1]; ++j) {
-                dim_t j_in_off  = j * istrides[1];
-                dim_t j_out_off = j * ostrides[1];
-
-                for (dim_t i = 0; i < dims[0]; ++i) {
-                    dim_t i_in_off  = i * istrides[0];
-                    dim_t i_out_off = i * ostrides[0];
-
-                    for (unsigned ch = 0; ch < channels; ++ch)
-                        currentCenterColors[ch] = static_cast<AccType>(
-                            inData[j_in_off + i_in_off + ch * istrides[2]]);
-
-                    int meanPosJ = j;
-                    int meanPosI = i;
-
-                    // scope of meanshift iterations begin
-                    for (unsigned it = 0; it < numIterations; ++it) {
-                        int oldMeanPosJ = meanPosJ;
-                        int oldMeanPosI = meanPosI;
-                        unsigned count  = 0;
-                        int shift_y     = 0;
-                        int shift_x     = 0;
-
-                        currentMeanColors.fill(0);
-                        // Windowing operation
-                        for (dim_t wj = -radius; wj <= radius; ++wj) {
-                            int hit_count = 0;
-                            dim_t tj      = meanPosJ + wj;
-                            if (tj < 0 || tj > dims[1] - 1) continue;
-
-                            dim_t tjstride = tj * istrides[1];
-
-                            for (dim_t wi = -radius; wi <= radius; ++wi) {
-                                dim_t ti = meanPosI + wi;
-                                if (ti < 0 || ti > dims[0] - 1) continue;
-
-                                dim_t tistride = ti * istrides[0];
-
-                                AccType norm = 0;
-                                for (unsigned ch = 0; ch < channels; ++ch) {
-                                    tempColors[ch] = static_cast<AccType>(
-                                        inData[tistride + tjstride +
-                                               ch * istrides[2]]);
-                                    AccType diff = currentCenterColors[ch] -
-                                                   tempColors[ch];
-                                    norm += (diff * diff);
-                                }
-                                if (norm <= cvar) {
-                                    for (unsigned ch = 0; ch < channels; ++ch)
-                                        currentMeanColors[ch] += tempColors[ch];
-
-                                    shift_x += ti;
-                                    ++hit_count;
-                                }
-                            }
-                            count += hit_count;
-                            shift_y += tj * hit_count;
-                        }
-
-                        if (count == 0) break;
-
-                        const AccType fcount = 1 / static_cast<AccType>(count);
-
-                        meanPosJ =
-                            static_cast<int>(std::trunc(shift_y * fcount));
-                        meanPosI =
-                            static_cast<int>(std::trunc(shift_x * fcount));
-
-                        for (unsigned ch = 0; ch < channels; ++ch)
-                            currentMeanColors[ch] =
-                                std::trunc(currentMeanColors[ch] * fcount);
-
-                        AccType norm = 0;
-                        for (unsigned ch = 0; ch < channels; ++ch) {
-                            AccType diff =
-                                currentMeanColors[ch] - currentCenterColors[ch];
-                            norm += (diff * diff);
-                        }
-
-                        // stop the process if mean converged or within given
-                        // tolerance range
-                        bool stop = (meanPosJ == oldMeanPosJ &&
-                                     oldMeanPosI == meanPosI) ||
-                                    ((abs(oldMeanPosJ - meanPosJ) +
-                                      abs(oldMeanPosI - meanPosI) + norm) <= 1);
-
-                        for (unsigned ch = 0; ch < channels; ++ch)
-                            currentCenterColors[ch] = currentMeanColors[ch];
-
-                        if (stop) break;
-                    }  // scope of meanshift iterations end
-
-                    for (dim_t ch = 0; ch < channels; ++ch)
-                        outData[j_out_off + i_out_off + ch * ostrides[2]] =
-                            static_cast<T>(currentCenterColors[ch]);
-                }
+    // Convert the input once to planar AccType images, so the window loops
+    // read contiguous memory and do not convert every tap
+    std::vector<AccType> colors(nimages * channels * plane);
+    parallelFor(nimages * channels, [&](dim_t p) {
+        const dim_t img = p / channels;
+        const dim_t b2  = (IsColor ? p % channels : img % bCount);
+        const dim_t b3  = img / bCount;
+        const T *src    = in.get() + b2 * istrides[2] + b3 * istrides[3];
+        AccType *dst    = colors.data() + p * plane;
+        for (dim_t j = 0; j < dims[1]; ++j) {
+            const T *col = src + j * istrides[1];
+            AccType *row = dst + j * dims[0];
+            for (dim_t i = 0; i < dims[0]; ++i) {
+                row[i] = static_cast<AccType>(col[i * istrides[0]]);
+            }
+        }
+    });
+
+    MeanShiftBinning<AccType, channels> binning{};
+    std::vector<std::uint16_t> bins;
+    if (Binned) {
+        // Per channel colour range over the whole input
+        std::vector<AccType> planeMin(nimages * channels);
+        std::vector<AccType> planeMax(nimages * channels);
+        std::vector<char> planeFinite(nimages * channels);
+        parallelFor(nimages * channels, [&](dim_t p) {
+            const AccType *src = colors.data() + p * plane;
+            AccType lo         = src[0];
+            AccType hi         = src[0];
+            bool finite        = true;
+            for (dim_t k = 0; k < plane; ++k) {
+                lo     = std::min(lo, src[k]);
+                hi     = std::max(hi, src[k]);
+                finite = finite && std::isfinite(src[k]);
             }
+            planeMin[p]    = lo;
+            planeMax[p]    = hi;
+            planeFinite[p] = finite;
+        });
+
+        bool finite  = std::all_of(planeFinite.begin(), planeFinite.end(),
+                                   [](char f) { return f != 0; });
+        double range = 0;
+        for (int ch = 0; ch < channels; ++ch) {
+            AccType lo = std::numeric_limits<AccType>::max();
+            AccType hi = std::numeric_limits<AccType>::lowest();
+            for (dim_t img = 0; img < nimages; ++img) {
+                lo = std::min(lo, planeMin[img * channels + ch]);
+                hi = std::max(hi, planeMax[img * channels + ch]);
+            }
+            binning.minColor[ch] = lo;
+            range = std::max(range, static_cast<double>(hi) - lo);
+        }
+
+        // A zero chromatic sigma only accepts identical colours and
+        // non-finite colours cannot be binned, the exact method handles both
+        if (chromaticSigma <= 0 || !finite || !std::isfinite(range)) {
+            meanShift<T, IsColor, false>(out, in, spatialSigma,
+                                         chromaticSigma, numIterations);
+            return;
         }
+
+        // Bins are a fraction of the chromatic sigma wide, unless that would
+        // need more bins than fit in 16 bits
+        double width = double(chromaticSigma) / MeanShiftBinsPerSigma;
+        width        = std::max(width, range / (MeanShiftMaxBins - 1));
+        const double binsPerSigma = chromaticSigma / width;
+
+        binning.invWidth = static_cast<AccType>(1.0 / width);
+        binning.maxBin   = static_cast<int>(MeanShiftMaxBins - 1);
+        // The small bias keeps an exact multiple from rounding down
+        binning.threshold =
+            static_cast<int>(std::floor(binsPerSigma * binsPerSigma + 1e-6));
+
+        bins.resize(colors.size());
+        parallelFor(nimages * channels, [&](dim_t p) {
+            const int ch       = static_cast<int>(p % channels);
+            const AccType *src = colors.data() + p * plane;
+            std::uint16_t *dst = bins.data() + p * plane;
+            for (dim_t k = 0; k < plane; ++k) {
+                dst[k] = static_cast<std::uint16_t>(binning.bin(src[k], ch));
+            }
+        });
     }
+
+    // Every (image, column) pair is independent
+    parallelForChunks(0, nimages * dims[1], 1, [&](dim_t cbeg, dim_t cend) {
+        std::vector<unsigned char> hits(2 * radius + 1);
+        for (dim_t c = cbeg; c < cend; ++c) {
+            const dim_t img = c / dims[1];
+            const dim_t j   = c % dims[1];
+            const dim_t b2  = (IsColor ? 0 : img % bCount);
+            const dim_t b3  = img / bCount;
+
+            const MeanShiftImage<AccType, channels> image{
+                colors.data() + img * channels * plane,
+                Binned ? bins.data() + img * channels * plane : nullptr,
+                dims[0], dims[1], plane};
+            T *outData = out.get() + b2 * ostrides[2] + b3 * ostrides[3] +
+                         j * ostrides[1];
+
+            for (dim_t i = 0; i < dims[0]; ++i) {
+                AccType center[channels];
+                for (int ch = 0; ch < channels; ++ch) {
+                    center[ch] = image.colors[ch * plane + j * dims[0] + i];
+                }
+
+                meanShiftPixel<AccType, channels, Binned>(
+                    center, image, binning, i, j, radius, cvar,
+                    numIterations, hits.data());
+
+                for (int ch = 0; ch < channels; ++ch) {
+                    outData[i * ostrides[0] + ch * ostrides[2]] =
+                        static_cast<T>(center[ch]);
+                }
+            }
+        }
+    });
 }
 }  // namespace kernel
 }  // namespace cpu
@@ -0,0 +1,146 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+#include <Param.hpp>
+#include <common/dispatch.hpp>
+#include <common/quantile.hpp>
+#include <parallel.hpp>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace arrayfire {
+namespace cpu {
+namespace kernel {
+
+/// Number of columns next to each other in memory that are gathered
+/// together when the quantiles are not taken along dimension 0
+constexpr dim_t QuantileColumnBlock = 16;
+
+/// Strict weak ordering that places NaN values after all other values
+template<typename T, bool Floating = std::is_floating_point<T>::value>
+struct QuantileLess {
+    bool operator()(const T a, const T b) const { return a < b; }
+};
+
+template<typename T>
+struct QuantileLess<T, true> {
+    bool operator()(const T a, const T b) const {
+        return a < b || (b != b && a == a);
+    }
+};
+
+/// Moves the values of the sorted ranks \p ranks (ascending) of \p col into
+/// place and stores them in \p values. Every selection only partitions the
+/// part of the column above the previous rank.
+template<typename T>
+void selectRanks(double *values, T *col, const dim_t count,
+                 const std::vector<dim_t> &ranks) {
+    const QuantileLess<T> less;
+    dim_t begin = 0;
+    for (size_t r = 0; r < ranks.size(); ++r) {
+        const dim_t rank = ranks[r];
+        if (rank == begin) {
+            // Neighbouring ranks only need the minimum of the rest
+            std::iter_swap(col + rank,
+                           std::min_element(col + rank, col + count, less));
+        } else {
+            std::nth_element(col + begin, col + rank, col + count, less);
+        }
+        values[r] = static_cast<double>(col[rank]);
+        begin     = rank + 1;
+    }
+}
+
+/// Quantiles along \p dim with introselect. Columns are independent and run
+/// in parallel. For any other dimension than 0, blocks of columns that are
+/// next to each other in memory are gathered together.
+template<typename T, typename To>
+void quantile(Param<To> out, CParam<T> in,
+              const std::vector<common::QuantileRanks> &plan, const int dim) {
+    const af::dim4 dims    = in.dims();
+    const af::dim4 strides = in.strides();
+    const af::dim4 ostride = out.strides();
+    const dim_t count      = dims[dim];
+    const dim_t stride     = strides[dim];
+    const dim_t ostrideDim = ostride[dim];
+    const dim_t nprobs     = static_cast<dim_t>(plan.size());
+
+    dim_t odims[4] = {dims[0], dims[1], dims[2], dims[3]};
+    dim_t istr[4]  = {strides[0], strides[1], strides[2], strides[3]};
+    dim_t ostr[4]  = {ostride[0], ostride[1], ostride[2], ostride[3]};
+    odims[dim]     = 1;
+
+    // Distinct ranks of all quantiles, and where each quantile finds its two
+    std::vector<dim_t> ranks;
+    for (const auto &p : plan) {
+        ranks.push_back(p.lower);
+        ranks.push_back(p.upper);
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    std::vector<size_t> lowerIdx(nprobs), upperIdx(nprobs);
+    for (dim_t k = 0; k < nprobs; ++k) {
+        lowerIdx[k] = std::lower_bound(ranks.begin(), ranks.end(),
+                                       plan[k].lower) -
+                      ranks.begin();
+        upperIdx[k] = std::lower_bound(ranks.begin(), ranks.end(),
+                                       plan[k].upper) -
+                      ranks.begin();
+    }
+
+    const dim_t block   = std::min(QuantileColumnBlock, odims[0]);
+    const dim_t nblocks = divup(odims[0], block);
+    const dim_t ngroups = nblocks * odims[1] * odims[2] * odims[3];
+    const dim_t grain   = std::max(dim_t(1), dim_t(1 << 16) / (count * block));
+
+    parallelForChunks(0, ngroups, grain, [&](dim_t gbeg, dim_t gend) {
+        std::vector<T> cols(block * count);
+        std::vector<double> values(ranks.size());
+        for (dim_t g = gbeg; g < gend; ++g) {
+            const dim_t i0 = (g % nblocks) * block;
+            const dim_t r  = g / nblocks;
+            const dim_t i1 = r % odims[1];
+            const dim_t i2 = (r / odims[1]) % odims[2];
+            const dim_t i3 = r / (odims[1] * odims[2]);
+            const dim_t w  = std::min(block, odims[0] - i0);
+
+            const T *src =
+                in.get() + i0 * istr[0] + i1 * istr[1] + i2 * istr[2] +
+                i3 * istr[3];
+            To *dst = out.get() + i0 * ostr[0] + i1 * ostr[1] + i2 * ostr[2] +
+                      i3 * ostr[3];
+
+            for (dim_t j = 0; j < count; ++j) {
+                const T *row = src + j * stride;
+                for (dim_t l = 0; l < w; ++l) {
+                    cols[l * count + j] = row[l * istr[0]];
+                }
+            }
+
+            for (dim_t l = 0; l < w; ++l) {
+                selectRanks(values.data(), cols.data() + l * count, count,
+                            ranks);
+                To *o = dst + l * ostr[0];
+                for (dim_t k = 0; k < nprobs; ++k) {
+                    o[k * ostrideDim] = static_cast<To>(
+                        common::interpolateQuantile(plan[k],
+                                                    values[lowerIdx[k]],
+                                                    values[upperIdx[k]]));
+                }
+            }
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace cpu
+}  // namespace arrayfire
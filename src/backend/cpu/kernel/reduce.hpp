@@ -12,6 +12,10 @@
 #include <common/Binary.hpp>
 #include <common/Transform.hpp>
 #include <common/half.hpp>
+#include <kernel/Array.hpp>
+
+#include <algorithm>
+#include <vector>
 
 namespace arrayfire {
 namespace cpu {
@@ -199,6 +203,135 @@ struct reduce_all {
     }
 };
 
+/// Reduction of an unevaluated array. The values of the JIT tree \p node are
+/// evaluated one block at a time and reduced straight away, so the input is
+/// never written to memory.
+template<af_op_t op, typename Ti, typename To>
+struct reduce_node {
+    common::Transform<data_t<Ti>, compute_t<To>, op> transform;
+    common::Binary<compute_t<To>, op> reduce;
+
+    compute_t<To> value(const compute_t<Ti> val, bool change_nan,
+                        double nanval) {
+        // Same conversions as an evaluated input goes through
+        compute_t<To> in_val = transform(static_cast<data_t<Ti>>(val));
+        if (change_nan) in_val = IS_NAN(in_val) ? nanval : in_val;
+        return in_val;
+    }
+
+    void operator()(Param<To> out, common::Node_ptr node, const af::dim4 dims,
+                    const int dim, bool change_nan, double nanval) {
+        NodeEvaluator<Ti> values(node, dims);
+
+        const af::dim4 odims    = out.dims();
+        const af::dim4 ostrides = out.strides();
+
+        // Offsets of the accumulators, which are densely packed
+        dim_t astrides[4] = {1, odims[0], odims[0] * odims[1],
+                             odims[0] * odims[1] * odims[2]};
+        astrides[dim]     = 0;
+
+        std::vector<compute_t<To>> acc(odims.elements(), reduce.init());
+
+        for (dim_t w = 0; w < dims[3]; w++) {
+            for (dim_t z = 0; z < dims[2]; z++) {
+                for (dim_t y = 0; y < dims[1]; y++) {
+                    const dim_t off =
+                        y * astrides[1] + z * astrides[2] + w * astrides[3];
+
+                    for (dim_t x = 0; x < dims[0]; x += jit::VECTOR_LENGTH) {
+                        const int lim = static_cast<int>(std::min(
+                            dim_t(jit::VECTOR_LENGTH), dims[0] - x));
+                        const compute_t<Ti> *vals = values.calc(
+                            static_cast<int>(x), static_cast<int>(y),
+                            static_cast<int>(z), static_cast<int>(w), lim);
+
+                        if (dim == 0) {
+                            compute_t<To> out_val = acc[off];
+                            for (int i = 0; i < lim; i++) {
+                                compute_t<To> in_val =
+                                    value(vals[i], change_nan, nanval);
+                                out_val = reduce(in_val, out_val);
+                            }
+                            acc[off] = out_val;
+                        } else {
+                            compute_t<To> *accPtr = acc.data() + off + x;
+                            for (int i = 0; i < lim; i++) {
+                                compute_t<To> in_val =
+                                    value(vals[i], change_nan, nanval);
+                                accPtr[i] = reduce(in_val, accPtr[i]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        data_t<To> *const outPtr = out.get();
+        const compute_t<To> *src = acc.data();
+        for (dim_t w = 0; w < odims[3]; w++) {
+            for (dim_t z = 0; z < odims[2]; z++) {
+                for (dim_t y = 0; y < odims[1]; y++) {
+                    data_t<To> *dst = outPtr + y * ostrides[1] +
+                                      z * ostrides[2] + w * ostrides[3];
+                    for (dim_t x = 0; x < odims[0]; x++) {
+                        dst[x] = data_t<To>(*src++);
+                    }
+                }
+            }
+        }
+    }
+};
+
+/// Reduction of all values of an unevaluated array. See reduce_node.
+template<af_op_t op, typename Ti, typename To>
+struct reduce_all_node {
+    reduce_node<op, Ti, To> node_reduce;
+    common::Binary<compute_t<To>, op> reduce;
+
+    void operator()(Param<To> out, common::Node_ptr node, const af::dim4 dims,
+                    bool change_nan, double nanval) {
+        NodeEvaluator<Ti> values(node, dims);
+
+        compute_t<To> out_val = common::Binary<compute_t<To>, op>::init();
+        const auto accumulate = [&](const compute_t<Ti> *vals, int lim) {
+            for (int i = 0; i < lim; i++) {
+                out_val = reduce(
+                    node_reduce.value(vals[i], change_nan, nanval), out_val);
+            }
+        };
+
+        if (values.isLinear()) {
+            const dim_t num = dims.elements();
+            for (dim_t i = 0; i < num; i += jit::VECTOR_LENGTH) {
+                const int lim = static_cast<int>(
+                    std::min(dim_t(jit::VECTOR_LENGTH), num - i));
+                accumulate(values.calc(static_cast<int>(i), lim), lim);
+            }
+        } else {
+            for (dim_t w = 0; w < dims[3]; w++) {
+                for (dim_t z = 0; z < dims[2]; z++) {
+                    for (dim_t y = 0; y < dims[1]; y++) {
+                        for (dim_t x = 0; x < dims[0];
+                             x += jit::VECTOR_LENGTH) {
+                            const int lim = static_cast<int>(std::min(
+                                dim_t(jit::VECTOR_LENGTH), dims[0] - x));
+                            accumulate(
+                                values.calc(static_cast<int>(x),
+                                            static_cast<int>(y),
+                                            static_cast<int>(z),
+                                            static_cast<int>(w), lim),
+                                lim);
+                        }
+                    }
+                }
+            }
+        }
+
+        *out.get() = data_t<To>(out_val);
+    }
+};
+
 }  // namespace kernel
 }  // namespace cpu
 }  // namespace arrayfire
@@ -11,8 +11,12 @@
 #include <Param.hpp>
 #include <common/complex.hpp>
 #include <math.hpp>
+#include <parallel.hpp>
 #include <af/traits.hpp>
 
+#include <cmath>
+#include <vector>
+
 namespace arrayfire {
 namespace cpu {
 namespace kernel {
@@ -39,137 +43,88 @@ template<typename T>
 using vtype_t =
     typename conditional<common::is_complex<T>::value, T, wtype_t<T>>::type;
 
-template<typename T, af_interp_type method>
-struct resize_op {
-    void operator()(T *outPtr, const T *inPtr, const af::dim4 &odims,
-                    const af::dim4 &idims, const af::dim4 &ostrides,
-                    const af::dim4 &istrides, const dim_t x, const dim_t y) {
-        UNUSED(outPtr);
-        UNUSED(inPtr);
-        UNUSED(odims);
-        UNUSED(idims);
-        UNUSED(ostrides);
-        UNUSED(istrides);
-        UNUSED(x);
-        UNUSED(y);
-        return;
-    }
-};
-
-template<typename T>
-struct resize_op<T, AF_INTERP_NEAREST> {
-    void operator()(T *outPtr, const T *inPtr, const af::dim4 &odims,
-                    const af::dim4 &idims, const af::dim4 &ostrides,
-                    const af::dim4 &istrides, const dim_t x, const dim_t y) {
-        // Compute Indices
-        dim_t i_x = round2int((float)x / (odims[0] / (float)idims[0]));
-        dim_t i_y = round2int((float)y / (odims[1] / (float)idims[1]));
-
-        if (i_x >= idims[0]) i_x = idims[0] - 1;
-        if (i_y >= idims[1]) i_y = idims[1] - 1;
-
-        dim_t i_off = i_y * istrides[1] + i_x;
-        dim_t o_off = y * ostrides[1] + x;
-        // Copy values from all channels
-        for (dim_t w = 0; w < odims[3]; w++) {
-            dim_t wost = w * ostrides[3];
-            dim_t wist = w * istrides[3];
-            for (dim_t z = 0; z < odims[2]; z++) {
-                outPtr[o_off + z * ostrides[2] + wost] =
-                    inPtr[i_off + z * istrides[2] + wist];
-            }
+/// Input indices of every output index along one dimension. Nearest and
+/// lower use \p lo only, bilinear interpolates between \p lo and \p hi with
+/// the weight \p frac on \p hi.
+struct ResizeAxis {
+    std::vector<dim_t> lo;
+    std::vector<dim_t> hi;
+    std::vector<float> frac;
+
+    ResizeAxis(const af_interp_type method, const dim_t odim,
+               const dim_t idim)
+        : lo(odim), hi(odim), frac(odim, 0.0f) {
+        for (dim_t x = 0; x < odim; x++) {
+            const float f = (float)x / (odim / (float)idim);
+            dim_t i = method == AF_INTERP_NEAREST ? round2int(f) : floor(f);
+            if (i >= idim) i = idim - 1;
+
+            lo[x] = i;
+            hi[x] = (i + 1 >= idim ? idim - 1 : i + 1);
+            if (method == AF_INTERP_BILINEAR) frac[x] = f - i;
         }
     }
 };
 
-template<typename T>
-struct resize_op<T, AF_INTERP_BILINEAR> {
-    void operator()(T *outPtr, const T *inPtr, const af::dim4 &odims,
-                    const af::dim4 &idims, const af::dim4 &ostrides,
-                    const af::dim4 &istrides, const dim_t x, const dim_t y) {
-        // Compute Indices
-        float f_x = (float)x / (odims[0] / (float)idims[0]);
-        float f_y = (float)y / (odims[1] / (float)idims[1]);
-
-        dim_t i1_x = floor(f_x);
-        dim_t i1_y = floor(f_y);
-
-        if (i1_x >= idims[0]) i1_x = idims[0] - 1;
-        if (i1_y >= idims[1]) i1_y = idims[1] - 1;
+/// Resizes every image of \p in. The input indices and weights along each
+/// dimension are computed once, and the output columns are split across
+/// threads.
+template<typename T, af_interp_type method>
+void resize(Param<T> out, CParam<T> in) {
+    typedef typename af::dtype_traits<T>::base_type BT;
+    typedef wtype_t<BT> WT;
+    typedef vtype_t<T> VT;
 
-        float b = f_x - i1_x;
-        float a = f_y - i1_y;
+    const af::dim4 idims    = in.dims();
+    const af::dim4 odims    = out.dims();
+    const af::dim4 ostrides = out.strides();
+    const af::dim4 istrides = in.strides();
+    const T *inPtr          = in.get();
+    T *outPtr               = out.get();
 
-        dim_t i2_x = (i1_x + 1 >= idims[0] ? idims[0] - 1 : i1_x + 1);
-        dim_t i2_y = (i1_y + 1 >= idims[1] ? idims[1] - 1 : i1_y + 1);
+    const ResizeAxis ax(method, odims[0], idims[0]);
+    const ResizeAxis ay(method, odims[1], idims[1]);
 
-        typedef typename af::dtype_traits<T>::base_type BT;
-        typedef wtype_t<BT> WT;
-        typedef vtype_t<T> VT;
+    const dim_t width    = odims[0];
+    const dim_t istride1 = istrides[1];
+    const dim_t ostride1 = ostrides[1];
 
-        dim_t o_off = y * ostrides[1] + x;
-        // Copy values from all channels
+    parallelForChunks(0, odims[1], 8, [&](dim_t yBeg, dim_t yEnd) {
         for (dim_t w = 0; w < odims[3]; w++) {
-            dim_t wst = w * istrides[3];
             for (dim_t z = 0; z < odims[2]; z++) {
-                dim_t zst         = z * istrides[2];
-                dim_t channel_off = zst + wst;
-                VT p1 = inPtr[i1_y * istrides[1] + i1_x + channel_off];
-                VT p2 = inPtr[i2_y * istrides[1] + i1_x + channel_off];
-                VT p3 = inPtr[i1_y * istrides[1] + i2_x + channel_off];
-                VT p4 = inPtr[i2_y * istrides[1] + i2_x + channel_off];
-
-                outPtr[o_off + z * ostrides[2] + w * ostrides[3]] =
-                    scalar<WT>((1.0f - a) * (1.0f - b)) * p1 +
-                    scalar<WT>((a) * (1.0f - b)) * p2 +
-                    scalar<WT>((1.0f - a) * (b)) * p3 +
-                    scalar<WT>((a) * (b)) * p4;
+                const T *src = inPtr + z * istrides[2] + w * istrides[3];
+                T *dst       = outPtr + z * ostrides[2] + w * ostrides[3];
+                for (dim_t y = yBeg; y < yEnd; y++) {
+                    const T *row1 = src + ay.lo[y] * istride1;
+                    T *orow       = dst + y * ostride1;
+                    if (method != AF_INTERP_BILINEAR) {
+                        for (dim_t x = 0; x < width; x++) {
+                            orow[x] = row1[ax.lo[x]];
+                        }
+                        continue;
+                    }
+
+                    const T *row2 = src + ay.hi[y] * istride1;
+                    const float a = ay.frac[y];
+                    for (dim_t x = 0; x < width; x++) {
+                        const dim_t i1 = ax.lo[x];
+                        const dim_t i2 = ax.hi[x];
+                        const float b  = ax.frac[x];
+
+                        VT p1 = row1[i1];
+                        VT p2 = row2[i1];
+                        VT p3 = row1[i2];
+                        VT p4 = row2[i2];
+
+                        orow[x] = scalar<WT>((1.0f - a) * (1.0f - b)) * p1 +
+                                  scalar<WT>((a) * (1.0f - b)) * p2 +
+                                  scalar<WT>((1.0f - a) * (b)) * p3 +
+                                  scalar<WT>((a) * (b)) * p4;
+                    }
+                }
             }
         }
-    }
-};
-
-template<typename T>
-struct resize_op<T, AF_INTERP_LOWER> {
-    void operator()(T *outPtr, const T *inPtr, const af::dim4 &odims,
-                    const af::dim4 &idims, const af::dim4 &ostrides,
-                    const af::dim4 &istrides, const dim_t x, const dim_t y) {
-        // Compute Indices
-        dim_t i_x = floor((float)x / (odims[0] / (float)idims[0]));
-        dim_t i_y = floor((float)y / (odims[1] / (float)idims[1]));
-
-        if (i_x >= idims[0]) i_x = idims[0] - 1;
-        if (i_y >= idims[1]) i_y = idims[1] - 1;
-
-        dim_t i_off = i_y * istrides[1] + i_x;
-        dim_t o_off = y * ostrides[1] + x;
-        // Copy values from all channels
-        for (dim_t w = 0; w < odims[3]; w++) {
-            dim_t wost = w * ostrides[3];
-            dim_t wist = w * istrides[3];
-            for (dim_t z = 0; z < odims[2]; z++) {
-                outPtr[o_off + z * ostrides[2] + wost] =
-                    inPtr[i_off + z * istrides[2] + wist];
-            }
-        }
-    }
-};
-
-template<typename T, af_interp_type method>
-void resize(Param<T> out, CParam<T> in) {
-    af::dim4 idims    = in.dims();
-    af::dim4 odims    = out.dims();
-    const T *inPtr    = in.get();
-    T *outPtr         = out.get();
-    af::dim4 ostrides = out.strides();
-    af::dim4 istrides = in.strides();
-
-    resize_op<T, method> op;
-    for (dim_t y = 0; y < odims[1]; y++) {
-        for (dim_t x = 0; x < odims[0]; x++) {
-            op(outPtr, inPtr, odims, idims, ostrides, istrides, x, y);
-        }
-    }
+    });
 }
 
 }  // namespace kernel
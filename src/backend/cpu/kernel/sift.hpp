@@ -14,13 +14,12 @@
 
 #pragma once
 
-#include <convolve.hpp>
+#include <Array.hpp>
 #include <math.hpp>
-#include <memory.hpp>
-#include <resize.hpp>
-#include <sort_index.hpp>
+#include <parallel.hpp>
 
-#include <cstring>
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <vector>
 
@@ -82,11 +81,25 @@ static const unsigned GLOHAngularBins = 8;
 // Number of GLOH bins per histogram in descriptor
 static const unsigned GLOHHistBins = 16;
 
+
+// number of dim1 columns of a DoG layer scanned by one extrema detection task
+static const int ExtremaColsPerTask = 32;
+
 typedef struct {
     float f[4];
     unsigned l;
 } feat_t;
 
+typedef struct {
+    float x, y;
+    unsigned layer;
+} extremum_t;
+
+typedef struct {
+    float x, y, response, size, ori;
+    unsigned layer;
+} oriented_feat_t;
+
 bool feat_cmp(feat_t i, feat_t j) {
     for (int k = 0; k < 4; k++)
         if (i.f[k] != j.f[k]) return (i.f[k] < j.f[k]);
@@ -95,16 +108,61 @@ bool feat_cmp(feat_t i, feat_t j) {
     return false;
 }
 
-void array_to_feat(std::vector<feat_t>& feat, float* x, float* y,
-                   unsigned* layer, float* resp, float* size, unsigned nfeat) {
-    feat.resize(nfeat);
-    for (unsigned i = 0; i < feat.size(); i++) {
-        feat[i].f[0] = x[i];
-        feat[i].f[1] = y[i];
-        feat[i].f[2] = resp[i];
-        feat[i].f[3] = size[i];
-        feat[i].l    = layer[i];
+/// A level of the Gaussian or DoG pyramid, stored in column major order
+template<typename T>
+struct ScaleSpaceImage {
+    std::vector<T> data;
+    af::dim4 dims;
+
+    void resize(const dim_t d0, const dim_t d1) {
+        dims = af::dim4(d0, d1);
+        data.resize(d0 * d1);
+    }
+};
+
+/// Scratch buffers for the gradients of a keypoint's neighbourhood. Each
+/// thread reuses one set of buffers for all the keypoints it processes.
+struct GradientSamples {
+    std::vector<float> dx, dy, expo, bin0, bin1, bin2;
+
+    void resize(const size_t count) {
+        dx.resize(count);
+        dy.resize(count);
+        expo.resize(count);
+        bin0.resize(count);
+        bin1.resize(count);
+        bin2.resize(count);
     }
+};
+
+/// Calls \p func(begin, end, out) over chunks of [0, \p count) in parallel.
+/// \p func appends its results to \p out, and the results of all the chunks
+/// are returned in the same order a sequential loop would produce them.
+template<typename R, typename Func>
+std::vector<R> parallelGather(const dim_t count, const dim_t grain,
+                              Func&& func) {
+    std::vector<R> result;
+    if (count <= 0) { return result; }
+
+    const dim_t maxChunks = static_cast<dim_t>(getNumThreads()) * 4;
+    const dim_t nchunks =
+        std::max(std::min((count + grain - 1) / grain, maxChunks), dim_t(1));
+    const dim_t chunk = (count + nchunks - 1) / nchunks;
+
+    std::vector<std::vector<R>> parts(nchunks);
+    parallelFor(nchunks, [&](dim_t c) {
+        const dim_t begin = c * chunk;
+        const dim_t end   = std::min(begin + chunk, count);
+        if (begin < end) { func(begin, end, parts[c]); }
+    });
+
+    size_t total = 0;
+    for (const auto& part : parts) { total += part.size(); }
+    result.reserve(total);
+    for (const auto& part : parts) {
+        result.insert(result.end(), part.begin(), part.end());
+    }
+    return result;
 }
 
 template<typename T>
@@ -124,16 +182,117 @@ void gaussian1D(T* out, const int dim, double sigma = 0.0) {
 }
 
 template<typename T>
-Array<T> gauss_filter(float sigma) {
+std::vector<T> gauss_filter(float sigma) {
     // Using 6-sigma rule
     unsigned gauss_len = std::min((unsigned)round(sigma * 6 + 1) | 1, 31u);
 
-    Array<T> filter = createEmptyArray<T>(gauss_len);
-    gaussian1D((T*)getDevicePtr(filter), gauss_len, sigma);
+    std::vector<T> filter(gauss_len);
+    gaussian1D(filter.data(), gauss_len, sigma);
 
     return filter;
 }
 
+// Blurs in with the separable filter filt, treating pixels outside of the
+// image as zero like convolve2 does. The filter taps are applied in the same
+// order as convolve2 but the loops run along the contiguous dimension so
+// they vectorize. When dog is given, the difference between the result and
+// prev is written to it while the result is still in cache.
+template<typename T, typename convAccT>
+void separableBlur(ScaleSpaceImage<T>& out, const ScaleSpaceImage<T>& in,
+                   std::vector<T>& tmp, const std::vector<convAccT>& filt,
+                   ScaleSpaceImage<T>* dog = nullptr,
+                   const ScaleSpaceImage<T>* prev = nullptr) {
+    const dim_t d0   = in.dims[0];
+    const dim_t d1   = in.dims[1];
+    const dim_t flen = filt.size();
+    const dim_t half = flen >> 1;
+
+    out.resize(d0, d1);
+    if (dog) { dog->resize(d0, d1); }
+    tmp.resize(d0 * d1);
+
+    const T* iptr = in.data.data();
+    T* tptr       = tmp.data();
+    T* optr       = out.data.data();
+
+    // Filter along the first dimension
+    parallelForChunks(0, d1, 16, [&](dim_t begin, dim_t end) {
+        for (dim_t j = begin; j < end; ++j) {
+            const T* icol = iptr + j * d0;
+            T* tcol       = tptr + j * d0;
+            std::fill(tcol, tcol + d0, T(0));
+            for (dim_t f = 0; f < flen; ++f) {
+                const T fval   = filt[f];
+                const dim_t lo = std::max(f - half, dim_t(0));
+                const dim_t hi = std::min(d0 + f - half, d0);
+                for (dim_t i = lo; i < hi; ++i) {
+                    tcol[i] += icol[i + half - f] * fval;
+                }
+            }
+        }
+    });
+
+    // Filter along the second dimension and fuse the difference of Gaussians
+    parallelForChunks(0, d1, 16, [&](dim_t begin, dim_t end) {
+        for (dim_t j = begin; j < end; ++j) {
+            T* ocol = optr + j * d0;
+            std::fill(ocol, ocol + d0, T(0));
+            for (dim_t f = 0; f < flen; ++f) {
+                const dim_t offj = j + half - f;
+                if (offj < 0 || offj >= d1) { continue; }
+                const T fval = filt[f];
+                const T* src = tptr + offj * d0;
+                for (dim_t i = 0; i < d0; ++i) { ocol[i] += src[i] * fval; }
+            }
+            if (dog) {
+                const T* pcol = prev->data.data() + j * d0;
+                T* dcol       = dog->data.data() + j * d0;
+                for (dim_t i = 0; i < d0; ++i) { dcol[i] = ocol[i] - pcol[i]; }
+            }
+        }
+    });
+}
+
+// Bilinear resize, following the sampling of resize with AF_INTERP_BILINEAR
+template<typename T>
+void resizeBilinear(ScaleSpaceImage<T>& out, const ScaleSpaceImage<T>& in,
+                    const dim_t od0, const dim_t od1) {
+    const dim_t id0 = in.dims[0];
+    const dim_t id1 = in.dims[1];
+    out.resize(od0, od1);
+
+    const T* iptr = in.data.data();
+    T* optr       = out.data.data();
+
+    parallelForChunks(0, od1, 16, [&](dim_t begin, dim_t end) {
+        for (dim_t y = begin; y < end; ++y) {
+            float f_y  = (float)y / (od1 / (float)id1);
+            dim_t i1_y = floor(f_y);
+            if (i1_y >= id1) i1_y = id1 - 1;
+            const float a    = f_y - i1_y;
+            const dim_t i2_y = (i1_y + 1 >= id1 ? id1 - 1 : i1_y + 1);
+
+            for (dim_t x = 0; x < od0; ++x) {
+                float f_x  = (float)x / (od0 / (float)id0);
+                dim_t i1_x = floor(f_x);
+                if (i1_x >= id0) i1_x = id0 - 1;
+                const float b    = f_x - i1_x;
+                const dim_t i2_x = (i1_x + 1 >= id0 ? id0 - 1 : i1_x + 1);
+
+                const T p1 = iptr[i1_y * id0 + i1_x];
+                const T p2 = iptr[i2_y * id0 + i1_x];
+                const T p3 = iptr[i1_y * id0 + i2_x];
+                const T p4 = iptr[i2_y * id0 + i2_x];
+
+                optr[y * od0 + x] = T((1.0f - a) * (1.0f - b)) * p1 +
+                                    T((a) * (1.0f - b)) * p2 +
+                                    T((1.0f - a) * (b)) * p3 +
+                                    T((a) * (b)) * p4;
+            }
+        }
+    });
+}
+
 template<int N>
 void gaussianElimination(float* A, float* b, float* x) {
     // forward elimination
@@ -158,34 +317,19 @@ void gaussianElimination(float* A, float* b, float* x) {
     }
 }
 
-template<typename T>
-void sub(Array<T>& out, const Array<T>& in1, const Array<T>& in2) {
-    size_t nel       = in1.elements();
-    T* out_ptr       = out.get();
-    const T* in1_ptr = in1.get();
-    const T* in2_ptr = in2.get();
-
-    for (size_t i = 0; i < nel; i++) { out_ptr[i] = in1_ptr[i] - in2_ptr[i]; }
-}
-
 #define CPTR(Y, X) (center_ptr[(Y)*idims[0] + (X)])
 #define PPTR(Y, X) (prev_ptr[(Y)*idims[0] + (X)])
 #define NPTR(Y, X) (next_ptr[(Y)*idims[0] + (X)])
 
 // Determines whether a pixel is a scale-space extremum by comparing it to its
-// 3x3x3 pixel neighborhood.
+// 3x3x3 pixel neighborhood. Scans the dim1 columns [y_begin, y_end).
 template<typename T>
-void detectExtrema(float* x_out, float* y_out, unsigned* layer_out,
-                   unsigned* counter, const Array<T>& prev,
-                   const Array<T>& center, const Array<T>& next,
-                   const unsigned layer, const unsigned max_feat,
+void detectExtrema(std::vector<extremum_t>& out, const T* prev_ptr,
+                   const T* center_ptr, const T* next_ptr,
+                   const af::dim4& idims, const unsigned layer,
+                   const int y_begin, const int y_end,
                    const float threshold) {
-    const af::dim4 idims = center.dims();
-    const T* prev_ptr    = prev.get();
-    const T* center_ptr  = center.get();
-    const T* next_ptr    = next.get();
-
-    for (int y = ImgBorder; y < idims[1] - ImgBorder; y++) {
+    for (int y = y_begin; y < y_end; y++) {
         for (int x = ImgBorder; x < idims[0] - ImgBorder; x++) {
             float p = center_ptr[y * idims[0] + x];
 
@@ -217,12 +361,7 @@ void detectExtrema(float* x_out, float* y_out, unsigned* layer_out,
                   p < NPTR(y, x - 1) && p < NPTR(y, x) && p < NPTR(y, x + 1) &&
                   p < NPTR(y + 1, x - 1) && p < NPTR(y + 1, x) &&
                   p < NPTR(y + 1, x + 1)))) {
-                if (*counter < max_feat) {
-                    x_out[*counter]     = (float)y;
-                    y_out[*counter]     = (float)x;
-                    layer_out[*counter] = layer;
-                    (*counter)++;
-                }
+                out.push_back({(float)y, (float)x, layer});
             }
         }
     }
@@ -232,120 +371,112 @@ void detectExtrema(float* x_out, float* y_out, unsigned* layer_out,
 // accuracy to form an image feature. Rejects features with low contrast.
 // Based on Section 4 of Lowe's paper.
 template<typename T>
-void interpolateExtrema(float* x_out, float* y_out, unsigned* layer_out,
-                        float* response_out, float* size_out, unsigned* counter,
-                        const float* x_in, const float* y_in,
-                        const unsigned* layer_in, const unsigned extrema_feat,
-                        std::vector<Array<T>>& dog_pyr, const unsigned max_feat,
-                        const unsigned octave, const unsigned n_layers,
-                        const float contrast_thr, const float edge_thr,
-                        const float sigma, const float img_scale) {
-    for (int f = 0; f < (int)extrema_feat; f++) {
-        const float first_deriv_scale  = img_scale * 0.5f;
-        const float second_deriv_scale = img_scale;
-        const float cross_deriv_scale  = img_scale * 0.25f;
-
-        float xl = 0, xy = 0, xx = 0, contr = 0;
-        int i = 0;
-
-        unsigned x     = x_in[f];
-        unsigned y     = y_in[f];
-        unsigned layer = layer_in[f];
-
-        const T* prev_ptr = dog_pyr[octave * (n_layers + 2) + layer - 1].get();
-        const T* center_ptr = dog_pyr[octave * (n_layers + 2) + layer].get();
-        const T* next_ptr = dog_pyr[octave * (n_layers + 2) + layer + 1].get();
-
-        af::dim4 idims = dog_pyr[octave * (n_layers + 2)].dims();
-
-        bool converges = true;
-
-        for (i = 0; i < MaxInterpSteps; i++) {
-            float dD[3] = {
-                (float)(CPTR(x + 1, y) - CPTR(x - 1, y)) * first_deriv_scale,
-                (float)(CPTR(x, y + 1) - CPTR(x, y - 1)) * first_deriv_scale,
-                (float)(NPTR(x, y) - PPTR(x, y)) * first_deriv_scale};
-
-            float d2 = CPTR(x, y) * 2.f;
-            float dxx =
-                (CPTR(x + 1, y) + CPTR(x - 1, y) - d2) * second_deriv_scale;
-            float dyy =
-                (CPTR(x, y + 1) + CPTR(x, y - 1) - d2) * second_deriv_scale;
-            float dss = (NPTR(x, y) + PPTR(x, y) - d2) * second_deriv_scale;
-            float dxy = (CPTR(x + 1, y + 1) - CPTR(x - 1, y + 1) -
-                         CPTR(x + 1, y - 1) + CPTR(x - 1, y - 1)) *
-                        cross_deriv_scale;
-            float dxs = (NPTR(x + 1, y) - NPTR(x - 1, y) - PPTR(x + 1, y) +
-                         PPTR(x - 1, y)) *
-                        cross_deriv_scale;
-            float dys = (NPTR(x, y + 1) - NPTR(x - 1, y - 1) - PPTR(x, y - 1) +
-                         PPTR(x - 1, y - 1)) *
-                        cross_deriv_scale;
-
-            float H[9] = {dxx, dxy, dxs, dxy, dyy, dys, dxs, dys, dss};
-
-            float X[3];
-            gaussianElimination<3>(H, dD, X);
-
-            xl = -X[2];
-            xy = -X[1];
-            xx = -X[0];
-
-            if (fabs(xl) < 0.5f && fabs(xy) < 0.5f && fabs(xx) < 0.5f) break;
-
-            x += round(xx);
-            y += round(xy);
-            layer += round(xl);
-
-            if (layer < 1 || layer > n_layers || x < ImgBorder ||
-                x >= idims[1] - ImgBorder || y < ImgBorder ||
-                y >= idims[0] - ImgBorder) {
-                converges = false;
-                break;
-            }
-        }
+void interpolateExtremum(std::vector<feat_t>& out, const extremum_t& extremum,
+                         const std::vector<ScaleSpaceImage<T>>& dog_pyr,
+                         const unsigned octave, const unsigned n_layers,
+                         const float contrast_thr, const float edge_thr,
+                         const float sigma, const float img_scale) {
+    const float first_deriv_scale  = img_scale * 0.5f;
+    const float second_deriv_scale = img_scale;
+    const float cross_deriv_scale  = img_scale * 0.25f;
+
+    float xl = 0, xy = 0, xx = 0, contr = 0;
+    int i = 0;
+
+    unsigned x     = extremum.x;
+    unsigned y     = extremum.y;
+    unsigned layer = extremum.layer;
 
-        // ensure convergence of interpolation
-        if (i >= MaxInterpSteps || !converges) continue;
+    const unsigned base = octave * (n_layers + 2);
+    const T* prev_ptr   = dog_pyr[base + layer - 1].data.data();
+    const T* center_ptr = dog_pyr[base + layer].data.data();
+    const T* next_ptr   = dog_pyr[base + layer + 1].data.data();
 
+    const af::dim4 idims = dog_pyr[base].dims;
+
+    bool converges = true;
+
+    for (i = 0; i < MaxInterpSteps; i++) {
         float dD[3] = {
             (float)(CPTR(x + 1, y) - CPTR(x - 1, y)) * first_deriv_scale,
             (float)(CPTR(x, y + 1) - CPTR(x, y - 1)) * first_deriv_scale,
             (float)(NPTR(x, y) - PPTR(x, y)) * first_deriv_scale};
-        float X[3] = {xx, xy, xl};
-
-        float P = dD[0] * X[0] + dD[1] * X[1] + dD[2] * X[2];
 
-        contr = center_ptr[x * idims[0] + y] * img_scale + P * 0.5f;
-        if (abs(contr) < (contrast_thr / n_layers)) continue;
-
-        // principal curvatures are computed using the trace and det of Hessian
         float d2  = CPTR(x, y) * 2.f;
         float dxx = (CPTR(x + 1, y) + CPTR(x - 1, y) - d2) * second_deriv_scale;
         float dyy = (CPTR(x, y + 1) + CPTR(x, y - 1) - d2) * second_deriv_scale;
+        float dss = (NPTR(x, y) + PPTR(x, y) - d2) * second_deriv_scale;
         float dxy = (CPTR(x + 1, y + 1) - CPTR(x - 1, y + 1) -
                      CPTR(x + 1, y - 1) + CPTR(x - 1, y - 1)) *
                     cross_deriv_scale;
+        float dxs = (NPTR(x + 1, y) - NPTR(x - 1, y) - PPTR(x + 1, y) +
+                     PPTR(x - 1, y)) *
+                    cross_deriv_scale;
+        float dys = (NPTR(x, y + 1) - NPTR(x - 1, y - 1) - PPTR(x, y - 1) +
+                     PPTR(x - 1, y - 1)) *
+                    cross_deriv_scale;
 
-        float tr  = dxx + dyy;
-        float det = dxx * dyy - dxy * dxy;
+        float H[9] = {dxx, dxy, dxs, dxy, dyy, dys, dxs, dys, dss};
 
-        // add FLT_EPSILON for double-precision compatibility
-        if (det <= 0 ||
-            tr * tr * edge_thr >= (edge_thr + 1) * (edge_thr + 1) * det +
-                                      std::numeric_limits<float>::epsilon())
-            continue;
+        float X[3];
+        gaussianElimination<3>(H, dD, X);
+
+        xl = -X[2];
+        xy = -X[1];
+        xx = -X[0];
+
+        if (fabs(xl) < 0.5f && fabs(xy) < 0.5f && fabs(xx) < 0.5f) break;
 
-        if (*counter < max_feat) {
-            x_out[*counter]        = (x + xx) * (1 << octave);
-            y_out[*counter]        = (y + xy) * (1 << octave);
-            layer_out[*counter]    = layer;
-            response_out[*counter] = abs(contr);
-            size_out[*counter] =
-                sigma * pow(2.f, octave + (layer + xl) / n_layers) * 2.f;
-            (*counter)++;
+        x += round(xx);
+        y += round(xy);
+        layer += round(xl);
+
+        if (layer < 1 || layer > n_layers || x < ImgBorder ||
+            x >= idims[1] - ImgBorder || y < ImgBorder ||
+            y >= idims[0] - ImgBorder) {
+            converges = false;
+            break;
         }
     }
+
+    // ensure convergence of interpolation
+    if (i >= MaxInterpSteps || !converges) return;
+
+    float dD[3] = {
+        (float)(CPTR(x + 1, y) - CPTR(x - 1, y)) * first_deriv_scale,
+        (float)(CPTR(x, y + 1) - CPTR(x, y - 1)) * first_deriv_scale,
+        (float)(NPTR(x, y) - PPTR(x, y)) * first_deriv_scale};
+    float X[3] = {xx, xy, xl};
+
+    float P = dD[0] * X[0] + dD[1] * X[1] + dD[2] * X[2];
+
+    contr = center_ptr[x * idims[0] + y] * img_scale + P * 0.5f;
+    if (abs(contr) < (contrast_thr / n_layers)) return;
+
+    // principal curvatures are computed using the trace and det of Hessian
+    float d2  = CPTR(x, y) * 2.f;
+    float dxx = (CPTR(x + 1, y) + CPTR(x - 1, y) - d2) * second_deriv_scale;
+    float dyy = (CPTR(x, y + 1) + CPTR(x, y - 1) - d2) * second_deriv_scale;
+    float dxy = (CPTR(x + 1, y + 1) - CPTR(x - 1, y + 1) - CPTR(x + 1, y - 1) +
+                 CPTR(x - 1, y - 1)) *
+                cross_deriv_scale;
+
+    float tr  = dxx + dyy;
+    float det = dxx * dyy - dxy * dxy;
+
+    // add FLT_EPSILON for double-precision compatibility
+    if (det <= 0 ||
+        tr * tr * edge_thr >= (edge_thr + 1) * (edge_thr + 1) * det +
+                                  std::numeric_limits<float>::epsilon())
+        return;
+
+    feat_t feat;
+    feat.f[0] = (x + xx) * (1 << octave);
+    feat.f[1] = (y + xy) * (1 << octave);
+    feat.f[2] = abs(contr);
+    feat.f[3] = sigma * pow(2.f, octave + (layer + xl) / n_layers) * 2.f;
+    feat.l    = layer;
+    out.push_back(feat);
 }
 
 #undef CPTR
@@ -353,10 +484,10 @@ void interpolateExtrema(float* x_out, float* y_out, unsigned* layer_out,
 #undef NPTR
 
 // Remove duplicate keypoints
-void removeDuplicates(float* x_out, float* y_out, unsigned* layer_out,
-                      float* response_out, float* size_out, unsigned* counter,
-                      const std::vector<feat_t>& sorted_feat) {
+std::vector<feat_t> removeDuplicates(const std::vector<feat_t>& sorted_feat) {
     size_t nfeat = sorted_feat.size();
+    std::vector<feat_t> out;
+    out.reserve(nfeat);
 
     for (size_t f = 0; f < nfeat; f++) {
         float prec_fctr = 1e4f;
@@ -374,127 +505,124 @@ void removeDuplicates(float* x_out, float* y_out, unsigned* layer_out,
                 continue;
         }
 
-        x_out[*counter]        = sorted_feat[f].f[0];
-        y_out[*counter]        = sorted_feat[f].f[1];
-        response_out[*counter] = sorted_feat[f].f[2];
-        size_out[*counter]     = sorted_feat[f].f[3];
-        layer_out[*counter]    = sorted_feat[f].l;
-        (*counter)++;
+        out.push_back(sorted_feat[f]);
     }
+    return out;
 }
 
 #define IPTR(Y, X) (img_ptr[(Y)*idims[0] + (X)])
 
-// Computes a canonical orientation for each image feature in an array.  Based
-// on Section 5 of Lowe's paper.  This function adds features to the array when
-// there is more than one dominant orientation at a given feature location.
+// Computes a canonical orientation for an image feature.  Based on Section 5
+// of Lowe's paper.  More than one feature is added to out when there is more
+// than one dominant orientation at the feature location.
+//
+// The gradients of the neighbourhood are gathered first, so the square roots,
+// arc tangents and exponentials run over contiguous buffers before being
+// binned into the histogram in the original sample order.
 template<typename T>
-void calcOrientation(float* x_out, float* y_out, unsigned* layer_out,
-                     float* response_out, float* size_out, float* ori_out,
-                     unsigned* counter, const float* x_in, const float* y_in,
-                     const unsigned* layer_in, const float* response_in,
-                     const float* size_in, const unsigned total_feat,
-                     const std::vector<Array<T>>& gauss_pyr,
-                     const unsigned max_feat, const unsigned octave,
-                     const unsigned n_layers, const bool double_input) {
+void calcOrientation(std::vector<oriented_feat_t>& out, const feat_t& feat,
+                     const ScaleSpaceImage<T>& img, GradientSamples& samples,
+                     const unsigned octave, const bool double_input) {
     const int n = OriHistBins;
 
     float hist[OriHistBins];
     float temphist[OriHistBins];
 
-    for (unsigned f = 0; f < total_feat; f++) {
-        // Load keypoint information
-        const float real_x   = x_in[f];
-        const float real_y   = y_in[f];
-        const unsigned layer = layer_in[f];
-        const float response = response_in[f];
-        const float size     = size_in[f];
-
-        const int pt_x = (int)round(real_x / (1 << octave));
-        const int pt_y = (int)round(real_y / (1 << octave));
-
-        // Calculate auxiliary parameters
-        const float scl_octv  = size * 0.5f / (1 << octave);
-        const int radius      = (int)round(OriRadius * scl_octv);
-        const float sigma     = OriSigFctr * scl_octv;
-        const int len         = (radius * 2 + 1);
-        const float exp_denom = 2.f * sigma * sigma;
-
-        // Points img to correct Gaussian pyramid layer
-        const Array<T> img = gauss_pyr[octave * (n_layers + 3) + layer];
-        const T* img_ptr   = img.get();
-
-        for (int i = 0; i < OriHistBins; i++) hist[i] = 0.f;
-
-        af::dim4 idims = img.dims();
-
-        // Calculate orientation histogram
-        for (int l = 0; l < len * len; l++) {
-            int i = l / len - radius;
-            int j = l % len - radius;
-
-            int y = pt_y + i;
-            int x = pt_x + j;
-            if (y < 1 || y >= idims[0] - 1 || x < 1 || x >= idims[1] - 1)
-                continue;
+    // Load keypoint information
+    const float real_x   = feat.f[0];
+    const float real_y   = feat.f[1];
+    const unsigned layer = feat.l;
+    const float response = feat.f[2];
+    const float size     = feat.f[3];
+
+    const int pt_x = (int)round(real_x / (1 << octave));
+    const int pt_y = (int)round(real_y / (1 << octave));
+
+    // Calculate auxiliary parameters
+    const float scl_octv  = size * 0.5f / (1 << octave);
+    const int radius      = (int)round(OriRadius * scl_octv);
+    const float sigma     = OriSigFctr * scl_octv;
+    const int len         = (radius * 2 + 1);
+    const float exp_denom = 2.f * sigma * sigma;
+
+    const T* img_ptr     = img.data.data();
+    const af::dim4 idims = img.dims;
+
+    samples.resize(len * len);
+    float* gdx  = samples.dx.data();
+    float* gdy  = samples.dy.data();
+    float* expo = samples.expo.data();
+    float* mag  = samples.bin0.data();
+    float* ori  = samples.bin1.data();
+
+    int count = 0;
+    for (int l = 0; l < len * len; l++) {
+        int i = l / len - radius;
+        int j = l % len - radius;
+
+        int y = pt_y + i;
+        int x = pt_x + j;
+        if (y < 1 || y >= idims[0] - 1 || x < 1 || x >= idims[1] - 1) continue;
+
+        gdx[count]  = (float)(IPTR(x + 1, y) - IPTR(x - 1, y));
+        gdy[count]  = (float)(IPTR(x, y - 1) - IPTR(x, y + 1));
+        expo[count] = -(i * i + j * j) / exp_denom;
+        count++;
+    }
 
-            float dx = (float)(IPTR(x + 1, y) - IPTR(x - 1, y));
-            float dy = (float)(IPTR(x, y - 1) - IPTR(x, y + 1));
+    for (int k = 0; k < count; k++) {
+        mag[k] = sqrt(gdx[k] * gdx[k] + gdy[k] * gdy[k]);
+    }
+    for (int k = 0; k < count; k++) { ori[k] = atan2(gdy[k], gdx[k]); }
+    for (int k = 0; k < count; k++) { expo[k] = exp(expo[k]); }
 
-            float mag = sqrt(dx * dx + dy * dy);
-            float ori = atan2(dy, dx);
-            float w   = exp(-(i * i + j * j) / exp_denom);
+    // Calculate orientation histogram
+    for (int i = 0; i < OriHistBins; i++) hist[i] = 0.f;
+    for (int k = 0; k < count; k++) {
+        int bin = round(n * (ori[k] + PI_VAL) / (2.f * PI_VAL));
+        bin     = bin < n ? bin : 0;
 
-            int bin = round(n * (ori + PI_VAL) / (2.f * PI_VAL));
-            bin     = bin < n ? bin : 0;
+        hist[bin] += expo[k] * mag[k];
+    }
 
-            hist[bin] += w * mag;
+    for (int i = 0; i < SmoothOriPasses; i++) {
+        for (int j = 0; j < n; j++) { temphist[j] = hist[j]; }
+        for (int j = 0; j < n; j++) {
+            float prev = (j == 0) ? temphist[n - 1] : temphist[j - 1];
+            float next = (j + 1 == n) ? temphist[0] : temphist[j + 1];
+            hist[j]    = 0.25f * prev + 0.5f * temphist[j] + 0.25f * next;
         }
+    }
 
-        for (int i = 0; i < SmoothOriPasses; i++) {
-            for (int j = 0; j < n; j++) { temphist[j] = hist[j]; }
-            for (int j = 0; j < n; j++) {
-                float prev = (j == 0) ? temphist[n - 1] : temphist[j - 1];
-                float next = (j + 1 == n) ? temphist[0] : temphist[j + 1];
-                hist[j]    = 0.25f * prev + 0.5f * temphist[j] + 0.25f * next;
+    float omax = hist[0];
+    for (int i = 1; i < n; i++) omax = max(omax, hist[i]);
+
+    float mag_thr = (float)(omax * OriPeakRatio);
+    int l, r;
+    for (int j = 0; j < n; j++) {
+        l = (j == 0) ? n - 1 : j - 1;
+        r = (j + 1) % n;
+        if (hist[j] > hist[l] && hist[j] > hist[r] && hist[j] >= mag_thr) {
+            float bin = j + 0.5f * (hist[l] - hist[r]) /
+                                (hist[l] - 2.0f * hist[j] + hist[r]);
+            bin = (bin < 0.0f) ? bin + n : (bin >= n) ? bin - n : bin;
+
+            oriented_feat_t ofeat;
+            ofeat.x        = real_x;
+            ofeat.y        = real_y;
+            ofeat.response = response;
+            ofeat.size     = size;
+            ofeat.ori      = 360.f - ((360.f / n) * bin);
+            ofeat.layer    = layer;
+
+            if (double_input) {
+                float scale = 0.5f;
+                ofeat.x *= scale;
+                ofeat.y *= scale;
+                ofeat.size *= scale;
             }
-        }
-
-        float omax = hist[0];
-        for (int i = 1; i < n; i++) omax = max(omax, hist[i]);
 
-        float mag_thr = (float)(omax * OriPeakRatio);
-        int l, r;
-        for (int j = 0; j < n; j++) {
-            l = (j == 0) ? n - 1 : j - 1;
-            r = (j + 1) % n;
-            if (hist[j] > hist[l] && hist[j] > hist[r] && hist[j] >= mag_thr) {
-                if (*counter < max_feat) {
-                    float bin = j + 0.5f * (hist[l] - hist[r]) /
-                                        (hist[l] - 2.0f * hist[j] + hist[r]);
-                    bin = (bin < 0.0f) ? bin + n : (bin >= n) ? bin - n : bin;
-                    float ori = 360.f - ((360.f / n) * bin);
-
-                    float new_real_x = real_x;
-                    float new_real_y = real_y;
-                    float new_size   = size;
-
-                    if (double_input) {
-                        float scale = 0.5f;
-                        new_real_x *= scale;
-                        new_real_y *= scale;
-                        new_size *= scale;
-                    }
-
-                    x_out[*counter]        = new_real_x;
-                    y_out[*counter]        = new_real_y;
-                    layer_out[*counter]    = layer;
-                    response_out[*counter] = response;
-                    size_out[*counter]     = new_size;
-                    ori_out[*counter]      = ori;
-                    (*counter)++;
-                }
-            }
+            out.push_back(ofeat);
         }
     }
 }
@@ -509,183 +637,196 @@ void normalizeDesc(float* desc, const int histlen) {
     for (int i = 0; i < histlen; i++) { desc[i] *= len_inv; }
 }
 
-// Computes feature descriptors for features in an array.  Based on Section 6
-// of Lowe's paper.
+void finalizeDesc(float* desc_out, float* desc, const unsigned desc_len) {
+    normalizeDesc(desc, desc_len);
+
+    for (int i = 0; i < (int)desc_len; i++)
+        desc[i] = min(desc[i], DescrMagThr);
+
+    normalizeDesc(desc, desc_len);
+
+    // Calculate final descriptor values
+    for (int k = 0; k < (int)desc_len; k++) {
+        desc_out[k] = round(min(255.f, desc[k] * IntDescrFctr));
+    }
+}
+
+// Computes the descriptor of a feature.  Based on Section 6 of Lowe's paper.
 template<typename T>
 void computeDescriptor(float* desc_out, const unsigned desc_len,
-                       const float* x_in, const float* y_in,
-                       const unsigned* layer_in, const float* response_in,
-                       const float* size_in, const float* ori_in,
-                       const unsigned total_feat,
-                       const std::vector<Array<T>>& gauss_pyr, const int d,
-                       const int n, const float scale, const unsigned octave,
-                       const unsigned n_layers) {
-    UNUSED(response_in);
+                       const oriented_feat_t& feat,
+                       const ScaleSpaceImage<T>& img, GradientSamples& samples,
+                       const int d, const int n, const float scale) {
     float desc[128];
 
-    for (unsigned f = 0; f < total_feat; f++) {
-        const unsigned layer = layer_in[f];
-        float ori            = (360.f - ori_in[f]) * PI_VAL / 180.f;
-        ori                  = (ori > PI_VAL) ? ori - PI_VAL * 2 : ori;
-        const float size     = size_in[f];
-        const int fx         = round(x_in[f] * scale);
-        const int fy         = round(y_in[f] * scale);
-
-        // Points img to correct Gaussian pyramid layer
-        Array<T> img     = gauss_pyr[octave * (n_layers + 3) + layer];
-        const T* img_ptr = img.get();
-        af::dim4 idims   = img.dims();
-
-        float cos_t        = cos(ori);
-        float sin_t        = sin(ori);
-        float bins_per_rad = n / (PI_VAL * 2.f);
-        float exp_denom    = d * d * 0.5f;
-        float hist_width   = DescrSclFctr * size * scale * 0.5f;
-        int radius         = hist_width * sqrt(2.f) * (d + 1.f) * 0.5f + 0.5f;
-
-        int len = radius * 2 + 1;
-
-        for (int i = 0; i < (int)desc_len; i++) desc[i] = 0.f;
-
-        // Calculate orientation histogram
-        for (int l = 0; l < len * len; l++) {
-            int i = l / len - radius;
-            int j = l % len - radius;
-
-            int y = fy + i;
-            int x = fx + j;
-
-            float x_rot = (j * cos_t - i * sin_t) / hist_width;
-            float y_rot = (j * sin_t + i * cos_t) / hist_width;
-            float xbin  = x_rot + d / 2 - 0.5f;
-            float ybin  = y_rot + d / 2 - 0.5f;
-
-            if (ybin > -1.0f && ybin < d && xbin > -1.0f && xbin < d && y > 0 &&
-                y < idims[0] - 1 && x > 0 && x < idims[1] - 1) {
-                float dx = (float)(IPTR(x + 1, y) - IPTR(x - 1, y));
-                float dy = (float)(IPTR(x, y - 1) - IPTR(x, y + 1));
-
-                float grad_mag = sqrt(dx * dx + dy * dy);
-                float grad_ori = atan2(dy, dx) - ori;
-                while (grad_ori < 0.0f) grad_ori += PI_VAL * 2;
-                while (grad_ori >= PI_VAL * 2) grad_ori -= PI_VAL * 2;
-
-                float w    = exp(-(x_rot * x_rot + y_rot * y_rot) / exp_denom);
-                float obin = grad_ori * bins_per_rad;
-                float mag  = grad_mag * w;
-
-                int x0 = floor(xbin);
-                int y0 = floor(ybin);
-                int o0 = floor(obin);
-                xbin -= x0;
-                ybin -= y0;
-                obin -= o0;
-
-                for (int yl = 0; yl <= 1; yl++) {
-                    int yb = y0 + yl;
-                    if (yb >= 0 && yb < d) {
-                        float v_y = mag * ((yl == 0) ? 1.0f - ybin : ybin);
-                        for (int xl = 0; xl <= 1; xl++) {
-                            int xb = x0 + xl;
-                            if (xb >= 0 && xb < d) {
-                                float v_x =
-                                    v_y * ((xl == 0) ? 1.0f - xbin : xbin);
-                                for (int ol = 0; ol <= 1; ol++) {
-                                    int ob = (o0 + ol) % n;
-                                    float v_o =
-                                        v_x * ((ol == 0) ? 1.0f - obin : obin);
-                                    desc[(yb * d + xb) * n + ob] += v_o;
-                                }
-                            }
+    float ori        = (360.f - feat.ori) * PI_VAL / 180.f;
+    ori              = (ori > PI_VAL) ? ori - PI_VAL * 2 : ori;
+    const float size = feat.size;
+    const int fx     = round(feat.x * scale);
+    const int fy     = round(feat.y * scale);
+
+    const T* img_ptr     = img.data.data();
+    const af::dim4 idims = img.dims;
+
+    float cos_t        = cos(ori);
+    float sin_t        = sin(ori);
+    float bins_per_rad = n / (PI_VAL * 2.f);
+    float exp_denom    = d * d * 0.5f;
+    float hist_width   = DescrSclFctr * size * scale * 0.5f;
+    int radius         = hist_width * sqrt(2.f) * (d + 1.f) * 0.5f + 0.5f;
+
+    int len = radius * 2 + 1;
+
+    samples.resize(len * len);
+    float* gdx  = samples.dx.data();
+    float* gdy  = samples.dy.data();
+    float* expo = samples.expo.data();
+    float* xbs  = samples.bin0.data();
+    float* ybs  = samples.bin1.data();
+    float* obs  = samples.bin2.data();
+
+    // Gather the gradients of the samples that fall inside the histograms
+    int count = 0;
+    for (int l = 0; l < len * len; l++) {
+        int i = l / len - radius;
+        int j = l % len - radius;
+
+        int y = fy + i;
+        int x = fx + j;
+
+        float x_rot = (j * cos_t - i * sin_t) / hist_width;
+        float y_rot = (j * sin_t + i * cos_t) / hist_width;
+        float xbin  = x_rot + d / 2 - 0.5f;
+        float ybin  = y_rot + d / 2 - 0.5f;
+
+        if (ybin > -1.0f && ybin < d && xbin > -1.0f && xbin < d && y > 0 &&
+            y < idims[0] - 1 && x > 0 && x < idims[1] - 1) {
+            gdx[count]  = (float)(IPTR(x + 1, y) - IPTR(x - 1, y));
+            gdy[count]  = (float)(IPTR(x, y - 1) - IPTR(x, y + 1));
+            expo[count] = -(x_rot * x_rot + y_rot * y_rot) / exp_denom;
+            xbs[count]  = xbin;
+            ybs[count]  = ybin;
+            count++;
+        }
+    }
+
+    for (int k = 0; k < count; k++) {
+        float grad_ori = atan2(gdy[k], gdx[k]) - ori;
+        while (grad_ori < 0.0f) grad_ori += PI_VAL * 2;
+        while (grad_ori >= PI_VAL * 2) grad_ori -= PI_VAL * 2;
+        obs[k] = grad_ori * bins_per_rad;
+    }
+    for (int k = 0; k < count; k++) {
+        gdx[k] = sqrt(gdx[k] * gdx[k] + gdy[k] * gdy[k]) * exp(expo[k]);
+    }
+
+    for (int i = 0; i < (int)desc_len; i++) desc[i] = 0.f;
+
+    // Calculate orientation histogram
+    for (int k = 0; k < count; k++) {
+        float xbin = xbs[k];
+        float ybin = ybs[k];
+        float obin = obs[k];
+        float mag  = gdx[k];
+
+        int x0 = floor(xbin);
+        int y0 = floor(ybin);
+        int o0 = floor(obin);
+        xbin -= x0;
+        ybin -= y0;
+        obin -= o0;
+
+        for (int yl = 0; yl <= 1; yl++) {
+            int yb = y0 + yl;
+            if (yb >= 0 && yb < d) {
+                float v_y = mag * ((yl == 0) ? 1.0f - ybin : ybin);
+                for (int xl = 0; xl <= 1; xl++) {
+                    int xb = x0 + xl;
+                    if (xb >= 0 && xb < d) {
+                        float v_x = v_y * ((xl == 0) ? 1.0f - xbin : xbin);
+                        for (int ol = 0; ol <= 1; ol++) {
+                            int ob    = (o0 + ol) % n;
+                            float v_o = v_x * ((ol == 0) ? 1.0f - obin : obin);
+                            desc[(yb * d + xb) * n + ob] += v_o;
                         }
                     }
                 }
             }
         }
-
-        normalizeDesc(desc, desc_len);
-
-        for (int i = 0; i < (int)desc_len; i++)
-            desc[i] = min(desc[i], DescrMagThr);
-
-        normalizeDesc(desc, desc_len);
-
-        // Calculate final descriptor values
-        for (int k = 0; k < (int)desc_len; k++) {
-            desc_out[f * desc_len + k] =
-                round(min(255.f, desc[k] * IntDescrFctr));
-        }
     }
+
+    finalizeDesc(desc_out, desc, desc_len);
 }
 
-// Computes GLOH feature descriptors for features in an array. Based on Section
-// III-B of Mikolajczyk and Schmid paper.
+// Computes the GLOH descriptor of a feature. Based on Section III-B of
+// Mikolajczyk and Schmid paper.
 template<typename T>
 void computeGLOHDescriptor(float* desc_out, const unsigned desc_len,
-                           const float* x_in, const float* y_in,
-                           const unsigned* layer_in, const float* response_in,
-                           const float* size_in, const float* ori_in,
-                           const unsigned total_feat,
-                           const std::vector<Array<T>>& gauss_pyr, const int d,
+                           const oriented_feat_t& feat,
+                           const ScaleSpaceImage<T>& img,
+                           GradientSamples& samples, const int d,
                            const unsigned rb, const unsigned ab,
-                           const unsigned hb, const float scale,
-                           const unsigned octave, const unsigned n_layers) {
-    UNUSED(response_in);
+                           const unsigned hb, const float scale) {
     float desc[272];
 
-    for (unsigned f = 0; f < total_feat; f++) {
-        const unsigned layer = layer_in[f];
-        float ori            = (360.f - ori_in[f]) * PI_VAL / 180.f;
-        ori                  = (ori > PI_VAL) ? ori - PI_VAL * 2 : ori;
-        const float size     = size_in[f];
-        const int fx         = round(x_in[f] * scale);
-        const int fy         = round(y_in[f] * scale);
+    float ori        = (360.f - feat.ori) * PI_VAL / 180.f;
+    ori              = (ori > PI_VAL) ? ori - PI_VAL * 2 : ori;
+    const float size = feat.size;
+    const int fx     = round(feat.x * scale);
+    const int fy     = round(feat.y * scale);
 
-        // Points img to correct Gaussian pyramid layer
-        Array<T> img     = gauss_pyr[octave * (n_layers + 3) + layer];
-        const T* img_ptr = img.get();
-        af::dim4 idims   = img.dims();
+    const T* img_ptr     = img.data.data();
+    const af::dim4 idims = img.dims;
 
-        float cos_t              = cos(ori);
-        float sin_t              = sin(ori);
-        float hist_bins_per_rad  = hb / (PI_VAL * 2.f);
-        float polar_bins_per_rad = ab / (PI_VAL * 2.f);
-        float exp_denom          = GLOHRadii[rb - 1] * 0.5f;
+    float cos_t              = cos(ori);
+    float sin_t              = sin(ori);
+    float hist_bins_per_rad  = hb / (PI_VAL * 2.f);
+    float polar_bins_per_rad = ab / (PI_VAL * 2.f);
+    float exp_denom          = GLOHRadii[rb - 1] * 0.5f;
 
-        float hist_width = DescrSclFctr * size * scale * 0.5f;
+    float hist_width = DescrSclFctr * size * scale * 0.5f;
 
-        // Keep same descriptor radius used for SIFT
-        int radius = hist_width * sqrt(2.f) * (d + 1.f) * 0.5f + 0.5f;
+    // Keep same descriptor radius used for SIFT
+    int radius = hist_width * sqrt(2.f) * (d + 1.f) * 0.5f + 0.5f;
 
-        // Alternative radius size calculation, changing the radius weight
-        // (rw) in the range of 0.25f-0.75f gives different results,
-        // increasing it tends to show a better recall rate but with a
-        // smaller amount of correct matches
-        // float rw = 0.5f;
-        // int radius = hist_width * GLOHRadii[rb-1] * rw + 0.5f;
+    // Alternative radius size calculation, changing the radius weight
+    // (rw) in the range of 0.25f-0.75f gives different results,
+    // increasing it tends to show a better recall rate but with a
+    // smaller amount of correct matches
+    // float rw = 0.5f;
+    // int radius = hist_width * GLOHRadii[rb-1] * rw + 0.5f;
 
-        int len = radius * 2 + 1;
+    int len = radius * 2 + 1;
 
-        for (int i = 0; i < (int)desc_len; i++) desc[i] = 0.f;
+    samples.resize(len * len);
+    float* gdx  = samples.dx.data();
+    float* gdy  = samples.dy.data();
+    float* expo = samples.expo.data();
+    float* tbs  = samples.bin0.data();
+    float* rbs  = samples.bin1.data();
+    float* obs  = samples.bin2.data();
 
-        // Calculate orientation histogram
-        for (int l = 0; l < len * len; l++) {
-            int i = l / len - radius;
-            int j = l % len - radius;
+    // Gather the gradients of the samples that fall inside the outer ring
+    int count = 0;
+    for (int l = 0; l < len * len; l++) {
+        int i = l / len - radius;
+        int j = l % len - radius;
 
-            int y = fy + i;
-            int x = fx + j;
+        int y = fy + i;
+        int x = fx + j;
 
-            float x_rot = (j * cos_t - i * sin_t);
-            float y_rot = (j * sin_t + i * cos_t);
+        float x_rot = (j * cos_t - i * sin_t);
+        float y_rot = (j * sin_t + i * cos_t);
 
-            float r = sqrt(x_rot * x_rot + y_rot * y_rot) / radius *
-                      GLOHRadii[rb - 1];
+        float r = sqrt(x_rot * x_rot + y_rot * y_rot) / radius *
+                  GLOHRadii[rb - 1];
+
+        if (r <= GLOHRadii[rb - 1] && y > 0 && y < idims[0] - 1 && x > 0 &&
+            x < idims[1] - 1) {
             float theta = atan2(y_rot, x_rot);
             while (theta < 0.0f) theta += PI_VAL * 2;
             while (theta >= PI_VAL * 2) theta -= PI_VAL * 2;
 
-            float tbin = theta * polar_bins_per_rad;
             float rbin =
                 (r < GLOHRadii[0])
                     ? r / GLOHRadii[0]
@@ -696,73 +837,79 @@ void computeGLOHDescriptor(float* desc_out, const unsigned desc_len,
                                          (float)(GLOHRadii[2] - GLOHRadii[1]),
                                  3.f - std::numeric_limits<float>::epsilon()));
 
-            if (r <= GLOHRadii[rb - 1] && y > 0 && y < idims[0] - 1 && x > 0 &&
-                x < idims[1] - 1) {
-                float dx = (float)(IPTR(x + 1, y) - IPTR(x - 1, y));
-                float dy = (float)(IPTR(x, y - 1) - IPTR(x, y + 1));
-
-                float grad_mag = sqrt(dx * dx + dy * dy);
-                float grad_ori = atan2(dy, dx) - ori;
-                while (grad_ori < 0.0f) grad_ori += PI_VAL * 2;
-                while (grad_ori >= PI_VAL * 2) grad_ori -= PI_VAL * 2;
-
-                float w    = exp(-r / exp_denom);
-                float obin = grad_ori * hist_bins_per_rad;
-                float mag  = grad_mag * w;
-
-                int t0 = floor(tbin);
-                int r0 = floor(rbin);
-                int o0 = floor(obin);
-                tbin -= t0;
-                rbin -= r0;
-                obin -= o0;
-
-                for (int rl = 0; rl <= 1; rl++) {
-                    int rb    = (rbin > 0.5f) ? (r0 + rl) : (r0 - rl);
-                    float v_r = mag * ((rl == 0) ? 1.0f - rbin : rbin);
-                    if (rb >= 0 && rb <= 2) {
-                        for (int tl = 0; tl <= 1; tl++) {
-                            int tb    = (t0 + tl) % ab;
-                            float v_t = v_r * ((tl == 0) ? 1.0f - tbin : tbin);
-                            for (int ol = 0; ol <= 1; ol++) {
-                                int ob = (o0 + ol) % hb;
-                                float v_o =
-                                    v_t * ((ol == 0) ? 1.0f - obin : obin);
-                                unsigned idx =
-                                    (rb > 0) *
-                                        (hb + ((rb - 1) * ab + tb) * hb) +
-                                    ob;
-                                desc[idx] += v_o;
-                            }
-                        }
-                    }
-                }
-            }
+            gdx[count]  = (float)(IPTR(x + 1, y) - IPTR(x - 1, y));
+            gdy[count]  = (float)(IPTR(x, y - 1) - IPTR(x, y + 1));
+            expo[count] = -r / exp_denom;
+            tbs[count]  = theta * polar_bins_per_rad;
+            rbs[count]  = rbin;
+            count++;
         }
+    }
 
-        normalizeDesc(desc, desc_len);
-
-        for (int i = 0; i < (int)desc_len; i++)
-            desc[i] = min(desc[i], DescrMagThr);
-
-        normalizeDesc(desc, desc_len);
+    for (int k = 0; k < count; k++) {
+        float grad_ori = atan2(gdy[k], gdx[k]) - ori;
+        while (grad_ori < 0.0f) grad_ori += PI_VAL * 2;
+        while (grad_ori >= PI_VAL * 2) grad_ori -= PI_VAL * 2;
+        obs[k] = grad_ori * hist_bins_per_rad;
+    }
+    for (int k = 0; k < count; k++) {
+        gdx[k] = sqrt(gdx[k] * gdx[k] + gdy[k] * gdy[k]) * exp(expo[k]);
+    }
 
-        // Calculate final descriptor values
-        for (int k = 0; k < (int)desc_len; k++) {
-            desc_out[f * desc_len + k] =
-                round(min(255.f, desc[k] * IntDescrFctr));
+    for (int i = 0; i < (int)desc_len; i++) desc[i] = 0.f;
+
+    // Calculate orientation histogram
+    for (int k = 0; k < count; k++) {
+        float tbin = tbs[k];
+        float rbin = rbs[k];
+        float obin = obs[k];
+        float mag  = gdx[k];
+
+        int t0 = floor(tbin);
+        int r0 = floor(rbin);
+        int o0 = floor(obin);
+        tbin -= t0;
+        rbin -= r0;
+        obin -= o0;
+
+        for (int rl = 0; rl <= 1; rl++) {
+            int rb    = (rbin > 0.5f) ? (r0 + rl) : (r0 - rl);
+            float v_r = mag * ((rl == 0) ? 1.0f - rbin : rbin);
+            if (rb >= 0 && rb <= 2) {
+                for (int tl = 0; tl <= 1; tl++) {
+                    int tb    = (t0 + tl) % ab;
+                    float v_t = v_r * ((tl == 0) ? 1.0f - tbin : tbin);
+                    for (int ol = 0; ol <= 1; ol++) {
+                        int ob    = (o0 + ol) % hb;
+                        float v_o = v_t * ((ol == 0) ? 1.0f - obin : obin);
+                        unsigned idx =
+                            (rb > 0) * (hb + ((rb - 1) * ab + tb) * hb) + ob;
+                        desc[idx] += v_o;
+                    }
+                }
+            }
         }
     }
+
+    finalizeDesc(desc_out, desc, desc_len);
 }
 
 #undef IPTR
 
 template<typename T, typename convAccT>
-Array<T> createInitialImage(const Array<T>& img, const float init_sigma,
-                            const bool double_input) {
-    af::dim4 idims = img.dims();
-
-    Array<T> init_img = createEmptyArray<T>(af::dim4());
+ScaleSpaceImage<T> createInitialImage(const Array<T>& img,
+                                      const float init_sigma,
+                                      const bool double_input) {
+    const af::dim4 idims   = img.dims();
+    const af::dim4 strides = img.strides();
+
+    ScaleSpaceImage<T> src;
+    src.resize(idims[0], idims[1]);
+    const T* iptr = img.get();
+    for (dim_t j = 0; j < idims[1]; ++j) {
+        std::copy(iptr + j * strides[1], iptr + j * strides[1] + idims[0],
+                  src.data.begin() + j * idims[0]);
+    }
 
     float s = (double_input) ? std::max((float)sqrt(init_sigma * init_sigma -
                                                     InitSigma * InitSigma * 4),
@@ -771,24 +918,29 @@ Array<T> createInitialImage(const Array<T>& img, const float init_sigma,
                                                     InitSigma * InitSigma),
                                         0.1f);
 
-    Array<T> filter = gauss_filter<T>(s);
+    std::vector<convAccT> filter = gauss_filter<convAccT>(s);
 
+    ScaleSpaceImage<T> init_img;
+    std::vector<T> tmp;
     if (double_input) {
-        Array<T> double_img =
-            resize<T>(img, idims[0] * 2, idims[1] * 2, AF_INTERP_BILINEAR);
-        init_img = convolve2<T, convAccT>(double_img, filter, filter, false);
+        ScaleSpaceImage<T> double_img;
+        resizeBilinear(double_img, src, idims[0] * 2, idims[1] * 2);
+        separableBlur<T, convAccT>(init_img, double_img, tmp, filter);
     } else {
-        init_img = convolve2<T, convAccT>(img, filter, filter, false);
+        separableBlur<T, convAccT>(init_img, src, tmp, filter);
     }
 
     return init_img;
 }
 
+// Builds the Gaussian pyramid by blurring each layer from the previous one of
+// the same octave, and computes the difference of Gaussians pyramid while
+// each layer is produced.
 template<typename T, typename convAccT>
-std::vector<Array<T>> buildGaussPyr(const Array<T>& init_img,
-                                    const unsigned n_octaves,
-                                    const unsigned n_layers,
-                                    const float init_sigma) {
+void buildPyramids(std::vector<ScaleSpaceImage<T>>& gauss_pyr,
+                   std::vector<ScaleSpaceImage<T>>& dog_pyr,
+                   ScaleSpaceImage<T>&& init_img, const unsigned n_octaves,
+                   const unsigned n_layers, const float init_sigma) {
     // Precompute Gaussian sigmas using the following formula:
     // \sigma_{total}^2 = \sigma_{i}^2 + \sigma_{i-1}^2
     std::vector<float> sig_layers(n_layers + 3);
@@ -800,9 +952,15 @@ std::vector<Array<T>> buildGaussPyr(const Array<T>& init_img,
         sig_layers[i] = std::sqrt(sig_total * sig_total - sig_prev * sig_prev);
     }
 
-    // Gaussian Pyramid
-    std::vector<Array<T>> gauss_pyr(n_octaves * (n_layers + 3),
-                                    createEmptyArray<T>(af::dim4()));
+    std::vector<std::vector<convAccT>> filters(n_layers + 3);
+    for (unsigned l = 1; l < n_layers + 3; l++) {
+        filters[l] = gauss_filter<convAccT>(sig_layers[l]);
+    }
+
+    gauss_pyr.resize(n_octaves * (n_layers + 3));
+    dog_pyr.resize(n_octaves * (n_layers + 2));
+
+    std::vector<T> tmp;
     for (unsigned o = 0; o < n_octaves; o++) {
         for (unsigned l = 0; l < n_layers + 3; l++) {
             unsigned src_idx = (l == 0) ? (o - 1) * (n_layers + 3) + n_layers
@@ -810,43 +968,18 @@ std::vector<Array<T>> buildGaussPyr(const Array<T>& init_img,
             unsigned idx     = o * (n_layers + 3) + l;
 
             if (o == 0 && l == 0) {
-                gauss_pyr[idx] = init_img;
+                gauss_pyr[idx] = std::move(init_img);
             } else if (l == 0) {
-                af::dim4 sdims = gauss_pyr[src_idx].dims();
-                gauss_pyr[idx] = resize<T>(gauss_pyr[src_idx], sdims[0] / 2,
-                                           sdims[1] / 2, AF_INTERP_BILINEAR);
+                const af::dim4 sdims = gauss_pyr[src_idx].dims;
+                resizeBilinear(gauss_pyr[idx], gauss_pyr[src_idx],
+                               sdims[0] / 2, sdims[1] / 2);
             } else {
-                Array<T> filter = gauss_filter<T>(sig_layers[l]);
-
-                gauss_pyr[idx] = convolve2<T, convAccT>(gauss_pyr[src_idx],
-                                                        filter, filter, false);
+                separableBlur<T, convAccT>(
+                    gauss_pyr[idx], gauss_pyr[src_idx], tmp, filters[l],
+                    &dog_pyr[o * (n_layers + 2) + l - 1], &gauss_pyr[src_idx]);
             }
         }
     }
-
-    return gauss_pyr;
-}
-
-template<typename T>
-std::vector<Array<T>> buildDoGPyr(std::vector<Array<T>>& gauss_pyr,
-                                  const unsigned n_octaves,
-                                  const unsigned n_layers) {
-    // DoG Pyramid
-    std::vector<Array<T>> dog_pyr(n_octaves * (n_layers + 2),
-                                  createEmptyArray<T>(af::dim4()));
-    for (unsigned o = 0; o < n_octaves; o++) {
-        for (unsigned l = 0; l < n_layers + 2; l++) {
-            unsigned idx    = o * (n_layers + 2) + l;
-            unsigned bottom = o * (n_layers + 3) + l;
-            unsigned top    = o * (n_layers + 3) + l + 1;
-
-            dog_pyr[idx] = createEmptyArray<T>(gauss_pyr[bottom].dims());
-
-            sub<T>(dog_pyr[idx], gauss_pyr[top], gauss_pyr[bottom]);
-        }
-    }
-
-    return dog_pyr;
 }
 
 template<typename T, typename convAccT>
@@ -857,8 +990,6 @@ unsigned sift_impl(Array<float>& x, Array<float>& y, Array<float>& score,
                    const float init_sigma, const bool double_input,
                    const float img_scale, const float feature_ratio,
                    const bool compute_GLOH) {
-    using std::function;
-    using std::unique_ptr;
     using std::vector;
     af::dim4 idims = in.dims();
 
@@ -867,23 +998,12 @@ unsigned sift_impl(Array<float>& x, Array<float>& y, Array<float>& score,
 
     const unsigned n_octaves = floor(log(min_dim) / log(2)) - 2;
 
-    Array<T> init_img =
-        createInitialImage<T, convAccT>(in, init_sigma, double_input);
-
-    std::vector<Array<T>> gauss_pyr =
-        buildGaussPyr<T, convAccT>(init_img, n_octaves, n_layers, init_sigma);
-
-    std::vector<Array<T>> dog_pyr =
-        buildDoGPyr<T>(gauss_pyr, n_octaves, n_layers);
-
-    vector<uptr<float>> x_pyr(n_octaves);
-    vector<uptr<float>> y_pyr(n_octaves);
-    vector<uptr<float>> response_pyr(n_octaves);
-    vector<uptr<float>> size_pyr(n_octaves);
-    vector<uptr<float>> ori_pyr(n_octaves);
-    vector<uptr<float>> desc_pyr(n_octaves);
-    vector<unsigned> feat_pyr(n_octaves, 0);
-    unsigned total_feat = 0;
+    vector<ScaleSpaceImage<T>> gauss_pyr;
+    vector<ScaleSpaceImage<T>> dog_pyr;
+    buildPyramids<T, convAccT>(
+        gauss_pyr, dog_pyr,
+        createInitialImage<T, convAccT>(in, init_sigma, double_input),
+        n_octaves, n_layers, init_sigma);
 
     const unsigned d  = DescrWidth;
     const unsigned n  = DescrHistBins;
@@ -893,125 +1013,96 @@ unsigned sift_impl(Array<float>& x, Array<float>& y, Array<float>& score,
     const unsigned desc_len =
         (compute_GLOH) ? (1 + (rb - 1) * ab) * hb : d * d * n;
 
+    // Detect the extrema of every layer of every octave at once. Each task
+    // scans a band of columns of one layer; concatenating the results in
+    // task order gives the same list as a sequential scan.
+    struct ExtremaTask {
+        unsigned octave, layer;
+        int begin, end;
+    };
+    vector<ExtremaTask> tasks;
+    vector<unsigned> max_feat(n_octaves, 0);
     for (unsigned i = 0; i < n_octaves; i++) {
-        af::dim4 ddims = dog_pyr[i * (n_layers + 2)].dims();
+        af::dim4 ddims = dog_pyr[i * (n_layers + 2)].dims;
         if (ddims[0] - 2 * ImgBorder < 1 || ddims[1] - 2 * ImgBorder < 1)
             continue;
 
-        const unsigned imel     = ddims[0] * ddims[1];
-        const unsigned max_feat = ceil(imel * feature_ratio);
-
-        auto extrema_x        = memAlloc<float>(max_feat);
-        auto extrema_y        = memAlloc<float>(max_feat);
-        auto extrema_layer    = memAlloc<unsigned>(max_feat);
-        unsigned extrema_feat = 0;
+        const unsigned imel = ddims[0] * ddims[1];
+        max_feat[i]         = ceil(imel * feature_ratio);
 
         for (unsigned j = 1; j <= n_layers; j++) {
-            unsigned prev   = i * (n_layers + 2) + j - 1;
-            unsigned center = i * (n_layers + 2) + j;
-            unsigned next   = i * (n_layers + 2) + j + 1;
-
-            unsigned layer = j;
-
-            float extrema_thr = 0.5f * contrast_thr / n_layers;
-            detectExtrema<T>(extrema_x.get(), extrema_y.get(),
-                             extrema_layer.get(), &extrema_feat, dog_pyr[prev],
-                             dog_pyr[center], dog_pyr[next], layer, max_feat,
-                             extrema_thr);
+            for (int b = ImgBorder; b < ddims[1] - ImgBorder;
+                 b += ExtremaColsPerTask) {
+                const int e =
+                    std::min(b + ExtremaColsPerTask, int(ddims[1] - ImgBorder));
+                tasks.push_back({i, j, b, e});
+            }
         }
+    }
 
-        extrema_feat = min(extrema_feat, max_feat);
-
-        if (extrema_feat == 0) { continue; }
-
-        unsigned interp_feat = 0;
-
-        auto interp_x        = memAlloc<float>(extrema_feat);
-        auto interp_y        = memAlloc<float>(extrema_feat);
-        auto interp_layer    = memAlloc<unsigned>(extrema_feat);
-        auto interp_response = memAlloc<float>(extrema_feat);
-        auto interp_size     = memAlloc<float>(extrema_feat);
+    const float extrema_thr = 0.5f * contrast_thr / n_layers;
+    vector<vector<extremum_t>> task_extrema(tasks.size());
+    parallelFor(tasks.size(), [&](dim_t t) {
+        const ExtremaTask& task = tasks[t];
+        const unsigned center   = task.octave * (n_layers + 2) + task.layer;
+        detectExtrema<T>(task_extrema[t], dog_pyr[center - 1].data.data(),
+                         dog_pyr[center].data.data(),
+                         dog_pyr[center + 1].data.data(), dog_pyr[center].dims,
+                         task.layer, task.begin, task.end, extrema_thr);
+    });
+
+    vector<vector<oriented_feat_t>> oriented_pyr(n_octaves);
+    size_t task_idx = 0;
+    for (unsigned i = 0; i < n_octaves; i++) {
+        vector<extremum_t> extrema;
+        for (; task_idx < tasks.size() && tasks[task_idx].octave == i;
+             task_idx++) {
+            const vector<extremum_t>& part = task_extrema[task_idx];
+            const size_t room = max_feat[i] - extrema.size();
+            extrema.insert(extrema.end(), part.begin(),
+                           part.begin() + std::min(part.size(), room));
+        }
 
-        interpolateExtrema<T>(interp_x.get(), interp_y.get(),
-                              interp_layer.get(), interp_response.get(),
-                              interp_size.get(), &interp_feat, extrema_x.get(),
-                              extrema_y.get(), extrema_layer.get(),
-                              extrema_feat, dog_pyr, max_feat, i, n_layers,
-                              contrast_thr, edge_thr, init_sigma, img_scale);
+        if (extrema.empty()) { continue; }
 
-        interp_feat = min(interp_feat, max_feat);
+        vector<feat_t> sorted_feat = parallelGather<feat_t>(
+            extrema.size(), 64,
+            [&](dim_t begin, dim_t end, vector<feat_t>& out) {
+                for (dim_t f = begin; f < end; f++) {
+                    interpolateExtremum<T>(out, extrema[f], dog_pyr, i,
+                                           n_layers, contrast_thr, edge_thr,
+                                           init_sigma, img_scale);
+                }
+            });
 
-        if (interp_feat == 0) { continue; }
+        if (sorted_feat.empty()) { continue; }
 
-        std::vector<feat_t> sorted_feat;
-        array_to_feat(sorted_feat, interp_x.get(), interp_y.get(),
-                      interp_layer.get(), interp_response.get(),
-                      interp_size.get(), interp_feat);
         std::stable_sort(sorted_feat.begin(), sorted_feat.end(), feat_cmp);
 
-        unsigned nodup_feat = 0;
-
-        auto nodup_x        = memAlloc<float>(interp_feat);
-        auto nodup_y        = memAlloc<float>(interp_feat);
-        auto nodup_layer    = memAlloc<unsigned>(interp_feat);
-        auto nodup_response = memAlloc<float>(interp_feat);
-        auto nodup_size     = memAlloc<float>(interp_feat);
-
-        removeDuplicates(nodup_x.get(), nodup_y.get(), nodup_layer.get(),
-                         nodup_response.get(), nodup_size.get(), &nodup_feat,
-                         sorted_feat);
-
-        const unsigned max_oriented_feat = nodup_feat * 3;
-
-        auto oriented_x        = memAlloc<float>(max_oriented_feat);
-        auto oriented_y        = memAlloc<float>(max_oriented_feat);
-        auto oriented_layer    = memAlloc<unsigned>(max_oriented_feat);
-        auto oriented_response = memAlloc<float>(max_oriented_feat);
-        auto oriented_size     = memAlloc<float>(max_oriented_feat);
-        auto oriented_ori      = memAlloc<float>(max_oriented_feat);
-
-        unsigned oriented_feat = 0;
-
-        calcOrientation<T>(
-            oriented_x.get(), oriented_y.get(), oriented_layer.get(),
-            oriented_response.get(), oriented_size.get(), oriented_ori.get(),
-            &oriented_feat, nodup_x.get(), nodup_y.get(), nodup_layer.get(),
-            nodup_response.get(), nodup_size.get(), nodup_feat, gauss_pyr,
-            max_oriented_feat, i, n_layers, double_input);
-
-        if (oriented_feat == 0) { continue; }
-
-        auto desc = memAlloc<float>(oriented_feat * desc_len);
-
-        float scale = 1.f / (1 << i);
-        if (double_input) scale *= 2.f;
-
-        if (compute_GLOH)
-            computeGLOHDescriptor<T>(
-                desc.get(), desc_len, oriented_x.get(), oriented_y.get(),
-                oriented_layer.get(), oriented_response.get(),
-                oriented_size.get(), oriented_ori.get(), oriented_feat,
-                gauss_pyr, d, rb, ab, hb, scale, i, n_layers);
-        else
-            computeDescriptor<T>(desc.get(), desc_len, oriented_x.get(),
-                                 oriented_y.get(), oriented_layer.get(),
-                                 oriented_response.get(), oriented_size.get(),
-                                 oriented_ori.get(), oriented_feat, gauss_pyr,
-                                 d, n, scale, i, n_layers);
-
-        total_feat += oriented_feat;
-        feat_pyr[i] = oriented_feat;
-
-        if (oriented_feat > 0) {
-            x_pyr[i]        = std::move(oriented_x);
-            y_pyr[i]        = std::move(oriented_y);
-            response_pyr[i] = std::move(oriented_response);
-            ori_pyr[i]      = std::move(oriented_ori);
-            size_pyr[i]     = std::move(oriented_size);
-            desc_pyr[i]     = std::move(desc);
+        const vector<feat_t> nodup = removeDuplicates(sorted_feat);
+
+        vector<oriented_feat_t> oriented = parallelGather<oriented_feat_t>(
+            nodup.size(), 16,
+            [&](dim_t begin, dim_t end, vector<oriented_feat_t>& out) {
+                GradientSamples samples;
+                for (dim_t f = begin; f < end; f++) {
+                    const ScaleSpaceImage<T>& img =
+                        gauss_pyr[i * (n_layers + 3) + nodup[f].l];
+                    calcOrientation<T>(out, nodup[f], img, samples, i,
+                                       double_input);
+                }
+            });
+
+        const size_t max_oriented_feat = nodup.size() * 3;
+        if (oriented.size() > max_oriented_feat) {
+            oriented.resize(max_oriented_feat);
         }
+        oriented_pyr[i] = std::move(oriented);
     }
 
+    unsigned total_feat = 0;
+    for (const auto& oriented : oriented_pyr) { total_feat += oriented.size(); }
+
     if (total_feat > 0) {
         const af::dim4 total_feat_dims(total_feat);
         const af::dim4 desc_dims(desc_len, total_feat);
@@ -1031,23 +1122,44 @@ unsigned sift_impl(Array<float>& x, Array<float>& y, Array<float>& score,
         float* size_ptr  = size.get();
         float* desc_ptr  = desc.get();
 
+        vector<unsigned> feat_octave(total_feat);
+        vector<const oriented_feat_t*> feats(total_feat);
         unsigned offset = 0;
         for (unsigned i = 0; i < n_octaves; i++) {
-            if (feat_pyr[i] == 0) continue;
-
-            memcpy(x_ptr + offset, x_pyr[i].get(), feat_pyr[i] * sizeof(float));
-            memcpy(y_ptr + offset, y_pyr[i].get(), feat_pyr[i] * sizeof(float));
-            memcpy(score_ptr + offset, response_pyr[i].get(),
-                   feat_pyr[i] * sizeof(float));
-            memcpy(ori_ptr + offset, ori_pyr[i].get(),
-                   feat_pyr[i] * sizeof(float));
-            memcpy(size_ptr + offset, size_pyr[i].get(),
-                   feat_pyr[i] * sizeof(float));
-
-            memcpy(desc_ptr + (offset * desc_len), desc_pyr[i].get(),
-                   feat_pyr[i] * desc_len * sizeof(float));
-            offset += feat_pyr[i];
+            for (const oriented_feat_t& feat : oriented_pyr[i]) {
+                x_ptr[offset]     = feat.x;
+                y_ptr[offset]     = feat.y;
+                score_ptr[offset] = feat.response;
+                ori_ptr[offset]   = feat.ori;
+                size_ptr[offset]  = feat.size;
+
+                feat_octave[offset] = i;
+                feats[offset]       = &feat;
+                offset++;
+            }
         }
+
+        // Descriptors of all the octaves are computed in a single pass
+        parallelForChunks(0, total_feat, 16, [&](dim_t begin, dim_t end) {
+            GradientSamples samples;
+            for (dim_t f = begin; f < end; f++) {
+                const unsigned octave         = feat_octave[f];
+                const oriented_feat_t& feat   = *feats[f];
+                const ScaleSpaceImage<T>& img =
+                    gauss_pyr[octave * (n_layers + 3) + feat.layer];
+
+                float scale = 1.f / (1 << octave);
+                if (double_input) scale *= 2.f;
+
+                if (compute_GLOH)
+                    computeGLOHDescriptor<T>(desc_ptr + f * desc_len, desc_len,
+                                             feat, img, samples, d, rb, ab, hb,
+                                             scale);
+                else
+                    computeDescriptor<T>(desc_ptr + f * desc_len, desc_len,
+                                         feat, img, samples, d, n, scale);
+            }
+        });
     }
 
     return total_feat;
@@ -13,6 +13,7 @@
 #include <af/traits.hpp>
 #include <type_traits>
 #include "interp.hpp"
+#include "warp.hpp"
 
 namespace arrayfire {
 namespace cpu {
@@ -84,13 +85,15 @@ void transform(Param<T> output, CParam<T> input, CParam<float> transform,
     const af::dim4 istrides = input.strides();
     const af::dim4 ostrides = output.strides();
 
-    T *out          = output.get();
     const float *tf = transform.get();
 
     int batch_size = 1;
     if (idims[2] != tdims[2]) batch_size = idims[2];
 
-    Interp2<T, WT, order> interp;
+    // FIXME: Nearest and lower do not do clamping, but other methods do.
+    // Make it consistent
+    const WarpOptions opts{method, true};
+
     for (int idw = 0; idw < (int)odims[3]; idw++) {
         dim_t out_offw = idw * ostrides[3];
         dim_t in_offw  = (idims[3] > 1) * idw * istrides[3];
@@ -107,38 +110,33 @@ void transform(Param<T> output, CParam<T> input, CParam<float> transform,
             calc_transform_inverse(tmat, tptr, inverse, perspective,
                                    perspective ? 9 : 6);
 
-            for (int idy = 0; idy < (int)odims[1]; idy++) {
-                for (int idx = 0; idx < (int)odims[0]; idx++) {
-                    WT xidi = idx * tmat[0] + idy * tmat[1] + tmat[2];
-                    WT yidi = idx * tmat[3] + idy * tmat[4] + tmat[5];
-
-                    if (perspective) {
-                        WT W = idx * tmat[6] + idy * tmat[7] + tmat[8];
-                        xidi /= W;
-                        yidi /= W;
-                    }
-
-                    // FIXME: Nearest and lower do not do clamping, but other
-                    // methods do Make it consistent
-                    bool clamp = order != 1;
-                    bool condX = xidi >= -0.0001 && xidi < idims[0];
-                    bool condY = yidi >= -0.0001 && yidi < idims[1];
-
-                    int ooff = out_offzw + idy * ostrides[1] + idx;
-                    if (condX && condY) {
-                        interp(output, ooff, input, in_offzw, xidi, yidi,
-                               method, batch_size, clamp);
-                    } else {
-                        for (int n = 0; n < batch_size; n++) {
-                            out[ooff + n * ostrides[2]] = scalar<T>(0);
-                        }
-                    }
-                }
-            }
+            const TransformCoords<WT> coords(tmat, perspective, odims[0]);
+            warp<T, order>(output, out_offzw, input, in_offzw, batch_size,
+                           opts, coords);
         }
     }
 }
 
+/// Samples every image of \p input at the positions in \p xmap and \p ymap,
+/// which have one element per output pixel
+template<typename T, int order>
+void remap(Param<T> output, CParam<T> input, CParam<float> xmap,
+           CParam<float> ymap, af_interp_type method) {
+    typedef typename af::dtype_traits<T>::base_type BT;
+    typedef wtype_t<BT> WT;
+
+    const af::dim4 odims    = output.dims();
+    const af::dim4 istrides = input.strides();
+    const af::dim4 ostrides = output.strides();
+
+    const WarpOptions opts{method, true};
+    const MapCoords<WT> coords(xmap, ymap);
+    for (dim_t idw = 0; idw < odims[3]; idw++) {
+        warp<T, order>(output, idw * ostrides[3], input, idw * istrides[3],
+                       static_cast<int>(odims[2]), opts, coords);
+    }
+}
+
 }  // namespace kernel
 }  // namespace cpu
 }  // namespace arrayfire
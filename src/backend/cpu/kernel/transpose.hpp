@@ -10,8 +10,13 @@
 #pragma once
 #include <Param.hpp>
 #include <err_cpu.hpp>
+#include <parallel.hpp>
 #include <utility.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
 namespace arrayfire {
 namespace cpu {
 namespace kernel {
@@ -23,152 +28,307 @@ T getConjugate(const T &in) {
 }
 
 template<>
-cfloat getConjugate(const cfloat &in) {
+inline cfloat getConjugate(const cfloat &in) {
     return std::conj(in);
 }
 
 template<>
-cdouble getConjugate(const cdouble &in) {
+inline cdouble getConjugate(const cdouble &in) {
     return std::conj(in);
 }
 
-template<typename T, int M, int N>
-void transpose_kernel(T *output, const T *input, int ostride, int istride) {
-    for (int j = 0; j < N; j++) {
-        for (int i = 0; i < M; i++) { output[i * ostride] = input[i]; }
-        input += istride;
-        output++;
+template<typename T, bool Conj>
+T transposeValue(const T &in) {
+    if constexpr (Conj) {
+        return getConjugate(in);
+    } else {
+        return in;
     }
 }
 
-template<typename T>
-void transpose_real(Param<T> output, CParam<T> input) {
-    const af::dim4 odims    = output.dims();
-    const af::dim4 ostrides = output.strides();
-    const af::dim4 istrides = input.strides();
+/// Side of the tiles the leaves are cut into. The loops over a tile have
+/// fixed trip counts, so the compiler unrolls them and keeps the 8 lines
+/// written by a tile open in the cache.
+constexpr dim_t TransposeTile = 8;
 
-    T *out            = output.get();
-    T const *const in = input.get();
-
-    constexpr int M = 8;
-    constexpr int N = 8;
-
-    dim_t odims1_down = floor(odims[1] / N) * N;
-    dim_t odims0_down = floor(odims[0] / M) * M;
-
-    for (dim_t l = 0; l < odims[3]; ++l) {
-        for (dim_t k = 0; k < odims[2]; ++k) {
-            // Outermost loop handles batch mode
-            // if input has no data along third dimension
-            // this loop runs only once
-            T *out_      = out + l * ostrides[3] + k * ostrides[2];
-            const T *in_ = in + l * istrides[3] + k * istrides[2];
-
-            if (odims1_down > 0) {
-                for (dim_t j = 0; j <= odims1_down; j += N) {
-                    for (dim_t i = 0; i < odims0_down; i += M) {
-                        transpose_kernel<T, M, N>(out_, in_, ostrides[1],
-                                                  istrides[1]);
-                        out_ += M;
-                        in_ += istrides[1] * N;
-                    }
+/// Blocks up to this side are transposed tile by tile, larger blocks are
+/// halved first so that the rows read and written stay in the cache
+constexpr dim_t TransposeLeaf = 32;
 
-                    for (dim_t jj = 0; jj < N; jj++) {
-                        for (dim_t i = odims0_down; i < odims[0]; i++) {
-                            *out_ = *in_;
-                            out_++;
-                            in_ += istrides[1];
-                        }
-                        out_ += ostrides[1] - (odims[0] - odims0_down);
-                        in_ -= (odims[0] - odims0_down) * istrides[1] - 1;
-                    }
-                    out_ = out + l * ostrides[3] + k * ostrides[2] +
-                           j * ostrides[1];
-                    in_ = in + l * istrides[3] + k * istrides[2] + j;
-                }
-            }
-            for (dim_t j = odims1_down; j < odims[1]; j++) {
-                out_ =
-                    out + l * ostrides[3] + k * ostrides[2] + j * ostrides[1];
-                in_ = in + l * istrides[3] + k * istrides[2] + j;
-                for (dim_t i = 0; i < odims[0]; i++) {
-                    *out_ = *in_;
-                    out_++;
-                    in_ += istrides[1];
-                }
+/// Side of the blocks that are handed out to the threads
+constexpr dim_t TransposeBlock = 256;
+
+/// Elements copied by one thread at least
+constexpr dim_t TransposeGrain = 1 << 16;
+
+/// Transposes one full tile, out[i + j * ostride] = in[j + i * istride]
+template<typename T, bool Conj>
+void transposeTile(T *out, const dim_t ostride, const T *in,
+                   const dim_t istride) {
+    for (dim_t i = 0; i < TransposeTile; ++i) {
+        for (dim_t j = 0; j < TransposeTile; ++j) {
+            out[j * ostride + i] = transposeValue<T, Conj>(in[i * istride + j]);
+        }
+    }
+}
+
+/// Transposes a block of \p rows x \p cols output elements with full tiles
+/// and scalar edges
+template<typename T, bool Conj>
+void transposeLeaf(T *out, const dim_t ostride, const T *in,
+                   const dim_t istride, const dim_t rows, const dim_t cols) {
+    const dim_t rowsDown = rows - rows % TransposeTile;
+    const dim_t colsDown = cols - cols % TransposeTile;
+
+    for (dim_t j = 0; j < colsDown; j += TransposeTile) {
+        for (dim_t i = 0; i < rowsDown; i += TransposeTile) {
+            transposeTile<T, Conj>(out + j * ostride + i, ostride,
+                                   in + i * istride + j, istride);
+        }
+    }
+    for (dim_t j = 0; j < cols; ++j) {
+        for (dim_t i = (j < colsDown ? rowsDown : 0); i < rows; ++i) {
+            out[j * ostride + i] = transposeValue<T, Conj>(in[i * istride + j]);
+        }
+    }
+}
+
+/// Point at which a side of \p n elements is halved, rounded up to whole
+/// tiles so that only the last leaf has partial tiles
+inline dim_t transposeSplit(const dim_t n) {
+    return (n / 2 + TransposeTile - 1) / TransposeTile * TransposeTile;
+}
+
+/// Cache-oblivious transpose of a \p rows x \p cols block. The longer side
+/// is halved until both fit in a leaf.
+template<typename T, bool Conj>
+void transposeRecursive(T *out, const dim_t ostride, const T *in,
+                        const dim_t istride, const dim_t rows,
+                        const dim_t cols) {
+    if (rows <= TransposeLeaf && cols <= TransposeLeaf) {
+        transposeLeaf<T, Conj>(out, ostride, in, istride, rows, cols);
+    } else if (rows >= cols) {
+        const dim_t half = transposeSplit(rows);
+        transposeRecursive<T, Conj>(out, ostride, in, istride, half, cols);
+        transposeRecursive<T, Conj>(out + half, ostride, in + half * istride,
+                                    istride, rows - half, cols);
+    } else {
+        const dim_t half = transposeSplit(cols);
+        transposeRecursive<T, Conj>(out, ostride, in, istride, rows, half);
+        transposeRecursive<T, Conj>(out + half * ostride, ostride, in + half,
+                                    istride, rows, cols - half);
+    }
+}
+
+/// One dimension of a copy with the strides it has in the output and in the
+/// input
+struct CopyDim {
+    dim_t dim;
+    dim_t ostride;
+    dim_t istride;
+};
+
+/// Dimensions of a permuted copy, with the unit dimensions dropped and the
+/// dimensions that are contiguous in both arrays merged
+struct CopyPlan {
+    CopyDim dims[4];
+    int ndims;
+};
+
+/// Plans out(i0, i1, i2, i3) = in(i[rdims[0]], ..., i[rdims[3]])
+inline CopyPlan planPermute(const af::dim4 &odims, const af::dim4 &ostrides,
+                            const af::dim4 &istrides, const af::dim4 &rdims) {
+    CopyPlan plan{};
+    for (int d = 0; d < 4; ++d) {
+        if (odims[d] == 1) { continue; }
+        const CopyDim next{odims[d], ostrides[d],
+                           istrides[static_cast<int>(rdims[d])]};
+        if (plan.ndims > 0) {
+            CopyDim &last = plan.dims[plan.ndims - 1];
+            if (next.ostride == last.ostride * last.dim &&
+                next.istride == last.istride * last.dim) {
+                last.dim *= next.dim;
+                continue;
             }
         }
+        plan.dims[plan.ndims++] = next;
     }
+    if (plan.ndims == 0) { plan.dims[plan.ndims++] = CopyDim{1, 1, 1}; }
+    return plan;
 }
 
-template<typename T>
-void transpose_conj(Param<T> output, CParam<T> input) {
-    const af::dim4 odims    = output.dims();
-    const af::dim4 ostrides = output.strides();
-    const af::dim4 istrides = input.strides();
+/// Output and input offsets of element \p idx of the dimensions \p dims
+inline void copyOffsets(const CopyDim *dims, const int ndims, dim_t idx,
+                        dim_t &ooff, dim_t &ioff) {
+    ooff = 0;
+    ioff = 0;
+    for (int d = 0; d < ndims; ++d) {
+        const dim_t i = idx % dims[d].dim;
+        idx /= dims[d].dim;
+        ooff += i * dims[d].ostride;
+        ioff += i * dims[d].istride;
+    }
+}
+
+/// Copies every element of \p in to its permuted place in \p out.
+///
+/// Dimension 0 of the plan is the innermost loop. When it is contiguous in
+/// the input the rows are copied directly. When the input is contiguous
+/// along another dimension k instead, dimensions 0 and k are transposed in
+/// blocks and the remaining dimensions are batched.
+template<typename T, bool Conj>
+void permute(T *out, const T *in, const CopyPlan &plan) {
+    const CopyDim inner = plan.dims[0];
+
+    int k = 0;
+    if (inner.ostride == 1 && inner.istride != 1) {
+        for (int d = 1; d < plan.ndims; ++d) {
+            if (plan.dims[d].istride == 1) { k = d; }
+        }
+    }
+
+    if (k == 0) {
+        CopyDim outer[3];
+        dim_t nrows = 1;
+        for (int d = 1; d < plan.ndims; ++d) {
+            outer[d - 1] = plan.dims[d];
+            nrows *= plan.dims[d].dim;
+        }
+        const int nouter  = plan.ndims - 1;
+        const dim_t grain = std::max<dim_t>(1, TransposeGrain / inner.dim);
 
-    T *out            = output.get();
-    T const *const in = input.get();
-
-    for (dim_t l = 0; l < odims[3]; ++l) {
-        for (dim_t k = 0; k < odims[2]; ++k) {
-            // Outermost loop handles batch mode
-            // if input has no data along third dimension
-            // this loop runs only once
-
-            for (dim_t j = 0; j < odims[1]; ++j) {
-                for (dim_t i = 0; i < odims[0]; ++i) {
-                    // calculate array indices based on offsets and strides
-                    // the helper getIdx takes care of indices
-                    const dim_t inIdx  = getIdx(istrides, j, i, k, l);
-                    const dim_t outIdx = getIdx(ostrides, i, j, k, l);
-                    out[outIdx]        = getConjugate(in[inIdx]);
+        parallelForChunks(0, nrows, grain, [&](dim_t beg, dim_t end) {
+            for (dim_t r = beg; r < end; ++r) {
+                dim_t ooff, ioff;
+                copyOffsets(outer, nouter, r, ooff, ioff);
+                T *dst       = out + ooff;
+                const T *src = in + ioff;
+                if (inner.ostride == 1 && inner.istride == 1) {
+                    for (dim_t i = 0; i < inner.dim; ++i) {
+                        dst[i] = transposeValue<T, Conj>(src[i]);
+                    }
+                } else {
+                    for (dim_t i = 0; i < inner.dim; ++i) {
+                        dst[i * inner.ostride] =
+                            transposeValue<T, Conj>(src[i * inner.istride]);
+                    }
                 }
             }
-            // outData and inData pointers doesn't need to be
-            // offset as the getIdx function is taking care
-            // of the batch parameter
-        }
+        });
+        return;
     }
+
+    const CopyDim cols = plan.dims[k];
+    CopyDim batch[2];
+    int nbatch    = 0;
+    dim_t nplanes = 1;
+    for (int d = 1; d < plan.ndims; ++d) {
+        if (d == k) { continue; }
+        batch[nbatch++] = plan.dims[d];
+        nplanes *= plan.dims[d].dim;
+    }
+
+    const dim_t nbi    = (inner.dim + TransposeBlock - 1) / TransposeBlock;
+    const dim_t nbj    = (cols.dim + TransposeBlock - 1) / TransposeBlock;
+    const dim_t blockN = std::min(inner.dim, TransposeBlock) *
+                         std::min(cols.dim, TransposeBlock);
+    const dim_t grain  = std::max<dim_t>(1, TransposeGrain / blockN);
+
+    parallelForChunks(
+        0, nplanes * nbi * nbj, grain, [&](dim_t beg, dim_t end) {
+            for (dim_t b = beg; b < end; ++b) {
+                const dim_t bi = b % nbi;
+                const dim_t bj = (b / nbi) % nbj;
+                dim_t ooff, ioff;
+                copyOffsets(batch, nbatch, b / (nbi * nbj), ooff, ioff);
+
+                const dim_t i0 = bi * TransposeBlock;
+                const dim_t j0 = bj * TransposeBlock;
+                transposeRecursive<T, Conj>(
+                    out + ooff + i0 + j0 * cols.ostride, cols.ostride,
+                    in + ioff + i0 * inner.istride + j0, inner.istride,
+                    std::min(TransposeBlock, inner.dim - i0),
+                    std::min(TransposeBlock, cols.dim - j0));
+            }
+        });
+}
+
+template<typename T, bool Conj>
+void permute(Param<T> out, CParam<T> in, const af::dim4 &rdims) {
+    const af::dim4 odims = out.dims();
+    if (odims.elements() == 0) { return; }
+    const CopyPlan plan =
+        planPermute(odims, out.strides(), in.strides(), rdims);
+    permute<T, Conj>(out.get(), in.get(), plan);
 }
 
 template<typename T>
 void transpose(Param<T> out, CParam<T> in, const bool conjugate) {
-    return (conjugate ? transpose_conj<T>(out, in)
-                      : transpose_real<T>(out, in));
+    const af::dim4 rdims(1, 0, 2, 3);
+    return (conjugate ? permute<T, true>(out, in, rdims)
+                      : permute<T, false>(out, in, rdims));
+}
+
+/// Swaps the blocks of rows [r0, r0 + rows) and columns [c0, c0 + cols) of
+/// a square plane with their transposes. A block on the diagonal is swapped
+/// with itself, so only its upper triangle is visited.
+template<typename T, bool Conj>
+void transposeSwap(T *plane, const dim_t stride, const dim_t r0,
+                   const dim_t c0, const dim_t rows, const dim_t cols) {
+    for (dim_t c = c0; c < c0 + cols; ++c) {
+        const dim_t rend = r0 == c0 ? c : r0 + rows;
+        T *a             = plane + c * stride;
+        T *b             = plane + c;
+        for (dim_t r = r0; r < rend; ++r) {
+            const T tmp   = a[r];
+            a[r]          = transposeValue<T, Conj>(b[r * stride]);
+            b[r * stride] = transposeValue<T, Conj>(tmp);
+        }
+        if (Conj && r0 == c0) { a[c] = transposeValue<T, Conj>(a[c]); }
+    }
 }
 
+/// In-place transpose of square planes. The planes are cut into blocks and
+/// every pair of blocks (I, J) with I <= J is swapped independently, so the
+/// pairs are spread over the threads.
 template<typename T, bool conjugate>
 void transpose_inplace(Param<T> input) {
     const af::dim4 idims    = input.dims();
     const af::dim4 istrides = input.strides();
+    const dim_t n           = idims[0];
+    if (idims.elements() == 0) { return; }
 
     T *in = input.get();
 
-    for (dim_t l = 0; l < idims[3]; ++l) {
-        for (dim_t k = 0; k < idims[2]; ++k) {
-            // Outermost loop handles batch mode
-            // if input has no data along third dimension
-            // this loop runs only once
-            //
-            // Run only bottom triangle. std::swap swaps with upper triangle
-            for (dim_t j = 0; j < idims[1]; ++j) {
-                for (dim_t i = j + 1; i < idims[0]; ++i) {
-                    // calculate array indices based on offsets and strides
-                    // the helper getIdx takes care of indices
-                    const dim_t iIdx = getIdx(istrides, j, i, k, l);
-                    const dim_t oIdx = getIdx(istrides, i, j, k, l);
-                    if (conjugate) {
-                        in[iIdx] = getConjugate(in[iIdx]);
-                        in[oIdx] = getConjugate(in[oIdx]);
-                        std::swap(in[iIdx], in[oIdx]);
-                    } else {
-                        std::swap(in[iIdx], in[oIdx]);
-                    }
-                }
+    const dim_t nb     = (n + TransposeLeaf - 1) / TransposeLeaf;
+    const dim_t npairs = nb * (nb + 1) / 2;
+    const dim_t grain  = std::max<dim_t>(
+        1, TransposeGrain / (std::min(n, TransposeLeaf) *
+                             std::min(n, TransposeLeaf)));
+
+    parallelForChunks(
+        0, idims[2] * idims[3] * npairs, grain, [&](dim_t beg, dim_t end) {
+            for (dim_t p = beg; p < end; ++p) {
+                const dim_t plane = p / npairs;
+                const dim_t pair  = p % npairs;
+
+                // Pair index J * (J + 1) / 2 + I with I <= J
+                dim_t J = static_cast<dim_t>(
+                    (std::sqrt(8.0 * static_cast<double>(pair) + 1.0) - 1.0) /
+                    2.0);
+                while (J * (J + 1) / 2 > pair) { --J; }
+                while ((J + 1) * (J + 2) / 2 <= pair) { ++J; }
+                const dim_t I = pair - J * (J + 1) / 2;
+
+                T *ptr = in + (plane % idims[2]) * istrides[2] +
+                         (plane / idims[2]) * istrides[3];
+                const dim_t r0 = I * TransposeLeaf;
+                const dim_t c0 = J * TransposeLeaf;
+                transposeSwap<T, conjugate>(
+                    ptr, istrides[1], r0, c0, std::min(TransposeLeaf, n - r0),
+                    std::min(TransposeLeaf, n - c0));
             }
-        }
-    }
+        });
 }
 
 template<typename T>
@@ -0,0 +1,444 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+#include <Param.hpp>
+#include <parallel.hpp>
+#include <af/constants.h>
+#include <af/traits.hpp>
+#include "interp.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace arrayfire {
+namespace cpu {
+namespace kernel {
+
+/// Output pixels along dimension 0 that are mapped together
+constexpr dim_t WarpSpan = 64;
+
+/// Output columns, along dimension 1, of one tile
+constexpr dim_t WarpTileCols = 16;
+
+/// Types that are interpolated with integer weights.
+///
+/// Fractional positions are rounded to multiples of 1 / (1 << fracBits).
+/// The weights along each dimension sum to 1 << coefBits, which is as large
+/// as the type of the weighted sums allows even for the negative lobes of
+/// the cubics.
+template<typename T>
+struct WarpFixed {
+    static constexpr bool value   = false;
+    static constexpr int fracBits = 0;
+    static constexpr int coefBits = 0;
+    using acc_t                   = int;
+};
+
+template<>
+struct WarpFixed<unsigned char> {
+    static constexpr bool value   = true;
+    static constexpr int fracBits = 10;
+    static constexpr int coefBits = 10;
+    using acc_t                   = int;
+};
+
+template<>
+struct WarpFixed<unsigned short> {
+    static constexpr bool value   = true;
+    static constexpr int fracBits = 12;
+    static constexpr int coefBits = 14;
+    using acc_t                   = long long;
+};
+
+/// Interpolation and boundary handling shared by the kernels that use the
+/// warp engine
+struct WarpOptions {
+    af_interp_type method;
+    /// If true, nearest and lower also need the position itself to be
+    /// inside of the image, not only the index it rounds to
+    bool strictNearest;
+};
+
+/// True for the methods that smooth the fraction t between two taps to
+/// (1 - cos(pi * t)) / 2
+inline bool isCosineInterp(const af_interp_type method) {
+    return method == AF_INTERP_LINEAR_COSINE ||
+           method == AF_INTERP_BILINEAR_COSINE;
+}
+
+/// Fraction \p t smoothed with cosine, as in Interp2
+template<typename WT>
+WT cosineFraction(const WT t) {
+    return (1 - std::cos(t * af::Pi)) / 2;
+}
+
+/// Integer weights, summing to 1 << \p coefBits, of the taps along one
+/// dimension for each of the 1 << \p fracBits rounded fractions. Linear,
+/// cosine and cubic weights are separable, so one table serves both
+/// dimensions.
+class WarpLut {
+    std::vector<int> weights;
+    int taps = 0;
+
+   public:
+    WarpLut() = default;
+
+    WarpLut(const int order, const bool spline, const bool cosine,
+            const int fracBits, const int coefBits)
+        : weights((order == 3 ? 4 : 2) << fracBits)
+        , taps(order == 3 ? 4 : 2) {
+        const int size   = 1 << fracBits;
+        const double one = static_cast<double>(1 << coefBits);
+        for (int q = 0; q < size; ++q) {
+            const double t = static_cast<double>(q) / size;
+            const double c = cosine ? cosineFraction(t) : t;
+            double wf[4]   = {1.0 - c, c, 0.0, 0.0};
+            if (taps == 4) { cubicWeights(wf, t, spline); }
+
+            int *w  = weights.data() + q * taps;
+            int sum = 0;
+            for (int i = 0; i < taps; ++i) {
+                w[i] = static_cast<int>(std::lround(wf[i] * one));
+                sum += w[i];
+            }
+            // Rounding must not change the sum, or flat areas would change.
+            // The difference goes to the largest weight.
+            const int largest = (taps == 4 ? 1 : 0) + (t >= 0.5 ? 1 : 0);
+            w[largest] += (1 << coefBits) - sum;
+        }
+    }
+
+    const int *operator[](const int q) const {
+        return weights.data() + q * taps;
+    }
+};
+
+/// Samples one input image at the positions of a span of output pixels.
+///
+/// map() turns the positions into clamped tap offsets and fractions once,
+/// and sample() reads any number of images of the same size with them.
+/// Positions are handled as in Interp2: nearest and lower read zero outside
+/// of the image, linear and cubic read zero for positions outside of
+/// [-0.0001, dim) and clamp their taps to the edge otherwise.
+///
+/// 8 and 16 bit images are interpolated in fixed point with weights from a
+/// WarpLut, and are rounded to the nearest integer. Other types follow
+/// bilinearInterpFunc and bicubicInterpFunc. The cosine methods smooth the
+/// fractions with cosineFraction() first.
+template<typename T, int Order>
+class WarpSampler {
+    using BT = typename af::dtype_traits<T>::base_type;
+    using VT = vtype_t<T>;
+
+   public:
+    using WT = wtype_t<BT>;
+
+    static constexpr bool IsFixed = Order > 1 && WarpFixed<T>::value;
+
+   private:
+    using acc_t = typename WarpFixed<T>::acc_t;
+
+    static constexpr int Taps = Order == 3 ? 4 : Order;
+
+    const dim_t dim0;
+    const dim_t dim1;
+    const dim_t stride0;
+    const dim_t stride1;
+    const bool lower;
+    const bool spline;
+    const bool cosine;
+    const bool strict;
+    const WarpLut &lut;
+
+    dim_t count = 0;
+    bool valid[WarpSpan];
+    dim_t cols[WarpSpan][Taps];
+    dim_t rows[WarpSpan][Taps];
+    WT fracX[WarpSpan];
+    WT fracY[WarpSpan];
+    int quantX[WarpSpan];
+    int quantY[WarpSpan];
+
+    // Same comparisons as the bounds checks of transform and rotate
+    static bool inRange(const WT pos, const dim_t lim) {
+        return static_cast<double>(pos) >= -0.0001 && pos < WT(lim);
+    }
+
+    void mapNearest(const dim_t k, const WT x, const WT y) {
+        // Far away and NaN positions are rejected before they are rounded
+        bool ok = x > WT(-1) && x < WT(dim0) && y > WT(-1) && y < WT(dim1);
+        if (strict) { ok = ok && inRange(x, dim0) && inRange(y, dim1); }
+
+        dim_t xi = 0;
+        dim_t yi = 0;
+        if (ok) {
+            xi = static_cast<dim_t>(lower ? std::floor(x) : std::round(x));
+            yi = static_cast<dim_t>(lower ? std::floor(y) : std::round(y));
+            ok = xi >= 0 && xi < dim0 && yi >= 0 && yi < dim1;
+        }
+        valid[k]   = ok;
+        cols[k][0] = ok ? yi * stride1 + xi * stride0 : 0;
+    }
+
+    static void taps(const WT pos, const dim_t lim, const dim_t stride,
+                     dim_t *idx, WT &frac, int &quant) {
+        dim_t grid = static_cast<dim_t>(std::floor(pos));
+        frac       = pos - WT(grid);
+        if constexpr (IsFixed) {
+            constexpr int size = 1 << WarpFixed<T>::fracBits;
+            quant              = static_cast<int>(frac * size + WT(0.5));
+            if (quant == size) {
+                grid++;
+                quant = 0;
+            }
+        }
+        const dim_t first = Order == 3 ? grid - 1 : grid;
+        for (int i = 0; i < Taps; ++i) {
+            idx[i] = std::min(std::max(first + i, dim_t(0)), lim - 1) * stride;
+        }
+    }
+
+    void mapFiltered(const dim_t k, const WT x, const WT y) {
+        valid[k] = inRange(x, dim0) && inRange(y, dim1);
+        if (!valid[k]) { return; }
+        taps(x, dim0, stride0, cols[k], fracX[k], quantX[k]);
+        taps(y, dim1, stride1, rows[k], fracY[k], quantY[k]);
+        // The fixed point weights are smoothed in the WarpLut
+        if (!IsFixed && cosine) {
+            fracX[k] = cosineFraction(fracX[k]);
+            fracY[k] = cosineFraction(fracY[k]);
+        }
+    }
+
+    T fixedValue(const T *in, const dim_t k) const {
+        const int *wx = lut[quantX[k]];
+        const int *wy = lut[quantY[k]];
+        acc_t sum     = 0;
+        for (int j = 0; j < Taps; ++j) {
+            const T *row = in + rows[k][j];
+            int h        = 0;
+            for (int i = 0; i < Taps; ++i) { h += wx[i] * row[cols[k][i]]; }
+            sum += static_cast<acc_t>(wy[j]) * h;
+        }
+        constexpr int shift = 2 * WarpFixed<T>::coefBits;
+        sum = (sum + (acc_t(1) << (shift - 1))) >> shift;
+        sum = std::min<acc_t>(std::max<acc_t>(sum, 0),
+                              std::numeric_limits<T>::max());
+        return static_cast<T>(sum);
+    }
+
+    T filteredValue(const T *in, const dim_t k) const {
+        if constexpr (Order == 2) {
+            VT val[2][2];
+            for (int j = 0; j < 2; ++j) {
+                for (int i = 0; i < 2; ++i) {
+                    val[j][i] = in[rows[k][j] + cols[k][i]];
+                }
+            }
+            return static_cast<T>(bilinearInterpFunc(val, fracX[k], fracY[k]));
+        } else {
+            VT val[4][4];
+            for (int j = 0; j < 4; ++j) {
+                for (int i = 0; i < 4; ++i) {
+                    val[j][i] = in[rows[k][j] + cols[k][i]];
+                }
+            }
+            return static_cast<T>(
+                bicubicInterpFunc(val, fracX[k], fracY[k], spline));
+        }
+    }
+
+   public:
+    WarpSampler(const af::dim4 &idims, const af::dim4 &istrides,
+                const WarpOptions &opts, const WarpLut &table)
+        : dim0(idims[0])
+        , dim1(idims[1])
+        , stride0(istrides[0])
+        , stride1(istrides[1])
+        , lower(opts.method == AF_INTERP_LOWER)
+        , spline(opts.method == AF_INTERP_BICUBIC_SPLINE ||
+                 opts.method == AF_INTERP_CUBIC_SPLINE)
+        , cosine(Order == 2 && isCosineInterp(opts.method))
+        , strict(opts.strictNearest)
+        , lut(table) {}
+
+    /// Maps the \p n positions (xs[k], ys[k]) of the next span
+    void map(const WT *xs, const WT *ys, const dim_t n) {
+        count = n;
+        for (dim_t k = 0; k < n; ++k) {
+            if constexpr (Order == 1) {
+                mapNearest(k, xs[k], ys[k]);
+            } else {
+                mapFiltered(k, xs[k], ys[k]);
+            }
+        }
+    }
+
+    /// Writes the span sampled from the image at \p in to \p out
+    void sample(T *out, const T *in) const {
+        for (dim_t k = 0; k < count; ++k) {
+            if (!valid[k]) {
+                out[k] = scalar<T>(0);
+            } else if constexpr (Order == 1) {
+                out[k] = in[cols[k][0]];
+            } else if constexpr (IsFixed) {
+                out[k] = fixedValue(in, k);
+            } else {
+                out[k] = filteredValue(in, k);
+            }
+        }
+    }
+};
+
+/// Samples \p nimages images of \p in, starting at \p inOffset, at the
+/// positions given by \p coords, and writes them to the images of \p out
+/// starting at \p outOffset. Images are strides[2] apart in both arrays.
+///
+/// \p coords(x0, y, n, xs, ys) writes the input positions of the \p n output
+/// pixels starting at (x0, y). Positions are computed once per pixel and
+/// shared by all images. Tiles of WarpSpan x WarpTileCols output pixels run
+/// in parallel.
+template<typename T, int Order, typename Coords>
+void warp(Param<T> out, const dim_t outOffset, CParam<T> in,
+          const dim_t inOffset, const int nimages, const WarpOptions &opts,
+          const Coords &coords) {
+    using Sampler = WarpSampler<T, Order>;
+    using WT      = typename Sampler::WT;
+
+    const af::dim4 odims    = out.dims();
+    const af::dim4 ostrides = out.strides();
+    const af::dim4 idims    = in.dims();
+    const af::dim4 istrides = in.strides();
+    const dim_t ostride1    = ostrides[1];
+    const dim_t ostride2    = ostrides[2];
+    const dim_t istride2    = istrides[2];
+    const dim_t width       = odims[0];
+    const dim_t height      = odims[1];
+    const dim_t tilesX      = (width + WarpSpan - 1) / WarpSpan;
+    const dim_t tilesY      = (height + WarpTileCols - 1) / WarpTileCols;
+
+    const WarpLut lut =
+        Sampler::IsFixed
+            ? WarpLut(Order, opts.method == AF_INTERP_BICUBIC_SPLINE,
+                      Order == 2 && isCosineInterp(opts.method),
+                      WarpFixed<T>::fracBits, WarpFixed<T>::coefBits)
+            : WarpLut();
+
+    T *optr       = out.get() + outOffset;
+    const T *iptr = in.get() + inOffset;
+
+    parallelForChunks(0, tilesX * tilesY, 1, [&](dim_t tBeg, dim_t tEnd) {
+        Sampler sampler(idims, istrides, opts, lut);
+        WT xs[WarpSpan];
+        WT ys[WarpSpan];
+        for (dim_t t = tBeg; t < tEnd; ++t) {
+            const dim_t x0   = (t % tilesX) * WarpSpan;
+            const dim_t y0   = (t / tilesX) * WarpTileCols;
+            const dim_t n    = std::min(WarpSpan, width - x0);
+            const dim_t yEnd = std::min(y0 + WarpTileCols, height);
+            for (dim_t y = y0; y < yEnd; ++y) {
+                coords(x0, y, n, xs, ys);
+                sampler.map(xs, ys, n);
+                for (int b = 0; b < nimages; ++b) {
+                    sampler.sample(optr + b * ostride2 + y * ostride1 + x0,
+                                   iptr + b * istride2);
+                }
+            }
+        }
+    });
+}
+
+/// Input positions of an affine or a perspective transform, given the matrix
+/// that maps output positions to input positions. The products of the output
+/// indices along dimension 0 with the matrix are computed once per image,
+/// so every row adds a constant to them. The sums are done in float in the
+/// same order as in the per pixel code.
+template<typename WT>
+class TransformCoords {
+    float tmat[9];
+    bool perspective;
+    std::vector<float> colX;
+    std::vector<float> colY;
+    std::vector<float> colW;
+
+   public:
+    TransformCoords(const float *mat, const bool isPerspective,
+                    const dim_t width)
+        : perspective(isPerspective)
+        , colX(width)
+        , colY(width)
+        , colW(isPerspective ? width : 0) {
+        std::copy(mat, mat + (perspective ? 9 : 6), tmat);
+        for (dim_t x = 0; x < width; ++x) {
+            colX[x] = x * tmat[0];
+            colY[x] = x * tmat[3];
+            if (perspective) { colW[x] = x * tmat[6]; }
+        }
+    }
+
+    void operator()(const dim_t x0, const dim_t y, const dim_t n, WT *xs,
+                    WT *ys) const {
+        const float rowX = y * tmat[1];
+        const float rowY = y * tmat[4];
+        const float *cx  = colX.data() + x0;
+        const float *cy  = colY.data() + x0;
+        if (!perspective) {
+            for (dim_t k = 0; k < n; ++k) {
+                xs[k] = cx[k] + rowX + tmat[2];
+                ys[k] = cy[k] + rowY + tmat[5];
+            }
+            return;
+        }
+        const float rowW = y * tmat[7];
+        const float *cw  = colW.data() + x0;
+        for (dim_t k = 0; k < n; ++k) {
+            const WT w = cw[k] + rowW + tmat[8];
+            xs[k]      = WT(cx[k] + rowX + tmat[2]) / w;
+            ys[k]      = WT(cy[k] + rowY + tmat[5]) / w;
+        }
+    }
+};
+
+/// Input positions read from a pair of coordinate maps with one element per
+/// output pixel
+template<typename WT>
+class MapCoords {
+    const float *mapX;
+    const float *mapY;
+    dim_t strideX0;
+    dim_t strideX1;
+    dim_t strideY0;
+    dim_t strideY1;
+
+   public:
+    MapCoords(CParam<float> xmap, CParam<float> ymap)
+        : mapX(xmap.get())
+        , mapY(ymap.get())
+        , strideX0(xmap.strides(0))
+        , strideX1(xmap.strides(1))
+        , strideY0(ymap.strides(0))
+        , strideY1(ymap.strides(1)) {}
+
+    void operator()(const dim_t x0, const dim_t y, const dim_t n, WT *xs,
+                    WT *ys) const {
+        const float *mx = mapX + y * strideX1 + x0 * strideX0;
+        const float *my = mapY + y * strideY1 + x0 * strideY0;
+        for (dim_t k = 0; k < n; ++k) {
+            xs[k] = mx[k * strideX0];
+            ys[k] = my[k * strideY0];
+        }
+    }
+};
+
+}  // namespace kernel
+}  // namespace cpu
+}  // namespace arrayfire
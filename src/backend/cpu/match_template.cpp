@@ -9,36 +9,205 @@
 
 #include <match_template.hpp>
 
+#include <fftw3.h>
 #include <kernel/match_template.hpp>
 #include <platform.hpp>
 #include <queue.hpp>
 #include <af/dim4.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
 #include <functional>
+#include <memory>
 
 using af::dim4;
 
 namespace arrayfire {
 namespace cpu {
 
+namespace {
+
 template<typename To, typename Ti>
 using matchFunc = std::function<void(Param<To>, CParam<Ti>, CParam<Ti>)>;
 
+/// Smallest size of at least \p n with no prime factors above 7, for which
+/// FFTW has fast codelets
+dim_t fftSize(const dim_t n) {
+    for (dim_t size = std::max(n, dim_t(1));; ++size) {
+        dim_t rest = size;
+        for (const dim_t p : {2, 3, 5, 7}) {
+            while (rest % p == 0) { rest /= p; }
+        }
+        if (rest == 1) { return size; }
+    }
+}
+
+/// Transform size along both dimensions so that correlating an image with
+/// the template does not wrap around
+dim4 correlationSize(const dim4 &sDims, const dim4 &tDims) {
+    return dim4(fftSize(sDims[0] + tDims[0] - 1),
+                fftSize(sDims[1] + tDims[1] - 1), 1, 1);
+}
+
+/// True if the FFT path is expected to be faster than the direct sums. The
+/// direct sums cost one multiply-add per image and template pixel, the FFT
+/// path a forward and an inverse real transform of the padded image.
+bool useFftCorrelation(const dim4 &sDims, const dim4 &tDims) {
+    const double direct = static_cast<double>(sDims[0] * sDims[1]) *
+                          static_cast<double>(tDims[0] * tDims[1]);
+    const dim4 fDims    = correlationSize(sDims, tDims);
+    const double size   = static_cast<double>(fDims[0] * fDims[1]);
+    return direct > 8.0 * size * std::log2(size);
+}
+
+/// Cross-correlation of images with one template through real FFTs, in
+/// double precision so that the energies stay exact for integer images.
+/// The template spectrum and the plans are made once and serve every image
+/// of a batch.
+class FftCorrelation {
+    using buffer = std::unique_ptr<void, void (*)(void *)>;
+    using cdouble_t = std::complex<double>;
+
+    static buffer allocate(const size_t bytes) {
+        return buffer(fftw_malloc(bytes), fftw_free);
+    }
+
+    const dim_t n0;
+    const dim_t n1;
+    const dim_t bins;
+    buffer realBuf;
+    buffer spectrumBuf;
+    buffer templateBuf;
+    fftw_plan r2cPlan;
+    fftw_plan c2rPlan;
+
+    template<typename T>
+    void load(const kernel::Plane<T> &img) {
+        double *dst = real();
+        std::fill(dst, dst + n0 * n1, 0.0);
+        for (dim_t j = 0; j < img.dim1; ++j) {
+            for (dim_t i = 0; i < img.dim0; ++i) {
+                dst[j * n0 + i] = static_cast<double>(img(i, j));
+            }
+        }
+    }
+
+    cdouble_t *spectrum() {
+        return static_cast<cdouble_t *>(spectrumBuf.get());
+    }
+    fftw_complex *rawSpectrum() {
+        return static_cast<fftw_complex *>(spectrumBuf.get());
+    }
+
+   public:
+    template<typename T>
+    FftCorrelation(const dim4 &size, const kernel::Plane<T> &tpl)
+        : n0(size[0])
+        , n1(size[1])
+        , bins((size[0] / 2 + 1) * size[1])
+        , realBuf(allocate(sizeof(double) * n0 * n1))
+        , spectrumBuf(allocate(sizeof(cdouble_t) * bins))
+        , templateBuf(allocate(sizeof(cdouble_t) * bins)) {
+        // FFTW's row major n1 x n0 transform is the column major n0 x n1 one
+        const int rows = static_cast<int>(n1);
+        const int cols = static_cast<int>(n0);
+        r2cPlan = fftw_plan_dft_r2c_2d(rows, cols, real(), rawSpectrum(),
+                                       FFTW_ESTIMATE);
+        c2rPlan = fftw_plan_dft_c2r_2d(rows, cols, rawSpectrum(), real(),
+                                       FFTW_ESTIMATE);
+
+        // Conjugating the template spectrum turns the product into a
+        // correlation. The scale of the inverse transform is folded in.
+        load(tpl);
+        fftw_execute(r2cPlan);
+        const double scale = 1.0 / static_cast<double>(n0 * n1);
+        cdouble_t *tSpec   = static_cast<cdouble_t *>(templateBuf.get());
+        for (dim_t b = 0; b < bins; ++b) {
+            tSpec[b] = std::conj(spectrum()[b]) * scale;
+        }
+    }
+
+    ~FftCorrelation() {
+        fftw_destroy_plan(r2cPlan);
+        fftw_destroy_plan(c2rPlan);
+    }
+
+    FftCorrelation(const FftCorrelation &)            = delete;
+    FftCorrelation &operator=(const FftCorrelation &) = delete;
+
+    double *real() { return static_cast<double *>(realBuf.get()); }
+    dim_t stride() const { return n0; }
+
+    /// Leaves the correlation of \p img with the template in real(), with
+    /// element (i, j) at real()[j * stride() + i]
+    template<typename T>
+    void correlate(const kernel::Plane<T> &img) {
+        load(img);
+        fftw_execute(r2cPlan);
+        cdouble_t *spec        = spectrum();
+        const cdouble_t *tSpec = static_cast<cdouble_t *>(templateBuf.get());
+        for (dim_t b = 0; b < bins; ++b) { spec[b] *= tSpec[b]; }
+        fftw_execute(c2rPlan);
+    }
+};
+
+template<typename OutT, typename InT, af::matchType MatchType>
+void matchTemplateFft(Param<OutT> out, CParam<InT> sImg, CParam<InT> tImg) {
+    const dim4 sDims    = sImg.dims();
+    const dim4 sStrides = sImg.strides();
+    const dim4 oStrides = out.strides();
+
+    const kernel::Plane<InT> tpl(tImg.get(), tImg.dims(), tImg.strides());
+    const kernel::TemplateStats tStats(tpl);
+    FftCorrelation corr(correlationSize(sDims, tImg.dims()), tpl);
+
+    for (dim_t b3 = 0; b3 < sDims[3]; ++b3) {
+        for (dim_t b2 = 0; b2 < sDims[2]; ++b2) {
+            const kernel::Plane<InT> img(
+                sImg.get() + b2 * sStrides[2] + b3 * sStrides[3], sDims,
+                sStrides);
+            corr.correlate(img);
+            kernel::matchFromCorrelation<OutT, InT, MatchType>(
+                out.get() + b2 * oStrides[2] + b3 * oStrides[3], oStrides[1],
+                corr.real(), corr.stride(), img, tpl, tStats);
+        }
+    }
+}
+
+}  // namespace
+
 template<typename inType, typename outType>
 Array<outType> match_template(const Array<inType> &sImg,
                               const Array<inType> &tImg,
                               const af::matchType mType) {
-    static const matchFunc<outType, inType> funcs[6] = {
+    static const matchFunc<outType, inType> funcs[8] = {
         kernel::matchTemplate<outType, inType, AF_SAD>,
         kernel::matchTemplate<outType, inType, AF_ZSAD>,
         kernel::matchTemplate<outType, inType, AF_LSAD>,
         kernel::matchTemplate<outType, inType, AF_SSD>,
         kernel::matchTemplate<outType, inType, AF_ZSSD>,
         kernel::matchTemplate<outType, inType, AF_LSSD>,
+        kernel::matchTemplate<outType, inType, AF_NCC>,
+        kernel::matchTemplate<outType, inType, AF_ZNCC>,
+    };
+    static const matchFunc<outType, inType> fftFuncs[8] = {
+        nullptr,
+        nullptr,
+        nullptr,
+        matchTemplateFft<outType, inType, AF_SSD>,
+        matchTemplateFft<outType, inType, AF_ZSSD>,
+        matchTemplateFft<outType, inType, AF_LSSD>,
+        matchTemplateFft<outType, inType, AF_NCC>,
+        matchTemplateFft<outType, inType, AF_ZNCC>,
     };
 
+    const int idx = static_cast<int>(mType);
+    const bool fft =
+        fftFuncs[idx] && useFftCorrelation(sImg.dims(), tImg.dims());
+
     Array<outType> out = createEmptyArray<outType>(sImg.dims());
-    getQueue().enqueue(funcs[static_cast<int>(mType)], out, sImg, tImg);
+    getQueue().enqueue(fft ? fftFuncs[idx] : funcs[idx], out, sImg, tImg);
     return out;
 }
 
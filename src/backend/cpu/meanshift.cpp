@@ -26,15 +26,20 @@ namespace cpu {
 template<typename T>
 Array<T> meanshift(const Array<T> &in, const float &spatialSigma,
                    const float &chromaticSigma, const unsigned &numIterations,
-                   const bool &isColor) {
+                   const bool &isColor, const af_meanshift_method method) {
     Array<T> out = createEmptyArray<T>(in.dims());
 
+    const bool binned = (method == AF_MEANSHIFT_BINNED);
     if (isColor) {
-        getQueue().enqueue(kernel::meanShift<T, true>, out, in, spatialSigma,
-                           chromaticSigma, numIterations);
+        getQueue().enqueue(binned ? kernel::meanShift<T, true, true>
+                                  : kernel::meanShift<T, true, false>,
+                           out, in, spatialSigma, chromaticSigma,
+                           numIterations);
     } else {
-        getQueue().enqueue(kernel::meanShift<T, false>, out, in, spatialSigma,
-                           chromaticSigma, numIterations);
+        getQueue().enqueue(binned ? kernel::meanShift<T, false, true>
+                                  : kernel::meanShift<T, false, false>,
+                           out, in, spatialSigma, chromaticSigma,
+                           numIterations);
     }
 
     return out;
@@ -43,7 +48,7 @@ Array<T> meanshift(const Array<T> &in, const float &spatialSigma,
 #define INSTANTIATE(T)                                              \
     template Array<T> meanshift<T>(const Array<T> &, const float &, \
                                    const float &, const unsigned &, \
-                                   const bool &);
+                                   const bool &, const af_meanshift_method);
 
 INSTANTIATE(float)
 INSTANTIATE(double)
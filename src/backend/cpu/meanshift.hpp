@@ -14,6 +14,6 @@ namespace cpu {
 template<typename T>
 Array<T> meanshift(const Array<T> &in, const float &spatialSigma,
                    const float &chromaticSigma, const unsigned &numIterations,
-                   const bool &isColor);
+                   const bool &isColor, const af_meanshift_method method);
 }  // namespace cpu
 }  // namespace arrayfire
@@ -8,38 +8,42 @@
  ********************************************************/
 
 #include <Array.hpp>
-#include <convolve.hpp>
 #include <fast.hpp>
+#include <kernel/convolve.hpp>
 #include <kernel/orb.hpp>
-#include <memory.hpp>
+#include <parallel.hpp>
 #include <platform.hpp>
 #include <queue.hpp>
 #include <resize.hpp>
-#include <sort_index.hpp>
 #include <af/dim4.hpp>
 
+#include <algorithm>
 #include <cmath>
-#include <cstring>
-#include <functional>
-#include <memory>
-#include <utility>
 #include <vector>
 
 using af::dim4;
 using std::ceil;
+using std::copy;
 using std::floor;
-using std::function;
 using std::min;
-using std::move;
 using std::pow;
 using std::round;
 using std::sqrt;
-using std::unique_ptr;
 using std::vector;
 
 namespace arrayfire {
 namespace cpu {
 
+namespace {
+
+/// Features and descriptors found on a single pyramid level
+struct OrbLevel {
+    vector<float> x, y, score, ori, size;
+    vector<unsigned> desc;
+};
+
+}  // namespace
+
 template<typename T, typename convAccT>
 unsigned orb(Array<float>& x, Array<float>& y, Array<float>& score,
              Array<float>& ori, Array<float>& size, Array<uint>& desc,
@@ -66,17 +70,6 @@ unsigned orb(Array<float>& x, Array<float>& y, Array<float>& score,
         scl_sum += 1.f / pow(scl_fctr, static_cast<float>(i));
     }
 
-    vector<unique_ptr<float[], function<void(float*)>>> h_x_pyr(max_levels);
-    vector<unique_ptr<float[], function<void(float*)>>> h_y_pyr(max_levels);
-    vector<unique_ptr<float[], function<void(float*)>>> h_score_pyr(max_levels);
-    vector<unique_ptr<float[], function<void(float*)>>> h_ori_pyr(max_levels);
-    vector<unique_ptr<float[], function<void(float*)>>> h_size_pyr(max_levels);
-    vector<unique_ptr<unsigned[], function<void(unsigned*)>>> h_desc_pyr(
-        max_levels);
-
-    vector<unsigned> feat_pyr(max_levels);
-    unsigned total_feat = 0;
-
     // Compute number of features to keep for each level
     vector<unsigned> lvl_best(max_levels);
     unsigned feat_sum = 0;
@@ -87,157 +80,131 @@ unsigned orb(Array<float>& x, Array<float>& y, Array<float>& score,
     }
     lvl_best[max_levels - 1] = max_feat - feat_sum;
 
-    // Maintain a reference to previous level image
-    Array<T> prev_img = createEmptyArray<T>(dim4());
-    dim4 prev_ldims;
+    // Round feature size to nearest odd integer
+    float feat_size = 2.f * floor(static_cast<float>(patch_size) / 2.f) + 1.f;
 
-    dim4 gauss_dims(9);
-    unique_ptr<T[], function<void(T*)>> h_gauss;
-    Array<T> gauss_filter = createEmptyArray<T>(dim4());
+    // Avoid keeping features that might be too wide and might not fit on
+    // the image, sqrt(2.f) is the radius when angle is 45 degrees and
+    // represents widest case possible
+    unsigned edge = ceil(feat_size * sqrt(2.f) / 2.f);
 
-    for (unsigned i = 0; i < max_levels; i++) {
-        dim4 ldims;
-        const auto lvl_scl = pow(scl_fctr, static_cast<float>(i));
-        Array<T> lvl_img   = createEmptyArray<T>(dim4());
+    // Build the pyramid and detect FAST corners on every level. Each level
+    // is resized from the previous one, so this part runs level by level.
+    vector<Array<T>> lvl_imgs;
+    vector<Array<float>> x_fast, y_fast;
+    vector<unsigned> lvl_feat(max_levels);
+    lvl_imgs.reserve(max_levels);
+    x_fast.reserve(max_levels);
+    y_fast.reserve(max_levels);
 
+    for (unsigned i = 0; i < max_levels; i++) {
         if (i == 0) {
             // First level is used in its original size
-            lvl_img = image;
-            ldims   = image.dims();
-
-            prev_img   = image;
-            prev_ldims = image.dims();
+            lvl_imgs.push_back(image);
         } else {
             // Resize previous level image to current level dimensions
-            ldims[0] = round(idims[0] / lvl_scl);
-            ldims[1] = round(idims[1] / lvl_scl);
-
-            lvl_img =
-                resize<T>(prev_img, ldims[0], ldims[1], AF_INTERP_BILINEAR);
+            const auto lvl_scl = pow(scl_fctr, static_cast<float>(i));
+            dim_t ldims0       = round(idims[0] / lvl_scl);
+            dim_t ldims1       = round(idims[1] / lvl_scl);
 
-            prev_img   = lvl_img;
-            prev_ldims = lvl_img.dims();
+            lvl_imgs.push_back(
+                resize<T>(lvl_imgs[i - 1], ldims0, ldims1, AF_INTERP_BILINEAR));
         }
-        prev_img.eval();
-        lvl_img.eval();
+        lvl_imgs[i].eval();
         getQueue().sync();
 
-        Array<float> x_feat     = createEmptyArray<float>(dim4());
-        Array<float> y_feat     = createEmptyArray<float>(dim4());
-        Array<float> score_feat = createEmptyArray<float>(dim4());
-
-        // Round feature size to nearest odd integer
-        float size = 2.f * floor(static_cast<float>(patch_size) / 2.f) + 1.f;
-
-        // Avoid keeping features that might be too wide and might not fit on
-        // the image, sqrt(2.f) is the radius when angle is 45 degrees and
-        // represents widest case possible
-        unsigned edge = ceil(size * sqrt(2.f) / 2.f);
+        x_fast.push_back(createEmptyArray<float>(dim4()));
+        y_fast.push_back(createEmptyArray<float>(dim4()));
+        Array<float> score_fast = createEmptyArray<float>(dim4());
 
-        unsigned lvl_feat = fast(x_feat, y_feat, score_feat, lvl_img, fast_thr,
-                                 9, 1, 0.15f, edge);
+        lvl_feat[i] = fast(x_fast[i], y_fast[i], score_fast, lvl_imgs[i],
+                           fast_thr, 9, 1, 0.15f, edge);
+    }
 
-        if (lvl_feat == 0) { continue; }
+    // Separable Gaussian kernel used to reduce noise sensitivity of the
+    // descriptors
+    const dim_t gauss_len = 9;
+    vector<convAccT> h_gauss(gauss_len);
+    if (blur_img) { gaussian1D(h_gauss.data(), gauss_len, 2.f); }
 
-        float* h_x_feat = x_feat.get();
-        float* h_y_feat = y_feat.get();
+    // The remaining stages only touch host memory, so the levels are
+    // processed concurrently. Kernels called from a level run on that
+    // level's thread.
+    vector<OrbLevel> lvl_out(max_levels);
+    parallelFor(max_levels, [&](dim_t i) {
+        if (lvl_feat[i] == 0) { return; }
 
-        auto h_x_harris     = memAlloc<float>(lvl_feat);
-        auto h_y_harris     = memAlloc<float>(lvl_feat);
-        auto h_score_harris = memAlloc<float>(lvl_feat);
+        const Array<T>& lvl_img = lvl_imgs[i];
+        const dim4 ldims        = lvl_img.dims();
+        const auto lvl_scl      = pow(scl_fctr, static_cast<float>(i));
 
         // Calculate Harris responses
         // Good block_size >= 7 (must be an odd number)
+        vector<float> x_harris(lvl_feat[i]);
+        vector<float> y_harris(lvl_feat[i]);
+        vector<float> score_harris(lvl_feat[i]);
         unsigned usable_feat = 0;
         kernel::harris_response<T, false>(
-            h_x_harris.get(), h_y_harris.get(), h_score_harris.get(), nullptr,
-            h_x_feat, h_y_feat, nullptr, lvl_feat, &usable_feat, lvl_img, 7,
-            0.04f, patch_size);
-
-        if (usable_feat == 0) { continue; }
+            x_harris.data(), y_harris.data(), score_harris.data(), nullptr,
+            x_fast[i].get(), y_fast[i].get(), nullptr, lvl_feat[i],
+            &usable_feat, lvl_img, 7, 0.04f, patch_size);
 
-        // Sort features according to Harris responses
-        af::dim4 usable_feat_dims(usable_feat);
-        Array<float> score_harris = createDeviceDataArray<float>(
-            usable_feat_dims, h_score_harris.get());
-        Array<float> harris_sorted = createEmptyArray<float>(af::dim4());
-        Array<unsigned> harris_idx = createEmptyArray<unsigned>(af::dim4());
-
-        sort_index<float>(harris_sorted, harris_idx, score_harris, 0, false);
-        getQueue().sync();
-
-        usable_feat = min(usable_feat, lvl_best[i]);
-
-        if (usable_feat == 0) {
-            h_score_harris.release();
-            continue;
-        }
-
-        auto h_x_lvl     = memAlloc<float>(usable_feat);
-        auto h_y_lvl     = memAlloc<float>(usable_feat);
-        auto h_score_lvl = memAlloc<float>(usable_feat);
+        const unsigned lvl_usable = min(usable_feat, lvl_best[i]);
+        if (lvl_usable == 0) { return; }
 
         // Keep only features with higher Harris responses
-        kernel::keep_features<T>(h_x_lvl.get(), h_y_lvl.get(),
-                                 h_score_lvl.get(), nullptr, h_x_harris.get(),
-                                 h_y_harris.get(), harris_sorted.get(),
-                                 harris_idx.get(), nullptr, usable_feat);
-
-        auto h_ori_lvl  = memAlloc<float>(usable_feat);
-        auto h_size_lvl = memAlloc<float>(usable_feat);
+        vector<float> harris_best(lvl_usable);
+        vector<unsigned> harris_idx(lvl_usable);
+        kernel::best_features(harris_best.data(), harris_idx.data(),
+                              score_harris.data(), usable_feat, lvl_usable);
+
+        OrbLevel& lvl = lvl_out[i];
+        lvl.x.resize(lvl_usable);
+        lvl.y.resize(lvl_usable);
+        lvl.score.resize(lvl_usable);
+        lvl.ori.resize(lvl_usable);
+        lvl.size.resize(lvl_usable);
+        lvl.desc.assign(lvl_usable * 8, 0U);
+
+        kernel::keep_features<T>(lvl.x.data(), lvl.y.data(), lvl.score.data(),
+                                 nullptr, x_harris.data(), y_harris.data(),
+                                 harris_best.data(), harris_idx.data(),
+                                 nullptr, lvl_usable);
 
         // Compute orientation of features
-        kernel::centroid_angle<T>(h_x_lvl.get(), h_y_lvl.get(), h_ori_lvl.get(),
-                                  usable_feat, lvl_img, patch_size);
-
-        Array<T> lvl_filt = createEmptyArray<T>(dim4());
+        kernel::centroid_angle<T>(lvl.x.data(), lvl.y.data(), lvl.ori.data(),
+                                  lvl_usable, lvl_img, patch_size);
 
+        // Compute ORB descriptors, sampled from the blurred level when
+        // requested
         if (blur_img) {
-            // Calculate a separable Gaussian kernel, if one is not already
-            // stored
-            if (!h_gauss) {
-                h_gauss = memAlloc<T>(gauss_dims[0]);
-                gaussian1D(h_gauss.get(), gauss_dims[0], 2.f);
-                gauss_filter =
-                    createDeviceDataArray<T>(gauss_dims, h_gauss.get());
-                gauss_filter.eval();
-            }
-
-            // Filter level image with Gaussian kernel to reduce noise
-            // sensitivity
-            lvl_filt = convolve2<T, convAccT>(lvl_img, gauss_filter,
-                                              gauss_filter, false);
-        }
-        lvl_filt.eval();
-        getQueue().sync();
-
-        // Compute ORB descriptors
-        auto h_desc_lvl = memAlloc<unsigned>(usable_feat * 8);
-        memset(h_desc_lvl.get(), 0, usable_feat * 8 * sizeof(unsigned));
-        if (blur_img) {
-            kernel::extract_orb<T>(h_desc_lvl.get(), usable_feat, h_x_lvl.get(),
-                                   h_y_lvl.get(), h_ori_lvl.get(),
-                                   h_size_lvl.get(), lvl_filt, lvl_scl,
-                                   patch_size);
+            const dim4 lstrides(1, ldims[0], ldims[0] * ldims[1],
+                                ldims[0] * ldims[1]);
+            vector<T> tmp(ldims[0] * ldims[1]);
+            vector<T> lvl_filt(ldims[0] * ldims[1]);
+
+            kernel::convolve2_separable<T, convAccT, false, 0>(
+                tmp.data(), lvl_img.get(), h_gauss.data(), ldims, ldims, ldims,
+                gauss_len, lstrides, lvl_img.strides(), 1);
+            kernel::convolve2_separable<T, convAccT, false, 1>(
+                lvl_filt.data(), tmp.data(), h_gauss.data(), ldims, ldims,
+                ldims, gauss_len, lstrides, lstrides, 1);
+
+            kernel::extract_orb<T>(
+                lvl.desc.data(), lvl_usable, lvl.x.data(), lvl.y.data(),
+                lvl.ori.data(), lvl.size.data(),
+                CParam<T>(lvl_filt.data(), ldims, lstrides), lvl_scl,
+                patch_size);
         } else {
-            kernel::extract_orb<T>(h_desc_lvl.get(), usable_feat, h_x_lvl.get(),
-                                   h_y_lvl.get(), h_ori_lvl.get(),
-                                   h_size_lvl.get(), lvl_img, lvl_scl,
+            kernel::extract_orb<T>(lvl.desc.data(), lvl_usable, lvl.x.data(),
+                                   lvl.y.data(), lvl.ori.data(),
+                                   lvl.size.data(), lvl_img, lvl_scl,
                                    patch_size);
         }
+    });
 
-        // Store results to pyramids
-        total_feat += usable_feat;
-        feat_pyr[i]    = usable_feat;
-        h_x_pyr[i]     = move(h_x_lvl);
-        h_y_pyr[i]     = move(h_y_lvl);
-        h_score_pyr[i] = move(h_score_lvl);
-        h_ori_pyr[i]   = move(h_ori_lvl);
-        h_size_pyr[i]  = move(h_size_lvl);
-        h_desc_pyr[i]  = move(h_desc_lvl);
-        h_score_harris.release();
-        h_gauss.release();
-    }
+    unsigned total_feat = 0;
+    for (const OrbLevel& lvl : lvl_out) { total_feat += lvl.x.size(); }
 
     if (total_feat > 0) {
         // Allocate feature Arrays
@@ -260,22 +227,18 @@ unsigned orb(Array<float>& x, Array<float>& y, Array<float>& score,
         unsigned* h_desc = desc.get();
 
         unsigned offset = 0;
-        for (unsigned i = 0; i < max_levels; i++) {
-            if (feat_pyr[i] == 0) { continue; }
-
-            if (i > 0) { offset += feat_pyr[i - 1]; }
-
-            memcpy(h_x + offset, h_x_pyr[i].get(), feat_pyr[i] * sizeof(float));
-            memcpy(h_y + offset, h_y_pyr[i].get(), feat_pyr[i] * sizeof(float));
-            memcpy(h_score + offset, h_score_pyr[i].get(),
-                   feat_pyr[i] * sizeof(float));
-            memcpy(h_ori + offset, h_ori_pyr[i].get(),
-                   feat_pyr[i] * sizeof(float));
-            memcpy(h_size + offset, h_size_pyr[i].get(),
-                   feat_pyr[i] * sizeof(float));
-
-            memcpy(h_desc + (offset * 8), h_desc_pyr[i].get(),
-                   feat_pyr[i] * 8 * sizeof(unsigned));
+        for (const OrbLevel& lvl : lvl_out) {
+            const size_t nfeat = lvl.x.size();
+            if (nfeat == 0) { continue; }
+
+            copy(lvl.x.begin(), lvl.x.end(), h_x + offset);
+            copy(lvl.y.begin(), lvl.y.end(), h_y + offset);
+            copy(lvl.score.begin(), lvl.score.end(), h_score + offset);
+            copy(lvl.ori.begin(), lvl.ori.end(), h_ori + offset);
+            copy(lvl.size.begin(), lvl.size.end(), h_size + offset);
+            copy(lvl.desc.begin(), lvl.desc.end(), h_desc + offset * 8);
+
+            offset += nfeat;
         }
     }
 
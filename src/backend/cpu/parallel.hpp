@@ -0,0 +1,22 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+
+#include <common/parallel.hpp>
+
+namespace arrayfire {
+namespace cpu {
+
+using common::getNumThreads;
+using common::parallelFor;
+using common::parallelForChunks;
+
+}  // namespace cpu
+}  // namespace arrayfire
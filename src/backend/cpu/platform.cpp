@@ -114,6 +114,11 @@ int& getMaxJitSize() {
     return length;
 }
 
+std::atomic<size_t>& getJitMergedNodes() {
+    static std::atomic<size_t> merged{0};
+    return merged;
+}
+
 int getDeviceCount() { return DeviceManager::NUM_DEVICES; }
 
 void init() {
@@ -10,6 +10,9 @@
 #pragma once
 
 #include <queue.hpp>
+
+#include <atomic>
+#include <cstddef>
 #include <string>
 
 namespace arrayfire {
@@ -36,6 +39,10 @@ void devprop(char* d_name, char* d_platform, char* d_toolkit, char* d_compute);
 
 int& getMaxJitSize();
 
+/// Number of JIT nodes that were merged into an equal node before evaluation
+/// since the start of the program
+std::atomic<size_t>& getJitMergedNodes();
+
 int getDeviceCount();
 
 void init();
@@ -13,6 +13,7 @@
 
 #if defined(WITH_LINEAR_ALGEBRA)
 #include <copy.hpp>
+#include <kernel/batched_linalg.hpp>
 #include <lapack_helper.hpp>
 #include <math.hpp>
 #include <platform.hpp>
@@ -79,16 +80,27 @@ void qr(Array<T> &q, Array<T> &r, Array<T> &t, const Array<T> &in) {
     t = qr_inplace(q);
 
     // SPLIT into q and r
-    dim4 rdims(M, N);
+    dim4 rdims(M, N, iDims[2], iDims[3]);
     r = createEmptyArray<T>(rdims);
 
     triangle<T>(r, q, true, false);
 
+    q.resetDims(dim4(M, M, iDims[2], iDims[3]));
+    if (kernel::useBatchedLinAlg(iDims)) {
+        getQueue().enqueue(kernel::qrFormQBatched<T>, q, t, min(M, N));
+        return;
+    }
+
     auto func = [=](Param<T> q, Param<T> t, int M, int N) {
-        gqr_func<T>()(AF_LAPACK_COL_MAJOR, M, M, min(M, N), q.get(),
-                      q.strides(1), t.get());
+        for (dim_t w = 0; w < q.dims(3); ++w) {
+            for (dim_t z = 0; z < q.dims(2); ++z) {
+                gqr_func<T>()(AF_LAPACK_COL_MAJOR, M, M, min(M, N),
+                              q.get() + z * q.strides(2) + w * q.strides(3),
+                              q.strides(1),
+                              t.get() + z * t.strides(2) + w * t.strides(3));
+            }
+        }
     };
-    q.resetDims(dim4(M, M));
     getQueue().enqueue(func, q, t, M, N);
 }
 
@@ -97,11 +109,24 @@ Array<T> qr_inplace(Array<T> &in) {
     dim4 iDims = in.dims();
     int M      = iDims[0];
     int N      = iDims[1];
-    Array<T> t = createEmptyArray<T>(af::dim4(min(M, N), 1, 1, 1));
+    Array<T> t =
+        createEmptyArray<T>(af::dim4(min(M, N), 1, iDims[2], iDims[3]));
+
+    if (kernel::useBatchedLinAlg(iDims)) {
+        getQueue().enqueue(kernel::qrBatched<T>, in, t);
+        return t;
+    }
 
     auto func = [=](Param<T> in, Param<T> t, int M, int N) {
-        geqrf_func<T>()(AF_LAPACK_COL_MAJOR, M, N, in.get(), in.strides(1),
-                        t.get());
+        for (dim_t w = 0; w < in.dims(3); ++w) {
+            for (dim_t z = 0; z < in.dims(2); ++z) {
+                geqrf_func<T>()(AF_LAPACK_COL_MAJOR, M, N,
+                                in.get() + z * in.strides(2) +
+                                    w * in.strides(3),
+                                in.strides(1),
+                                t.get() + z * t.strides(2) + w * t.strides(3));
+            }
+        }
     };
     getQueue().enqueue(func, in, t, M, N);
 
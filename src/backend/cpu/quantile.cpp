@@ -0,0 +1,54 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <quantile.hpp>
+
+#include <Array.hpp>
+#include <kernel/quantile.hpp>
+#include <platform.hpp>
+#include <queue.hpp>
+#include <af/dim4.hpp>
+
+using af::dim4;
+using arrayfire::common::QuantileRanks;
+using std::vector;
+
+namespace arrayfire {
+namespace cpu {
+
+template<typename T, typename To>
+Array<To> quantile(const Array<T> &in, const vector<QuantileRanks> &plan,
+                   const int dim) {
+    dim4 odims    = in.dims();
+    odims[dim]    = static_cast<dim_t>(plan.size());
+    Array<To> out = createEmptyArray<To>(odims);
+
+    getQueue().enqueue(kernel::quantile<T, To>, out, in, plan, dim);
+
+    return out;
+}
+
+#define INSTANTIATE(T)                                                       \
+    template Array<float> quantile<T, float>(                                \
+        const Array<T> &in, const vector<QuantileRanks> &plan,               \
+        const int dim);                                                      \
+    template Array<double> quantile<T, double>(                              \
+        const Array<T> &in, const vector<QuantileRanks> &plan,               \
+        const int dim);
+
+INSTANTIATE(float)
+INSTANTIATE(double)
+INSTANTIATE(int)
+INSTANTIATE(uint)
+INSTANTIATE(short)
+INSTANTIATE(ushort)
+INSTANTIATE(uchar)
+
+}  // namespace cpu
+}  // namespace arrayfire
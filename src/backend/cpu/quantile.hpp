@@ -0,0 +1,24 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+#include <Array.hpp>
+#include <common/quantile.hpp>
+
+#include <vector>
+
+namespace arrayfire {
+namespace cpu {
+/// Quantiles along \p dim, one per element of \p plan, found by selection
+template<typename T, typename To>
+Array<To> quantile(const Array<T> &in,
+                   const std::vector<common::QuantileRanks> &plan,
+                   const int dim);
+}  // namespace cpu
+}  // namespace arrayfire
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Param.hpp>
+#include <common/Profiler.hpp>
 #include <common/util.hpp>
 #include <memory.hpp>
 
@@ -62,10 +63,10 @@ class queue {
     template<typename F, typename... Args>
     void enqueue(const F func, Args &&...args) {
         count++;
-        if (sync_calls) {
-            func(toParam(std::forward<Args>(args))...);
+        if (common::profilerEnabled()) {
+            submit(profiledTask(func), std::forward<Args>(args)...);
         } else {
-            aQueue.enqueue(func, toParam(std::forward<Args>(args))...);
+            submit(func, std::forward<Args>(args)...);
         }
 #ifndef NDEBUG
         sync();
@@ -89,6 +90,32 @@ class queue {
     friend class queue_event;
 
    private:
+    template<typename F, typename... Args>
+    void submit(const F func, Args &&...args) {
+        if (sync_calls) {
+            func(toParam(std::forward<Args>(args))...);
+        } else {
+            aQueue.enqueue(func, toParam(std::forward<Args>(args))...);
+        }
+    }
+
+    /// Wraps \p func so that the time the task waits in the queue and the
+    /// time it runs are recorded. The task is named after the profiled call
+    /// that enqueued it.
+    template<typename F>
+    static auto profiledTask(const F func) {
+        const common::ProfileScope *caller = common::currentProfileScope();
+        const char *name     = caller ? caller->name() : "task";
+        const int64_t queued = common::profilerNow();
+        return [func, name, queued](auto &&...params) {
+            const int64_t started = common::profilerNow();
+            common::recordProfileEvent(
+                {name, "queue", 'X', queued, started - queued, {}, {}});
+            common::ProfileScope scope(name, "task");
+            func(std::forward<decltype(params)>(params)...);
+        };
+    }
+
     int count;
     const bool sync_calls;
     queue_impl aQueue;
@@ -45,6 +45,11 @@ template<af_op_t op, typename Ti, typename To>
 using reduce_dim_func = std::function<void(
     Param<To>, const dim_t, CParam<Ti>, const dim_t, const int, bool, double)>;
 
+template<af_op_t op, typename Ti, typename To>
+using reduce_node_func =
+    std::function<void(Param<To>, common::Node_ptr, const dim4, const int,
+                       bool, double)>;
+
 template<af_op_t op, typename Ti, typename To>
 Array<To> reduce(const Array<Ti> &in, const int dim, bool change_nan,
                  double nanval) {
@@ -58,6 +63,15 @@ Array<To> reduce(const Array<Ti> &in, const int dim, bool change_nan,
         kernel::reduce_dim<op, Ti, To, 3>(),
         kernel::reduce_dim<op, Ti, To, 4>()};
 
+    if (!in.isReady()) {
+        // Reduce the values of the JIT tree as they are evaluated
+        static const reduce_node_func<op, Ti, To> reduce_node_kernel =
+            kernel::reduce_node<op, Ti, To>();
+        getQueue().enqueue(reduce_node_kernel, out, in.getNode(), in.dims(),
+                           dim, change_nan, nanval);
+        return out;
+    }
+
     getQueue().enqueue(reduce_funcs[in.ndims() - 1], out, 0, in, 0, dim,
                        change_nan, nanval);
 
@@ -112,13 +126,23 @@ using reduce_all_func =
     std::function<void(Param<To>, CParam<Ti>, bool, double)>;
 
 template<af_op_t op, typename Ti, typename To>
-Array<To> reduce_all(const Array<Ti> &in, bool change_nan, double nanval) {
-    in.eval();
+using reduce_all_node_func =
+    std::function<void(Param<To>, common::Node_ptr, const dim4, bool, double)>;
 
+template<af_op_t op, typename Ti, typename To>
+Array<To> reduce_all(const Array<Ti> &in, bool change_nan, double nanval) {
     Array<To> out = createEmptyArray<To>(1);
-    static const reduce_all_func<op, Ti, To> reduce_all_kernel =
-        kernel::reduce_all<op, Ti, To>();
-    getQueue().enqueue(reduce_all_kernel, out, in, change_nan, nanval);
+    if (in.isReady()) {
+        static const reduce_all_func<op, Ti, To> reduce_all_kernel =
+            kernel::reduce_all<op, Ti, To>();
+        getQueue().enqueue(reduce_all_kernel, out, in, change_nan, nanval);
+    } else {
+        // Reduce the values of the JIT tree as they are evaluated
+        static const reduce_all_node_func<op, Ti, To> reduce_all_node_kernel =
+            kernel::reduce_all_node<op, Ti, To>();
+        getQueue().enqueue(reduce_all_node_kernel, out, in.getNode(),
+                           in.dims(), change_nan, nanval);
+    }
     getQueue().sync();
     return out;
 }
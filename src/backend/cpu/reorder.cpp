@@ -26,7 +26,7 @@ Array<T> reorder(const Array<T> &in, const af::dim4 &rdims) {
     for (int i = 0; i < 4; i++) { oDims[i] = iDims[rdims[i]]; }
 
     Array<T> out = createEmptyArray<T>(oDims);
-    getQueue().enqueue(kernel::reorder<T>, out, in, oDims, rdims);
+    getQueue().enqueue(kernel::reorder<T>, out, in, rdims);
     return out;
 }
 
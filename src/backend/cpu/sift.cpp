@@ -10,6 +10,8 @@
 #include <sift.hpp>
 
 #include <kernel/sift.hpp>
+#include <platform.hpp>
+#include <queue.hpp>
 
 using af::dim4;
 
@@ -24,6 +26,9 @@ unsigned sift(Array<float>& x, Array<float>& y, Array<float>& score,
               const float init_sigma, const bool double_input,
               const float img_scale, const float feature_ratio,
               const bool compute_GLOH) {
+    in.eval();
+    getQueue().sync();
+
     return sift_impl<T, convAccT>(
         x, y, score, ori, size, desc, in, n_layers, contrast_thr, edge_thr,
         init_sigma, double_input, img_scale, feature_ratio, compute_GLOH);
@@ -13,6 +13,7 @@
 
 #if defined(WITH_LINEAR_ALGEBRA)
 #include <copy.hpp>
+#include <kernel/batched_linalg.hpp>
 #include <lapack_helper.hpp>
 #include <math.hpp>
 #if USE_MKL
@@ -174,11 +175,25 @@ Array<T> solveLU(const Array<T> &A, const Array<int> &pivot, const Array<T> &b,
     int NRHS   = b.dims()[1];
     Array<T> B = copyArray<T>(b);
 
+    if (kernel::useBatchedLinAlg(A.dims())) {
+        getQueue().enqueue(kernel::luSolveBatched<T>, A, pivot, B);
+        return B;
+    }
+
     // NOLINTNEXTLINE
     auto func = [=](CParam<T> A, Param<T> B, CParam<int> pivot, int N,
                     int NRHS) {
-        getrs_func<T>()(AF_LAPACK_COL_MAJOR, 'N', N, NRHS, A.get(),
-                        A.strides(1), pivot.get(), B.get(), B.strides(1));
+        for (dim_t w = 0; w < A.dims(3); ++w) {
+            for (dim_t z = 0; z < A.dims(2); ++z) {
+                getrs_func<T>()(
+                    AF_LAPACK_COL_MAJOR, 'N', N, NRHS,
+                    A.get() + z * A.strides(2) + w * A.strides(3),
+                    A.strides(1),
+                    pivot.get() + z * pivot.strides(2) + w * pivot.strides(3),
+                    B.get() + z * B.strides(2) + w * B.strides(3),
+                    B.strides(1));
+            }
+        }
     };
     getQueue().enqueue(func, A, B, pivot, N, NRHS);
 
@@ -265,6 +280,14 @@ Array<T> solve(const Array<T> &a, const Array<T> &b,
         return triangleSolve<T>(a, b, options);
     }
 
+    // Stacks of small square systems are solved together
+    if (a.dims()[0] == a.dims()[1] && kernel::useBatchedLinAlg(a.dims())) {
+        Array<T> A = copyArray<T>(a);
+        Array<T> B = copyArray<T>(b);
+        getQueue().enqueue(kernel::solveBatched<T>, A, B);
+        return B;
+    }
+
 #ifdef AF_USE_MKL_BATCH
     if (a.dims()[2] > 1 || a.dims()[3] > 1) {
         return generalSolveBatched(a, b, options);
@@ -14,6 +14,7 @@
 
 #if defined(WITH_LINEAR_ALGEBRA)
 #include <copy.hpp>
+#include <kernel/batched_linalg.hpp>
 #include <lapack_helper.hpp>
 #include <platform.hpp>
 #include <queue.hpp>
@@ -60,21 +61,34 @@ SVD_FUNC(gesvd, cdouble, double, z)
 
 template<typename T, typename Tr>
 void svdInPlace(Array<Tr> &s, Array<T> &u, Array<T> &vt, Array<T> &in) {
+    if (kernel::useBatchedLinAlg(in.dims())) {
+        getQueue().enqueue(kernel::svdBatched<T>, s, u, vt, in);
+        return;
+    }
+
     auto func = [=](Param<Tr> s, Param<T> u, Param<T> vt, Param<T> in) {
         dim4 iDims = in.dims();
         int M      = iDims[0];
         int N      = iDims[1];
 
+        for (dim_t w = 0; w < iDims[3]; ++w) {
+            for (dim_t z = 0; z < iDims[2]; ++z) {
+                T *inPtr = in.get() + z * in.strides(2) + w * in.strides(3);
+                Tr *sPtr = s.get() + z * s.strides(2) + w * s.strides(3);
+                T *uPtr  = u.get() + z * u.strides(2) + w * u.strides(3);
+                T *vtPtr = vt.get() + z * vt.strides(2) + w * vt.strides(3);
 #if defined(USE_MKL) || defined(__APPLE__)
-        svd_func<T, Tr>()(AF_LAPACK_COL_MAJOR, 'A', M, N, in.get(),
-                          in.strides(1), s.get(), u.get(), u.strides(1),
-                          vt.get(), vt.strides(1));
+                svd_func<T, Tr>()(AF_LAPACK_COL_MAJOR, 'A', M, N, inPtr,
+                                  in.strides(1), sPtr, uPtr, u.strides(1),
+                                  vtPtr, vt.strides(1));
 #else
-        std::vector<Tr> superb(std::min(M, N));
-        svd_func<T, Tr>()(AF_LAPACK_COL_MAJOR, 'A', 'A', M, N, in.get(),
-                          in.strides(1), s.get(), u.get(), u.strides(1),
-                          vt.get(), vt.strides(1), &superb[0]);
+                std::vector<Tr> superb(std::min(M, N));
+                svd_func<T, Tr>()(AF_LAPACK_COL_MAJOR, 'A', 'A', M, N, inPtr,
+                                  in.strides(1), sPtr, uPtr, u.strides(1),
+                                  vtPtr, vt.strides(1), &superb[0]);
 #endif
+            }
+        }
     };
     getQueue().enqueue(func, s, u, vt, in);
 }
@@ -44,11 +44,43 @@ void transform(Array<T> &out, const Array<T> &in, const Array<float> &tf,
     }
 }
 
+template<typename T>
+Array<T> remap(const Array<T> &in, const Array<float> &mapX,
+               const Array<float> &mapY, const af_interp_type method) {
+    const af::dim4 idims = in.dims();
+    const af::dim4 mdims = mapX.dims();
+    Array<T> out =
+        createEmptyArray<T>(af::dim4(mdims[0], mdims[1], idims[2], idims[3]));
+
+    switch (method) {
+        case AF_INTERP_NEAREST:
+        case AF_INTERP_LOWER:
+            getQueue().enqueue(kernel::remap<T, 1>, out, in, mapX, mapY,
+                               method);
+            break;
+        case AF_INTERP_BILINEAR:
+        case AF_INTERP_BILINEAR_COSINE:
+            getQueue().enqueue(kernel::remap<T, 2>, out, in, mapX, mapY,
+                               method);
+            break;
+        case AF_INTERP_BICUBIC:
+        case AF_INTERP_BICUBIC_SPLINE:
+            getQueue().enqueue(kernel::remap<T, 3>, out, in, mapX, mapY,
+                               method);
+            break;
+        default: AF_ERROR("Unsupported interpolation type", AF_ERR_ARG); break;
+    }
+    return out;
+}
+
 #define INSTANTIATE(T)                                                       \
     template void transform(Array<T> &out, const Array<T> &in,               \
                             const Array<float> &tf,                          \
                             const af_interp_type method, const bool inverse, \
-                            const bool perspective);
+                            const bool perspective);                         \
+    template Array<T> remap(const Array<T> &in, const Array<float> &mapX,    \
+                            const Array<float> &mapY,                        \
+                            const af_interp_type method);
 
 INSTANTIATE(float)
 INSTANTIATE(double)
@@ -15,5 +15,11 @@ template<typename T>
 void transform(Array<T> &out, const Array<T> &in, const Array<float> &tf,
                const af_interp_type method, const bool inverse,
                const bool perspective);
+
+/// Samples every image of \p in at the positions given by \p mapX and
+/// \p mapY, which hold one position per output pixel
+template<typename T>
+Array<T> remap(const Array<T> &in, const Array<float> &mapX,
+               const Array<float> &mapY, const af_interp_type method);
 }  // namespace cpu
 }  // namespace arrayfire
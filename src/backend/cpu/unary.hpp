@@ -9,6 +9,7 @@
 
 #pragma once
 #include <Array.hpp>
+#include <common/ObjectPool.hpp>
 #include <err_cpu.hpp>
 #include <jit/UnaryNode.hpp>
 #include <optypes.hpp>
@@ -89,7 +90,7 @@ Array<T> unaryOp(const Array<T> &in, dim4 outDim = dim4(-1, -1, -1, -1)) {
     using UnaryNode = jit::UnaryNode<T, T, op>;
 
     common::Node_ptr in_node = in.getNode();
-    auto node                = std::make_shared<UnaryNode>(in_node);
+    auto node = common::makePooledShared<UnaryNode>(in_node);
 
     if (outDim == dim4(-1, -1, -1, -1)) { outDim = in.dims(); }
     return createNodeArray<T>(outDim, move(node));
@@ -114,7 +115,8 @@ CHECK_FN(iszero, iszero)
 template<typename T, af_op_t op>
 Array<char> checkOp(const Array<T> &in, dim4 outDim = dim4(-1, -1, -1, -1)) {
     common::Node_ptr in_node = in.getNode();
-    auto node = std::make_shared<jit::UnaryNode<char, T, op>>(in_node);
+    auto node =
+        common::makePooledShared<jit::UnaryNode<char, T, op>>(in_node);
 
     if (outDim == dim4(-1, -1, -1, -1)) { outDim = in.dims(); }
     return createNodeArray<char>(outDim, move(node));
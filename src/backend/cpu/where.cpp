@@ -10,12 +10,14 @@
 #include <Array.hpp>
 #include <common/Binary.hpp>
 #include <common/Transform.hpp>
+#include <kernel/Array.hpp>
 #include <math.hpp>
 #include <memory.hpp>
 #include <platform.hpp>
 #include <where.hpp>
 #include <af/dim4.hpp>
 
+#include <algorithm>
 #include <complex>
 #include <vector>
 
@@ -24,8 +26,45 @@ using af::dim4;
 namespace arrayfire {
 namespace cpu {
 
+template<typename T>
+Array<uint> whereNode(const Array<T> &in) {
+    const dim4 dims     = in.dims();
+    static const T zero = scalar<T>(0);
+
+    auto out_vec = memAlloc<uint>(in.elements());
+    getQueue().sync();
+
+    // Test the values of the JIT tree as they are evaluated
+    kernel::NodeEvaluator<T> values(in.getNode(), dims);
+
+    dim_t count = 0;
+    uint idx    = 0;
+    for (int w = 0; w < (int)dims[3]; w++) {
+        for (int z = 0; z < (int)dims[2]; z++) {
+            for (int y = 0; y < (int)dims[1]; y++) {
+                for (int x = 0; x < (int)dims[0]; x += jit::VECTOR_LENGTH) {
+                    int lim = std::min(jit::VECTOR_LENGTH, (int)dims[0] - x);
+                    const compute_t<T> *vals = values.calc(x, y, z, w, lim);
+                    for (int i = 0; i < lim; i++, idx++) {
+                        if (static_cast<T>(vals[i]) != zero) {
+                            out_vec[count] = idx;
+                            count++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    Array<uint> out = createDeviceDataArray<uint>(dim4(count), out_vec.get());
+    out_vec.release();
+    return out;
+}
+
 template<typename T>
 Array<uint> where(const Array<T> &in) {
+    if (!in.isReady()) { return whereNode(in); }
+
     const dim_t *dims    = in.dims().get();
     const dim_t *strides = in.strides().get();
     static const T zero  = scalar<T>(0);
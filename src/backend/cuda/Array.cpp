@@ -9,6 +9,7 @@
 
 #include <Array.hpp>
 #include <common/Logger.hpp>
+#include <common/ObjectPool.hpp>
 #include <common/half.hpp>
 #include <common/jit/NodeIterator.hpp>
 #include <copy.hpp>
@@ -423,7 +424,7 @@ Array<T> createParamArray(Param<T> &tmp, bool owner) {
 
 template<typename T>
 void destroyArray(Array<T> *A) {
-    delete A;
+    common::destroyPooled(A);
 }
 
 template<typename T>
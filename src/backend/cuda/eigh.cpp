@@ -0,0 +1,40 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <Array.hpp>
+#include <eigh.hpp>
+#include <err_cuda.hpp>
+
+namespace arrayfire {
+namespace cuda {
+
+template<typename T, typename Tr>
+void eigh(Array<Tr> &values, Array<T> &vectors, const Array<T> &in,
+          const unsigned k, const bool is_upper, const bool want_vectors) {
+    UNUSED(values);
+    UNUSED(vectors);
+    UNUSED(in);
+    UNUSED(k);
+    UNUSED(is_upper);
+    UNUSED(want_vectors);
+    CUDA_NOT_SUPPORTED("eigh is only supported on the CPU backend");
+}
+
+#define INSTANTIATE(T, Tr)                                                   \
+    template void eigh<T, Tr>(Array<Tr> & values, Array<T> & vectors,        \
+                              const Array<T> &in, const unsigned k,          \
+                              const bool is_upper, const bool want_vectors);
+
+INSTANTIATE(float, float)
+INSTANTIATE(double, double)
+INSTANTIATE(cfloat, float)
+INSTANTIATE(cdouble, double)
+
+}  // namespace cuda
+}  // namespace arrayfire
@@ -0,0 +1,18 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <Array.hpp>
+
+namespace arrayfire {
+namespace cuda {
+template<typename T, typename Tr>
+void eigh(Array<Tr> &values, Array<T> &vectors, const Array<T> &in,
+          const unsigned k, const bool is_upper, const bool want_vectors);
+}  // namespace cuda
+}  // namespace arrayfire
@@ -15,5 +15,9 @@ namespace cuda {
 template<typename T>
 Array<T> fftconvolve(Array<T> const& signal, Array<T> const& filter,
                      const bool expand, AF_BATCH_KIND kind, const int rank);
+
+template<typename T>
+Array<T> fftconvolve(Array<T>& zf, Array<T> const& signal,
+                     Array<T> const& filter, Array<T> const& zi);
 }  // namespace cuda
 }  // namespace arrayfire
@@ -14,5 +14,13 @@ namespace cuda {
 
 template<typename T>
 Array<T> iir(const Array<T> &b, const Array<T> &a, const Array<T> &x);
+
+template<typename T>
+Array<T> iir(Array<T> &zf, const Array<T> &b, const Array<T> &a,
+             const Array<T> &x, const Array<T> &zi);
+
+template<typename T>
+Array<T> iirSos(Array<T> &zf, const Array<T> &sos, const Array<T> &x,
+                const Array<T> &zi);
 }  // namespace cuda
 }  // namespace arrayfire
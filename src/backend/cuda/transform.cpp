@@ -9,6 +9,7 @@
 
 #include <transform.hpp>
 
+#include <err_cuda.hpp>
 #include <kernel/transform.hpp>
 #include <utility.hpp>
 
@@ -23,11 +24,24 @@ void transform(Array<T> &out, const Array<T> &in, const Array<float> &tf,
                          interpOrder(method));
 }
 
+template<typename T>
+Array<T> remap(const Array<T> &in, const Array<float> &mapX,
+               const Array<float> &mapY, const af_interp_type method) {
+    UNUSED(in);
+    UNUSED(mapX);
+    UNUSED(mapY);
+    UNUSED(method);
+    CUDA_NOT_SUPPORTED("remap is only supported on the CPU backend");
+}
+
 #define INSTANTIATE(T)                                                       \
     template void transform(Array<T> &out, const Array<T> &in,               \
                             const Array<float> &tf,                          \
                             const af_interp_type method, const bool inverse, \
-                            const bool perspective);
+                            const bool perspective);                         \
+    template Array<T> remap(const Array<T> &in, const Array<float> &mapX,    \
+                            const Array<float> &mapY,                        \
+                            const af_interp_type method);
 
 INSTANTIATE(float)
 INSTANTIATE(double)
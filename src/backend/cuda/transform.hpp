@@ -15,5 +15,9 @@ template<typename T>
 void transform(Array<T> &out, const Array<T> &in, const Array<float> &tf,
                const af_interp_type method, const bool inverse,
                const bool perspective);
+
+template<typename T>
+Array<T> remap(const Array<T> &in, const Array<float> &mapX,
+               const Array<float> &mapY, const af_interp_type method);
 }  // namespace cuda
 }  // namespace arrayfire
@@ -12,6 +12,7 @@
 #include <Param.hpp>
 #include <common/Logger.hpp>
 #include <common/MemoryManagerBase.hpp>
+#include <common/ObjectPool.hpp>
 #include <common/half.hpp>
 #include <common/jit/NodeIterator.hpp>
 #include <common/jit/ScalarNode.hpp>
@@ -493,7 +494,7 @@ Array<T> createParamArray(Param<T> &tmp, bool owner) {
 
 template<typename T>
 void destroyArray(Array<T> *A) {
-    delete A;
+    common::destroyPooled(A);
 }
 
 template<typename T>
@@ -20,15 +20,21 @@ namespace oneapi {
 
 template<typename inType, typename outType>
 Array<outType> bilateral(const Array<inType> &in, const float &sSigma,
-                         const float &cSigma) {
+                         const float &cSigma, const bool isColor,
+                         const af_bilateral_method method) {
+    UNUSED(isColor);
+    if (method != AF_BILATERAL_EXACT) {
+        ONEAPI_NOT_SUPPORTED("Only AF_BILATERAL_EXACT is supported");
+    }
     Array<outType> out = createEmptyArray<outType>(in.dims());
     kernel::bilateral<inType, outType>(out, in, sSigma, cSigma);
     return out;
 }
 
-#define INSTANTIATE(inT, outT)                                    \
-    template Array<outT> bilateral<inT, outT>(const Array<inT> &, \
-                                              const float &, const float &);
+#define INSTANTIATE(inT, outT)                                        \
+    template Array<outT> bilateral<inT, outT>(                        \
+        const Array<inT> &, const float &, const float &, const bool, \
+        const af_bilateral_method);
 
 INSTANTIATE(double, double)
 INSTANTIATE(float, float)
@@ -13,6 +13,7 @@ namespace arrayfire {
 namespace oneapi {
 template<typename inType, typename outType>
 Array<outType> bilateral(const Array<inType> &in, const float &spatialSigma,
-                         const float &chromaticSigma);
+                         const float &chromaticSigma, const bool isColor,
+                         const af_bilateral_method method);
 }  // namespace oneapi
 }  // namespace arrayfire
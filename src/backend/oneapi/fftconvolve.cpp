@@ -140,6 +140,17 @@ Array<T> fftconvolve(Array<T> const& signal, Array<T> const& filter,
     return out;
 }
 
+template<typename T>
+Array<T> fftconvolve(Array<T>& zf, Array<T> const& signal,
+                     Array<T> const& filter, Array<T> const& zi) {
+    UNUSED(zf);
+    UNUSED(signal);
+    UNUSED(filter);
+    UNUSED(zi);
+    ONEAPI_NOT_SUPPORTED(
+        "streaming fftconvolve is only supported on the CPU backend");
+}
+
 #define INSTANTIATE(T)                                                 \
     template Array<T> fftconvolve<T>(Array<T> const&, Array<T> const&, \
                                      const bool, AF_BATCH_KIND, const int);
@@ -155,5 +166,12 @@ INSTANTIATE(intl)
 INSTANTIATE(ushort)
 INSTANTIATE(short)
 
+#define INSTANTIATE_STREAM(T)                                          \
+    template Array<T> fftconvolve<T>(Array<T>&, Array<T> const&,       \
+                                     Array<T> const&, Array<T> const&);
+
+INSTANTIATE_STREAM(float)
+INSTANTIATE_STREAM(double)
+
 }  // namespace oneapi
 }  // namespace arrayfire
@@ -20,7 +20,10 @@ namespace oneapi {
 template<typename T>
 Array<T> meanshift(const Array<T> &in, const float &spatialSigma,
                    const float &chromaticSigma, const unsigned &numIterations,
-                   const bool &isColor) {
+                   const bool &isColor, const af_meanshift_method method) {
+    if (method != AF_MEANSHIFT_EXACT) {
+        ONEAPI_NOT_SUPPORTED("Only AF_MEANSHIFT_EXACT is supported");
+    }
     const dim4 &dims = in.dims();
     Array<T> out     = createEmptyArray<T>(dims);
     kernel::meanshift<T>(out, in, spatialSigma, chromaticSigma, numIterations,
@@ -31,7 +34,7 @@ Array<T> meanshift(const Array<T> &in, const float &spatialSigma,
 #define INSTANTIATE(T)                                              \
     template Array<T> meanshift<T>(const Array<T> &, const float &, \
                                    const float &, const unsigned &, \
-                                   const bool &);
+                                   const bool &, const af_meanshift_method);
 
 INSTANTIATE(float)
 INSTANTIATE(double)
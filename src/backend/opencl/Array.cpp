@@ -10,6 +10,7 @@
 #include <Array.hpp>
 
 #include <common/Logger.hpp>
+#include <common/ObjectPool.hpp>
 #include <common/half.hpp>
 #include <common/jit/NodeIterator.hpp>
 #include <common/jit/ScalarNode.hpp>
@@ -502,7 +503,7 @@ Array<T> createParamArray(Param &tmp, bool owner) {
 
 template<typename T>
 void destroyArray(Array<T> *A) {
-    delete A;
+    common::destroyPooled(A);
 }
 
 template<typename T>
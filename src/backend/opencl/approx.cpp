@@ -9,6 +9,7 @@
 
 #include <approx.hpp>
 
+#include <err_opencl.hpp>
 #include <kernel/approx.hpp>
 
 namespace arrayfire {
@@ -67,6 +68,26 @@ void approx2(Array<Ty> &zo, const Array<Ty> &zi, const Array<Tp> &xo,
     }
 }
 
+template<typename Ty>
+Array<Ty> approx1Prepare(const Array<Ty> &yi, const af_interp_type method) {
+    UNUSED(yi);
+    UNUSED(method);
+    OPENCL_NOT_SUPPORTED("approx1Prepare is only supported on the CPU backend");
+}
+
+template<typename Ty, typename Tp>
+Array<Ty> approx1Prepared(const Array<Ty> &coeffs, const Array<Tp> &xo,
+                          const Tp &xi_beg, const Tp &xi_step,
+                          const float offGrid) {
+    UNUSED(coeffs);
+    UNUSED(xo);
+    UNUSED(xi_beg);
+    UNUSED(xi_step);
+    UNUSED(offGrid);
+    OPENCL_NOT_SUPPORTED(
+        "approx1Prepared is only supported on the CPU backend");
+}
+
 #define INSTANTIATE(Ty, Tp)                                       \
     template void approx1<Ty, Tp>(                                \
         Array<Ty> & yo, const Array<Ty> &yi, const Array<Tp> &xo, \
@@ -83,5 +104,17 @@ INSTANTIATE(double, double)
 INSTANTIATE(cfloat, float)
 INSTANTIATE(cdouble, double)
 
+#define INSTANTIATE_PREPARED(Ty, Tp)                                    \
+    template Array<Ty> approx1Prepare<Ty>(const Array<Ty> &yi,          \
+                                          const af_interp_type method); \
+    template Array<Ty> approx1Prepared<Ty, Tp>(                         \
+        const Array<Ty> &coeffs, const Array<Tp> &xo, const Tp &xi_beg, \
+        const Tp &xi_step, const float offGrid);
+
+INSTANTIATE_PREPARED(float, float)
+INSTANTIATE_PREPARED(double, double)
+INSTANTIATE_PREPARED(cfloat, float)
+INSTANTIATE_PREPARED(cdouble, double)
+
 }  // namespace opencl
 }  // namespace arrayfire
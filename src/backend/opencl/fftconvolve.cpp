@@ -10,6 +10,7 @@
 #include <fftconvolve.hpp>
 
 #include <Array.hpp>
+#include <err_opencl.hpp>
 #include <fft.hpp>
 #include <kernel/fftconvolve.hpp>
 #include <af/dim4.hpp>
@@ -129,6 +130,17 @@ Array<T> fftconvolve(Array<T> const& signal, Array<T> const& filter,
     return out;
 }
 
+template<typename T>
+Array<T> fftconvolve(Array<T>& zf, Array<T> const& signal,
+                     Array<T> const& filter, Array<T> const& zi) {
+    UNUSED(zf);
+    UNUSED(signal);
+    UNUSED(filter);
+    UNUSED(zi);
+    OPENCL_NOT_SUPPORTED(
+        "streaming fftconvolve is only supported on the CPU backend");
+}
+
 #define INSTANTIATE(T)                                                 \
     template Array<T> fftconvolve<T>(Array<T> const&, Array<T> const&, \
                                      const bool, AF_BATCH_KIND, const int);
@@ -144,5 +156,12 @@ INSTANTIATE(intl)
 INSTANTIATE(ushort)
 INSTANTIATE(short)
 
+#define INSTANTIATE_STREAM(T)                                          \
+    template Array<T> fftconvolve<T>(Array<T>&, Array<T> const&,       \
+                                     Array<T> const&, Array<T> const&);
+
+INSTANTIATE_STREAM(float)
+INSTANTIATE_STREAM(double)
+
 }  // namespace opencl
 }  // namespace arrayfire
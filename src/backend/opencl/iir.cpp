@@ -49,9 +49,35 @@ Array<T> iir(const Array<T> &b, const Array<T> &a, const Array<T> &x) {
     return y;
 }
 
-#define INSTANTIATE(T)                                          \
-    template Array<T> iir(const Array<T> &b, const Array<T> &a, \
-                          const Array<T> &x);
+template<typename T>
+Array<T> iir(Array<T> &zf, const Array<T> &b, const Array<T> &a,
+             const Array<T> &x, const Array<T> &zi) {
+    UNUSED(zf);
+    UNUSED(b);
+    UNUSED(a);
+    UNUSED(x);
+    UNUSED(zi);
+    OPENCL_NOT_SUPPORTED("iir states are only supported on the CPU backend");
+}
+
+template<typename T>
+Array<T> iirSos(Array<T> &zf, const Array<T> &sos, const Array<T> &x,
+                const Array<T> &zi) {
+    UNUSED(zf);
+    UNUSED(sos);
+    UNUSED(x);
+    UNUSED(zi);
+    OPENCL_NOT_SUPPORTED("iirSos is only supported on the CPU backend");
+}
+
+#define INSTANTIATE(T)                                                     \
+    template Array<T> iir(const Array<T> &b, const Array<T> &a,            \
+                          const Array<T> &x);                              \
+    template Array<T> iir(Array<T> &zf, const Array<T> &b,                 \
+                          const Array<T> &a, const Array<T> &x,            \
+                          const Array<T> &zi);                             \
+    template Array<T> iirSos(Array<T> &zf, const Array<T> &sos,            \
+                             const Array<T> &x, const Array<T> &zi);
 
 INSTANTIATE(float)
 INSTANTIATE(double)
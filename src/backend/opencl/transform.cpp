@@ -9,6 +9,7 @@
 
 #include <transform.hpp>
 
+#include <err_opencl.hpp>
 #include <kernel/transform.hpp>
 
 namespace arrayfire {
@@ -35,11 +36,24 @@ void transform(Array<T> &out, const Array<T> &in, const Array<float> &tf,
     }
 }
 
+template<typename T>
+Array<T> remap(const Array<T> &in, const Array<float> &mapX,
+               const Array<float> &mapY, const af_interp_type method) {
+    UNUSED(in);
+    UNUSED(mapX);
+    UNUSED(mapY);
+    UNUSED(method);
+    OPENCL_NOT_SUPPORTED("remap is only supported on the CPU backend");
+}
+
 #define INSTANTIATE(T)                                                       \
     template void transform(Array<T> &out, const Array<T> &in,               \
                             const Array<float> &tf,                          \
                             const af_interp_type method, const bool inverse, \
-                            const bool perspective);
+                            const bool perspective);                         \
+    template Array<T> remap(const Array<T> &in, const Array<float> &mapX,    \
+                            const Array<float> &mapY,                        \
+                            const af_interp_type method);
 
 INSTANTIATE(float)
 INSTANTIATE(double)
@@ -187,3 +187,29 @@ TEST(AnisotropicDiffusion, CurvatureInvalidInputArray) {
         array out = anisotropicDiffusion(randu(100), 0.125f, 0.2f, 10);
     } catch (exception &exp) { ASSERT_EQ(AF_ERR_SIZE, exp.err()); }
 }
+
+using af::anisotropicDiffusion;
+using af::dim4;
+using af::mean;
+
+TEST(AnisotropicDiffusion, IterationsCompose) {
+    // The conductance is rescaled from the gradient of the current image
+    // before every iteration, so iterating twice equals filtering twice
+    array clean;
+    array in  = noisyStep(dim4(70, 90, 3), clean, 10.f);
+    array two = anisotropicDiffusion(in, 0.125f, 1.0f, 2);
+    array one = anisotropicDiffusion(in, 0.125f, 1.0f, 1);
+
+    ASSERT_ARRAYS_NEAR(two, anisotropicDiffusion(one, 0.125f, 1.0f, 1),
+                       1e-3);
+}
+
+TEST(AnisotropicDiffusion, GradientReducesNoise) {
+    array clean;
+    array in  = noisyStep(dim4(96, 128, 2), clean, 10.f);
+    array out = anisotropicDiffusion(in, 0.125f, 1.0f, 10);
+
+    ASSERT_EQ(in.dims(), out.dims());
+    EXPECT_LT(mean<float>(abs(out - clean)),
+              0.75f * mean<float>(abs(in - clean)));
+}
@@ -32,6 +32,8 @@
 
 using af::abs;
 using af::approx1;
+using af::approx1Prepare;
+using af::approx1Prepared;
 using af::array;
 using af::cdouble;
 using af::cfloat;
@@ -844,6 +846,72 @@ TEST(Approx1, CPPEmptyPosAndInput) {
     ASSERT_TRUE(interp.isempty());
 }
 
+TEST(Approx1, CPPSharedPosBatch) {
+    array input = randu(1000, 20);
+    array pos   = 1000 * randu(3000) - 2;
+
+    array outBatch = approx1(input, pos, AF_INTERP_CUBIC_SPLINE, -1.0f);
+
+    array outSerial(3000, 20);
+    for (int i = 0; i < input.dims(1); i++) {
+        outSerial(span, i) =
+            approx1(input(span, i), pos, AF_INTERP_CUBIC_SPLINE, -1.0f);
+    }
+
+    ASSERT_ARRAYS_NEAR(outSerial, outBatch, 1e-5);
+}
+
+TEST(Approx1Prepared, MatchesApprox1) {
+    CPU_ONLY_CHECK("Prepared interpolation");
+
+    array input = randu(500, 4, 3);
+    array pos   = 520 * randu(2000) - 10;
+
+    const af_interp_type methods[] = {AF_INTERP_LINEAR, AF_INTERP_CUBIC,
+                                      AF_INTERP_CUBIC_SPLINE};
+    for (af_interp_type method : methods) {
+        array coeffs = approx1Prepare(input, method);
+        ASSERT_EQ(dim4(2000, 4, 3), coeffs.dims());
+
+        array expected = approx1(input, pos, 0, 0.0, 1.0, method, 3.0f);
+        array out      = approx1Prepared(coeffs, pos, 0.0, 1.0, 3.0f);
+        ASSERT_ARRAYS_NEAR(expected, out, 1e-5);
+    }
+}
+
+TEST(Approx1Prepared, PerColumnPosAndUniformGrid) {
+    CPU_ONLY_CHECK("Prepared interpolation");
+
+    array input = randu(100, 6, c64);
+    array pos   = 10 + 0.5 * 110 * randu(300, 6, f64);
+
+    array coeffs   = approx1Prepare(input, AF_INTERP_CUBIC);
+    array expected = approx1(input, pos, 0, 10.0, 0.5, AF_INTERP_CUBIC);
+    array out      = approx1Prepared(coeffs, pos, 10.0, 0.5);
+    ASSERT_ARRAYS_NEAR(expected, out, 1e-10);
+}
+
+TEST(Approx1Prepared, InvalidArgs) {
+    CPU_ONLY_CHECK("Prepared interpolation");
+
+    array input = randu(10, 3);
+    af_array coeffs = 0;
+    ASSERT_EQ(AF_ERR_ARG,
+              af_approx1_prepare(&coeffs, input.get(), AF_INTERP_NEAREST));
+
+    array prepared = approx1Prepare(input, AF_INTERP_LINEAR);
+    array pos      = randu(5, 2);
+    af_array out   = 0;
+    ASSERT_EQ(AF_ERR_SIZE, af_approx1_prepared(&out, prepared.get(),
+                                               pos.get(), 0.0, 1.0, 0.0f));
+    ASSERT_EQ(AF_ERR_SIZE, af_approx1_prepared(&out, input(seq(9)).get(),
+                                               randu(5).get(), 0.0, 1.0,
+                                               0.0f));
+    ASSERT_EQ(AF_ERR_ARG, af_approx1_prepared(&out, prepared.get(),
+                                              randu(5, f64).get(), 0.0, 1.0,
+                                              0.0f));
+}
+
 template<typename T>
 class Approx1V2 : public ::testing::Test {
    protected:
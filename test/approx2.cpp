@@ -761,6 +761,35 @@ TEST(Approx2, CPPEmptyPosAndInput) {
     ASSERT_TRUE(interpolated.isempty());
 }
 
+TEST(Approx2, CPPSharedPosBatch) {
+    array input = randu(200, 100, 10);
+    array pos   = input.dims(0) * randu(100, 100);
+    array qos   = input.dims(1) * randu(100, 100);
+
+    array outBatch = approx2(input, pos, qos, AF_INTERP_BICUBIC_SPLINE);
+
+    array outSerial(100, 100, 10);
+    for (int i = 0; i < input.dims(2); i++) {
+        outSerial(span, span, i) = approx2(input(span, span, i), pos, qos,
+                                           AF_INTERP_BICUBIC_SPLINE);
+    }
+
+    ASSERT_ARRAYS_NEAR(outSerial, outBatch, 1e-5);
+}
+
+TEST(Approx2, CPPLinearCosineOnGridRows) {
+    // With every position on a row of the grid, only the interpolation
+    // along the first dimension remains
+    array input = randu(50, 40);
+    array pos   = 49 * randu(30, 40);
+    array qos   = af::iota(dim4(1, 40), dim4(30, 1));
+
+    array out = approx2(input, pos, qos, AF_INTERP_BILINEAR_COSINE);
+    array expected = af::approx1(input, pos, AF_INTERP_LINEAR_COSINE);
+
+    ASSERT_ARRAYS_NEAR(expected, out, 1e-5);
+}
+
 template<typename T>
 class Approx2V2 : public ::testing::Test {
    protected:
@@ -1400,6 +1400,44 @@ INSTANTIATE(long long);
 INSTANTIATE(unsigned long long);
 #undef INSTANTIATE
 
+af::array noisyStep(const af::dim4 &dims, af::array &clean, const float noise) {
+    af::setSeed(1);
+    af::array x =
+        af::iota(af::dim4(dims[0]), af::dim4(1, dims[1], dims[2], dims[3]));
+    clean = 60.f + 120.f * (x >= dims[0] / 2).as(f32);
+    return clean + noise * af::randn(dims);
+}
+
+af::array bilinearCosine(const af::array &in, const af::array &xs,
+                         const af::array &ys) {
+    const dim_t w = in.dims(0);
+    const dim_t h = in.dims(1);
+    vector<float> img(in.elements());
+    vector<float> hx(xs.elements());
+    vector<float> hy(ys.elements());
+    in.as(f32).host(img.data());
+    xs.as(f32).host(hx.data());
+    ys.as(f32).host(hy.data());
+
+    const auto smooth = [](const float t) {
+        return (1 - std::cos(t * af::Pi)) / 2;
+    };
+    vector<float> out(hx.size(), std::numeric_limits<float>::quiet_NaN());
+    for (size_t i = 0; i < hx.size(); ++i) {
+        const float x = hx[i];
+        const float y = hy[i];
+        if (!(x >= 0 && x < w - 1 && y >= 0 && y < h - 1)) { continue; }
+        const dim_t gx  = static_cast<dim_t>(std::floor(x));
+        const dim_t gy  = static_cast<dim_t>(std::floor(y));
+        const double tx = smooth(x - gx);
+        const double ty = smooth(y - gy);
+        const float *p  = &img[gy * w + gx];
+        out[i] = static_cast<float>((1 - ty) * ((1 - tx) * p[0] + tx * p[1]) +
+                                    ty * ((1 - tx) * p[w] + tx * p[w + 1]));
+    }
+    return af::array(xs.dims(), out.data());
+}
+
 template<typename T>
 struct sparseCooValue {
     int row = 0;
@@ -0,0 +1,80 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#pragma once
+#include <arrayfire.h>
+#include <benchmark/benchmark.h>
+#include <af/traits.hpp>
+
+#include <cstdint>
+
+namespace bench {
+
+template<typename T>
+af::dtype dtypeOf() {
+    return static_cast<af::dtype>(af::dtype_traits<T>::af_type);
+}
+
+/// Uniform random values of type T
+template<typename T>
+af::array random(const af::dim4 &dims) {
+    return af::randu(dims, dtypeOf<T>());
+}
+
+/// Times \p fn. The first call is outside of the timed loop so that one time
+/// setup, like JIT kernel fetches and memory pool growth, is excluded.
+/// Every iteration waits for the device so that queued work is counted.
+template<typename Fn>
+void run(benchmark::State &state, Fn fn) {
+    fn();
+    af::sync();
+    for (auto _ : state) {
+        fn();
+        af::sync();
+    }
+}
+
+/// Reports bytes/s and FLOP/s from the work done in one iteration
+inline void counters(benchmark::State &state, const double bytes,
+                     const double flops = 0.0) {
+    const double iters = static_cast<double>(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(bytes * iters));
+    if (flops > 0.0) {
+        state.counters["FLOP/s"] =
+            benchmark::Counter(flops * iters, benchmark::Counter::kIsRate);
+    }
+}
+
+/// Work runs on the worker threads of the backend, so the wall clock time of
+/// the calling thread is the one that matters
+inline void configure(benchmark::internal::Benchmark *b) {
+    b->UseRealTime()->Unit(benchmark::kMicrosecond);
+}
+
+/// Element counts for one dimensional and element-wise benchmarks
+inline void elements(benchmark::internal::Benchmark *b) {
+    configure(b);
+    b->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+}
+
+/// Side lengths for square matrices and images
+inline void squares(benchmark::internal::Benchmark *b) {
+    configure(b);
+    b->RangeMultiplier(2)->Range(128, 2048);
+}
+
+/// Side lengths of square matrices, with the dimension to work along
+inline void squaresAlongDim(benchmark::internal::Benchmark *b) {
+    configure(b);
+    for (int64_t dim = 0; dim < 2; ++dim) {
+        for (int64_t n = 128; n <= 4096; n *= 4) { b->Args({n, dim}); }
+    }
+}
+
+}  // namespace bench
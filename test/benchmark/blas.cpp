@@ -0,0 +1,102 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include "bench.hpp"
+
+using af::array;
+
+template<typename T>
+static void matmul(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array a = bench::random<T>(af::dim4(n, n));
+    const array b = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] { array c = af::matmul(a, b); });
+    bench::counters(state, 3.0 * n * n * sizeof(T), 2.0 * n * n * n);
+}
+
+template<typename T>
+static void matmulTransposed(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array a = bench::random<T>(af::dim4(n, n));
+    const array b = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] {
+        array c = af::matmul(a, b, AF_MAT_TRANS, AF_MAT_NONE);
+    });
+    bench::counters(state, 3.0 * n * n * sizeof(T), 2.0 * n * n * n);
+}
+
+// Many small products in one call
+template<typename T>
+static void matmulBatched(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array a = bench::random<T>(af::dim4(n, n, 256));
+    const array b = bench::random<T>(af::dim4(n, n, 256));
+    bench::run(state, [&] { array c = af::matmul(a, b); });
+    bench::counters(state, 3.0 * 256 * n * n * sizeof(T),
+                    2.0 * 256 * n * n * n);
+}
+
+template<typename T>
+static void gemv(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array a = bench::random<T>(af::dim4(n, n));
+    const array x = bench::random<T>(n);
+    bench::run(state, [&] { array y = af::matmul(a, x); });
+    bench::counters(state, (1.0 * n * n + 2.0 * n) * sizeof(T),
+                    2.0 * n * n);
+}
+
+template<typename T>
+static void dot(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array a = bench::random<T>(n);
+    const array b = bench::random<T>(n);
+    bench::run(state, [&] { array c = af::dot(a, b); });
+    bench::counters(state, 2.0 * n * sizeof(T), 2.0 * n);
+}
+
+template<typename T>
+static void solve(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array a = bench::random<T>(af::dim4(n, n)) +
+                    af::identity(n, n, bench::dtypeOf<T>()) * n;
+    const array b = bench::random<T>(af::dim4(n, 1));
+    bench::run(state, [&] { array x = af::solve(a, b); });
+    bench::counters(state, 1.0 * n * n * sizeof(T), 2.0 / 3.0 * n * n * n);
+}
+
+template<typename T>
+static void inverse(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array a = bench::random<T>(af::dim4(n, n)) +
+                    af::identity(n, n, bench::dtypeOf<T>()) * n;
+    bench::run(state, [&] { array x = af::inverse(a); });
+    bench::counters(state, 2.0 * n * n * sizeof(T), 2.0 * n * n * n);
+}
+
+static void batchedSizes(benchmark::internal::Benchmark *b) {
+    bench::configure(b);
+    b->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+}
+
+static void solverSizes(benchmark::internal::Benchmark *b) {
+    bench::configure(b);
+    b->RangeMultiplier(2)->Range(64, 1024);
+}
+
+BENCHMARK_TEMPLATE(matmul, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(matmul, double)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(matmul, af::cfloat)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(matmulTransposed, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(matmulBatched, float)->Apply(batchedSizes);
+BENCHMARK_TEMPLATE(gemv, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(dot, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(dot, double)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(solve, float)->Apply(solverSizes);
+BENCHMARK_TEMPLATE(inverse, double)->Apply(solverSizes);
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#######################################################
+# Copyright (c) 2026, ArrayFire
+# All rights reserved.
+#
+# This file is distributed under 3-clause BSD license.
+# The complete license agreement can be obtained at:
+# http://arrayfire.com/licenses/BSD-3-Clause
+########################################################
+
+"""Compares two result files of bench_cpu and flags regressions.
+
+The files are the JSON output of Google Benchmark:
+
+    bench_cpu --benchmark_out=current.json --benchmark_out_format=json
+
+When the benchmarks were run with --benchmark_repetitions, the median of the
+repetitions is compared. Exits with status 1 when any benchmark became slower
+than the threshold allows.
+"""
+
+import argparse
+import json
+import statistics
+import sys
+
+UNITS = {"ns": 1e-9, "us": 1e-6, "ms": 1e-3, "s": 1.0}
+
+
+def load(path, metric):
+    """Returns the time in seconds of every benchmark in the file"""
+    with open(path) as f:
+        results = json.load(f)["benchmarks"]
+
+    medians = {}
+    runs = {}
+    for r in results:
+        if r.get("error_occurred"):
+            continue
+        seconds = r[metric] * UNITS[r.get("time_unit", "ns")]
+        name = r.get("run_name", r["name"])
+        if r.get("run_type") == "aggregate":
+            if r.get("aggregate_name") == "median":
+                medians[name] = seconds
+        else:
+            runs.setdefault(name, []).append(seconds)
+
+    times = {name: statistics.median(t) for name, t in runs.items()}
+    times.update(medians)
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="results of the reference build")
+    parser.add_argument("current", help="results of the build to check")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="relative slow down that counts as a "
+                        "regression (default: 0.10)")
+    parser.add_argument("--metric", default="real_time",
+                        choices=["real_time", "cpu_time"],
+                        help="time to compare (default: real_time)")
+    parser.add_argument("--all", action="store_true",
+                        help="list unchanged benchmarks as well")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    current = load(args.current, args.metric)
+
+    rows = []
+    for name in sorted(set(baseline) & set(current)):
+        before = baseline[name]
+        after = current[name]
+        change = (after - before) / before if before > 0 else 0.0
+        if change > args.threshold:
+            status = "REGRESSION"
+        elif change < -args.threshold:
+            status = "improved"
+        else:
+            status = ""
+        rows.append((change, name, before, after, status))
+    rows.sort(reverse=True)
+
+    width = max([len(r[1]) for r in rows] + [len("Benchmark")])
+    print("{:<{w}} {:>12} {:>12} {:>8}".format(
+        "Benchmark", "Base(us)", "Now(us)", "Change", w=width))
+    for change, name, before, after, status in rows:
+        if status or args.all:
+            line = "{:<{w}} {:>12.3f} {:>12.3f} {:>+7.1%} {}".format(
+                name, before * 1e6, after * 1e6, change, status, w=width)
+            print(line.rstrip())
+
+    missing = sorted(set(baseline) - set(current))
+    added = sorted(set(current) - set(baseline))
+    for name in missing:
+        print("missing from current results: " + name)
+    for name in added:
+        print("not in baseline: " + name)
+
+    regressions = [r for r in rows if r[4] == "REGRESSION"]
+    print("\n{} benchmarks compared, {} regressions above {:.0%}".format(
+        len(rows), len(regressions), args.threshold))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,141 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include "bench.hpp"
+
+using af::array;
+
+// Random n x n image with pixel values in [0, 255]
+template<typename T>
+static array image(const dim_t n) {
+    return (af::randu(n, n) * 255).as(bench::dtypeOf<T>());
+}
+
+template<typename T>
+static void resize(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = image<T>(n);
+    bench::run(state, [&] {
+        array out = af::resize(in, 2 * n, 2 * n, AF_INTERP_BILINEAR);
+    });
+    bench::counters(state, 5.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void rotate(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = image<T>(n);
+    bench::run(state, [&] {
+        array out = af::rotate(in, 0.3f, true, AF_INTERP_BILINEAR);
+    });
+    bench::counters(state, 2.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void transform(benchmark::State &state) {
+    const dim_t n       = state.range(0);
+    const array in      = image<T>(n);
+    const float h_tf[6] = {0.9f, 0.1f, 5.0f, -0.1f, 0.9f, 3.0f};
+    const array tf(3, 2, h_tf);
+    bench::run(state, [&] {
+        array out = af::transform(in, tf, n, n, AF_INTERP_BILINEAR);
+    });
+    bench::counters(state, 2.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void medfilt(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = image<T>(n);
+    bench::run(state, [&] { array out = af::medfilt(in, 5, 5); });
+    bench::counters(state, 2.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void dilate(benchmark::State &state) {
+    const dim_t n    = state.range(0);
+    const array in   = image<T>(n);
+    const array mask = af::constant(1, 5, 5, bench::dtypeOf<T>());
+    bench::run(state, [&] { array out = af::dilate(in, mask); });
+    bench::counters(state, 2.0 * n * n * sizeof(T), 25.0 * n * n);
+}
+
+template<typename T>
+static void histogram(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = image<T>(n);
+    bench::run(state, [&] { array out = af::histogram(in, 256, 0, 255); });
+    bench::counters(state, 1.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void bilateral(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = image<T>(n);
+    bench::run(state, [&] { array out = af::bilateral(in, 2.f, 30.f); });
+    bench::counters(state, 2.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void sobel(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = image<T>(n);
+    bench::run(state, [&] {
+        array dx, dy;
+        af::sobel(dx, dy, in, 3);
+    });
+    bench::counters(state, 3.0 * n * n * sizeof(T), 2.0 * 18.0 * n * n);
+}
+
+template<typename T>
+static void meanShift(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = image<T>(n);
+    bench::run(state, [&] { array out = af::meanShift(in, 3.f, 30.f, 5); });
+    bench::counters(state, 2.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void regions(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = af::randu(n, n) > 0.6;
+    bench::run(state, [&] {
+        array out = af::regions(in, AF_CONNECTIVITY_4, bench::dtypeOf<T>());
+    });
+    bench::counters(state, 1.0 * n * n * (1 + sizeof(T)));
+}
+
+template<typename T>
+static void colorSpace(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = af::randu(n, n, 3, bench::dtypeOf<T>());
+    bench::run(state, [&] { array out = af::rgb2gray(in); });
+    bench::counters(state, 4.0 * n * n * sizeof(T), 5.0 * n * n);
+}
+
+static void imageSizes(benchmark::internal::Benchmark *b) {
+    bench::configure(b);
+    b->RangeMultiplier(2)->Range(256, 2048);
+}
+
+BENCHMARK_TEMPLATE(resize, float)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(resize, unsigned char)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(rotate, float)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(transform, float)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(medfilt, float)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(medfilt, unsigned char)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(dilate, float)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(dilate, unsigned char)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(histogram, float)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(histogram, unsigned char)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(bilateral, float)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(sobel, float)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(meanShift, float)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(regions, unsigned)->Apply(imageSizes);
+BENCHMARK_TEMPLATE(colorSpace, float)->Apply(imageSizes);
@@ -0,0 +1,141 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include "bench.hpp"
+
+using af::array;
+using af::seq;
+using af::span;
+
+// Copies a block of rows (dimension 0) or columns (dimension 1) out of an
+// n x n matrix
+template<typename T>
+static void indexSeq(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const int dim  = static_cast<int>(state.range(1));
+    const array in = bench::random<T>(af::dim4(n, n));
+    const seq half(0, static_cast<double>(n / 2 - 1));
+    bench::run(state, [&] {
+        array out = dim == 0 ? in(half, span).copy() : in(span, half).copy();
+    });
+    bench::counters(state, 1.0 * n * n * sizeof(T));
+}
+
+// Gathers n / 2 random columns, or random rows for dimension 0
+template<typename T>
+static void indexLookup(benchmark::State &state) {
+    const dim_t n   = state.range(0);
+    const int dim   = static_cast<int>(state.range(1));
+    const array in  = bench::random<T>(af::dim4(n, n));
+    const array idx = (af::randu(n / 2) * n).as(u32);
+    bench::run(state, [&] { array out = af::lookup(in, idx, dim); });
+    bench::counters(state, 1.0 * n * n * sizeof(T));
+}
+
+// Writes a block of columns into an n x n matrix
+template<typename T>
+static void assignSeq(benchmark::State &state) {
+    const dim_t n   = state.range(0);
+    array out       = bench::random<T>(af::dim4(n, n));
+    const array val = bench::random<T>(af::dim4(n, n / 2));
+    const seq half(0, static_cast<double>(n / 2 - 1));
+    bench::run(state, [&] { out(span, half) = val; });
+    bench::counters(state, 1.0 * n * n * sizeof(T));
+}
+
+// Scatters values to random rows
+template<typename T>
+static void assignIndexed(benchmark::State &state) {
+    const dim_t n   = state.range(0);
+    array out       = bench::random<T>(af::dim4(n, n));
+    const array idx = (af::randu(n / 2) * n).as(u32);
+    const array val = bench::random<T>(af::dim4(n / 2, n));
+    bench::run(state, [&] { out(idx, span) = val; });
+    bench::counters(state, 1.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void transpose(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] { array out = af::transpose(in); });
+    bench::counters(state, 2.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void transposeInPlace(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    array in      = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] { af::transposeInPlace(in); });
+    bench::counters(state, 2.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void reorder(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(af::dim4(n, n / 16, 16));
+    bench::run(state, [&] { array out = af::reorder(in, 2, 0, 1); });
+    bench::counters(state, 2.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void tile(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(af::dim4(n, n / 4));
+    bench::run(state, [&] {
+        array out = af::tile(in, 1, 4);
+        out.eval();
+    });
+    bench::counters(state, 1.25 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void join(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array a = bench::random<T>(af::dim4(n, n / 2));
+    const array b = bench::random<T>(af::dim4(n, n / 2));
+    bench::run(state, [&] { array out = af::join(1, a, b); });
+    bench::counters(state, 2.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void where(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(n);
+    bench::run(state, [&] { array out = af::where(in > 0.5); });
+    bench::counters(state, 1.0 * n * sizeof(T));
+}
+
+template<typename T>
+static void select(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array a = bench::random<T>(n);
+    const array b = bench::random<T>(n);
+    bench::run(state, [&] {
+        array out = af::select(a > b, a, b);
+        out.eval();
+    });
+    bench::counters(state, 3.0 * n * sizeof(T), 1.0 * n);
+}
+
+BENCHMARK_TEMPLATE(indexSeq, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(indexLookup, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(indexLookup, double)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(assignSeq, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(assignIndexed, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(transpose, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(transpose, double)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(transpose, unsigned char)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(transpose, af::cdouble)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(transposeInPlace, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(reorder, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(tile, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(join, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(where, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(select, float)->Apply(bench::elements);
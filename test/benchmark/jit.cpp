@@ -0,0 +1,124 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include "bench.hpp"
+
+#include <vector>
+
+using af::array;
+
+template<typename T>
+static void jitAdd(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    array a       = bench::random<T>(n);
+    array b       = bench::random<T>(n);
+    bench::run(state, [&] {
+        array c = a + b;
+        c.eval();
+    });
+    bench::counters(state, 3.0 * n * sizeof(T), n);
+}
+
+// Eight element-wise operations fused into one kernel
+template<typename T>
+static void jitFused(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    array a       = bench::random<T>(n);
+    array b       = bench::random<T>(n);
+    array c       = bench::random<T>(n);
+    bench::run(state, [&] {
+        array d = (a * b + c) / (a + 1) - af::sqrt(b) * c + af::abs(a - c);
+        d.eval();
+    });
+    bench::counters(state, 4.0 * n * sizeof(T), 8.0 * n);
+}
+
+// Column vector broadcast against a matrix
+template<typename T>
+static void jitBroadcast(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    array a       = bench::random<T>(af::dim4(n, n));
+    array b       = bench::random<T>(n);
+    bench::run(state, [&] {
+        array c = af::batchFunc(a, b, [](const array &l, const array &r) {
+            return l * r;
+        });
+        c.eval();
+    });
+    bench::counters(state, (2.0 * n * n + n) * sizeof(T), 1.0 * n * n);
+}
+
+// Operations on a strided view of a larger array
+template<typename T>
+static void jitStrided(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    array a       = bench::random<T>(af::dim4(2 * n, n));
+    bench::run(state, [&] {
+        array c = a(af::seq(0, af::end, 2), af::span) * 2 + 1;
+        c.eval();
+    });
+    bench::counters(state, 2.0 * n * n * sizeof(T), 2.0 * n * n);
+}
+
+// Several outputs of different expressions in one evaluation
+template<typename T>
+static void jitMultiple(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    array a       = bench::random<T>(n);
+    array b       = bench::random<T>(n);
+    bench::run(state, [&] {
+        array s = a + b;
+        array d = a - b;
+        array p = a * b;
+        af::eval(s, d, p);
+    });
+    bench::counters(state, 5.0 * n * sizeof(T), 3.0 * n);
+}
+
+template<typename To, typename Ti>
+static void jitCast(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    array a       = bench::random<Ti>(n);
+    bench::run(state, [&] {
+        array c = a.as(bench::dtypeOf<To>());
+        c.eval();
+    });
+    bench::counters(state, 1.0 * n * (sizeof(Ti) + sizeof(To)));
+}
+
+// Many small independent expressions, which is dominated by per call costs
+static void jitSmallArrays(benchmark::State &state) {
+    const dim_t count = state.range(0);
+    std::vector<array> in;
+    for (dim_t i = 0; i < count; ++i) { in.push_back(af::randu(1000)); }
+    bench::run(state, [&] {
+        for (const array &a : in) {
+            array c = a * 2 + 1;
+            c.eval();
+        }
+    });
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(jitAdd, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(jitAdd, double)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(jitAdd, int)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(jitAdd, af::cfloat)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(jitFused, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(jitFused, double)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(jitBroadcast, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(jitStrided, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(jitMultiple, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(jitCast, double, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(jitCast, float, int)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(jitCast, float, unsigned char)->Apply(bench::elements);
+BENCHMARK(jitSmallArrays)
+    ->Apply(bench::configure)
+    ->Arg(100)
+    ->Arg(1000);
@@ -0,0 +1,95 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include "bench.hpp"
+
+using af::array;
+
+// Reductions of an n x n matrix along dimension state.range(1). Dimension 0
+// reads contiguous columns, dimension 1 reads across them.
+#define REDUCE_DIM(NAME, FN)                                          \
+    template<typename T>                                              \
+    static void NAME(benchmark::State &state) {                       \
+        const dim_t n  = state.range(0);                              \
+        const int dim  = static_cast<int>(state.range(1));            \
+        const array in = bench::random<T>(af::dim4(n, n));            \
+        bench::run(state, [&] {                                       \
+            array out = FN(in, dim);                                  \
+            out.eval();                                               \
+        });                                                           \
+        bench::counters(state, 1.0 * n * n * sizeof(T), 1.0 * n * n); \
+    }
+
+REDUCE_DIM(reduceSum, af::sum)
+REDUCE_DIM(reduceMax, af::max)
+REDUCE_DIM(reduceProduct, af::product)
+REDUCE_DIM(reduceAnyTrue, af::anyTrue)
+REDUCE_DIM(reduceCount, af::count)
+
+#undef REDUCE_DIM
+
+template<typename T>
+static void reduceSumAll(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(n);
+    bench::run(state, [&] { benchmark::DoNotOptimize(af::sum<double>(in)); });
+    bench::counters(state, 1.0 * n * sizeof(T), 1.0 * n);
+}
+
+// Reduction of an unevaluated expression
+template<typename T>
+static void reduceSumJit(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array a = bench::random<T>(n);
+    const array b = bench::random<T>(n);
+    bench::run(state, [&] {
+        benchmark::DoNotOptimize(af::sum<double>(a * b + 1));
+    });
+    bench::counters(state, 2.0 * n * sizeof(T), 3.0 * n);
+}
+
+template<typename T>
+static void reduceIndexedMax(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const int dim  = static_cast<int>(state.range(1));
+    const array in = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] {
+        array val, idx;
+        af::max(val, idx, in, dim);
+    });
+    bench::counters(state, 1.0 * n * n * sizeof(T), 1.0 * n * n);
+}
+
+template<typename T>
+static void reduceByKey(benchmark::State &state) {
+    const dim_t n    = state.range(0);
+    const array keys = af::sort(af::randu(n, u32) % 1024);
+    const array vals = bench::random<T>(n);
+    bench::run(state, [&] {
+        array okeys, ovals;
+        af::sumByKey(okeys, ovals, keys, vals);
+    });
+    bench::counters(state, 1.0 * n * (sizeof(unsigned) + sizeof(T)), 1.0 * n);
+}
+
+BENCHMARK_TEMPLATE(reduceSum, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(reduceSum, double)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(reduceSum, int)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(reduceSum, af::cfloat)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(reduceMax, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(reduceMax, unsigned char)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(reduceProduct, double)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(reduceAnyTrue, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(reduceCount, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(reduceSumAll, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(reduceSumAll, double)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(reduceSumAll, int)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(reduceSumJit, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(reduceIndexedMax, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(reduceByKey, float)->Apply(bench::elements);
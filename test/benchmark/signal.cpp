@@ -0,0 +1,141 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include "bench.hpp"
+
+#include <cmath>
+
+using af::array;
+
+// Floating point operations of a complex transform of n points
+static double fftWork(const double n) { return 5.0 * n * std::log2(n); }
+
+// One dimensional convolution of n samples with a filter of state.range(1)
+// taps
+template<typename T>
+static void convolve1(benchmark::State &state) {
+    const dim_t n      = state.range(0);
+    const dim_t taps   = state.range(1);
+    const array signal = bench::random<T>(n);
+    const array filter = bench::random<T>(taps);
+    bench::run(state, [&] { array out = af::convolve1(signal, filter); });
+    bench::counters(state, 2.0 * n * sizeof(T), 2.0 * n * taps);
+}
+
+// Two dimensional convolution of an n x n image with a k x k filter
+template<typename T>
+static void convolve2(benchmark::State &state) {
+    const dim_t n      = state.range(0);
+    const dim_t k      = state.range(1);
+    const array signal = bench::random<T>(af::dim4(n, n));
+    const array filter = bench::random<T>(af::dim4(k, k));
+    bench::run(state, [&] { array out = af::convolve2(signal, filter); });
+    bench::counters(state, 2.0 * n * n * sizeof(T), 2.0 * n * n * k * k);
+}
+
+// Separable convolution with two k tap filters
+template<typename T>
+static void convolve2Separable(benchmark::State &state) {
+    const dim_t n      = state.range(0);
+    const dim_t k      = state.range(1);
+    const array signal = bench::random<T>(af::dim4(n, n));
+    const array col    = bench::random<T>(k);
+    const array row    = bench::random<T>(k);
+    bench::run(state, [&] { array out = af::convolve(col, row, signal); });
+    bench::counters(state, 2.0 * n * n * sizeof(T), 4.0 * n * n * k);
+}
+
+template<typename T>
+static void fftConvolve2(benchmark::State &state) {
+    const dim_t n      = state.range(0);
+    const dim_t k      = state.range(1);
+    const array signal = bench::random<T>(af::dim4(n, n));
+    const array filter = bench::random<T>(af::dim4(k, k));
+    bench::run(state, [&] { array out = af::fftConvolve2(signal, filter); });
+    bench::counters(state, 2.0 * n * n * sizeof(T),
+                    3.0 * fftWork(1.0 * (n + k) * (n + k)));
+}
+
+template<typename T>
+static void fir(benchmark::State &state) {
+    const dim_t n      = state.range(0);
+    const array signal = bench::random<T>(n);
+    const array taps   = bench::random<T>(32);
+    bench::run(state, [&] { array out = af::fir(taps, signal); });
+    bench::counters(state, 2.0 * n * sizeof(T), 64.0 * n);
+}
+
+template<typename T>
+static void fft1(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(n);
+    bench::run(state, [&] { array out = af::fft(in); });
+    bench::counters(state, 2.0 * n * sizeof(T), fftWork(n));
+}
+
+template<typename T>
+static void fft2(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] { array out = af::fft2(in); });
+    bench::counters(state, 2.0 * n * n * sizeof(T), fftWork(1.0 * n * n));
+}
+
+template<typename T>
+static void fftR2C(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] { array out = af::fftR2C<2>(in); });
+    bench::counters(state, 2.0 * n * n * sizeof(T),
+                    fftWork(1.0 * n * n) / 2);
+}
+
+template<typename T>
+static void approx1(benchmark::State &state) {
+    const dim_t n   = state.range(0);
+    const array in  = bench::random<T>(n);
+    const array pos = bench::random<T>(n) * static_cast<double>(n - 1);
+    bench::run(state, [&] {
+        array out = af::approx1(in, pos, AF_INTERP_LINEAR);
+    });
+    bench::counters(state, 3.0 * n * sizeof(T), 3.0 * n);
+}
+
+static void convolveArgs(benchmark::internal::Benchmark *b) {
+    bench::configure(b);
+    for (int64_t n = 256; n <= 2048; n *= 2) {
+        for (int64_t k : {3, 9, 17}) { b->Args({n, k}); }
+    }
+}
+
+static void fftConvolveArgs(benchmark::internal::Benchmark *b) {
+    bench::configure(b);
+    for (int64_t n = 256; n <= 2048; n *= 2) {
+        for (int64_t k : {17, 65}) { b->Args({n, k}); }
+    }
+}
+
+static void convolve1Args(benchmark::internal::Benchmark *b) {
+    bench::configure(b);
+    for (int64_t n = 1 << 12; n <= 1 << 22; n *= 32) {
+        for (int64_t taps : {5, 33, 257}) { b->Args({n, taps}); }
+    }
+}
+
+BENCHMARK_TEMPLATE(convolve1, float)->Apply(convolve1Args);
+BENCHMARK_TEMPLATE(convolve2, float)->Apply(convolveArgs);
+BENCHMARK_TEMPLATE(convolve2, double)->Apply(convolveArgs);
+BENCHMARK_TEMPLATE(convolve2Separable, float)->Apply(convolveArgs);
+BENCHMARK_TEMPLATE(fftConvolve2, float)->Apply(fftConvolveArgs);
+BENCHMARK_TEMPLATE(fir, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(fft1, af::cfloat)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(fft1, af::cdouble)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(fft2, af::cfloat)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(fftR2C, float)->Apply(bench::squares);
+BENCHMARK_TEMPLATE(approx1, float)->Apply(bench::elements);
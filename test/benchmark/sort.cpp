@@ -0,0 +1,123 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include "bench.hpp"
+
+#include <cmath>
+
+using af::array;
+
+// Comparisons of a comparison sort of n values
+static double sortWork(const dim_t n) {
+    return static_cast<double>(n) * std::log2(static_cast<double>(n));
+}
+
+template<typename T>
+static void sortValues(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(n);
+    bench::run(state, [&] { array out = af::sort(in); });
+    bench::counters(state, 2.0 * n * sizeof(T), sortWork(n));
+}
+
+// Sorts every column of an n x n matrix, or every row for dimension 1
+template<typename T>
+static void sortColumns(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const int dim  = static_cast<int>(state.range(1));
+    const array in = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] { array out = af::sort(in, dim); });
+    bench::counters(state, 2.0 * n * n * sizeof(T), n * sortWork(n));
+}
+
+template<typename T>
+static void sortIndex(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(n);
+    bench::run(state, [&] {
+        array out, idx;
+        af::sort(out, idx, in);
+    });
+    bench::counters(state, 2.0 * n * (sizeof(T) + sizeof(unsigned)),
+                    sortWork(n));
+}
+
+template<typename K, typename V>
+static void sortByKey(benchmark::State &state) {
+    const dim_t n    = state.range(0);
+    const array keys = bench::random<K>(n);
+    const array vals = bench::random<V>(n);
+    bench::run(state, [&] {
+        array okeys, ovals;
+        af::sort(okeys, ovals, keys, vals);
+    });
+    bench::counters(state, 2.0 * n * (sizeof(K) + sizeof(V)), sortWork(n));
+}
+
+template<typename T>
+static void setUnique(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = (bench::random<float>(n) * 1000).as(bench::dtypeOf<T>());
+    bench::run(state, [&] { array out = af::setUnique(in); });
+    bench::counters(state, 1.0 * n * sizeof(T), sortWork(n));
+}
+
+template<typename T>
+static void scanSum(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const int dim  = static_cast<int>(state.range(1));
+    const array in = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] { array out = af::accum(in, dim); });
+    bench::counters(state, 2.0 * n * n * sizeof(T), 1.0 * n * n);
+}
+
+template<typename T>
+static void scanMaxExclusive(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(n);
+    bench::run(state, [&] {
+        array out = af::scan(in, 0, AF_BINARY_MAX, false);
+    });
+    bench::counters(state, 2.0 * n * sizeof(T), 1.0 * n);
+}
+
+template<typename T>
+static void scanByKey(benchmark::State &state) {
+    const dim_t n    = state.range(0);
+    const array keys = af::sort(af::randu(n, s32) % 1024);
+    const array in   = bench::random<T>(n);
+    bench::run(state, [&] { array out = af::scanByKey(keys, in); });
+    bench::counters(state, 1.0 * n * (2 * sizeof(T) + sizeof(int)), 1.0 * n);
+}
+
+template<typename T>
+static void topk(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array in = bench::random<T>(n);
+    bench::run(state, [&] {
+        array vals, idx;
+        af::topk(vals, idx, in, 16);
+    });
+    bench::counters(state, 1.0 * n * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(sortValues, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(sortValues, double)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(sortValues, int)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(sortValues, unsigned char)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(sortColumns, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(sortIndex, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(sortByKey, float, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(sortByKey, int, double)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(setUnique, int)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(scanSum, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(scanSum, int)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(scanMaxExclusive, double)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(scanByKey, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(topk, float)->Apply(bench::elements);
@@ -0,0 +1,95 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include "bench.hpp"
+
+using af::array;
+
+// n x n matrix with about 1% of its values set
+template<typename T>
+static array sparseMatrix(const dim_t n, const af::storage stype) {
+    const array dense = bench::random<T>(af::dim4(n, n)) *
+                        (af::randu(n, n) < 0.01).as(bench::dtypeOf<T>());
+    return af::sparse(dense, stype);
+}
+
+static double nonZeros(const array &sp) {
+    return static_cast<double>(af::sparseGetNNZ(sp));
+}
+
+template<typename T>
+static void sparseMatVec(benchmark::State &state) {
+    const dim_t n    = state.range(0);
+    const array sp   = sparseMatrix<T>(n, AF_STORAGE_CSR);
+    const array x    = bench::random<T>(n);
+    const double nnz = nonZeros(sp);
+    bench::run(state, [&] { array y = af::matmul(sp, x); });
+    bench::counters(state, nnz * (sizeof(T) + sizeof(int)), 2.0 * nnz);
+}
+
+template<typename T>
+static void sparseMatMat(benchmark::State &state) {
+    const dim_t n    = state.range(0);
+    const array sp   = sparseMatrix<T>(n, AF_STORAGE_CSR);
+    const array b    = bench::random<T>(af::dim4(n, 64));
+    const double nnz = nonZeros(sp);
+    bench::run(state, [&] { array y = af::matmul(sp, b); });
+    bench::counters(state, nnz * (sizeof(T) + sizeof(int)), 2.0 * 64 * nnz);
+}
+
+template<typename T>
+static void sparseFromDense(benchmark::State &state) {
+    const dim_t n     = state.range(0);
+    const array dense = bench::random<T>(af::dim4(n, n)) *
+                        (af::randu(n, n) < 0.01).as(bench::dtypeOf<T>());
+    bench::run(state, [&] { array sp = af::sparse(dense, AF_STORAGE_CSR); });
+    bench::counters(state, 1.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void sparseToDense(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const array sp = sparseMatrix<T>(n, AF_STORAGE_CSR);
+    bench::run(state, [&] { array dense = af::dense(sp); });
+    bench::counters(state, 1.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void sparseConvert(benchmark::State &state) {
+    const dim_t n    = state.range(0);
+    const array sp   = sparseMatrix<T>(n, AF_STORAGE_COO);
+    const double nnz = nonZeros(sp);
+    bench::run(state, [&] {
+        array out = af::sparseConvertTo(sp, AF_STORAGE_CSR);
+    });
+    bench::counters(state, 2.0 * nnz * (sizeof(T) + 2 * sizeof(int)));
+}
+
+template<typename T>
+static void sparseAdd(benchmark::State &state) {
+    const dim_t n    = state.range(0);
+    const array a    = sparseMatrix<T>(n, AF_STORAGE_CSR);
+    const array b    = sparseMatrix<T>(n, AF_STORAGE_CSR);
+    const double nnz = nonZeros(a) + nonZeros(b);
+    bench::run(state, [&] { array c = a + b; });
+    bench::counters(state, 2.0 * nnz * (sizeof(T) + sizeof(int)), nnz);
+}
+
+static void sparseSizes(benchmark::internal::Benchmark *b) {
+    bench::configure(b);
+    b->RangeMultiplier(4)->Range(256, 4096);
+}
+
+BENCHMARK_TEMPLATE(sparseMatVec, float)->Apply(sparseSizes);
+BENCHMARK_TEMPLATE(sparseMatVec, double)->Apply(sparseSizes);
+BENCHMARK_TEMPLATE(sparseMatMat, float)->Apply(sparseSizes);
+BENCHMARK_TEMPLATE(sparseFromDense, float)->Apply(sparseSizes);
+BENCHMARK_TEMPLATE(sparseToDense, float)->Apply(sparseSizes);
+BENCHMARK_TEMPLATE(sparseConvert, float)->Apply(sparseSizes);
+BENCHMARK_TEMPLATE(sparseAdd, float)->Apply(sparseSizes);
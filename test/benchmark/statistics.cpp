@@ -0,0 +1,75 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include "bench.hpp"
+
+using af::array;
+
+template<typename T>
+static void randomUniform(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    bench::run(state, [&] { array out = af::randu(n, bench::dtypeOf<T>()); });
+    bench::counters(state, 1.0 * n * sizeof(T));
+}
+
+template<typename T>
+static void randomNormal(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    bench::run(state, [&] { array out = af::randn(n, bench::dtypeOf<T>()); });
+    bench::counters(state, 1.0 * n * sizeof(T));
+}
+
+template<typename T>
+static void mean(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const int dim  = static_cast<int>(state.range(1));
+    const array in = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] { array out = af::mean(in, dim); });
+    bench::counters(state, 1.0 * n * n * sizeof(T), 1.0 * n * n);
+}
+
+template<typename T>
+static void variance(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const int dim  = static_cast<int>(state.range(1));
+    const array in = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] {
+        array out = af::var(in, AF_VARIANCE_SAMPLE, dim);
+    });
+    bench::counters(state, 1.0 * n * n * sizeof(T), 3.0 * n * n);
+}
+
+template<typename T>
+static void median(benchmark::State &state) {
+    const dim_t n  = state.range(0);
+    const int dim  = static_cast<int>(state.range(1));
+    const array in = bench::random<T>(af::dim4(n, n));
+    bench::run(state, [&] { array out = af::median(in, dim); });
+    bench::counters(state, 1.0 * n * n * sizeof(T));
+}
+
+template<typename T>
+static void covariance(benchmark::State &state) {
+    const dim_t n = state.range(0);
+    const array x = bench::random<T>(n);
+    const array y = bench::random<T>(n);
+    bench::run(state, [&] {
+        array out = af::cov(x, y, AF_VARIANCE_SAMPLE);
+    });
+    bench::counters(state, 2.0 * n * sizeof(T), 4.0 * n);
+}
+
+BENCHMARK_TEMPLATE(randomUniform, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(randomUniform, double)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(randomNormal, float)->Apply(bench::elements);
+BENCHMARK_TEMPLATE(mean, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(mean, int)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(variance, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(median, float)->Apply(bench::squaresAlongDim);
+BENCHMARK_TEMPLATE(covariance, float)->Apply(bench::elements);
@@ -193,3 +193,84 @@ TEST(bilateral, GFOR) {
         ASSERT_EQ(max<double>(abs(c_ii - b_ii)) < 1E-5, true);
     }
 }
+
+using af::bilateralMethod;
+using af::mean;
+
+class BilateralApprox : public ::testing::TestWithParam<bilateralMethod> {
+   protected:
+    void SetUp() override {
+        CPU_ONLY_CHECK("Approximate bilateral filtering");
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(Methods, BilateralApprox,
+                         ::testing::Values(AF_BILATERAL_GRID,
+                                           AF_BILATERAL_PERMUTOHEDRAL));
+
+TEST_P(BilateralApprox, MatchesExactGrayscale) {
+    array clean;
+    array in     = noisyStep(dim4(160, 120), clean, 10.f);
+    array exact  = bilateral(in, 3.f, 20.f, false, AF_BILATERAL_EXACT);
+    array approx = bilateral(in, 3.f, 20.f, false, GetParam());
+
+    ASSERT_EQ(f32, approx.type());
+    ASSERT_EQ(in.dims(), approx.dims());
+    EXPECT_LT(mean<float>(abs(exact - approx)), 1.5f);
+    EXPECT_LT(mean<float>(abs(approx - clean)),
+              0.5f * mean<float>(abs(in - clean)));
+}
+
+TEST_P(BilateralApprox, ColorAndBatch) {
+    array clean;
+    array in     = noisyStep(dim4(64, 48, 3, 2), clean, 10.f);
+    array approx = bilateral(in, 3.f, 20.f, true, GetParam());
+
+    ASSERT_EQ(in.dims(), approx.dims());
+    EXPECT_LT(mean<float>(abs(approx - clean)),
+              0.5f * mean<float>(abs(in - clean)));
+}
+
+TEST_P(BilateralApprox, LargeSigma) {
+    array clean;
+    array in     = noisyStep(dim4(256, 256), clean, 10.f);
+    array approx = bilateral(in, 30.f, 20.f, false, GetParam());
+
+    EXPECT_LT(mean<float>(abs(approx - clean)),
+              0.25f * mean<float>(abs(in - clean)));
+}
+
+TEST_P(BilateralApprox, Integer) {
+    array clean;
+    array in     = noisyStep(dim4(64, 64), clean, 10.f);
+    array approx = bilateral(in.as(u8), 3.f, 20.f, false, GetParam());
+
+    ASSERT_EQ(f32, approx.type());
+    EXPECT_LT(mean<float>(abs(approx - clean)),
+              0.5f * mean<float>(abs(in - clean)));
+}
+
+// A grid at a small spatial sigma would have about a cell per pixel of a
+// large image, so the exact filter is used instead
+TEST(BilateralGrid, SmallSpatialSigmaOnLargeImage) {
+    CPU_ONLY_CHECK("Approximate bilateral filtering");
+    array clean;
+    array in = noisyStep(dim4(4096, 4096), clean, 10.f);
+
+    const float sigmas[] = {1.f, 3.f};
+    for (const float sigma : sigmas) {
+        ASSERT_ARRAYS_EQ(bilateral(in, sigma, 20.f, false, AF_BILATERAL_EXACT),
+                         bilateral(in, sigma, 20.f, false, AF_BILATERAL_GRID));
+    }
+}
+
+TEST(Bilateral, InvalidMethod) {
+    af_array in  = 0;
+    af_array out = 0;
+    dim_t dims[] = {10, 10};
+    ASSERT_SUCCESS(af_randu(&in, 2, dims, f32));
+    ASSERT_EQ(AF_ERR_ARG,
+              af_bilateral_v2(&out, in, 2.f, 20.f, false,
+                              static_cast<af_bilateral_method>(42)));
+    ASSERT_SUCCESS(af_release_array(in));
+}
@@ -26,6 +26,7 @@ using af::dtype_traits;
 using af::identity;
 using af::matmul;
 using af::max;
+using af::span;
 using std::abs;
 using std::endl;
 using std::string;
@@ -134,3 +135,54 @@ TYPED_TEST(Cholesky, LowerMultipleOfTwo) {
 TYPED_TEST(Cholesky, LowerMultipleOfTwoLarge) {
     choleskyTester<TypeParam>(1024, eps<TypeParam>(), false);
 }
+
+template<typename T>
+void choleskyBatchTester(const int n, const int batch, double eps,
+                         bool is_upper) {
+    SUPPORTED_TYPE_CHECK(T);
+    LAPACK_ENABLED_CHECK();
+    CPU_ONLY_CHECK("Batched Cholesky");
+
+    dtype ty = (dtype)dtype_traits<T>::af_type;
+
+    array a  = cpu_randu<T>(dim4(n, n, batch));
+    array b  = 10 * n * identity(dim4(n, n, batch), ty);
+    array in = matmul(a.H(), a) + b;
+
+    array out;
+    ASSERT_EQ(0, cholesky(out, in, is_upper));
+
+    array re = is_upper ? matmul(out.H(), out) : matmul(out, out.H());
+    ASSERT_ARRAYS_NEAR(in, re, eps);
+
+    for (int i = 0; i < batch; ++i) {
+        array slice;
+        cholesky(slice, in(span, span, i), is_upper);
+        ASSERT_ARRAYS_NEAR(slice, out(span, span, i), eps);
+    }
+}
+
+TYPED_TEST(Cholesky, UpperBatch) {
+    choleskyBatchTester<TypeParam>(6, 20, eps<TypeParam>(), true);
+}
+
+TYPED_TEST(Cholesky, LowerBatch) {
+    choleskyBatchTester<TypeParam>(6, 20, eps<TypeParam>(), false);
+}
+
+TYPED_TEST(Cholesky, LowerLargeBatch) {
+    choleskyBatchTester<TypeParam>(100, 3, eps<TypeParam>(), false);
+}
+
+TEST(Cholesky, BatchNotPositiveDefinite) {
+    LAPACK_ENABLED_CHECK();
+    CPU_ONLY_CHECK("Batched Cholesky");
+
+    // The first failure in batch order is reported
+    array in    = identity(dim4(3, 3, 4));
+    in(1, 1, 3) = -1;
+    in(2, 2, 1) = -1;
+
+    array out;
+    ASSERT_EQ(3, cholesky(out, in));
+}
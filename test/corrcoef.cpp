@@ -90,3 +90,27 @@ TYPED_TEST(CorrelationCoefficient, All) {
     ASSERT_NEAR(::real(currGoldBar[0]), ::real(c), 1.0e-3);
     ASSERT_NEAR(::imag(currGoldBar[0]), ::imag(c), 1.0e-3);
 }
+
+TEST(CorrelationCoefficient, Matrix) {
+    array x = af::randu(60, 5);
+    x.col(1) += 2 * x.col(0);
+
+    array c = af::corrcoefMatrix(x);
+    ASSERT_EQ(dim4(5, 5), c.dims());
+    for (int j = 0; j < 5; ++j) {
+        for (int k = 0; k < 5; ++k) {
+            const float gold = corrcoef<float>(x.col(j), x.col(k));
+            ASSERT_NEAR(gold, c(j, k).scalar<float>(), 1e-5);
+        }
+    }
+}
+
+TEST(CorrelationCoefficient, LargeOffset) {
+    // The values only differ far below the precision of their sum of squares
+    array t = af::randu(1000);
+    array x = 1.0e4f + t;
+    array y = 1.0e4f - 3.0f * t + 0.01f * af::randu(1000);
+
+    const double gold = corrcoef<double>(x.as(f64), y.as(f64));
+    ASSERT_NEAR(gold, corrcoef<float>(x, y), 1e-3);
+}
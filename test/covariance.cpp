@@ -140,3 +140,69 @@ TEST(Covariance, c64) {
     array b = constant(cdouble(2.0, -1.0), 10, c64);
     ASSERT_THROW(cov(a, b, AF_VARIANCE_POPULATION), exception);
 }
+
+template<typename T>
+void covMatrixTest(const af_var_bias bias) {
+    typedef typename covOutType<T>::type outType;
+    SUPPORTED_TYPE_CHECK(T);
+    SUPPORTED_TYPE_CHECK(outType);
+
+    const dim_t rows = 50;
+    const dim_t cols = 6;
+    const af_dtype ty = (af_dtype)af::dtype_traits<T>::af_type;
+    array x           = (af::randu(rows, cols) * 100).as(ty);
+
+    array c = af::covMatrix(x, bias);
+    ASSERT_EQ(dim4(cols, cols), c.dims());
+    ASSERT_EQ((af_dtype)af::dtype_traits<outType>::af_type, c.type());
+
+    vector<T> h_x(rows * cols);
+    x.host(&h_x.front());
+
+    vector<double> means(cols, 0.0);
+    for (dim_t j = 0; j < cols; ++j) {
+        for (dim_t i = 0; i < rows; ++i) { means[j] += h_x[j * rows + i]; }
+        means[j] /= rows;
+    }
+
+    const double norm = (bias == AF_VARIANCE_SAMPLE ? rows - 1 : rows);
+    vector<outType> gold(cols * cols);
+    for (dim_t j = 0; j < cols; ++j) {
+        for (dim_t k = 0; k < cols; ++k) {
+            double sum = 0.0;
+            for (dim_t i = 0; i < rows; ++i) {
+                sum += (h_x[j * rows + i] - means[j]) *
+                       (h_x[k * rows + i] - means[k]);
+            }
+            gold[j + k * cols] = static_cast<outType>(sum / norm);
+        }
+    }
+
+    ASSERT_VEC_ARRAY_NEAR(gold, dim4(cols, cols), c, 1.0e-2);
+}
+
+TYPED_TEST(Covariance, MatrixOfColumns) {
+    covMatrixTest<TypeParam>(AF_VARIANCE_POPULATION);
+    covMatrixTest<TypeParam>(AF_VARIANCE_SAMPLE);
+}
+
+TEST(Covariance, MatrixMatchesPairwise) {
+    array x = af::randu(40, 5);
+    array c = af::covMatrix(x, AF_VARIANCE_SAMPLE);
+    for (int j = 0; j < 5; ++j) {
+        for (int k = 0; k < 5; ++k) {
+            array pair = cov(x.col(j), x.col(k), AF_VARIANCE_SAMPLE);
+            ASSERT_NEAR(pair.scalar<float>(), c(j, k).scalar<float>(), 1e-5);
+        }
+    }
+}
+
+TEST(Covariance, MatrixInvalidDims) {
+    array x = af::randu(10, 4, 2);
+    ASSERT_THROW(af::covMatrix(x), exception);
+}
+
+TEST(Covariance, MatrixComplex) {
+    array x = af::randu(10, 4, c32);
+    ASSERT_THROW(af::covMatrix(x), exception);
+}
@@ -0,0 +1,163 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <arrayfire.h>
+#include <gtest/gtest.h>
+#include <testHelpers.hpp>
+#include <af/backend.h>
+#include <af/defines.h>
+#include <af/dim4.hpp>
+#include <af/traits.hpp>
+#include <complex>
+
+using af::array;
+using af::cdouble;
+using af::cfloat;
+using af::dim4;
+using af::dtype;
+using af::dtype_traits;
+using af::seq;
+using af::span;
+
+template<typename T>
+class Eigh : public ::testing::Test {};
+
+typedef ::testing::Types<float, cfloat, double, cdouble> TestTypes;
+TYPED_TEST_SUITE(Eigh, TestTypes);
+
+template<typename T>
+double eps();
+
+template<>
+double eps<float>() {
+    return 1e-3;
+}
+
+template<>
+double eps<double>() {
+    return 1e-10;
+}
+
+template<>
+double eps<cfloat>() {
+    return 1e-3;
+}
+
+template<>
+double eps<cdouble>() {
+    return 1e-10;
+}
+
+template<typename T>
+array hermitian(const dim4 dims) {
+    array a = cpu_randu<T>(dims);
+    return (a + a.H()) / 2;
+}
+
+template<typename T>
+void eighTester(const int n, const unsigned k, const int batch,
+                const bool is_upper) {
+    SUPPORTED_TYPE_CHECK(T);
+    LAPACK_ENABLED_CHECK();
+    CPU_ONLY_CHECK("eigh");
+
+    dtype ty     = (dtype)dtype_traits<T>::af_type;
+    const int nk = (k == 0) ? n : static_cast<int>(k);
+
+    array in = hermitian<T>(dim4(n, n, batch));
+    // Only the selected triangle may be read
+    array tri = is_upper ? upper(in) : lower(in);
+
+    array values, vectors;
+    eigh(values, vectors, tri, k, is_upper);
+
+    ASSERT_EQ(dim4(nk, 1, batch), values.dims());
+    ASSERT_EQ(dim4(n, nk, batch), vectors.dims());
+    using BT = typename dtype_traits<T>::base_type;
+    ASSERT_EQ((af_dtype)dtype_traits<BT>::af_type, (af_dtype)values.type());
+
+    for (int i = 0; i < batch; ++i) {
+        array a = in(span, span, i);
+        array v = vectors(span, span, i);
+        array w = values(span, 0, i);
+
+        // A V = V diag(w) with orthonormal V
+        array lhs = matmul(a, v);
+        array rhs = matmul(v, diag(w, 0, false).as(ty));
+        ASSERT_ARRAYS_NEAR(lhs, rhs, eps<T>());
+        ASSERT_ARRAYS_NEAR(af::identity(nk, nk, ty), matmul(v.H(), v),
+                           eps<T>());
+
+        // A subset holds the largest eigenvalues of the full set
+        array all, allVectors;
+        eigh(all, allVectors, a);
+        array top = all(seq(n - nk, n - 1));
+        ASSERT_ARRAYS_NEAR(top, w, eps<T>());
+    }
+}
+
+TYPED_TEST(Eigh, Upper) { eighTester<TypeParam>(40, 0, 1, true); }
+
+TYPED_TEST(Eigh, Lower) { eighTester<TypeParam>(40, 0, 1, false); }
+
+TYPED_TEST(Eigh, TopK) { eighTester<TypeParam>(40, 5, 1, true); }
+
+TYPED_TEST(Eigh, TopKLower) { eighTester<TypeParam>(40, 5, 1, false); }
+
+TYPED_TEST(Eigh, Batch) { eighTester<TypeParam>(8, 0, 10, true); }
+
+TYPED_TEST(Eigh, TopKBatch) { eighTester<TypeParam>(8, 3, 10, false); }
+
+TEST(Eigh, Snippet) {
+    LAPACK_ENABLED_CHECK();
+    CPU_ONLY_CHECK("eigh");
+
+    array a  = af::randu(10, 10);
+    array in = a + a.T();
+
+    //! [ex_eigh]
+    array values, vectors;
+    af::eigh(values, vectors, in);
+
+    array re = matmul(vectors, diag(values, 0, false), vectors.T());
+    //! [ex_eigh]
+
+    ASSERT_ARRAYS_NEAR(in, re, 1e-3);
+}
+
+TEST(Eigh, ValuesOnly) {
+    LAPACK_ENABLED_CHECK();
+    CPU_ONLY_CHECK("eigh");
+
+    array in = hermitian<double>(dim4(12, 12, 3));
+
+    af_array values = 0;
+    ASSERT_SUCCESS(af_eigh(&values, NULL, in.get(), 4, true));
+    array w(values);
+
+    array all, vectors;
+    eigh(all, vectors, in, 4);
+    ASSERT_ARRAYS_NEAR(all, w, 1e-10);
+}
+
+TEST(Eigh, NonSquare) {
+    LAPACK_ENABLED_CHECK();
+
+    array in = af::randu(4, 5);
+    array values, vectors;
+    EXPECT_THROW(eigh(values, vectors, in), af::exception);
+}
+
+TEST(Eigh, InvalidK) {
+    LAPACK_ENABLED_CHECK();
+
+    array in = af::randu(4, 4);
+    array values, vectors;
+    EXPECT_THROW(eigh(values, vectors, in, 5), af::exception);
+}
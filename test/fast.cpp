@@ -13,6 +13,7 @@
 #include <af/compatible.h>
 #include <af/dim4.hpp>
 #include <af/traits.hpp>
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <typeinfo>
@@ -236,3 +237,134 @@ TEST(FloatFAST, CPP) {
     delete[] outOrientation;
     delete[] outSize;
 }
+
+static af::array fastTestImage() {
+    // Bright squares on a dark background give four corners each
+    af::array img = af::constant(0.f, 96, 128);
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 5; ++c) {
+            const int y0 = 8 + r * 22, x0 = 8 + c * 24;
+            img(af::seq(y0, y0 + 9), af::seq(x0, x0 + 11)) = 200.f + r * 5 + c;
+        }
+    }
+    return img;
+}
+
+TEST(FAST, GridCapDisabledMatchesFast) {
+    af::array img = fastTestImage();
+
+    af::features ref  = af::fast(img, 20.f, 9, true, 0.05f, 3);
+    af::features grid = af::fast(img, 20.f, 9, true, 0.05f, 3, 4, 4, 0);
+
+    ASSERT_GT(ref.getNumFeatures(), 0u);
+    ASSERT_EQ(ref.getNumFeatures(), grid.getNumFeatures());
+    ASSERT_ARRAYS_EQ(ref.getX(), grid.getX());
+    ASSERT_ARRAYS_EQ(ref.getY(), grid.getY());
+    ASSERT_ARRAYS_EQ(ref.getScore(), grid.getScore());
+}
+
+TEST(FAST, GridCapKeepsStrongestPerCell) {
+    af::array img = fastTestImage();
+
+    const unsigned rows = 2, cols = 3, cap = 5;
+    af::features all  = af::fast(img, 20.f, 9, true, 0.05f, 3);
+    af::features kept = af::fast(img, 20.f, 9, true, 0.05f, 3, rows, cols, cap);
+
+    const unsigned n = all.getNumFeatures();
+    vector<float> x(n), y(n), score(n);
+    all.getX().host(x.data());
+    all.getY().host(y.data());
+    all.getScore().host(score.data());
+
+    const unsigned m = kept.getNumFeatures();
+    vector<float> kx(m), ky(m), kscore(m);
+    kept.getX().host(kx.data());
+    kept.getY().host(ky.data());
+    kept.getScore().host(kscore.data());
+
+    auto cellOf = [&](float fx, float fy) {
+        unsigned r = std::min(unsigned(fy / (96.f / rows)), rows - 1);
+        unsigned c = std::min(unsigned(fx / (128.f / cols)), cols - 1);
+        return c * rows + r;
+    };
+
+    // Expected: the cap highest scores of every cell, in detection order
+    vector<vector<unsigned>> cells(rows * cols);
+    for (unsigned i = 0; i < n; ++i) cells[cellOf(x[i], y[i])].push_back(i);
+
+    vector<bool> keep(n, true);
+    for (auto &cell : cells) {
+        std::stable_sort(cell.begin(), cell.end(), [&](unsigned a, unsigned b) {
+            return score[a] > score[b];
+        });
+        for (size_t i = cap; i < cell.size(); ++i) keep[cell[i]] = false;
+    }
+
+    vector<float> ex, ey, escore;
+    for (unsigned i = 0; i < n; ++i) {
+        if (!keep[i]) continue;
+        ex.push_back(x[i]);
+        ey.push_back(y[i]);
+        escore.push_back(score[i]);
+    }
+
+    ASSERT_LT(m, n);
+    ASSERT_EQ(ex.size(), m);
+    ASSERT_VEC_ARRAY_EQ(ex, dim4(m), kept.getX());
+    ASSERT_VEC_ARRAY_EQ(ey, dim4(m), kept.getY());
+    ASSERT_VEC_ARRAY_EQ(escore, dim4(m), kept.getScore());
+}
+
+TEST(FAST, GridCapAppliesLimitAfterCap) {
+    af::array img = fastTestImage();
+
+    // The limit of 8 features is below the number of corners, so each of the
+    // 4 cells keeps its 2 strongest instead of the scan stopping early
+    const unsigned rows = 2, cols = 2, cap = 100, limit = 8;
+    const float ratio = (limit - 0.5f) / img.elements();
+    af::features all  = af::fast(img, 20.f, 9, true, 1.f, 3, rows, cols, cap);
+    af::features kept = af::fast(img, 20.f, 9, true, ratio, 3, rows, cols, cap);
+
+    const unsigned n = all.getNumFeatures();
+    const unsigned m = kept.getNumFeatures();
+    ASSERT_GT(n, limit);
+    ASSERT_EQ(limit, m);
+
+    vector<float> x(n), y(n), score(n), kx(m), ky(m), kscore(m);
+    all.getX().host(x.data());
+    all.getY().host(y.data());
+    all.getScore().host(score.data());
+    kept.getX().host(kx.data());
+    kept.getY().host(ky.data());
+    kept.getScore().host(kscore.data());
+
+    auto cellOf = [&](float fx, float fy) {
+        unsigned r = std::min(unsigned(fy / (96.f / rows)), rows - 1);
+        unsigned c = std::min(unsigned(fx / (128.f / cols)), cols - 1);
+        return c * rows + r;
+    };
+
+    vector<vector<float>> expected(rows * cols), actual(rows * cols);
+    for (unsigned i = 0; i < n; ++i) {
+        expected[cellOf(x[i], y[i])].push_back(score[i]);
+    }
+    for (unsigned i = 0; i < m; ++i) {
+        actual[cellOf(kx[i], ky[i])].push_back(kscore[i]);
+    }
+    for (unsigned c = 0; c < rows * cols; ++c) {
+        std::sort(expected[c].rbegin(), expected[c].rend());
+        std::sort(actual[c].rbegin(), actual[c].rend());
+        ASSERT_GE(expected[c].size(), 2u);
+        expected[c].resize(2);
+        ASSERT_EQ(expected[c], actual[c]) << "cell " << c;
+    }
+}
+
+TEST(FAST, GridCapInvalidGrid) {
+    af::array img = fastTestImage();
+    af_features out;
+    ASSERT_EQ(AF_ERR_ARG,
+              af_fast_v2(&out, img.get(), 20.f, 9, true, 0.05f, 3, 0, 4, 2));
+    ASSERT_EQ(AF_ERR_ARG,
+              af_fast_v2(&out, img.get(), 20.f, 9, true, 0.05f, 3, 4, 0, 2));
+}
@@ -638,3 +638,87 @@ TEST(FFTConvolve2, Interleaved2) {
         ASSERT_EQ(max<double>(abs(c_ii - d)) < 1E-5, true);
     }
 }
+
+// Signals much longer than the filter are convolved in blocks on the CPU
+TEST(FFTConvolve1, LongSignal) {
+    array a = randu(20000, 2);
+    array b = randu(33);
+
+    array c = fftConvolve1(a, b, AF_CONV_EXPAND);
+    array d = convolve1(a, b, AF_CONV_EXPAND, AF_CONV_SPATIAL);
+    ASSERT_ARRAYS_NEAR(d, c, 1E-3);
+
+    c = fftConvolve1(a, b);
+    d = convolve1(a, b, AF_CONV_DEFAULT, AF_CONV_SPATIAL);
+    ASSERT_ARRAYS_NEAR(d, c, 1E-3);
+}
+
+TEST(FFTConvolve1, LongSignalManyFilters) {
+    array a = randu(20000);
+    array b = randu(40, 3);
+
+    array c = fftConvolve1(a, b);
+    for (int ii = 0; ii < 3; ii++) {
+        array d = convolve1(a, b(span, ii), AF_CONV_DEFAULT, AF_CONV_SPATIAL);
+        ASSERT_ARRAYS_NEAR(d, c(span, ii), 1E-3);
+    }
+}
+
+TEST(FFTConvolve1, LongSignalInt) {
+    array a = (randu(20000) * 100).as(s32);
+    array b = (randu(21) * 10).as(s32);
+
+    array c = fftConvolve1(a, b, AF_CONV_EXPAND);
+    array d = convolve1(a, b, AF_CONV_EXPAND, AF_CONV_SPATIAL);
+    ASSERT_ARRAYS_EQ(d, c);
+}
+
+TEST(FFTConvolve1Stream, MatchesWholeSignal) {
+    CPU_ONLY_CHECK("Streaming fftConvolve1");
+
+    array a    = randu(10000, 3, f64);
+    array b    = randu(65, f64);
+    array gold = fftConvolve1(a, b, AF_CONV_EXPAND);
+
+    const int bounds[] = {0, 1000, 1001, 4500, 4510, 10000};
+    array y, zf;
+    for (int ii = 0; ii < 5; ii++) {
+        array block = a(af::seq(bounds[ii], bounds[ii + 1] - 1), span);
+        fftConvolve1(y, zf, block, b, zf);
+        ASSERT_ARRAYS_NEAR(gold(af::seq(bounds[ii], bounds[ii + 1] - 1), span),
+                           y, 1E-9);
+    }
+    ASSERT_ARRAYS_NEAR(gold(af::seq(10000, 10063), span), zf, 1E-9);
+}
+
+TEST(FFTConvolve1Stream, ManyFilters) {
+    CPU_ONLY_CHECK("Streaming fftConvolve1");
+
+    array a = randu(3000);
+    array b = randu(10, 2);
+
+    array y, zf;
+    fftConvolve1(y, zf, a(af::seq(1499)), b);
+    array y2;
+    fftConvolve1(y2, zf, a(af::seq(1500, 2999)), b, zf);
+
+    for (int ii = 0; ii < 2; ii++) {
+        array gold = fftConvolve1(a, b(span, ii), AF_CONV_EXPAND);
+        ASSERT_ARRAYS_NEAR(gold(af::seq(1499)), y(span, ii), 1E-4);
+        ASSERT_ARRAYS_NEAR(gold(af::seq(1500, 2999)), y2(span, ii), 1E-4);
+        ASSERT_ARRAYS_NEAR(gold(af::seq(3000, 3008)), zf(span, ii), 1E-4);
+    }
+}
+
+TEST(FFTConvolve1Stream, InvalidArgs) {
+    array a = randu(100);
+    array b = randu(10);
+
+    af_array y = 0;
+    ASSERT_EQ(AF_ERR_ARG, af_fft_convolve1_stream(&y, 0, a.get(),
+                                                  randu(1).get(), 0));
+    ASSERT_EQ(AF_ERR_ARG, af_fft_convolve1_stream(&y, 0, a.as(s32).get(),
+                                                  b.as(s32).get(), 0));
+    ASSERT_EQ(AF_ERR_SIZE, af_fft_convolve1_stream(&y, 0, a.get(), b.get(),
+                                                   randu(8).get()));
+}
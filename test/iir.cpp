@@ -12,12 +12,15 @@
 #include <testHelpers.hpp>
 #include <af/dim4.hpp>
 #include <af/traits.hpp>
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
 using af::array;
 using af::cdouble;
 using af::cfloat;
+using af::constant;
 using af::convolve1;
 using af::dim4;
 using af::dtype;
@@ -25,7 +28,10 @@ using af::dtype_traits;
 using af::exception;
 using af::fir;
 using af::iir;
+using af::iirSos;
 using af::randu;
+using af::seq;
+using af::span;
 using std::string;
 using std::vector;
 
@@ -158,3 +164,138 @@ TYPED_TEST(filter, iirVecMat) {
 TYPED_TEST(filter, iirMatMat) {
     iirTest<TypeParam>(TEST_DIR "/iir/iir_mm.test");
 }
+
+template<typename T>
+array stableFeedback() {
+    const T a[] = {T(1), T(-0.5), T(0.1)};
+    return array(3, a);
+}
+
+template<typename T>
+void iirStateBlockTest(const dim_t n, const dim_t channels, const dim_t blk) {
+    SUPPORTED_TYPE_CHECK(T);
+    CPU_ONLY_CHECK("Stateful iir");
+    const dtype ty = (dtype)dtype_traits<T>::af_type;
+
+    array x = randu(n, channels, ty);
+    array b = randu(4, ty);
+    array a = stableFeedback<T>();
+
+    array gold = iir(b, a, x);
+
+    array y = constant(0, n, channels, ty);
+    array zi, zf;
+    for (dim_t i = 0; i < n; i += blk) {
+        const double end = static_cast<double>(std::min(i + blk, n) - 1);
+        array yb;
+        iir(yb, zf, b, a, x(seq(i, end), span), zi);
+        y(seq(i, end), span) = yb;
+        zi                   = zf;
+    }
+
+    ASSERT_EQ(zf.dims(), dim4(3, channels));
+    ASSERT_ARRAYS_NEAR(gold, y, 1e-4);
+}
+
+TYPED_TEST(filter, iirStateBlocks) {
+    iirStateBlockTest<TypeParam>(1000, 37, 64);
+}
+
+TYPED_TEST(filter, iirStateOneBlock) {
+    iirStateBlockTest<TypeParam>(500, 3, 500);
+}
+
+TEST(filter, iirStateInitial) {
+    CPU_ONLY_CHECK("Stateful iir");
+
+    // With zero input only the initial state decays, y[i] = 2 * 0.5^i
+    const float hb[] = {1.f};
+    const float ha[] = {1.f, -0.5f};
+    array b(1, hb);
+    array a(2, ha);
+    array x  = constant(0, 8);
+    array zi = constant(2, 1);
+
+    array y, zf;
+    iir(y, zf, b, a, x, zi);
+
+    vector<float> gold(8);
+    for (int i = 0; i < 8; ++i) { gold[i] = 2.f * std::pow(0.5f, i); }
+    ASSERT_VEC_ARRAY_NEAR(gold, dim4(8), y, 1e-6);
+    ASSERT_NEAR(2.f * std::pow(0.5f, 8), zf.scalar<float>(), 1e-6);
+}
+
+TEST(filter, iirStateInvalidStates) {
+    CPU_ONLY_CHECK("Stateful iir");
+
+    array b  = randu(3);
+    array a  = stableFeedback<float>();
+    array x  = randu(100, 4);
+    array zi = constant(0, 2, 3);
+
+    af_array y = 0;
+    ASSERT_EQ(AF_ERR_SIZE,
+              af_iir_state(&y, NULL, b.get(), a.get(), x.get(), zi.get()));
+}
+
+template<typename T>
+array testSections() {
+    const T h[] = {T(0.2), T(0.4),  T(0.2),  T(1), T(-0.6), T(0.2),
+                   T(0.5), T(-0.3), T(0.1),  T(2), T(0.4),  T(0.3)};
+    return array(6, 2, h);
+}
+
+TYPED_TEST(filter, iirSosCascade) {
+    SUPPORTED_TYPE_CHECK(TypeParam);
+    CPU_ONLY_CHECK("Stateful iir");
+    const dtype ty = (dtype)dtype_traits<TypeParam>::af_type;
+
+    array sos = testSections<TypeParam>();
+    array x   = randu(2000, 5, ty);
+
+    array gold = x;
+    for (int s = 0; s < 2; ++s) {
+        gold = iir(sos(seq(0, 2), s), sos(seq(3, 5), s), gold);
+    }
+
+    array y, zf;
+    iirSos(y, zf, sos, x);
+
+    ASSERT_EQ(zf.dims(), dim4(4, 5));
+    ASSERT_ARRAYS_NEAR(gold, y, 1e-4);
+}
+
+TYPED_TEST(filter, iirSosBlocks) {
+    SUPPORTED_TYPE_CHECK(TypeParam);
+    CPU_ONLY_CHECK("Stateful iir");
+    const dtype ty = (dtype)dtype_traits<TypeParam>::af_type;
+
+    array sos = testSections<TypeParam>();
+    array x   = randu(700, 20, ty);
+
+    array gold, zf;
+    iirSos(gold, zf, sos, x);
+
+    array y = constant(0, 700, 20, ty);
+    array zi;
+    for (dim_t i = 0; i < 700; i += 128) {
+        const dim_t stop = std::min<dim_t>(i + 128, 700);
+        const double end = static_cast<double>(stop - 1);
+        array yb;
+        iirSos(yb, zf, sos, x(seq(i, end), span), zi);
+        y(seq(i, end), span) = yb;
+        zi                   = zf;
+    }
+
+    ASSERT_ARRAYS_NEAR(gold, y, 1e-4);
+}
+
+TEST(filter, iirSosInvalidSections) {
+    CPU_ONLY_CHECK("Stateful iir");
+
+    array sos = randu(5, 2);
+    array x   = randu(100);
+
+    af_array y = 0;
+    ASSERT_EQ(AF_ERR_SIZE, af_iir_sos(&y, NULL, sos.get(), x.get(), 0));
+}
@@ -391,3 +391,131 @@ TEST(ImageIONative, SaveLoadImageNative16ColorCPP) {
 TEST(ImageIONative, SaveLoadImageNative16GrayCPP) {
     saveLoadImageNativeCPPTest<ushort>(dim4(24, 32, 1, 1));
 }
+
+////////////////////////////////// Batch //////////////////////////////////////
+
+using af::loadImages;
+using af::loadImagesMem;
+using af::saveImage;
+using af::saveImages;
+
+// Random 8-bit valued images that survive a lossless save/load round trip
+static array randomImages(const dim4 &dims) {
+    return af::floor(af::randu(dims) * 255.f);
+}
+
+static vector<string> batchNames(const unsigned count, const string &ext) {
+    vector<string> names;
+    for (unsigned i = 0; i < count; ++i) {
+        names.push_back(getTestName() + "_" + getBackendName() + "_" +
+                        std::to_string(i) + ext);
+    }
+    return names;
+}
+
+static vector<const char *> cstrings(const vector<string> &names) {
+    vector<const char *> out;
+    for (const string &name : names) { out.push_back(name.c_str()); }
+    return out;
+}
+
+TEST(ImageIOBatch, LoadImagesMatchesLoadImage) {
+    IMAGEIO_ENABLED_CHECK();
+
+    const string color = string(TEST_DIR "/imageio/color_seq.png");
+    const char *files[] = {color.c_str(), color.c_str(), color.c_str()};
+
+    for (bool isColor : {true, false}) {
+        array single = loadImage(color.c_str(), isColor);
+        array batch  = loadImages(files, 3, isColor);
+
+        ASSERT_EQ(dim4(single.dims(0), single.dims(1), isColor ? 3 : 1, 3),
+                  batch.dims());
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_ARRAYS_EQ(single, batch(span, span, span, i));
+        }
+    }
+}
+
+TEST(ImageIOBatch, SaveLoadImages) {
+    IMAGEIO_ENABLED_CHECK();
+
+    const unsigned count = 5;
+    array input          = randomImages(dim4(37, 53, 3, count));
+
+    vector<string> names           = batchNames(count, ".png");
+    vector<const char *> filenames = cstrings(names);
+    saveImages(filenames.data(), count, input);
+
+    ASSERT_ARRAYS_EQ(input, loadImages(filenames.data(), count, true));
+    for (unsigned i = 0; i < count; ++i) {
+        ASSERT_ARRAYS_EQ(input(span, span, span, i),
+                         loadImage(filenames[i], true));
+    }
+}
+
+TEST(ImageIOBatch, SaveLoadImagesGray) {
+    IMAGEIO_ENABLED_CHECK();
+
+    const unsigned count = 4;
+    array input          = randomImages(dim4(64, 33, 1, count));
+
+    vector<string> names           = batchNames(count, ".png");
+    vector<const char *> filenames = cstrings(names);
+    saveImages(filenames.data(), count, input);
+
+    ASSERT_ARRAYS_EQ(input, loadImages(filenames.data(), count, false));
+}
+
+TEST(ImageIOBatch, LoadImagesMem) {
+    IMAGEIO_ENABLED_CHECK();
+
+    const unsigned count = 3;
+    array input          = randomImages(dim4(20, 30, 3, count));
+
+    vector<void *> ptrs;
+    for (unsigned i = 0; i < count; ++i) {
+        ptrs.push_back(saveImageMem(input(span, span, span, i), AF_FIF_PNG));
+    }
+
+    vector<const void *> cptrs(ptrs.begin(), ptrs.end());
+    array loaded = loadImagesMem(cptrs.data(), count, true);
+
+    for (void *ptr : ptrs) { deleteImageMem(ptr); }
+
+    ASSERT_ARRAYS_EQ(input, loaded);
+}
+
+TEST(ImageIOBatch, LoadImagesSizeMismatch) {
+    IMAGEIO_ENABLED_CHECK();
+
+    vector<string> names = batchNames(2, ".png");
+    saveImage(names[0].c_str(), randomImages(dim4(10, 12, 3)));
+    saveImage(names[1].c_str(), randomImages(dim4(12, 10, 3)));
+
+    vector<const char *> filenames = cstrings(names);
+    af_array out                   = 0;
+    ASSERT_EQ(AF_ERR_SIZE, af_load_images(&out, filenames.data(), 2, true));
+    ASSERT_EQ(0, out);
+}
+
+TEST(ImageIOBatch, LoadImagesMissingFile) {
+    IMAGEIO_ENABLED_CHECK();
+
+    const string color   = string(TEST_DIR "/imageio/color_seq.png");
+    const string missing = string(TEST_DIR "/imageio/nofile.png");
+    const char *files[]  = {color.c_str(), missing.c_str()};
+
+    af_array out = 0;
+    ASSERT_EQ(AF_ERR_RUNTIME, af_load_images(&out, files, 2, true));
+}
+
+TEST(ImageIOBatch, SaveImagesCountMismatch) {
+    IMAGEIO_ENABLED_CHECK();
+
+    array input                    = randomImages(dim4(8, 8, 3, 2));
+    vector<string> names           = batchNames(3, ".png");
+    vector<const char *> filenames = cstrings(names);
+
+    ASSERT_EQ(AF_ERR_SIZE, af_save_images(filenames.data(), 3, input.get()));
+}
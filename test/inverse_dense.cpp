@@ -90,3 +90,28 @@ TYPED_TEST(Inverse, Square) {
 TYPED_TEST(Inverse, SquareMultiplePowerOfTwo) {
     inverseTester<TypeParam>(2048, 2048, eps<TypeParam>());
 }
+
+template<typename T>
+void inverseBatchTester(const int n, const int b2, const int b3, double eps) {
+    SUPPORTED_TYPE_CHECK(T);
+    LAPACK_ENABLED_CHECK();
+    CPU_ONLY_CHECK("Batched inverse");
+
+    // Diagonally dominant, so every slice is well conditioned
+    dtype ty = (dtype)dtype_traits<T>::af_type;
+    array I2 = identity(dim4(n, n, b2, b3), ty);
+    array A  = cpu_randu<T>(dim4(n, n, b2, b3)) + n * I2;
+
+    array IA = inverse(A);
+    array I  = matmul(A, IA);
+
+    ASSERT_ARRAYS_NEAR(I2, I, eps);
+}
+
+TYPED_TEST(Inverse, SquareBatch) {
+    inverseBatchTester<TypeParam>(4, 10, 3, eps<TypeParam>());
+}
+
+TYPED_TEST(Inverse, SquareLargeBatch) {
+    inverseBatchTester<TypeParam>(100, 3, 1, eps<TypeParam>());
+}
@@ -135,3 +135,73 @@ TYPED_TEST(IterativeDeconvolution, RichardsonLucyOnGrayscale) {
         string(TEST_DIR "/iterative_deconv/gray_100_50_lucy.test"), 100, 0.05,
         AF_ITERATIVE_DECONV_RICHARDSONLUCY);
 }
+
+// Landweber with a zero tolerance takes all iterations at once per frequency
+// instead of looping, so its results only match the loop within rounding
+// relative to the size of the image
+static void assertDeconvNear(const array &gold, const array &out) {
+    const float scale = max<float>(abs(gold));
+    ASSERT_ARRAYS_NEAR(gold, out, 1e-5f * scale);
+}
+
+TEST(IterativeDeconvolution, ZeroToleranceRunsAllIterations) {
+    array in  = randu(64, 48) * 255;
+    array ker = gaussianKernel(5, 5, 1.5, 1.5);
+
+    // A tolerance this small never stops the loop, so that run takes every
+    // iteration, and one iteration less gives a different image
+    const iterativeDeconvAlgo algos[] = {AF_ITERATIVE_DECONV_LANDWEBER,
+                                         AF_ITERATIVE_DECONV_RICHARDSONLUCY};
+    for (const iterativeDeconvAlgo algo : algos) {
+        const array all   = iterativeDeconv(in, ker, 20, 0.5, algo, 0.f);
+        const array loop  = iterativeDeconv(in, ker, 20, 0.5, algo, 1e-30f);
+        const array fewer = iterativeDeconv(in, ker, 19, 0.5, algo, 0.f);
+        assertDeconvNear(loop, all);
+        ASSERT_GT(max<float>(abs(all - fewer)), 1e-4f * max<float>(abs(all)));
+    }
+}
+
+TEST(IterativeDeconvolution, ToleranceStopsEarly) {
+    array in  = randu(64, 48) * 255;
+    array ker = gaussianKernel(5, 5, 1.5, 1.5);
+
+    // No iteration changes the estimate by more than its own size, so a
+    // tolerance of one stops right after the first iteration. Richardson-Lucy
+    // runs the same loop either way, so its images match exactly.
+    ASSERT_ARRAYS_EQ(
+        iterativeDeconv(in, ker, 1, 0.5, AF_ITERATIVE_DECONV_RICHARDSONLUCY),
+        iterativeDeconv(in, ker, 100, 0.5, AF_ITERATIVE_DECONV_RICHARDSONLUCY,
+                        1.f));
+    assertDeconvNear(
+        iterativeDeconv(in, ker, 1, 0.5, AF_ITERATIVE_DECONV_LANDWEBER),
+        iterativeDeconv(in, ker, 100, 0.5, AF_ITERATIVE_DECONV_LANDWEBER,
+                        1.f));
+}
+
+TEST(IterativeDeconvolution, DeltaKernelKeepsMagnitude) {
+    array in    = randu(64, 48) * 254 + 1;
+    array delta = constant(0, 3, 3);
+    delta(1, 1) = 1;
+
+    // Deblurring an image that is not blurred returns it unchanged, with no
+    // scale left over from the inverse transforms
+    const iterativeDeconvAlgo algos[] = {AF_ITERATIVE_DECONV_LANDWEBER,
+                                         AF_ITERATIVE_DECONV_RICHARDSONLUCY};
+    for (const iterativeDeconvAlgo algo : algos) {
+        ASSERT_ARRAYS_NEAR(in, iterativeDeconv(in, delta, 10, 0.5, algo),
+                           1e-2f);
+    }
+}
+
+TEST(IterativeDeconvolution, InvalidTolerance) {
+    array in     = randu(32, 32);
+    array ker    = gaussianKernel(3, 3);
+    af_array out = 0;
+    ASSERT_EQ(AF_ERR_ARG,
+              af_iterative_deconv_v2(&out, in.get(), ker.get(), 10, 0.5,
+                                     AF_ITERATIVE_DECONV_LANDWEBER, -1.f));
+    ASSERT_EQ(AF_ERR_ARG,
+              af_iterative_deconv_v2(&out, in.get(), ker.get(), 10, 0.5,
+                                     AF_ITERATIVE_DECONV_RICHARDSONLUCY,
+                                     af::NaN));
+}
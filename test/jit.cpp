@@ -34,6 +34,10 @@ using std::to_string;
 using std::tuple;
 using std::vector;
 
+namespace af {
+size_t getJitMergedNodes(void);
+}  // namespace af
+
 TEST(JIT, CPP_JIT_HASH) {
     const int num     = 20;
     const float valA  = 3;
@@ -132,6 +136,68 @@ TEST(JIT, CPP_Multi_linear) {
     ASSERT_VEC_ARRAY_EQ(goldy, dim4(num), y);
 }
 
+TEST(JIT, CPP_Multi_types_shapes) {
+    const int num = 1 << 12;
+    array a       = randu(num, 3);
+    array b       = randu(num, 3);
+    array c       = randu(17, 2);
+    array x       = a * b;
+    array mask    = x > 0.25;
+    array y       = c * 2;
+    eval(x, mask, y);
+
+    vector<float> ha(a.elements());
+    vector<float> hb(b.elements());
+    vector<float> hc(c.elements());
+    a.host(&ha[0]);
+    b.host(&hb[0]);
+    c.host(&hc[0]);
+
+    vector<float> goldx(ha.size());
+    vector<char> goldmask(ha.size());
+    vector<float> goldy(hc.size());
+    for (size_t i = 0; i < ha.size(); i++) {
+        goldx[i]    = ha[i] * hb[i];
+        goldmask[i] = goldx[i] > 0.25f;
+    }
+    for (size_t i = 0; i < hc.size(); i++) { goldy[i] = hc[i] * 2; }
+
+    ASSERT_VEC_ARRAY_EQ(goldx, dim4(num, 3), x);
+    ASSERT_VEC_ARRAY_EQ(goldmask, dim4(num, 3), mask);
+    ASSERT_VEC_ARRAY_EQ(goldy, dim4(17, 2), y);
+}
+
+TEST(JIT, CommonSubexpressions) {
+    const int num = 1 << 12;
+    array x       = randu(num, 2);
+    array y       = randu(num, 2);
+    eval(x, y);
+    af::sync();
+    const size_t merged = af::getJitMergedNodes();
+
+    // Structurally equal sub-trees built separately, next to ones that only
+    // differ in a scalar or an operand
+    array out = (x - 0.5) * (x - 0.5) + (x - 0.25) * (y - 0.5);
+    out.eval();
+
+    vector<float> hx(x.elements());
+    vector<float> hy(y.elements());
+    x.host(&hx[0]);
+    y.host(&hy[0]);
+
+    vector<float> gold(hx.size());
+    for (size_t i = 0; i < hx.size(); i++) {
+        gold[i] =
+            (hx[i] - 0.5f) * (hx[i] - 0.5f) + (hx[i] - 0.25f) * (hy[i] - 0.5f);
+    }
+    ASSERT_VEC_ARRAY_NEAR(gold, dim4(num, 2), out, 1e-6);
+
+    // Only the CPU backend merges nodes
+    if (af::getActiveBackend() == AF_BACKEND_CPU) {
+        EXPECT_LT(merged, af::getJitMergedNodes());
+    }
+}
+
 TEST(JIT, CPP_gforSet_strided) {
     const int num = 1024;
     gforSet(true);
@@ -236,6 +236,55 @@ TYPED_TEST(LU, RectangularMultipleOfTwoLarge1) {
     luTester<TypeParam>(512, 1024, eps<TypeParam>());
 }
 
+template<typename T>
+void luBatchTester(const int m, const int n, const int b2, const int b3,
+                   double eps) {
+    SUPPORTED_TYPE_CHECK(T);
+    LAPACK_ENABLED_CHECK();
+    CPU_ONLY_CHECK("Batched LU");
+
+    array a_orig = cpu_randu<T>(dim4(m, n, b2, b3));
+
+    array l, u, pivot;
+    lu(l, u, pivot, a_orig);
+
+    array out = a_orig.copy();
+    array pivot2;
+    luInPlace(pivot2, out, false);
+
+    ASSERT_EQ(count<uint>(pivot == pivot2), pivot.elements());
+
+    int mn = std::min(m, n);
+    ASSERT_ARRAYS_NEAR(l, lower(out, true)(span, seq(mn), span, span), eps);
+    ASSERT_ARRAYS_NEAR(u, upper(out, false)(seq(mn), span, span, span), eps);
+
+    array a_recon = matmul(l, u);
+    for (int j = 0; j < b3; ++j) {
+        for (int i = 0; i < b2; ++i) {
+            array a_slice = a_orig(span, span, i, j);
+            array p       = pivot(span, span, i, j);
+            array a_perm  = a_slice(p, span);
+            ASSERT_ARRAYS_NEAR(a_recon(span, span, i, j), a_perm, eps);
+        }
+    }
+}
+
+TYPED_TEST(LU, SquareBatch) {
+    luBatchTester<TypeParam>(4, 4, 10, 3, eps<TypeParam>());
+}
+
+TYPED_TEST(LU, RectangularBatch0) {
+    luBatchTester<TypeParam>(7, 5, 9, 1, eps<TypeParam>());
+}
+
+TYPED_TEST(LU, RectangularBatch1) {
+    luBatchTester<TypeParam>(5, 7, 9, 1, eps<TypeParam>());
+}
+
+TYPED_TEST(LU, SquareLargeBatch) {
+    luBatchTester<TypeParam>(100, 100, 3, 1, eps<TypeParam>());
+}
+
 TEST(LU, NullLowerOutput) {
     LAPACK_ENABLED_CHECK();
     dim4 dims(3, 3);
@@ -12,11 +12,15 @@
 #include <testHelpers.hpp>
 #include <af/dim4.hpp>
 #include <af/traits.hpp>
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
 using af::array;
 using af::dim4;
+using af::randu;
+using af::seq;
 using af::dtype_traits;
 using af::exception;
 using std::cout;
@@ -123,6 +127,135 @@ TEST(MatchTemplate, InvalidMatchType) {
     ASSERT_SUCCESS(af_release_array(tArray));
 }
 
+// Metric of every window computed on the host, with the window zero padded
+// past the image
+vector<double> matchReference(const vector<float> &img, const dim4 &sDims,
+                              const vector<float> &tpl, const dim4 &tDims,
+                              const af_match_type mType) {
+    const dim_t s0 = sDims[0], s1 = sDims[1];
+    const dim_t t0 = tDims[0], t1 = tDims[1];
+    const double n = static_cast<double>(t0 * t1);
+
+    double tMean = 0.0;
+    for (float v : tpl) { tMean += v; }
+    tMean /= n;
+
+    vector<double> out(s0 * s1);
+    for (dim_t sj = 0; sj < s1; ++sj) {
+        for (dim_t si = 0; si < s0; ++si) {
+            auto pixel = [&](dim_t i, dim_t j) {
+                const bool in = si + i < s0 && sj + j < s1;
+                return in ? double(img[(sj + j) * s0 + si + i]) : 0.0;
+            };
+            double wMean = 0.0;
+            for (dim_t j = 0; j < t1; ++j) {
+                for (dim_t i = 0; i < t0; ++i) { wMean += pixel(i, j); }
+            }
+            wMean /= n;
+
+            double acc = 0.0, wNorm = 0.0, tNorm = 0.0;
+            for (dim_t j = 0; j < t1; ++j) {
+                for (dim_t i = 0; i < t0; ++i) {
+                    const double s = pixel(i, j);
+                    const double t = tpl[j * t0 + i];
+                    double d       = 0.0;
+                    switch (mType) {
+                        case AF_SSD: d = s - t; break;
+                        case AF_ZSSD: d = s - wMean - t + tMean; break;
+                        case AF_LSSD: d = s - wMean / tMean * t; break;
+                        case AF_NCC:
+                            acc += s * t;
+                            wNorm += s * s;
+                            tNorm += t * t;
+                            break;
+                        case AF_ZNCC:
+                            acc += (s - wMean) * (t - tMean);
+                            wNorm += (s - wMean) * (s - wMean);
+                            tNorm += (t - tMean) * (t - tMean);
+                            break;
+                        default: break;
+                    }
+                    acc += d * d;
+                }
+            }
+            if (mType == AF_NCC || mType == AF_ZNCC) {
+                const double norm = std::sqrt(wNorm * tNorm);
+                acc               = norm > 0.0 ? acc / norm : 0.0;
+            }
+            out[sj * s0 + si] = acc;
+        }
+    }
+    return out;
+}
+
+void matchAgainstReference(const dim4 &sDims, const dim4 &tDims,
+                           const af_match_type mType) {
+    const array img = randu(sDims);
+    const array tpl = randu(tDims) + 0.5;
+
+    vector<float> hImg(sDims.elements()), hTpl(tDims.elements());
+    img.host(hImg.data());
+    tpl.host(hTpl.data());
+    const vector<double> gold =
+        matchReference(hImg, sDims, hTpl, tDims, mType);
+
+    vector<float> out(sDims.elements());
+    matchTemplate(img, tpl, mType).host(out.data());
+
+    double scale = 1.0;
+    for (double v : gold) { scale = std::max(scale, std::fabs(v)); }
+    for (size_t i = 0; i < gold.size(); ++i) {
+        ASSERT_NEAR(gold[i], out[i], 1e-4 * scale) << "at index " << i;
+    }
+}
+
+// Large templates take the FFT path on the CPU backend
+TEST(MatchTemplate, LargeTemplateSSD) {
+    matchAgainstReference(dim4(100, 80), dim4(31, 29), AF_SSD);
+}
+
+TEST(MatchTemplate, LargeTemplateZSSD) {
+    matchAgainstReference(dim4(100, 80), dim4(31, 29), AF_ZSSD);
+}
+
+TEST(MatchTemplate, LargeTemplateLSSD) {
+    matchAgainstReference(dim4(100, 80), dim4(31, 29), AF_LSSD);
+}
+
+TEST(MatchTemplate, SmallTemplateNCC) {
+    CPU_ONLY_CHECK("Matching by NCC and ZNCC");
+    matchAgainstReference(dim4(40, 30), dim4(5, 4), AF_NCC);
+}
+
+TEST(MatchTemplate, SmallTemplateZNCC) {
+    CPU_ONLY_CHECK("Matching by NCC and ZNCC");
+    matchAgainstReference(dim4(40, 30), dim4(5, 4), AF_ZNCC);
+}
+
+TEST(MatchTemplate, LargeTemplateNCC) {
+    CPU_ONLY_CHECK("Matching by NCC and ZNCC");
+    matchAgainstReference(dim4(100, 80), dim4(31, 29), AF_NCC);
+}
+
+TEST(MatchTemplate, LargeTemplateZNCC) {
+    CPU_ONLY_CHECK("Matching by NCC and ZNCC");
+    matchAgainstReference(dim4(100, 80), dim4(31, 29), AF_ZNCC);
+}
+
+TEST(MatchTemplate, ZNCCFindsTemplate) {
+    CPU_ONLY_CHECK("Matching by NCC and ZNCC");
+    const array img = randu(128, 96);
+    const array tpl = img(seq(40, 79), seq(23, 54));
+
+    const array out = matchTemplate(img, tpl, AF_ZNCC);
+
+    float value    = 0.0f;
+    unsigned index = 0;
+    af::max(&value, &index, af::flat(out));
+    ASSERT_NEAR(1.0f, value, 1e-4f);
+    ASSERT_EQ(40u + 23u * 128u, index);
+}
+
 ///////////////////////////////// CPP TESTS /////////////////////////////
 //
 TEST(MatchTemplate, CPP) {
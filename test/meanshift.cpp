@@ -172,3 +172,44 @@ TEST(Meanshift, GFOR) {
         ASSERT_LT(max<double>(abs(c_ii - b_ii)), 1E-5);
     }
 }
+
+using af::mean;
+
+TEST(Meanshift, BinnedMatchesExact) {
+    CPU_ONLY_CHECK("Binned mean shift");
+    array clean;
+    array in     = noisyStep(dim4(96, 64), clean, 8.f);
+    array exact  = meanShift(in, 3.f, 30.f, 5, false, AF_MEANSHIFT_EXACT);
+    array binned = meanShift(in, 3.f, 30.f, 5, false, AF_MEANSHIFT_BINNED);
+
+    ASSERT_EQ(in.dims(), binned.dims());
+    EXPECT_LT(mean<float>(abs(exact - binned)), 1.f);
+    EXPECT_LT(mean<float>(abs(binned - clean)),
+              0.5f * mean<float>(abs(in - clean)));
+}
+
+TEST(Meanshift, BinnedColorAndBatch) {
+    CPU_ONLY_CHECK("Binned mean shift");
+    array clean;
+    array in = noisyStep(dim4(48, 32, 3, 2), clean, 8.f).as(u8);
+    array exact =
+        meanShift(in, 2.f, 30.f, 4, true, AF_MEANSHIFT_EXACT).as(f32);
+    array binned =
+        meanShift(in, 2.f, 30.f, 4, true, AF_MEANSHIFT_BINNED).as(f32);
+
+    ASSERT_EQ(u8,
+              meanShift(in, 2.f, 30.f, 1, true, AF_MEANSHIFT_BINNED).type());
+    ASSERT_EQ(in.dims(), binned.dims());
+    EXPECT_LT(mean<float>(abs(exact - binned)), 1.f);
+}
+
+TEST(Meanshift, InvalidMethod) {
+    af_array in  = 0;
+    af_array out = 0;
+    dim_t dims[] = {10, 10};
+    ASSERT_SUCCESS(af_randu(&in, 2, dims, f32));
+    ASSERT_EQ(AF_ERR_ARG,
+              af_mean_shift_v2(&out, in, 2.f, 20.f, 3, false,
+                               static_cast<af_meanshift_method>(42)));
+    ASSERT_SUCCESS(af_release_array(in));
+}
@@ -0,0 +1,216 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <gtest/gtest.h>
+#include <testHelpers.hpp>
+#include <af/algorithm.h>
+#include <af/arith.h>
+#include <af/array.h>
+#include <af/backend.h>
+#include <af/random.h>
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+
+using af::array;
+using af::randu;
+using af::sum;
+using std::ifstream;
+using std::istringstream;
+using std::set;
+using std::string;
+using std::stringstream;
+
+namespace {
+
+const char *const kTracePath   = "profiler_trace.json";
+const char *const kSummaryPath = "profiler_summary.txt";
+
+/// Body of the death test. The profiler reads AF_PROFILE on the first call
+/// into ArrayFire, so it is set here, in the child process, before any call.
+/// The trace and the summary are written by the exit handler of the child.
+void profiledCalls() {
+#if defined(_WIN32)
+    _putenv_s("AF_PROFILE", kTracePath);
+#else
+    setenv("AF_PROFILE", kTracePath, 1);
+#endif
+    if (!std::freopen(kSummaryPath, "w", stderr)) { std::exit(1); }
+
+    array x = randu(1000, 4);
+    array y = (x - 0.5) * (x - 0.5) + x;
+    y.eval();
+    if (sum<float>(y) <= 0) { std::exit(1); }
+    std::exit(0);
+}
+
+string readFile(const char *path) {
+    ifstream file(path);
+    stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+bool isSpace(char c) { return std::isspace(static_cast<unsigned char>(c)); }
+bool isDigit(char c) { return std::isdigit(static_cast<unsigned char>(c)); }
+
+/// Checks the JSON syntax of a document and collects the values of the "cat"
+/// members of its objects
+class JsonChecker {
+    const string &text_;
+    size_t pos_ = 0;
+
+    void skipSpace() {
+        while (pos_ < text_.size() && isSpace(text_[pos_])) { ++pos_; }
+    }
+
+    bool consume(char c) {
+        skipSpace();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool stringValue(string *out) {
+        if (!consume('"')) { return false; }
+        for (; pos_ < text_.size(); ++pos_) {
+            const char c = text_[pos_];
+            if (c == '"') {
+                ++pos_;
+                return true;
+            }
+            if (c == '\\') { ++pos_; }
+            if (out && pos_ < text_.size()) { *out += text_[pos_]; }
+        }
+        return false;
+    }
+
+    bool numberValue() {
+        const size_t start = pos_;
+        if (text_[pos_] == '-') { ++pos_; }
+        while (pos_ < text_.size() &&
+               (isDigit(text_[pos_]) || text_[pos_] == '.' ||
+                text_[pos_] == 'e' || text_[pos_] == 'E' ||
+                text_[pos_] == '+' || text_[pos_] == '-')) {
+            ++pos_;
+        }
+        return pos_ > start && isDigit(text_[pos_ - 1]);
+    }
+
+    bool literal(const char *word) {
+        const string w(word);
+        if (text_.compare(pos_, w.size(), w) != 0) { return false; }
+        pos_ += w.size();
+        return true;
+    }
+
+    bool object() {
+        if (!consume('{')) { return false; }
+        if (consume('}')) { return true; }
+        do {
+            string key;
+            skipSpace();
+            if (!stringValue(&key) || !consume(':')) { return false; }
+            skipSpace();
+            if (key == "cat" && pos_ < text_.size() && text_[pos_] == '"') {
+                string category;
+                if (!stringValue(&category)) { return false; }
+                categories.insert(category);
+            } else if (!value()) {
+                return false;
+            }
+        } while (consume(','));
+        return consume('}');
+    }
+
+    bool arrayValue() {
+        if (!consume('[')) { return false; }
+        if (consume(']')) { return true; }
+        do {
+            if (!value()) { return false; }
+        } while (consume(','));
+        return consume(']');
+    }
+
+   public:
+    set<string> categories;
+
+    explicit JsonChecker(const string &text) : text_(text) {}
+
+    bool value() {
+        skipSpace();
+        if (pos_ >= text_.size()) { return false; }
+        switch (text_[pos_]) {
+            case '{': return object();
+            case '[': return arrayValue();
+            case '"': return stringValue(nullptr);
+            case 't': return literal("true");
+            case 'f': return literal("false");
+            case 'n': return literal("null");
+            default: return numberValue();
+        }
+    }
+
+    bool document() {
+        if (!value()) { return false; }
+        skipSpace();
+        return pos_ == text_.size();
+    }
+};
+
+/// Categories of the rows of the summary table that starts at \p title
+set<string> summaryCategories(const string &summary, size_t title) {
+    set<string> out;
+    istringstream lines(summary.substr(title));
+    string line;
+    std::getline(lines, line);  // Title
+    std::getline(lines, line);  // Header
+    while (std::getline(lines, line)) {
+        istringstream fields(line);
+        string category;
+        if (fields >> category) { out.insert(category); }
+    }
+    return out;
+}
+
+}  // namespace
+
+// No ArrayFire call is made before the death test, so that the child starts
+// with the profiler not yet initialized
+TEST(Profiler, TraceAndSummary) {
+    EXPECT_EXIT(profiledCalls(), ::testing::ExitedWithCode(0), "");
+
+    const string trace   = readFile(kTracePath);
+    const string summary = readFile(kSummaryPath);
+    std::remove(kTracePath);
+    std::remove(kSummaryPath);
+
+    JsonChecker checker(trace);
+    ASSERT_TRUE(checker.document()) << trace;
+
+    const size_t title = summary.find("ArrayFire profile summary");
+    ASSERT_NE(string::npos, title) << summary;
+    const set<string> rows = summaryCategories(summary, title);
+    EXPECT_EQ(1u, checker.categories.count("api"));
+    EXPECT_EQ(1u, rows.count("api")) << summary;
+
+    // Queue tasks and JIT evaluations are only recorded by the CPU backend
+    if (af::getActiveBackend() != AF_BACKEND_CPU) { return; }
+    EXPECT_EQ(1u, checker.categories.count("queue"));
+    EXPECT_EQ(1u, checker.categories.count("jit"));
+    EXPECT_EQ(1u, rows.count("queue")) << summary;
+    EXPECT_EQ(1u, rows.count("jit")) << summary;
+}
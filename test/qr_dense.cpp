@@ -180,6 +180,51 @@ TYPED_TEST(QR, RectangularMultipleOfTwoLarge1) {
     qrTester<TypeParam>(512, 1024, eps<TypeParam>());
 }
 
+template<typename T>
+void qrBatchTester(const int m, const int n, const int batch, double eps) {
+    SUPPORTED_TYPE_CHECK(T);
+    LAPACK_ENABLED_CHECK();
+    CPU_ONLY_CHECK("Batched QR");
+
+    array in = cpu_randu<T>(dim4(m, n, batch));
+
+    array q, r, tau;
+    qr(q, r, tau, in);
+
+    array qq = matmul(q, q.H());
+    ASSERT_ARRAYS_NEAR(identity(qq.dims(), qq.type()), qq, eps);
+    ASSERT_ARRAYS_NEAR(in, matmul(q, r), eps);
+
+    array out = in.copy();
+    array tau2;
+    qrInPlace(tau2, out);
+    ASSERT_ARRAYS_NEAR(tau, tau2, eps);
+    ASSERT_ARRAYS_NEAR(r, upper(out), eps);
+
+    for (int i = 0; i < batch; ++i) {
+        array sq, sr, stau;
+        qr(sq, sr, stau, in(af::span, af::span, i));
+        ASSERT_ARRAYS_NEAR(sq, q(af::span, af::span, i), eps);
+        ASSERT_ARRAYS_NEAR(sr, r(af::span, af::span, i), eps);
+    }
+}
+
+TYPED_TEST(QR, SquareBatch) {
+    qrBatchTester<TypeParam>(5, 5, 12, eps<TypeParam>());
+}
+
+TYPED_TEST(QR, RectangularBatch0) {
+    qrBatchTester<TypeParam>(7, 4, 9, eps<TypeParam>());
+}
+
+TYPED_TEST(QR, RectangularBatch1) {
+    qrBatchTester<TypeParam>(4, 7, 9, eps<TypeParam>());
+}
+
+TYPED_TEST(QR, SquareLargeBatch) {
+    qrBatchTester<TypeParam>(100, 100, 3, eps<TypeParam>());
+}
+
 TEST(QR, InPlaceNullOutput) {
     LAPACK_ENABLED_CHECK();
     dim4 dims(3, 3);
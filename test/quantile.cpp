@@ -0,0 +1,239 @@
+/*******************************************************
+ * Copyright (c) 2026, ArrayFire
+ * All rights reserved.
+ *
+ * This file is distributed under 3-clause BSD license.
+ * The complete license agreement can be obtained at:
+ * http://arrayfire.com/licenses/BSD-3-Clause
+ ********************************************************/
+
+#include <gtest/gtest.h>
+#include <testHelpers.hpp>
+#include <af/array.h>
+#include <af/data.h>
+#include <af/dim4.hpp>
+#include <af/random.h>
+#include <af/statistics.h>
+#include <af/traits.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+using af::array;
+using af::dim4;
+using af::dtype;
+using af::dtype_traits;
+using af::quantile;
+using std::vector;
+
+template<typename T>
+class Quantile : public ::testing::Test {};
+
+typedef ::testing::Types<float, double, int, uint, short, ushort, uchar>
+    TestTypes;
+TYPED_TEST_SUITE(Quantile, TestTypes);
+
+template<typename T>
+array generate(const dim4 dims) {
+    dtype ty = (dtype)dtype_traits<T>::af_type;
+    if (std::is_floating_point<T>::value) { return af::randu(dims, ty); }
+    // Small integers make sure there are repeated values
+    return (af::randu(dims) * 100).as(ty);
+}
+
+// Quantile of the sorted values in col
+double reference(const vector<double> &col, const double p,
+                 const af_quantile_method method) {
+    const double pos = p * (col.size() - 1);
+    const size_t lo  = static_cast<size_t>(std::floor(pos));
+    const size_t hi  = static_cast<size_t>(std::ceil(pos));
+    switch (method) {
+        case AF_QUANTILE_LOWER: return col[lo];
+        case AF_QUANTILE_HIGHER: return col[hi];
+        case AF_QUANTILE_NEAREST:
+            return col[static_cast<size_t>(std::nearbyint(pos))];
+        case AF_QUANTILE_MIDPOINT: return (col[lo] + col[hi]) / 2;
+        default: return col[lo] + (col[hi] - col[lo]) * (pos - lo);
+    }
+}
+
+template<typename T>
+void quantileTest(const dim4 dims, const int dim, const vector<double> &probs,
+                  const af_quantile_method method) {
+    SUPPORTED_TYPE_CHECK(T);
+    typedef typename std::conditional<std::is_same<T, double>::value, double,
+                                      float>::type To;
+
+    array in = generate<T>(dims);
+    array p(probs.size(), &probs.front());
+
+    array out = quantile(in, p, dim, method);
+
+    dim4 odims = dims;
+    odims[dim] = probs.size();
+
+    vector<T> h_in(in.elements());
+    in.host(&h_in.front());
+
+    dim_t stride[4] = {1, dims[0], dims[0] * dims[1],
+                       dims[0] * dims[1] * dims[2]};
+    dim4 cols       = dims;
+    cols[dim]       = 1;
+
+    vector<To> gold(odims.elements());
+    for (dim_t l = 0; l < cols[3]; ++l) {
+        for (dim_t k = 0; k < cols[2]; ++k) {
+            for (dim_t j = 0; j < cols[1]; ++j) {
+                for (dim_t i = 0; i < cols[0]; ++i) {
+                    const dim_t off = i * stride[0] + j * stride[1] +
+                                      k * stride[2] + l * stride[3];
+                    vector<double> col(dims[dim]);
+                    for (dim_t n = 0; n < dims[dim]; ++n) {
+                        col[n] = h_in[off + n * stride[dim]];
+                    }
+                    std::sort(col.begin(), col.end());
+
+                    dim_t idx[4] = {i, j, k, l};
+                    for (size_t q = 0; q < probs.size(); ++q) {
+                        idx[dim] = q;
+                        const dim_t o =
+                            idx[0] +
+                            odims[0] *
+                                (idx[1] +
+                                 odims[1] * (idx[2] + odims[2] * idx[3]));
+                        gold[o] =
+                            static_cast<To>(reference(col, probs[q], method));
+                    }
+                }
+            }
+        }
+    }
+
+    ASSERT_EQ((af_dtype)dtype_traits<To>::af_type, out.type());
+    ASSERT_VEC_ARRAY_NEAR(gold, odims, out, 1e-5);
+}
+
+const vector<double> testProbs = {0.0, 0.1, 0.25, 0.5, 0.75, 0.9, 1.0};
+
+TYPED_TEST(Quantile, Dim0Linear) {
+    quantileTest<TypeParam>(dim4(101, 6, 2, 2), 0, testProbs,
+                            AF_QUANTILE_LINEAR);
+}
+
+TYPED_TEST(Quantile, Dim1Lower) {
+    quantileTest<TypeParam>(dim4(35, 40, 3), 1, testProbs, AF_QUANTILE_LOWER);
+}
+
+TYPED_TEST(Quantile, Dim2Higher) {
+    quantileTest<TypeParam>(dim4(5, 7, 24, 2), 2, testProbs,
+                            AF_QUANTILE_HIGHER);
+}
+
+TYPED_TEST(Quantile, Dim3Nearest) {
+    quantileTest<TypeParam>(dim4(9, 3, 2, 30), 3, testProbs,
+                            AF_QUANTILE_NEAREST);
+}
+
+TYPED_TEST(Quantile, Dim1Midpoint) {
+    quantileTest<TypeParam>(dim4(17, 64), 1, testProbs, AF_QUANTILE_MIDPOINT);
+}
+
+TYPED_TEST(Quantile, SingleProbability) {
+    quantileTest<TypeParam>(dim4(1000, 4), 0, {0.3}, AF_QUANTILE_LINEAR);
+}
+
+TYPED_TEST(Quantile, SingleValue) {
+    quantileTest<TypeParam>(dim4(1, 20), 0, testProbs, AF_QUANTILE_LINEAR);
+}
+
+TEST(Quantile, AllMethods) {
+    const af_quantile_method methods[] = {
+        AF_QUANTILE_LINEAR, AF_QUANTILE_LOWER, AF_QUANTILE_HIGHER,
+        AF_QUANTILE_NEAREST, AF_QUANTILE_MIDPOINT};
+    for (const af_quantile_method m : methods) {
+        quantileTest<float>(dim4(10, 33), 0, testProbs, m);
+        quantileTest<float>(dim4(10, 33), 1, testProbs, m);
+    }
+}
+
+TEST(Quantile, DefaultIsLinear) {
+    array in = af::randu(50, 3);
+    array p  = af::constant(0.37, 1);
+    ASSERT_ARRAYS_EQ(quantile(in, p, 0, AF_QUANTILE_LINEAR), quantile(in, p));
+}
+
+TEST(Quantile, FirstNonSingletonDim) {
+    array in  = af::randu(1, 50);
+    array p   = af::constant(0.5, 1);
+    array out = quantile(in, p);
+    ASSERT_EQ(dim4(1, 1), out.dims());
+    ASSERT_ARRAYS_EQ(af::median(in, 1), out);
+}
+
+TEST(Quantile, MatchesMedian) {
+    array in = af::randu(64, 9);
+    array p  = af::constant(0.5, 1);
+    ASSERT_ARRAYS_EQ(af::median(in, 0),
+                     quantile(in, p, 0, AF_QUANTILE_MIDPOINT));
+}
+
+TEST(Quantile, Snippet) {
+    array in = af::randu(100, 4);
+
+    //! [ex_quantile]
+    // Quartiles of every column
+    float h_probs[] = {0.25f, 0.5f, 0.75f};
+    array probs(3, h_probs);
+    array quartiles = quantile(in, probs, 0);  // 3x4
+    //! [ex_quantile]
+
+    ASSERT_EQ(dim4(3, 4), quartiles.dims());
+}
+
+TEST(Quantile, Empty) {
+    array in  = array(dim4(0, 4));
+    array p   = af::constant(0.5, 2);
+    array out = quantile(in, p, 0);
+    ASSERT_EQ(dim4(2, 4), out.dims());
+}
+
+TEST(Quantile, InvalidProbability) {
+    array in     = af::randu(10, 4);
+    af_array out = 0;
+
+    array above = af::constant(1.5, 1);
+    ASSERT_EQ(AF_ERR_ARG, af_quantile(&out, in.get(), above.get(), 0,
+                                      AF_QUANTILE_LINEAR));
+
+    array below = af::constant(-0.1, 1);
+    ASSERT_EQ(AF_ERR_ARG, af_quantile(&out, in.get(), below.get(), 0,
+                                      AF_QUANTILE_LINEAR));
+
+    array integer = af::constant(0, 1, s32);
+    ASSERT_EQ(AF_ERR_ARG, af_quantile(&out, in.get(), integer.get(), 0,
+                                      AF_QUANTILE_LINEAR));
+
+    array matrix = af::constant(0.5, 2, 2);
+    ASSERT_EQ(AF_ERR_SIZE, af_quantile(&out, in.get(), matrix.get(), 0,
+                                       AF_QUANTILE_LINEAR));
+}
+
+TEST(Quantile, InvalidDim) {
+    array in     = af::randu(10, 4);
+    array p      = af::constant(0.5, 1);
+    af_array out = 0;
+    ASSERT_EQ(AF_ERR_ARG,
+              af_quantile(&out, in.get(), p.get(), 4, AF_QUANTILE_LINEAR));
+    ASSERT_EQ(AF_ERR_ARG,
+              af_quantile(&out, in.get(), p.get(), 0, (af_quantile_method)9));
+}
+
+TEST(Quantile, ComplexInput) {
+    array in     = af::randu(10, 4, c32);
+    array p      = af::constant(0.5, 1);
+    af_array out = 0;
+    ASSERT_EQ(AF_ERR_TYPE,
+              af_quantile(&out, in.get(), p.get(), 0, AF_QUANTILE_LINEAR));
+}
@@ -2397,3 +2397,20 @@ TEST(Reduce, SNIPPET_algorithm_func_sum) {
     ASSERT_VEC_ARRAY_EQ(gold_a, d.dims(), d);
     ASSERT_VEC_ARRAY_EQ(gold_a, e.dims(), e);
 }
+
+TEST(Reduce, JITInput) {
+    array a = randu(301, 7, 3, 2);
+    array b = randu(300, 7, 3, 2);
+
+    // The sub-array makes the tree read a strided buffer
+    array expr = a(af::seq(1, af::end), af::span) * b + 0.5;
+    array gold = expr.copy();
+    gold.eval();
+
+    for (int dim = 0; dim < 4; ++dim) {
+        ASSERT_ARRAYS_EQ(sum(gold, dim), sum(expr, dim));
+        ASSERT_ARRAYS_EQ(max(gold, dim), max(expr, dim));
+    }
+    ASSERT_EQ(sum<float>(gold), sum<float>(expr));
+    ASSERT_EQ(count<unsigned>(gold > 1), count<unsigned>(expr > 1));
+}
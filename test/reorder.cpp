@@ -13,6 +13,7 @@
 #include <af/defines.h>
 #include <af/dim4.hpp>
 #include <af/traits.hpp>
+#include <algorithm>
 #include <complex>
 #include <iostream>
 #include <string>
@@ -198,3 +199,34 @@ TEST(Reorder, InputArrayUnchanged) {
     array input_gold(2, 3, 2, h_input);
     ASSERT_ARRAYS_EQ(input_gold, input);
 }
+
+TEST(Reorder, CPPAllPermutations) {
+    // Odd sizes so that the blocked paths have partial blocks and tiles
+    const dim4 idims(37, 11, 5, 3);
+    vector<float> h_input(idims.elements());
+    for (size_t i = 0; i < h_input.size(); ++i) { h_input[i] = (float)i; }
+    array input(idims, &h_input.front());
+
+    unsigned perm[4] = {0, 1, 2, 3};
+    do {
+        array output = reorder(input, perm[0], perm[1], perm[2], perm[3]);
+
+        const dim4 odims(idims[perm[0]], idims[perm[1]], idims[perm[2]],
+                         idims[perm[3]]);
+        vector<float> gold(idims.elements());
+        for (dim_t iIdx = 0; iIdx < (dim_t)idims.elements(); ++iIdx) {
+            dim_t ids[4];
+            dim_t rem = iIdx;
+            for (int d = 0; d < 4; ++d) {
+                ids[d] = rem % idims[d];
+                rem /= idims[d];
+            }
+            dim_t oIdx = 0;
+            for (int d = 3; d >= 0; --d) {
+                oIdx = oIdx * odims[d] + ids[perm[d]];
+            }
+            gold[oIdx] = h_input[iIdx];
+        }
+        ASSERT_VEC_ARRAY_EQ(gold, odims, output);
+    } while (std::next_permutation(perm, perm + 4));
+}
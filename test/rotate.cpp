@@ -198,3 +198,37 @@ TEST(Rotate, CPP) {
     // Delete
     delete[] outData;
 }
+
+TEST(Rotate, BilinearCosine) {
+    const array in    = af::randu(48, 40);
+    const float theta = 0.4f;
+
+    // Rotation about the center, with the matrix rounded to three decimals
+    // as the backends do
+    const float c  = std::cos(-theta);
+    const float s  = std::sin(-theta);
+    const float m  = 0.5f * (48 - 1);
+    const float n  = 0.5f * (40 - 1);
+    const float tx = -((m * c + n * -s) - m);
+    const float ty = -((m * s + n * c) - n);
+    const auto r3  = [](const float v) {
+        return std::round(v * 1000) / 1000.0f;
+    };
+
+    const array x    = af::range(dim4(48, 40), 0);
+    const array y    = af::range(dim4(48, 40), 1);
+    const array mapX = x * r3(c) + y * r3(-s) + r3(tx);
+    const array mapY = x * r3(s) + y * r3(c) + r3(ty);
+
+    const array gold = bilinearCosine(in, mapX, mapY);
+    const array edge = af::isNaN(gold);
+    ASSERT_GT(af::count<int>(!edge), 48 * 40 / 2);
+
+    const array out = rotate(in, theta, true, AF_INTERP_BILINEAR_COSINE);
+    ASSERT_ARRAYS_NEAR(af::select(edge, 0.0, gold), af::select(edge, 0.0, out),
+                       1e-4);
+
+    // The smoothing changes the result of plain bilinear interpolation
+    const array linear = rotate(in, theta, true, AF_INTERP_BILINEAR);
+    ASSERT_GT(af::max<float>(af::abs(out - linear)), 1e-2f);
+}
@@ -16,6 +16,7 @@
 #include <testHelpers.hpp>
 #include <af/algorithm.h>
 #include <af/arith.h>
+#include <af/backend.h>
 #include <af/blas.h>
 #include <af/defines.h>
 #include <af/device.h>
@@ -231,6 +232,10 @@ TYPED_TEST(Solve, SquareMultipleOfTwoLargeBatch) {
     solveTester<TypeParam>(2048, 2048, 32, 10, eps<TypeParam>());
 }
 
+TYPED_TEST(Solve, SquareSmallBatch) {
+    solveTester<TypeParam>(4, 4, 3, 100, eps<TypeParam>());
+}
+
 TYPED_TEST(Solve, LeastSquaresUnderDetermined) {
     solveTester<TypeParam>(80, 100, 20, 1, eps<TypeParam>());
 }
@@ -277,6 +282,32 @@ TYPED_TEST(Solve, LUMultipleOfTwoLarge) {
     solveLUTester<TypeParam>(2048, 512, eps<TypeParam>());
 }
 
+template<typename T>
+void solveLUBatchTester(const int n, const int k, const int batch,
+                        double eps) {
+    SUPPORTED_TYPE_CHECK(T);
+    LAPACK_ENABLED_CHECK();
+    CPU_ONLY_CHECK("Batched solveLU");
+
+    array A  = cpu_randu<T>(dim4(n, n, batch));
+    array X0 = cpu_randu<T>(dim4(n, k, batch));
+    array B0 = matmul(A, X0);
+
+    array A_lu, pivot;
+    lu(A_lu, pivot, A);
+    array X1 = solveLU(A_lu, pivot, B0);
+
+    ASSERT_ARRAYS_NEAR(B0, matmul(A, X1), eps);
+}
+
+TYPED_TEST(Solve, LUBatch) {
+    solveLUBatchTester<TypeParam>(6, 3, 50, eps<TypeParam>());
+}
+
+TYPED_TEST(Solve, LULargeBatch) {
+    solveLUBatchTester<TypeParam>(100, 10, 3, eps<TypeParam>());
+}
+
 TYPED_TEST(Solve, TriangleUpper) {
     solveTriangleTester<TypeParam>(100, 10, true, eps<TypeParam>());
 }
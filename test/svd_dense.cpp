@@ -10,6 +10,7 @@
 #include <arrayfire.h>
 #include <gtest/gtest.h>
 #include <testHelpers.hpp>
+#include <af/backend.h>
 #include <af/defines.h>
 #include <af/dim4.hpp>
 #include <af/traits.hpp>
@@ -24,6 +25,7 @@ using af::cfloat;
 using af::dim4;
 using af::dtype;
 using af::dtype_traits;
+using af::identity;
 using af::iota;
 using af::randu;
 using af::seq;
@@ -166,3 +168,47 @@ TEST(svd, InPlaceRect0_Exception) {
     array u, s, v;
     EXPECT_THROW(svdInPlace(u, s, v, in), af::exception);
 }
+
+template<typename T>
+void svdBatchTest(const int M, const int N, const int batch) {
+    SUPPORTED_TYPE_CHECK(T);
+    LAPACK_ENABLED_CHECK();
+    CPU_ONLY_CHECK("Batched svd");
+
+    dtype ty = (dtype)dtype_traits<T>::af_type;
+
+    array A = randu(M, N, batch, ty);
+
+    array U, S, Vt;
+    af::svd(U, S, Vt, A);
+
+    const int MN = std::min(M, N);
+    ASSERT_EQ(dim4(MN, 1, batch), S.dims());
+    ASSERT_EQ(dim4(M, M, batch), U.dims());
+    ASSERT_EQ(dim4(N, N, batch), Vt.dims());
+
+    for (int i = 0; i < batch; ++i) {
+        array a  = A(span, span, i);
+        array u  = U(span, span, i);
+        array s  = S(span, 0, i);
+        array vt = Vt(span, span, i);
+
+        array AA = matmul(u(span, seq(MN)), diag(s, 0, false).as(ty),
+                          vt(seq(MN), span));
+        ASSERT_ARRAYS_NEAR(a, AA, 1E-3);
+        ASSERT_ARRAYS_NEAR(identity(M, M, ty), matmul(u.H(), u), 1E-3);
+        ASSERT_ARRAYS_NEAR(identity(N, N, ty), matmul(vt, vt.H()), 1E-3);
+
+        array uu, ss, vv;
+        af::svd(uu, ss, vv, a);
+        ASSERT_ARRAYS_NEAR(ss, s, 1E-3);
+    }
+}
+
+TYPED_TEST(svd, SquareBatch) { svdBatchTest<TypeParam>(4, 4, 20); }
+
+TYPED_TEST(svd, RectBatch0) { svdBatchTest<TypeParam>(7, 3, 20); }
+
+TYPED_TEST(svd, RectBatch1) { svdBatchTest<TypeParam>(3, 7, 20); }
+
+TYPED_TEST(svd, LargeBatch) { svdBatchTest<TypeParam>(80, 70, 2); }
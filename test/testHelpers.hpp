@@ -19,6 +19,7 @@
 #pragma GCC diagnostic pop
 #endif
 #include <af/array.h>
+#include <af/backend.h>
 #include <af/defines.h>
 #include <af/dim4.hpp>
 #include <af/traits.hpp>
@@ -245,6 +246,12 @@ bool noHalfTests(af::dtype ty);
 #define LAPACK_ENABLED_CHECK() \
     if (!af::isLAPACKAvailable()) GTEST_SKIP() << "LAPACK Not Configured."
 
+/// Skips the tests of features that only the CPU backend implements.
+/// \p feature names the feature in the skip message.
+#define CPU_ONLY_CHECK(feature)                   \
+    if (af::getActiveBackend() != AF_BACKEND_CPU) \
+    GTEST_SKIP() << feature << " is only supported on CPU"
+
 #define IMAGEIO_ENABLED_CHECK() \
     if (!af::isImageIOAvailable()) GTEST_SKIP() << "Image IO Not Configured"
 
@@ -267,6 +274,18 @@ af_err conv_image(af_array *out, af_array in);
 template<typename T>
 af::array cpu_randu(const af::dim4 dims);
 
+/// Two flat regions, split along dimension 0, with gaussian noise of
+/// standard deviation \p noise added. The noiseless image is returned in
+/// \p clean. Edge preserving filters must keep the step between the regions.
+af::array noisyStep(const af::dim4 &dims, af::array &clean, const float noise);
+
+/// Samples the 2D image \p in at the positions (\p xs, \p ys) with bilinear
+/// interpolation of cosine smoothed fractions, as AF_INTERP_BILINEAR_COSINE
+/// does. Positions outside of [0, dim - 1), where the backends handle the
+/// edges differently, are NaN.
+af::array bilinearCosine(const af::array &in, const af::array &xs,
+                         const af::array &ys);
+
 void cleanSlate();
 
 //********** arrayfire custom test asserts ***********
@@ -250,6 +250,33 @@ TEST(Threading, MemoryManagement_JIT_Node) {
     ASSERT_EQ(lock_bytes, 0u);
 }
 
+TEST(Threading, HandlesReleasedOnOtherThread) {
+    // Handles and JIT nodes are pooled per thread. Hand them over to the
+    // main thread so that they are released on a different thread.
+    vector<vector<array>> results(THREAD_COUNT);
+    vector<std::thread> tests;
+
+    for (int t = 0; t < THREAD_COUNT; ++t) {
+        tests.emplace_back([t, &results] {
+            setDevice(0);
+            for (int i = 0; i < 100; ++i) {
+                array a = constant(t, 10, 10);
+                results[t].push_back(a * 2 + i);
+            }
+        });
+    }
+
+    for (int t = 0; t < THREAD_COUNT; ++t)
+        if (tests[t].joinable()) tests[t].join();
+
+    for (int t = 0; t < THREAD_COUNT; ++t) {
+        for (int i = 0; i < 100; i += 33) {
+            ASSERT_ARRAYS_EQ(constant(2 * t + i, 10, 10), results[t][i]);
+        }
+        results[t].clear();
+    }
+}
+
 template<typename inType, typename outType, bool isInverse>
 void fftTest(int targetDevice, string pTestFile, dim_t pad0 = 0, dim_t pad1 = 0,
              dim_t pad2 = 0) {
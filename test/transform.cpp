@@ -13,6 +13,7 @@
 #include <af/dim4.hpp>
 #include <af/traits.hpp>
 #include <iostream>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -620,3 +621,141 @@ TEST(TransformBatching, CPP) {
         }
     }
 }
+
+// Coefficients of an inverse affine transform whose positions never land
+// exactly on the edges of a 48x40 image
+static const float remapTf[] = {0.8f, 0.3f, -2.15f, -0.25f, 0.9f, 4.37f};
+
+static void affineMaps(array &mapX, array &mapY, const dim_t odim0,
+                       const dim_t odim1) {
+    const array x = af::range(dim4(odim0, odim1), 0);
+    const array y = af::range(dim4(odim0, odim1), 1);
+    mapX = x * remapTf[0] + y * remapTf[1] + remapTf[2];
+    mapY = x * remapTf[3] + y * remapTf[4] + remapTf[5];
+}
+
+TEST(Transform, BilinearCosine) {
+    const array in = af::randu(48, 40);
+    const array tf(3, 2, remapTf);
+    array mapX, mapY;
+    affineMaps(mapX, mapY, 50, 45);
+
+    const array gold = bilinearCosine(in, mapX, mapY);
+    const array edge = af::isNaN(gold);
+    ASSERT_GT(af::count<int>(!edge), 50 * 45 / 2);
+
+    const array out =
+        transform(in, tf, 50, 45, AF_INTERP_BILINEAR_COSINE, true);
+    ASSERT_ARRAYS_NEAR(af::select(edge, 0.0, gold), af::select(edge, 0.0, out),
+                       1e-4);
+
+    // The smoothing changes the result of plain bilinear interpolation
+    const array linear = transform(in, tf, 50, 45, AF_INTERP_BILINEAR, true);
+    ASSERT_GT(af::max<float>(af::abs(out - linear)), 1e-2f);
+}
+
+TEST(Remap, MatchesTransform) {
+    CPU_ONLY_CHECK("remap");
+
+    const array in = af::randu(48, 40);
+    const array tf(3, 2, remapTf);
+    array mapX, mapY;
+    affineMaps(mapX, mapY, 50, 45);
+
+    const af_interp_type methods[] = {AF_INTERP_BILINEAR,
+                                      AF_INTERP_BILINEAR_COSINE,
+                                      AF_INTERP_BICUBIC,
+                                      AF_INTERP_BICUBIC_SPLINE};
+    for (const af_interp_type method : methods) {
+        const array gold = transform(in, tf, 50, 45, method, true);
+        const array out  = remap(in, mapX, mapY, method);
+        ASSERT_ARRAYS_NEAR(gold, out, 1e-3) << "for method " << method;
+    }
+}
+
+TEST(Remap, BilinearCosine) {
+    CPU_ONLY_CHECK("remap");
+
+    const array in = af::randu(48, 40);
+    array mapX, mapY;
+    affineMaps(mapX, mapY, 50, 45);
+
+    const array gold = bilinearCosine(in, mapX, mapY);
+    const array edge = af::isNaN(gold);
+    const array out  = remap(in, mapX, mapY, AF_INTERP_BILINEAR_COSINE);
+    ASSERT_ARRAYS_NEAR(af::select(edge, 0.0, gold), af::select(edge, 0.0, out),
+                       1e-4);
+}
+
+TEST(Remap, Batch) {
+    CPU_ONLY_CHECK("remap");
+
+    const array in = af::randu(48, 40, 3);
+    array mapX, mapY;
+    affineMaps(mapX, mapY, 50, 45);
+
+    const array out = remap(in, mapX, mapY, AF_INTERP_BICUBIC);
+    ASSERT_EQ(dim4(50, 45, 3), out.dims());
+    for (int k = 0; k < 3; ++k) {
+        const array gold =
+            remap(in(af::span, af::span, k), mapX, mapY, AF_INTERP_BICUBIC);
+        ASSERT_ARRAYS_EQ(gold, out(af::span, af::span, k));
+    }
+}
+
+TEST(Remap, MismatchedMaps) {
+    const array in = af::randu(48, 40);
+    array mapX, mapY;
+    affineMaps(mapX, mapY, 50, 45);
+
+    af_array out = 0;
+    ASSERT_EQ(AF_ERR_SIZE, af_remap(&out, in.get(), mapX.get(),
+                                    mapY(af::seq(49), af::span).get(),
+                                    AF_INTERP_BILINEAR));
+}
+
+TEST(Remap, DoubleMaps) {
+    const array in = af::randu(48, 40);
+    array mapX, mapY;
+    affineMaps(mapX, mapY, 50, 45);
+    const array mapX64 = mapX.as(f64);
+    const array mapY64 = mapY.as(f64);
+
+    af_array out = 0;
+    ASSERT_EQ(AF_ERR_ARG, af_remap(&out, in.get(), mapX64.get(), mapY64.get(),
+                                   AF_INTERP_BILINEAR));
+}
+
+// 8 and 16 bit images are interpolated in fixed point on the CPU, which
+// should stay within rounding of the floating point result
+template<typename T>
+static void fixedPointTest(const af_interp_type method, const double tol) {
+    const double maxVal = static_cast<double>(std::numeric_limits<T>::max());
+    const array in =
+        (af::randu(48, 40) * maxVal).as((af_dtype)dtype_traits<T>::af_type);
+    const array tf(3, 2, remapTf);
+
+    const array gold = af::clamp(
+        af::round(transform(in.as(f32), tf, 50, 45, method, true)), 0.0,
+        maxVal);
+    const array out = transform(in, tf, 50, 45, method, true).as(f32);
+    ASSERT_ARRAYS_NEAR(gold, out, tol);
+}
+
+TEST(TransformFixedPoint, UcharBilinear) {
+    fixedPointTest<uchar>(AF_INTERP_BILINEAR, 1.0);
+}
+
+TEST(TransformFixedPoint, UcharBilinearCosine) {
+    fixedPointTest<uchar>(AF_INTERP_BILINEAR_COSINE, 1.0);
+}
+
+TEST(TransformFixedPoint, UcharBicubic) {
+    CPU_ONLY_CHECK("Rounding bicubic results of integer images");
+    fixedPointTest<uchar>(AF_INTERP_BICUBIC, 1.0);
+}
+
+TEST(TransformFixedPoint, UshortBicubic) {
+    CPU_ONLY_CHECK("Rounding bicubic results of integer images");
+    fixedPointTest<ushort>(AF_INTERP_BICUBIC, 32.0);
+}
@@ -285,3 +285,25 @@ TEST(Transpose, SNIPPET_blas_func_transpose) {
 
     ASSERT_VEC_ARRAY_EQ(gold_b, b.dims(), b);
 }
+
+TEST(Transpose, CPPLargeOddRectangleBatch) {
+    // Larger than one block of the CPU kernel along both sides, with partial
+    // blocks and tiles at the edges
+    const dim4 dims(517, 301, 2);
+    vector<float> h_in(dims.elements());
+    for (size_t i = 0; i < h_in.size(); ++i) { h_in[i] = (float)i; }
+
+    array input(dims, &h_in.front());
+    array output = transpose(input);
+
+    vector<float> gold(dims.elements());
+    for (dim_t k = 0; k < dims[2]; ++k) {
+        for (dim_t j = 0; j < dims[1]; ++j) {
+            for (dim_t i = 0; i < dims[0]; ++i) {
+                gold[(k * dims[0] + i) * dims[1] + j] =
+                    h_in[(k * dims[1] + j) * dims[0] + i];
+            }
+        }
+    }
+    ASSERT_VEC_ARRAY_EQ(gold, dim4(dims[1], dims[0], dims[2]), output);
+}
@@ -80,3 +80,15 @@ void transposeInPlaceCPPTest() {
 
     ASSERT_ARRAYS_EQ(input, output);
 }
+
+TEST(Transpose, CPPInPlaceConjugate) {
+    // Spans several blocks and a partial one, so that the blocks off the
+    // diagonal are swapped in pairs and the diagonal is conjugated too
+    dim4 dims(131, 131, 2, 1);
+
+    array input  = randu(dims, c32);
+    array output = transpose(input, true);
+    transposeInPlace(input, true);
+
+    ASSERT_ARRAYS_EQ(output, input);
+}
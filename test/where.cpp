@@ -136,3 +136,11 @@ TEST(Where, ISSUE_1259) {
     array indices = where(a > 2);
     ASSERT_EQ(indices.elements(), 0);
 }
+
+TEST(Where, JITInput) {
+    array a    = randu(301, 7, 3);
+    array expr = a(af::seq(1, af::end), af::span) * 2 > 1;
+    array gold = expr.copy();
+    gold.eval();
+    ASSERT_ARRAYS_EQ(where(gold), where(expr));
+}